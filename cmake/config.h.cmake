@@ -40,6 +40,7 @@
 #cmakedefine HAVE_GETOPT_H 1
 #cmakedefine HAVE_INTTYPES_H 1
 #cmakedefine HAVE_LIBGEN_H 1
+#cmakedefine HAVE_LINUX_IO_URING_H 1
 #cmakedefine HAVE_LIMITS_H 1
 #cmakedefine PATH_MAX @PATH_MAX@
 #cmakedefine NAME_MAX @NAME_MAX@
@@ -279,6 +279,11 @@ orc_diskrep_from_record (THREAD_ENTRY * thread_p, RECDES * record)
       or_att->default_value.value = NULL;
       att->classoid = or_att->classoid;
 
+      /* column statistics are gathered by update statistics */
+      att->ndv = 0;
+      att->hist_length = 0;
+      att->histogram = NULL;
+
       /* initialize B+tree statistics information */
 
       n_btstats = att->n_btstats = or_att->n_btids;
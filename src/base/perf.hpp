@@ -464,7 +464,7 @@ namespace cubperf
   template<bool IsAtomic>
   generic_statset<IsAtomic>::generic_statset (std::size_t value_count)
     : m_value_count (value_count)
-    , m_values (new generic_value<IsAtomic>[m_value_count])
+    , m_values (new generic_value<IsAtomic>[m_value_count] ())
     , m_timept (clock::now ())
   {
     //
@@ -39,6 +39,7 @@
 #if !defined(SERVER_MODE)
 #include "memory_alloc.h"
 #include "server_interface.h"
+#include "monitor_definition.hpp"
 #endif /* !SERVER_MODE */
 #include "thread_worker_pool.hpp"
 #if defined (SERVER_MODE)
@@ -81,6 +82,8 @@
 #include "vacuum.h"
 #include "xasl_cache.h"
 #include "load_worker_manager.hpp"
+#include "monitor_collect.hpp"
+#include "monitor_registration.hpp"
 
 #if defined (SERVER_MODE)
 #include "connection_error.h"
@@ -130,6 +133,7 @@ static int f_load_Time_get_oldest_mvcc_acquire_time (void);
 static int f_load_Count_get_oldest_mvcc_retry (void);
 static int f_load_thread_stats (void);
 static int f_load_thread_daemon_stats (void);
+static int f_load_latency_histogram (void);
 
 static void f_dump_in_file_Num_data_page_fix_ext (FILE *, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_data_page_promote_ext (FILE *, const UINT64 * stat_vals);
@@ -143,6 +147,8 @@ static void f_dump_in_file_Time_obj_lock_acquire_time (FILE *, const UINT64 * st
 static void f_dump_in_file_thread_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_thread_daemon_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_dwb_flushed_block_volumes (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_latency_histogram (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_count_histogram (FILE *, const UINT64 * stat_vals);
 
 static void f_dump_in_buffer_Num_data_page_fix_ext (char **, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_data_page_promote_ext (char **, const UINT64 * stat_vals, int *remaining_size);
@@ -156,6 +162,8 @@ static void f_dump_in_buffer_Time_obj_lock_acquire_time (char **, const UINT64 *
 static void f_dump_in_buffer_thread_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_thread_daemon_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_vals, int *remaining_size);
+static void f_dump_in_buffer_latency_histogram (char **s, const UINT64 * stat_vals, int *remaining_size);
+static void f_dump_in_buffer_count_histogram (char **s, const UINT64 * stat_vals, int *remaining_size);
 
 static void perfmon_stat_dump_in_file_fix_page_array_stat (FILE *, const UINT64 * stats_ptr);
 static void perfmon_stat_dump_in_file_promote_page_array_stat (FILE *, const UINT64 * stats_ptr);
@@ -180,6 +188,11 @@ static void perfmon_stat_dump_in_buffer_page_fix_time_array_stat (const UINT64 *
 static void perfmon_stat_dump_in_buffer_snapshot_array_stat (const UINT64 * stats_ptr, char **s, int *remaining_size);
 static void perfmon_stat_dump_in_buffer_thread_stats (const UINT64 * stats_ptr, char **s, int *remaining_size);
 static void perfmon_stat_dump_in_buffer_thread_daemon_stats (const UINT64 * stats_ptr, char **s, int *remaining_size);
+static void perfmon_stat_dump_in_buffer_latency_histogram (const UINT64 * stats_ptr, const char **summary_names,
+							   char **s, int *remaining_size);
+static void perfmon_stat_dump_in_file_latency_histogram (FILE * stream, const UINT64 * stats_ptr,
+							 const char **summary_names);
+static void perfmon_latency_histogram_summary (const UINT64 * stats_ptr, UINT64 * summary);
 
 static void perfmon_print_timer_to_file (FILE * stream, int stat_index, UINT64 * stats_ptr);
 static void perfmon_print_timer_to_buffer (char **s, int stat_index, UINT64 * stats_ptr, int *remained_size);
@@ -202,6 +215,7 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_FILE_IOSYNC_ALL, "file_iosync_all"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_PAGE_ALLOCS, "Num_file_page_allocs"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_PAGE_DEALLOCS, "Num_file_page_deallocs"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_DWB_HELPER_IOSYNCHES, "Num_file_dwb_helper_iosynches"),
 
   /* Page buffer basic module */
   /* Execution statistics for the page buffer manager */
@@ -210,6 +224,10 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_IOREADS, "Num_data_page_ioreads"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_IOWRITES, "Num_data_page_iowrites"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_FLUSHED, "Num_data_page_flushed"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_READ_AHEAD, "Num_data_page_read_ahead"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_HITS, "Num_data_page_read_ahead_hits"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_READ_AHEAD_WASTED, "Num_data_page_read_ahead_wasted"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_LOCK_FREE_READ_FIX, "Num_data_page_lock_free_read_fix"),
   /* peeked stats */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_PRIVATE_QUOTA, "Num_data_page_private_quota"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_PRIVATE_COUNT, "Num_data_page_private_count"),
@@ -231,6 +249,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_WALS, "Num_log_wals"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_REPLACEMENTS_IOWRITES, "Num_log_page_iowrites_for_replacement"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_REPLACEMENTS, "Num_log_page_replacements"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_REDO_RECORDS, "Num_log_redo_records"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_LOG_REDO_RECORDS_PER_SEC, "Num_log_redo_records_per_sec"),
 
   /* Execution statistics for the lock manager */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_ACQUIRED_ON_PAGES, "Num_page_locks_acquired"),
@@ -292,6 +312,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_METHSCANS, "Num_query_methscans"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_NLJOINS, "Num_query_nljoins"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_MJOINS, "Num_query_mjoins"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_HJOINS, "Num_query_hjoins"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_HJOIN_SPILLS, "Num_query_hjoin_spills"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_QM_NUM_OBJFETCHES, "Num_query_objfetches"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_QM_NUM_HOLDABLE_CURSORS, "Num_query_holdable_cursors"),
 
@@ -330,6 +352,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES, "Num_vacuum_log_pages_to_vacuum"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES, "Num_vacuum_prefetch_requests_log_pages"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES, "Num_vacuum_prefetch_hits_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_SPLIT_JOBS, "Num_vacuum_split_jobs"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_HELPER_SUBJOBS, "Num_vacuum_helper_subjobs"),
 
   /* Track heap modify counters. */
   /* Make a complex entry for heap stats */
@@ -435,6 +459,7 @@ PSTAT_METADATA pstat_Metadata[] = {
 
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_TIME_COUNTERS, "Time_get_snapshot_acquire_time"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS, "Count_get_snapshot_retry"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS, "Count_get_snapshot_reuse"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_TRAN_COMPLETE_TIME_COUNTERS, "Time_tran_complete_time"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_OLDEST_MVCC_TIME_COUNTERS, "compute_oldest_visible"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_OLDEST_MVCC_RETRY_COUNTERS, "Count_get_oldest_mvcc_retry"),
@@ -601,7 +626,41 @@ PSTAT_METADATA pstat_Metadata[] = {
 			       &f_dump_in_buffer_Num_dwb_flushed_block_volumes,
 			       &f_load_Num_dwb_flushed_block_volumes),
   PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOAD_THREAD_STATS, "Thread_loaddb_stats_counters_timers",
-			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats)
+			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_PAGE_FIX_WAIT_LATENCY, "Time_page_fix_wait_latency",
+			       &f_dump_in_file_latency_histogram, &f_dump_in_buffer_latency_histogram,
+			       &f_load_latency_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOCK_WAIT_LATENCY, "Time_lock_wait_latency",
+			       &f_dump_in_file_latency_histogram, &f_dump_in_buffer_latency_histogram,
+			       &f_load_latency_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOG_FLUSH_LATENCY, "Time_log_flush_latency",
+			       &f_dump_in_file_latency_histogram, &f_dump_in_buffer_latency_histogram,
+			       &f_load_latency_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_QUERY_EXEC_LATENCY, "Time_query_exec_latency",
+			       &f_dump_in_file_latency_histogram, &f_dump_in_buffer_latency_histogram,
+			       &f_load_latency_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_CONN_REACTOR_LOOP_LATENCY, "Time_conn_reactor_loop_latency",
+			       &f_dump_in_file_latency_histogram, &f_dump_in_buffer_latency_histogram,
+			       &f_load_latency_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOG_GROUP_COMMIT_LATENCY, "Time_log_group_commit_latency",
+			       &f_dump_in_file_latency_histogram, &f_dump_in_buffer_latency_histogram,
+			       &f_load_latency_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOG_GROUP_COMMIT_BATCH_SIZE, "Num_log_group_commit_batch_size",
+			       &f_dump_in_file_count_histogram, &f_dump_in_buffer_count_histogram,
+			       &f_load_latency_histogram)
+};
+
+static_assert (PERF_LATENCY_HISTOGRAM_CNT == cubmonitor::HISTOGRAM_BUCKET_COUNT,
+	       "PERF_LATENCY_HISTOGRAM_CNT must match cubmonitor::HISTOGRAM_BUCKET_COUNT");
+
+/* Summary values of a latency histogram, in dump order. */
+#define PERF_LATENCY_SUMMARY_CNT 6
+static const char *perfmon_Latency_summary_names[PERF_LATENCY_SUMMARY_CNT] = {
+  "Num", "P50 (usec)", "P90 (usec)", "P99 (usec)", "P999 (usec)", "Max (usec)"
+};
+/* Summary names of histograms that count amounts instead of durations, see perfmon_count_histogram. */
+static const char *perfmon_Count_summary_names[PERF_LATENCY_SUMMARY_CNT] = {
+  "Num", "P50", "P90", "P99", "P999", "Max"
 };
 
 STATIC_INLINE void perfmon_add_stat_at_offset (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, const int offset,
@@ -612,6 +671,7 @@ static void perfmon_server_calc_stats (UINT64 * stats);
 STATIC_INLINE const char *perfmon_stat_module_name (const int module) __attribute__ ((ALWAYS_INLINE));
 #if defined (SERVER_MODE) || defined (SA_MODE)
 STATIC_INLINE int perfmon_get_module_type (THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
+static void perfmon_register_latency_histograms (void);
 #endif
 STATIC_INLINE const char *perfmon_stat_page_type_name (const int page_type) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE const char *perfmon_stat_page_mode_name (const int page_mode) __attribute__ ((ALWAYS_INLINE));
@@ -1296,6 +1356,80 @@ perfmon_db_flushed_block_volumes (THREAD_ENTRY * thread_p, int num_volumes)
     }
   perfmon_add_stat_at_offset (thread_p, PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES, offset, 1);
 }
+
+/* Latency histograms are shared by all transactions; they are collected outside transaction sheets and copied into
+ * the global statistics when these are peeked. */
+// *INDENT-OFF*
+static cubmonitor::time_histogram_statistic perfmon_Latency_histograms[PERF_LATENCY_COUNT];
+// *INDENT-ON*
+static const PERF_STAT_ID perfmon_Latency_stat_ids[PERF_LATENCY_COUNT] = {
+  PSTAT_PAGE_FIX_WAIT_LATENCY, PSTAT_LOCK_WAIT_LATENCY, PSTAT_LOG_FLUSH_LATENCY, PSTAT_QUERY_EXEC_LATENCY,
+  PSTAT_CONN_REACTOR_LOOP_LATENCY, PSTAT_LOG_GROUP_COMMIT_LATENCY, PSTAT_LOG_GROUP_COMMIT_BATCH_SIZE
+};
+static const char *perfmon_Latency_monitor_names[PERF_LATENCY_COUNT] = {
+  "page_fix_wait", "lock_wait", "log_flush", "query_exec", "conn_reactor_loop", "log_group_commit",
+  "log_group_commit_batch"
+};
+
+/*
+ *   perfmon_time_latency - add a latency to its histogram
+ *   return: none
+ *   type(in): latency histogram
+ *   latency_usec(in): latency in microseconds
+ */
+void
+perfmon_time_latency (PERF_LATENCY_TYPE type, UINT64 latency_usec)
+{
+  assert (type >= 0 && type < PERF_LATENCY_COUNT);
+
+  if (!perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM))
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  std::chrono::microseconds latency (latency_usec);
+  perfmon_Latency_histograms[type].collect (std::chrono::duration_cast<cubmonitor::time_rep> (latency));
+  // *INDENT-ON*
+}
+
+/*
+ *   perfmon_count_histogram - add an amount to its histogram
+ *   return: none
+ *   type(in): latency histogram that counts amounts
+ *   amount(in): amount
+ *
+ *   note: the amount is collected as a duration of as many microseconds, so that the summary of the histogram reads
+ *	   as amounts
+ */
+void
+perfmon_count_histogram (PERF_LATENCY_TYPE type, UINT64 amount)
+{
+  perfmon_time_latency (type, amount);
+}
+
+/*
+ *   perfmon_register_latency_histograms - register latency histograms to global monitor
+ *   return: none
+ */
+static void
+perfmon_register_latency_histograms (void)
+{
+  static bool is_registered = false;
+  int type;
+
+  if (is_registered)
+    {
+      return;
+    }
+
+  for (type = 0; type < PERF_LATENCY_COUNT; type++)
+    {
+      perfmon_Latency_histograms[type].register_to_monitor (cubmonitor::get_global_monitor (),
+							    perfmon_Latency_monitor_names[type]);
+    }
+  is_registered = true;
+}
 #endif /* SERVER_MODE || SA_MODE */
 
 int
@@ -2904,6 +3038,111 @@ perfmon_stat_dump_in_file_flushed_block_volumes_array_stat (FILE * stream, const
     }
 }
 
+/*
+ * perfmon_latency_histogram_summary () - compute the summary of a latency histogram
+ *
+ * stats_ptr(in): latency histogram buckets, in nanoseconds
+ * summary(out): PERF_LATENCY_SUMMARY_CNT values: count, then 50th, 90th, 99th and 99.9th percentiles and max in
+ *		 microseconds
+ *
+ * note: percentiles and max are upper bounds of histogram buckets
+ */
+static void
+perfmon_latency_histogram_summary (const UINT64 * stats_ptr, UINT64 * summary)
+{
+  const std::uint64_t *buckets = (const std::uint64_t *) stats_ptr;
+  const UINT64 per_mille[] = { 500, 900, 990, 999 };
+  int bucket;
+  int i;
+
+  summary[0] = cubmonitor::histogram_total_count (buckets);
+  for (i = 0; i < 4; i++)
+    {
+      summary[i + 1] = cubmonitor::histogram_percentile (buckets, per_mille[i]) / 1000;
+    }
+
+  summary[PERF_LATENCY_SUMMARY_CNT - 1] = 0;
+  for (bucket = PERF_LATENCY_HISTOGRAM_CNT - 1; bucket >= 0; bucket--)
+    {
+      if (buckets[bucket] != 0)
+	{
+	  summary[PERF_LATENCY_SUMMARY_CNT - 1] = cubmonitor::histogram_bucket_upper_bound (bucket) / 1000;
+	  break;
+	}
+    }
+}
+
+/*
+ * perfmon_stat_dump_in_buffer_latency_histogram () - dump the summary of a latency histogram
+ *
+ * stats_ptr(in): latency histogram buckets
+ * summary_names(in): PERF_LATENCY_SUMMARY_CNT names of the summary values
+ * s(in/out): output string (NULL if not used)
+ * remaining_size(in/out): remaining size in string s (NULL if not used)
+ *
+ */
+static void
+perfmon_stat_dump_in_buffer_latency_histogram (const UINT64 * stats_ptr, const char **summary_names, char **s,
+					       int *remaining_size)
+{
+  UINT64 summary[PERF_LATENCY_SUMMARY_CNT];
+  int i;
+  int ret;
+
+  assert (remaining_size != NULL);
+  assert (s != NULL);
+
+  if (*s == NULL)
+    {
+      return;
+    }
+
+  perfmon_latency_histogram_summary (stats_ptr, summary);
+  if (summary[0] == 0)
+    {
+      return;
+    }
+
+  for (i = 0; i < PERF_LATENCY_SUMMARY_CNT; i++)
+    {
+      ret = snprintf (*s, *remaining_size, "%-20s = %16llu\n", summary_names[i], (long long unsigned int) summary[i]);
+      *remaining_size -= ret;
+      *s += ret;
+      if (*remaining_size <= 0)
+	{
+	  return;
+	}
+    }
+}
+
+/*
+ * perfmon_stat_dump_in_file_latency_histogram () - dump the summary of a latency histogram
+ *
+ * stream(in): output file
+ * stats_ptr(in): latency histogram buckets
+ * summary_names(in): PERF_LATENCY_SUMMARY_CNT names of the summary values
+ *
+ */
+static void
+perfmon_stat_dump_in_file_latency_histogram (FILE * stream, const UINT64 * stats_ptr, const char **summary_names)
+{
+  UINT64 summary[PERF_LATENCY_SUMMARY_CNT];
+  int i;
+
+  assert (stream != NULL);
+
+  perfmon_latency_histogram_summary (stats_ptr, summary);
+  if (summary[0] == 0)
+    {
+      return;
+    }
+
+  for (i = 0; i < PERF_LATENCY_SUMMARY_CNT; i++)
+    {
+      fprintf (stream, "%-20s = %16llu\n", summary_names[i], (long long unsigned int) summary[i]);
+    }
+}
+
 /*
  * perfmon_stat_dump_in_buffer_snapshot_array_stat () -
  *
@@ -3097,6 +3336,8 @@ perfmon_initialize (int num_trans)
     }
   memset (pstat_Global.is_watching, 0, memsize);
 
+  perfmon_register_latency_histograms ();
+
   pstat_Global.n_watchers = 0;
   pstat_Global.initialized = true;
   return NO_ERROR;
@@ -3334,6 +3575,15 @@ f_load_Num_dwb_flushed_block_volumes (void)
   return PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT;
 }
 
+/*
+ * f_load_latency_histogram () - Get the number of values for latency histogram statistics
+ */
+static int
+f_load_latency_histogram (void)
+{
+  return PERF_LATENCY_HISTOGRAM_CNT;
+}
+
 /*
  * f_load_Time_get_snapshot_acquire_time () - Get the number of values for Time_get_snapshot_acquire_time statistic
  *
@@ -3522,6 +3772,36 @@ f_dump_in_file_Num_dwb_flushed_block_volumes (FILE * f, const UINT64 * stat_vals
     }
 }
 
+/*
+ * f_dump_in_file_latency_histogram () - Write in file the summary of a latency histogram statistic
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_latency_histogram (FILE * f, const UINT64 * stat_vals)
+{
+  if (pstat_Global.activation_flag & PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM)
+    {
+      perfmon_stat_dump_in_file_latency_histogram (f, stat_vals, perfmon_Latency_summary_names);
+    }
+}
+
+/*
+ * f_dump_in_file_count_histogram () - Write in file the summary of a latency histogram statistic that counts amounts
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_count_histogram (FILE * f, const UINT64 * stat_vals)
+{
+  if (pstat_Global.activation_flag & PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM)
+    {
+      perfmon_stat_dump_in_file_latency_histogram (f, stat_vals, perfmon_Count_summary_names);
+    }
+}
+
 /*
  * f_dump_in_buffer_Num_data_page_fix_ext () - Write to a buffer the values for Num_data_page_fix_ext
  *					       statistic
@@ -3674,6 +3954,39 @@ f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_va
     }
 }
 
+/*
+ * f_dump_in_buffer_latency_histogram () - Write to a buffer the summary of a latency histogram statistic
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_latency_histogram (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  if (pstat_Global.activation_flag & PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM)
+    {
+      perfmon_stat_dump_in_buffer_latency_histogram (stat_vals, perfmon_Latency_summary_names, s, remaining_size);
+    }
+}
+
+/*
+ * f_dump_in_buffer_count_histogram () - Write to a buffer the summary of a latency histogram statistic that counts
+ *					 amounts
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_count_histogram (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  if (pstat_Global.activation_flag & PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM)
+    {
+      perfmon_stat_dump_in_buffer_latency_histogram (stat_vals, perfmon_Count_summary_names, s, remaining_size);
+    }
+}
+
 /*
  * perfmon_get_number_of_statistic_values () - Get the number of entries in the statistic array
  *
@@ -3802,6 +4115,12 @@ perfmon_get_peek_stats (UINT64 * stats)
   stats[pstat_Metadata[PSTAT_PC_NUM_CACHE_ENTRIES].start_offset] = xcache_get_entry_count ();
   stats[pstat_Metadata[PSTAT_HF_NUM_STATS_ENTRIES].start_offset] = heap_get_best_space_num_stats_entries ();
   stats[pstat_Metadata[PSTAT_QM_NUM_HOLDABLE_CURSORS].start_offset] = session_get_number_of_holdable_cursors ();
+
+  for (int type = 0; type < PERF_LATENCY_COUNT; type++)
+    {
+      int offset = pstat_Metadata[perfmon_Latency_stat_ids[type]].start_offset;
+      perfmon_Latency_histograms[type].get_buckets ((std::uint64_t *) &stats[offset]);
+    }
 #endif /* defined (SERVER_MODE) || defined (SA_MODE) */
 }
 
@@ -3908,7 +4227,11 @@ const char *perfmon_Portable_worker_stat_names [] =
     "Counter_recycle_context",
     "Timer_recycle_context",
     "Counter_retire_context",
-    "Timer_retire_context"
+    "Timer_retire_context",
+    "Counter_steal_task",
+    "Timer_steal_task",
+    "Counter_queue_wait",
+    "Timer_queue_wait"
   };
 static const size_t PERFMON_PORTABLE_WORKER_STAT_COUNT =
   sizeof (perfmon_Portable_worker_stat_names) / sizeof (const char *);
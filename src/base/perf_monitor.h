@@ -66,9 +66,10 @@ typedef enum
   PERFMON_ACTIVATION_FLAG_THREAD = 32,
   PERFMON_ACTIVATION_FLAG_DAEMONS = 64,
   PERFMON_ACTIVATION_FLAG_FLUSHED_BLOCK_VOLUMES = 128,
+  PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM = 256,
 
   /* must update when adding new conditions */
-  PERFMON_ACTIVATION_FLAG_LAST = PERFMON_ACTIVATION_FLAG_FLUSHED_BLOCK_VOLUMES,
+  PERFMON_ACTIVATION_FLAG_LAST = PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM,
 
   PERFMON_ACTIVATION_FLAG_MAX_VALUE = (PERFMON_ACTIVATION_FLAG_LAST << 1) - 1
 } PERFMON_ACTIVATION_FLAG;
@@ -133,6 +134,23 @@ typedef enum
 #define PERF_OBJ_LOCK_STAT_COUNTERS (SCH_M_LOCK + 1)
 #define PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT 10
 
+/* Latency histograms are log-linear, see cubmonitor::time_histogram_statistic; must match
+ * cubmonitor::HISTOGRAM_BUCKET_COUNT */
+#define PERF_LATENCY_HISTOGRAM_CNT 304
+
+typedef enum
+{
+  PERF_LATENCY_PAGE_FIX_WAIT,
+  PERF_LATENCY_LOCK_WAIT,
+  PERF_LATENCY_LOG_FLUSH,
+  PERF_LATENCY_QUERY_EXEC,
+  PERF_LATENCY_CONN_REACTOR_LOOP,
+  PERF_LATENCY_LOG_GROUP_COMMIT,
+  PERF_LATENCY_LOG_GROUP_COMMIT_BATCH,	/* commits per flush, see perfmon_count_histogram */
+
+  PERF_LATENCY_COUNT
+} PERF_LATENCY_TYPE;
+
 #define SAFE_DIV(a, b) ((b) == 0 ? 0 : (a) / (b))
 
 /* Count & timer values. */
@@ -279,6 +297,7 @@ typedef enum
   PSTAT_FILE_IOSYNC_ALL,
   PSTAT_FILE_NUM_PAGE_ALLOCS,
   PSTAT_FILE_NUM_PAGE_DEALLOCS,
+  PSTAT_FILE_NUM_DWB_HELPER_IOSYNCHES,
 
   /* Page buffer basic module */
   /* Execution statistics for the page buffer manager */
@@ -287,6 +306,10 @@ typedef enum
   PSTAT_PB_NUM_IOREADS,
   PSTAT_PB_NUM_IOWRITES,
   PSTAT_PB_NUM_FLUSHED,
+  PSTAT_PB_NUM_READ_AHEAD,
+  PSTAT_PB_READ_AHEAD_HITS,
+  PSTAT_PB_READ_AHEAD_WASTED,
+  PSTAT_PB_NUM_LOCK_FREE_READ_FIX,
   /* peeked stats */
   PSTAT_PB_PRIVATE_QUOTA,
   PSTAT_PB_PRIVATE_COUNT,
@@ -308,6 +331,8 @@ typedef enum
   PSTAT_LOG_NUM_WALS,
   PSTAT_LOG_NUM_REPLACEMENTS_IOWRITES,
   PSTAT_LOG_NUM_REPLACEMENTS,
+  PSTAT_LOG_NUM_REDO_RECORDS,
+  PSTAT_LOG_REDO_RECORDS_PER_SEC,
 
   /* Execution statistics for the lock manager */
   PSTAT_LK_NUM_ACQUIRED_ON_PAGES,
@@ -367,6 +392,8 @@ typedef enum
   PSTAT_QM_NUM_METHSCANS,
   PSTAT_QM_NUM_NLJOINS,
   PSTAT_QM_NUM_MJOINS,
+  PSTAT_QM_NUM_HJOINS,
+  PSTAT_QM_NUM_HJOIN_SPILLS,
   PSTAT_QM_NUM_OBJFETCHES,
   PSTAT_QM_NUM_HOLDABLE_CURSORS,
 
@@ -404,6 +431,8 @@ typedef enum
   PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES,
+  PSTAT_VAC_NUM_SPLIT_JOBS,
+  PSTAT_VAC_NUM_HELPER_SUBJOBS,
 
   /* Track heap modify counters. */
   PSTAT_HEAP_HOME_INSERTS,
@@ -497,6 +526,7 @@ typedef enum
   /* Log statistics */
   PSTAT_LOG_SNAPSHOT_TIME_COUNTERS,
   PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS,
+  PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS,
   PSTAT_LOG_TRAN_COMPLETE_TIME_COUNTERS,
   PSTAT_LOG_OLDEST_MVCC_TIME_COUNTERS,
   PSTAT_LOG_OLDEST_MVCC_RETRY_COUNTERS,
@@ -645,6 +675,13 @@ typedef enum
   PSTAT_THREAD_DAEMON_STATS,
   PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES,
   PSTAT_LOAD_THREAD_STATS,
+  PSTAT_PAGE_FIX_WAIT_LATENCY,
+  PSTAT_LOCK_WAIT_LATENCY,
+  PSTAT_LOG_FLUSH_LATENCY,
+  PSTAT_QUERY_EXEC_LATENCY,
+  PSTAT_CONN_REACTOR_LOOP_LATENCY,
+  PSTAT_LOG_GROUP_COMMIT_LATENCY,
+  PSTAT_LOG_GROUP_COMMIT_BATCH_SIZE,
 
   PSTAT_COUNT
 } PERF_STAT_ID;
@@ -1473,6 +1510,8 @@ extern void perfmon_pbx_fix_acquire_time (THREAD_ENTRY * thread_p, int page_type
 					  int cond_type, UINT64 amount);
 extern void perfmon_mvcc_snapshot (THREAD_ENTRY * thread_p, int snapshot, int rec_type, int visibility);
 extern void perfmon_db_flushed_block_volumes (THREAD_ENTRY * thread_p, int num_volumes);
+extern void perfmon_time_latency (PERF_LATENCY_TYPE type, UINT64 latency_usec);
+extern void perfmon_count_histogram (PERF_LATENCY_TYPE type, UINT64 amount);
 
 #endif /* SERVER_MODE || SA_MODE */
 
@@ -668,6 +668,24 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_REPR_CACHE_LOG "er_log_repr_cache"
 #define PRM_NAME_ENABLE_NEW_LFHASH "new_lfhash"
 #define PRM_NAME_HEAP_INFO_CACHE_LOGGING "heap_info_cache_logging"
+#define PRM_NAME_ENABLE_ASYNC_PAGE_IO "enable_async_page_io"
+#define PRM_NAME_PB_READ_AHEAD_PAGES "data_buffer_read_ahead_pages"
+#define PRM_NAME_RECOVERY_REDO_WORKER_COUNT "recovery_redo_worker_count"
+#define PRM_NAME_PB_LOCK_FREE_READ_FIX "data_buffer_lock_free_read_fix"
+#define PRM_NAME_LOG_COMPRESS_METHOD "log_compress_method"
+#define PRM_NAME_LOG_COMPRESS_DICTIONARY "log_compress_dictionary"
+#define PRM_NAME_VACUUM_HEAP_SPLIT_MIN_OBJECTS "vacuum_heap_split_min_objects"
+#define PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN "optimizer_enable_hash_join"
+#define PRM_NAME_MAX_HASH_JOIN_SIZE "max_hash_join_size"
+#define PRM_NAME_DWB_VOLUME_SYNC_WORKERS "double_write_buffer_volume_sync_workers"
+#define PRM_NAME_LOG_GROUP_COMMIT_LEADER_FLUSH "group_commit_leader_flush"
+#define PRM_NAME_SORT_MERGE_WORKERS "sort_merge_workers"
+#define PRM_NAME_LK_FAST_PATH "lock_fast_path"
+#define PRM_NAME_THREAD_WORKER_STEALING "thread_worker_stealing"
+#define PRM_NAME_BT_KEY_PREFIX_SEARCH "index_key_prefix_search"
+#define PRM_NAME_PARALLEL_HEAP_SCAN_WORKERS "parallel_heap_scan_workers"
+#define PRM_NAME_HA_APPLYLOGDB_PARALLEL_WORKERS "ha_applylogdb_parallel_workers"
+#define PRM_NAME_THREAD_CONNECTION_REACTOR_COUNT "thread_connection_reactor_count"
 
 #define PRM_VALUE_DEFAULT "DEFAULT"
 #define PRM_VALUE_MAX "MAX"
@@ -2255,6 +2273,98 @@ bool PRM_HEAP_INFO_CACHE_LOGGING = false;
 static bool prm_heap_info_cache_logging_default = false;
 static unsigned int prm_heap_info_cache_logging_flag = 0;
 
+bool PRM_ENABLE_ASYNC_PAGE_IO = true;
+static bool prm_enable_async_page_io_default = true;
+static unsigned int prm_enable_async_page_io_flag = 0;
+
+int PRM_PB_READ_AHEAD_PAGES = 16;
+static int prm_pb_read_ahead_pages_default = 16;
+static int prm_pb_read_ahead_pages_upper = 64;
+static int prm_pb_read_ahead_pages_lower = 0;
+static unsigned int prm_pb_read_ahead_pages_flag = 0;
+
+int PRM_RECOVERY_REDO_WORKER_COUNT = 0;
+static int prm_recovery_redo_worker_count_default = 0;
+static int prm_recovery_redo_worker_count_upper = 64;
+static int prm_recovery_redo_worker_count_lower = 0;
+static unsigned int prm_recovery_redo_worker_count_flag = 0;
+
+bool PRM_PB_LOCK_FREE_READ_FIX = true;
+static bool prm_pb_lock_free_read_fix_default = true;
+static unsigned int prm_pb_lock_free_read_fix_flag = 0;
+
+int PRM_LOG_COMPRESS_METHOD = 0;
+static int prm_log_compress_method_default = 0;
+static int prm_log_compress_method_upper = 2;
+static int prm_log_compress_method_lower = 0;
+static unsigned int prm_log_compress_method_flag = 0;
+
+bool PRM_LOG_COMPRESS_DICTIONARY = false;
+static bool prm_log_compress_dictionary_default = false;
+static unsigned int prm_log_compress_dictionary_flag = 0;
+
+int PRM_VACUUM_HEAP_SPLIT_MIN_OBJECTS = 10000;
+static int prm_vacuum_heap_split_min_objects_default = 10000;
+static int prm_vacuum_heap_split_min_objects_upper = INT_MAX;
+static int prm_vacuum_heap_split_min_objects_lower = 0;
+static unsigned int prm_vacuum_heap_split_min_objects_flag = 0;
+
+bool PRM_OPTIMIZER_ENABLE_HASH_JOIN = true;
+static bool prm_optimizer_enable_hash_join_default = true;
+static unsigned int prm_optimizer_enable_hash_join_flag = 0;
+
+UINT64 PRM_MAX_HASH_JOIN_SIZE = 8 * 1024 * 1024;	/* 8 MB */
+static UINT64 prm_max_hash_join_size_default = 8 * 1024 * 1024;	/* 8 MB */
+static UINT64 prm_max_hash_join_size_upper = 1024 * 1024 * 1024;	/* 1 GB */
+static UINT64 prm_max_hash_join_size_lower = 64 * 1024;	/* 64 KB */
+static unsigned int prm_max_hash_join_size_flag = 0;
+
+int PRM_DWB_VOLUME_SYNC_WORKERS = 4;
+static int prm_dwb_volume_sync_workers_default = 4;
+static int prm_dwb_volume_sync_workers_upper = 32;
+static int prm_dwb_volume_sync_workers_lower = 0;
+static unsigned int prm_dwb_volume_sync_workers_flag = 0;
+
+bool PRM_LOG_GROUP_COMMIT_LEADER_FLUSH = true;
+static bool prm_log_group_commit_leader_flush_default = true;
+static unsigned int prm_log_group_commit_leader_flush_flag = 0;
+
+int PRM_SORT_MERGE_WORKERS = 4;
+static int prm_sort_merge_workers_default = 4;
+static int prm_sort_merge_workers_upper = 32;
+static int prm_sort_merge_workers_lower = 0;
+static unsigned int prm_sort_merge_workers_flag = 0;
+
+bool PRM_LK_FAST_PATH = true;
+static bool prm_lk_fast_path_default = true;
+static unsigned int prm_lk_fast_path_flag = 0;
+
+bool PRM_THREAD_WORKER_STEALING = false;
+static bool prm_thread_worker_stealing_default = false;
+static unsigned int prm_thread_worker_stealing_flag = 0;
+
+bool PRM_BT_KEY_PREFIX_SEARCH = true;
+static bool prm_bt_key_prefix_search_default = true;
+static unsigned int prm_bt_key_prefix_search_flag = 0;
+
+int PRM_PARALLEL_HEAP_SCAN_WORKERS = 0;
+static int prm_parallel_heap_scan_workers_default = 0;
+static int prm_parallel_heap_scan_workers_upper = 32;
+static int prm_parallel_heap_scan_workers_lower = 0;
+static unsigned int prm_parallel_heap_scan_workers_flag = 0;
+
+int PRM_HA_APPLYLOGDB_PARALLEL_WORKERS = 0;
+static int prm_ha_applylogdb_parallel_workers_default = 0;
+static int prm_ha_applylogdb_parallel_workers_upper = 16;
+static int prm_ha_applylogdb_parallel_workers_lower = 0;
+static unsigned int prm_ha_applylogdb_parallel_workers_flag = 0;
+
+int PRM_THREAD_CONNECTION_REACTOR_COUNT = 0;
+static int prm_thread_connection_reactor_count_default = 0;
+static int prm_thread_connection_reactor_count_upper = 64;
+static int prm_thread_connection_reactor_count_lower = 0;
+static unsigned int prm_thread_connection_reactor_count_flag = 0;
+
 typedef int (*DUP_PRM_FUNC) (void *, SYSPRM_DATATYPE, void *, SYSPRM_DATATYPE);
 
 static int prm_size_to_io_pages (void *out_val, SYSPRM_DATATYPE out_type, void *in_val, SYSPRM_DATATYPE in_type);
@@ -5800,6 +5910,214 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_ENABLE_ASYNC_PAGE_IO,
+   PRM_NAME_ENABLE_ASYNC_PAGE_IO,
+   (PRM_FOR_SERVER | PRM_HIDDEN),
+   PRM_BOOLEAN,
+   &prm_enable_async_page_io_flag,
+   (void *) &prm_enable_async_page_io_default,
+   (void *) &PRM_ENABLE_ASYNC_PAGE_IO,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_READ_AHEAD_PAGES,
+   PRM_NAME_PB_READ_AHEAD_PAGES,
+   (PRM_USER_CHANGE | PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_read_ahead_pages_flag,
+   (void *) &prm_pb_read_ahead_pages_default,
+   (void *) &PRM_PB_READ_AHEAD_PAGES,
+   (void *) &prm_pb_read_ahead_pages_upper,
+   (void *) &prm_pb_read_ahead_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_RECOVERY_REDO_WORKER_COUNT,
+   PRM_NAME_RECOVERY_REDO_WORKER_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_recovery_redo_worker_count_flag,
+   (void *) &prm_recovery_redo_worker_count_default,
+   (void *) &PRM_RECOVERY_REDO_WORKER_COUNT,
+   (void *) &prm_recovery_redo_worker_count_upper,
+   (void *) &prm_recovery_redo_worker_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_LOCK_FREE_READ_FIX,
+   PRM_NAME_PB_LOCK_FREE_READ_FIX,
+   (PRM_FOR_SERVER | PRM_HIDDEN),
+   PRM_BOOLEAN,
+   &prm_pb_lock_free_read_fix_flag,
+   (void *) &prm_pb_lock_free_read_fix_default,
+   (void *) &PRM_PB_LOCK_FREE_READ_FIX,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_COMPRESS_METHOD,
+   PRM_NAME_LOG_COMPRESS_METHOD,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_log_compress_method_flag,
+   (void *) &prm_log_compress_method_default,
+   (void *) &PRM_LOG_COMPRESS_METHOD,
+   (void *) &prm_log_compress_method_upper,
+   (void *) &prm_log_compress_method_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_COMPRESS_DICTIONARY,
+   PRM_NAME_LOG_COMPRESS_DICTIONARY,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_log_compress_dictionary_flag,
+   (void *) &prm_log_compress_dictionary_default,
+   (void *) &PRM_LOG_COMPRESS_DICTIONARY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VACUUM_HEAP_SPLIT_MIN_OBJECTS,
+   PRM_NAME_VACUUM_HEAP_SPLIT_MIN_OBJECTS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_vacuum_heap_split_min_objects_flag,
+   (void *) &prm_vacuum_heap_split_min_objects_default,
+   (void *) &PRM_VACUUM_HEAP_SPLIT_MIN_OBJECTS,
+   (void *) &prm_vacuum_heap_split_min_objects_upper,
+   (void *) &prm_vacuum_heap_split_min_objects_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+   PRM_NAME_OPTIMIZER_ENABLE_HASH_JOIN,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_optimizer_enable_hash_join_flag,
+   (void *) &prm_optimizer_enable_hash_join_default,
+   (void *) &PRM_OPTIMIZER_ENABLE_HASH_JOIN,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_MAX_HASH_JOIN_SIZE,
+   PRM_NAME_MAX_HASH_JOIN_SIZE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_max_hash_join_size_flag,
+   (void *) &prm_max_hash_join_size_default,
+   (void *) &PRM_MAX_HASH_JOIN_SIZE,
+   (void *) &prm_max_hash_join_size_upper,
+   (void *) &prm_max_hash_join_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DWB_VOLUME_SYNC_WORKERS,
+   PRM_NAME_DWB_VOLUME_SYNC_WORKERS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_dwb_volume_sync_workers_flag,
+   (void *) &prm_dwb_volume_sync_workers_default,
+   (void *) &PRM_DWB_VOLUME_SYNC_WORKERS,
+   (void *) &prm_dwb_volume_sync_workers_upper,
+   (void *) &prm_dwb_volume_sync_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_GROUP_COMMIT_LEADER_FLUSH,
+   PRM_NAME_LOG_GROUP_COMMIT_LEADER_FLUSH,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_log_group_commit_leader_flush_flag,
+   (void *) &prm_log_group_commit_leader_flush_default,
+   (void *) &PRM_LOG_GROUP_COMMIT_LEADER_FLUSH,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SORT_MERGE_WORKERS,
+   PRM_NAME_SORT_MERGE_WORKERS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_sort_merge_workers_flag,
+   (void *) &prm_sort_merge_workers_default,
+   (void *) &PRM_SORT_MERGE_WORKERS,
+   (void *) &prm_sort_merge_workers_upper,
+   (void *) &prm_sort_merge_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LK_FAST_PATH,
+   PRM_NAME_LK_FAST_PATH,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_lk_fast_path_flag,
+   (void *) &prm_lk_fast_path_default,
+   (void *) &PRM_LK_FAST_PATH,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_WORKER_STEALING,
+   PRM_NAME_THREAD_WORKER_STEALING,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_thread_worker_stealing_flag,
+   (void *) &prm_thread_worker_stealing_default,
+   (void *) &PRM_THREAD_WORKER_STEALING,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BT_KEY_PREFIX_SEARCH,
+   PRM_NAME_BT_KEY_PREFIX_SEARCH,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_bt_key_prefix_search_flag,
+   (void *) &prm_bt_key_prefix_search_default,
+   (void *) &PRM_BT_KEY_PREFIX_SEARCH,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PARALLEL_HEAP_SCAN_WORKERS,
+   PRM_NAME_PARALLEL_HEAP_SCAN_WORKERS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_parallel_heap_scan_workers_flag,
+   (void *) &prm_parallel_heap_scan_workers_default,
+   (void *) &PRM_PARALLEL_HEAP_SCAN_WORKERS,
+   (void *) &prm_parallel_heap_scan_workers_upper,
+   (void *) &prm_parallel_heap_scan_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HA_APPLYLOGDB_PARALLEL_WORKERS,
+   PRM_NAME_HA_APPLYLOGDB_PARALLEL_WORKERS,
+   (PRM_FOR_CLIENT | PRM_FOR_HA),
+   PRM_INTEGER,
+   &prm_ha_applylogdb_parallel_workers_flag,
+   (void *) &prm_ha_applylogdb_parallel_workers_default,
+   (void *) &PRM_HA_APPLYLOGDB_PARALLEL_WORKERS,
+   (void *) &prm_ha_applylogdb_parallel_workers_upper,
+   (void *) &prm_ha_applylogdb_parallel_workers_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_CONNECTION_REACTOR_COUNT,
+   PRM_NAME_THREAD_CONNECTION_REACTOR_COUNT,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_thread_connection_reactor_count_flag,
+   (void *) &prm_thread_connection_reactor_count_default,
+   (void *) &PRM_THREAD_CONNECTION_REACTOR_COUNT,
+   (void *) &prm_thread_connection_reactor_count_upper,
+   (void *) &prm_thread_connection_reactor_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
 };
 
 #define NUM_PRM ((int)(sizeof(prm_Def)/sizeof(prm_Def[0])))
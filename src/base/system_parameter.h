@@ -438,8 +438,44 @@ enum param_id
 
   PRM_ID_HEAP_INFO_CACHE_LOGGING,
 
+  PRM_ID_ENABLE_ASYNC_PAGE_IO,
+
+  PRM_ID_PB_READ_AHEAD_PAGES,
+
+  PRM_ID_RECOVERY_REDO_WORKER_COUNT,
+
+  PRM_ID_PB_LOCK_FREE_READ_FIX,
+
+  PRM_ID_LOG_COMPRESS_METHOD,
+
+  PRM_ID_LOG_COMPRESS_DICTIONARY,
+
+  PRM_ID_VACUUM_HEAP_SPLIT_MIN_OBJECTS,
+
+  PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN,
+
+  PRM_ID_MAX_HASH_JOIN_SIZE,
+
+  PRM_ID_DWB_VOLUME_SYNC_WORKERS,
+
+  PRM_ID_LOG_GROUP_COMMIT_LEADER_FLUSH,
+
+  PRM_ID_SORT_MERGE_WORKERS,
+
+  PRM_ID_LK_FAST_PATH,
+
+  PRM_ID_THREAD_WORKER_STEALING,
+
+  PRM_ID_BT_KEY_PREFIX_SEARCH,
+
+  PRM_ID_PARALLEL_HEAP_SCAN_WORKERS,
+
+  PRM_ID_HA_APPLYLOGDB_PARALLEL_WORKERS,
+
+  PRM_ID_THREAD_CONNECTION_REACTOR_COUNT,
+
   /* change PRM_LAST_ID when adding new system parameters */
-  PRM_LAST_ID = PRM_ID_HEAP_INFO_CACHE_LOGGING
+  PRM_LAST_ID = PRM_ID_THREAD_CONNECTION_REACTOR_COUNT
 };
 typedef enum param_id PARAM_ID;
 
@@ -42,6 +42,7 @@
 #include <netinet/tcp.h>
 #include <sys/time.h>
 #include <sys/un.h>
+#include <poll.h>
 #else
 #include  <io.h>
 #endif
@@ -69,6 +70,9 @@
 #include "broker_filename.h"
 #include "broker_er_html.h"
 #include "broker_send_fd.h"
+#if !defined(WINDOWS)
+#include "broker_recv_fd.h"
+#endif /* !WINDOWS */
 #include "error_manager.h"
 #include "shard_shm.h"
 #include "shard_metadata.h"
@@ -232,6 +236,7 @@ static void cleanup (int signo);
 static int init_env (void);
 #if !defined(WINDOWS)
 static int init_proxy_env (void);
+static int init_park_env (void);
 #endif /* !WINDOWS */
 static int broker_init_shm (void);
 
@@ -251,6 +256,13 @@ static THREAD_FUNC hang_check_thr_f (void *arg);
 static THREAD_FUNC proxy_monitor_thr_f (void *arg);
 #if !defined(WINDOWS)
 static THREAD_FUNC proxy_listener_thr_f (void *arg);
+static THREAD_FUNC park_thr_f (void *arg);
+static void park_accept_client (void);
+static void park_wake_client (int park_id, int *job_count);
+static int park_send_client_info (SOCKET srv_sock_fd, int park_id);
+static void park_release_client (int park_id);
+static int park_get_cas_pid (int park_id);
+static int read_nbytes_with_timeout (SOCKET sock_fd, char *buf, int size, int timeout_sec);
 #endif /* !WINDOWS */
 static THREAD_FUNC server_monitor_thr_f (void *arg);
 
@@ -306,6 +318,26 @@ static struct sockaddr_in shard_sock_addr;
 #else /* WINDOWS */
 static SOCKET proxy_sock_fd;
 static struct sockaddr_un shard_sock_addr;
+
+/* client connections parked by CAS while they are idle */
+typedef struct t_parked_client T_PARKED_CLIENT;
+struct t_parked_client
+{
+  SOCKET clt_sock_fd;		/* INVALID_SOCKET if the slot is free */
+  bool is_queued;		/* the client sent a request and waits in job queue */
+  int ip_addr;
+  int port;
+  T_BROKER_VERSION clt_version;
+  char cas_client_type;
+  char driver_info[SRV_CON_CLIENT_INFO_SIZE];
+  int cas_pid;			/* pid of the CAS the driver knows, for query cancel */
+  int db_info_size;
+  char db_info[SRV_CON_DB_INFO_SIZE];	/* includes the password; cleared when the slot is freed */
+};
+
+static SOCKET park_sock_fd = INVALID_SOCKET;
+static T_PARKED_CLIENT *parked_clients = NULL;
+static pthread_mutex_t park_mutex;
 #endif /* !WINDOWS */
 
 static T_SHM_BROKER *shm_br = NULL;
@@ -426,7 +458,7 @@ broker_drop_one_cas_by_time_to_kill (void)
       /* do nothing */
     }
   else if (drop_as_info->cur_keep_con == KEEP_CON_AUTO && drop_as_info->uts_status == UTS_STATUS_BUSY
-	   && drop_as_info->con_status == CON_STATUS_OUT_TRAN
+	   && drop_as_info->con_status == CON_STATUS_OUT_TRAN && !drop_as_info->pipelined_request
 	   && time (NULL) - drop_as_info->last_access_time > shm_br->br_info[br_index].time_to_kill)
     {
       drop_as_info->con_status = CON_STATUS_CLOSE;
@@ -473,6 +505,7 @@ main (int argc, char *argv[])
   pthread_t proxy_monitor_thread;
 #if !defined(WINDOWS)
   pthread_t proxy_listener_thread;
+  pthread_t park_thread;
 #endif /* !WINDOWS */
 
 #if defined(WIN_FW)
@@ -540,6 +573,12 @@ main (int argc, char *argv[])
     }
   else
     {
+#if !defined(WINDOWS)
+      if (shm_appl->max_parked_clients > 0 && init_park_env () < 0)
+	{
+	  goto error1;
+	}
+#endif /* !WINDOWS */
 #if defined(WIN_FW)
       num_thr = shm_br->br_info[br_index].appl_server_max_num;
 
@@ -593,6 +632,12 @@ main (int argc, char *argv[])
       THREAD_BEGIN (proxy_listener_thread, proxy_listener_thr_f, NULL);
 #endif /* !WINDOWS */
     }
+#if !defined(WINDOWS)
+  else if (shm_appl->max_parked_clients > 0)
+    {
+      THREAD_BEGIN (park_thread, park_thr_f, NULL);
+    }
+#endif /* !WINDOWS */
 
   if (shm_br->br_info[br_index].monitor_hang_flag)
     {
@@ -863,7 +908,7 @@ receiver_thr_f (void *arg)
 	{
 	  int ret_code = 0;
 #if !defined(WINDOWS)
-	  int pid, i;
+	  int pid, i, found;
 	  unsigned short client_port = 0;
 #endif
 
@@ -884,10 +929,24 @@ receiver_thr_f (void *arg)
 	  ret_code = CAS_ER_QUERY_CANCEL;
 	  if (shm_br->br_info[br_index].shard_flag == OFF)
 	    {
+	      /* the pid is the one of the CAS the client connected to. a client resumed after being parked is served
+	       * by another CAS, and the CAS it connected to may serve another client, so look for the client itself
+	       * before falling back to the pid. */
+	      found = -1;
+	      for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num && found < 0; i++)
+		{
+		  if (shm_appl->as_info[i].service_flag == SERVICE_ON && shm_appl->as_info[i].clt_cas_pid == pid
+		      && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY && cas_req_header[0] == 'Q'
+		      && client_port > 0 && shm_appl->as_info[i].cas_clt_port == client_port
+		      && memcmp (&shm_appl->as_info[i].cas_clt_ip, &clt_sock_addr.sin_addr, 4) == 0)
+		    {
+		      found = i;
+		    }
+		}
 
-	      for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
+	      for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num && found < 0; i++)
 		{
-		  if (shm_appl->as_info[i].service_flag == SERVICE_ON && shm_appl->as_info[i].pid == pid
+		  if (shm_appl->as_info[i].service_flag == SERVICE_ON && shm_appl->as_info[i].clt_cas_pid == pid
 		      && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY)
 		    {
 		      if (cas_req_header[0] == 'Q' && client_port > 0
@@ -896,12 +955,15 @@ receiver_thr_f (void *arg)
 			{
 			  continue;
 			}
-
-		      ret_code = 0;
-		      kill (pid, SIGUSR1);
-		      break;
+		      found = i;
 		    }
 		}
+
+	      if (found >= 0)
+		{
+		  ret_code = 0;
+		  kill (shm_appl->as_info[found].pid, SIGUSR1);
+		}
 	    }
 	  else
 	    {
@@ -997,6 +1059,7 @@ receiver_thr_f (void *arg)
       strcpy (new_job.prg_name, cas_client_type_str[(int) cas_client_type]);
       new_job.clt_version = client_version;
       memcpy (new_job.driver_info, cas_req_header, SRV_CON_CLIENT_INFO_SIZE);
+      new_job.park_id = -1;
 
       while (1)
 	{
@@ -1182,6 +1245,15 @@ dispatch_thr_f (void *arg)
       shm_appl->as_info[as_index].cas_client_type = cur_job.cas_client_type;
       memcpy (shm_appl->as_info[as_index].cas_clt_ip, cur_job.ip_addr, 4);
       shm_appl->as_info[as_index].cas_clt_port = cur_job.port;
+      shm_appl->as_info[as_index].resume_client = (cur_job.park_id >= 0);
+      shm_appl->as_info[as_index].clt_cas_pid = shm_appl->as_info[as_index].pid;
+#if !defined(WINDOWS)
+      if (cur_job.park_id >= 0)
+	{
+	  /* the driver sends query cancel with the pid of the CAS it connected to */
+	  shm_appl->as_info[as_index].clt_cas_pid = park_get_cas_pid (cur_job.park_id);
+	}
+#endif /* !WINDOWS */
 #if defined(WINDOWS)
       shm_appl->as_info[as_index].uts_status = UTS_STATUS_BUSY_WAIT;
       CAS_SEND_ERROR_CODE (cur_job.clt_sock_fd, shm_appl->as_info[as_index].as_port);
@@ -1217,6 +1289,10 @@ dispatch_thr_f (void *arg)
 
 	  memcpy (&ip_addr, cur_job.ip_addr, 4);
 	  ret_val = send_fd (srv_sock_fd, cur_job.clt_sock_fd, ip_addr, cur_job.driver_info);
+	  if (ret_val > 0 && cur_job.park_id >= 0)
+	    {
+	      ret_val = park_send_client_info (srv_sock_fd, cur_job.park_id);
+	    }
 	  if (ret_val > 0)
 	    {
 	      ret_val =
@@ -1226,7 +1302,11 @@ dispatch_thr_f (void *arg)
 
 	  if (ret_val < 0)
 	    {
-	      send_error_to_driver (cur_job.clt_sock_fd, CAS_ER_FREE_SERVER, cur_job.driver_info);
+	      /* a resumed client is in the middle of its session and does not expect a connect reply */
+	      if (cur_job.park_id < 0)
+		{
+		  send_error_to_driver (cur_job.clt_sock_fd, CAS_ER_FREE_SERVER, cur_job.driver_info);
+		}
 	    }
 	  else
 	    {
@@ -1239,6 +1319,10 @@ dispatch_thr_f (void *arg)
 	}
 
       CLOSE_SOCKET (cur_job.clt_sock_fd);
+      if (cur_job.park_id >= 0)
+	{
+	  park_release_client (cur_job.park_id);
+	}
 #endif /* ifdef !WINDOWS */
 #else /* !WIN_FW */
       session_request_q[as_index] = cur_job;
@@ -1252,6 +1336,290 @@ dispatch_thr_f (void *arg)
 #endif
 }
 
+#if !defined(WINDOWS)
+/*
+ * park_thr_f () - watch the client connections parked by CAS
+ *
+ * Note: with KEEP_CONNECTION=AUTO, a CAS serving an idle client is taken over by a new client. Instead of closing
+ *       the idle client, the CAS hands its connection over to broker, which queues it as a new job when the client
+ *       sends its next request. The client is then resumed by any idle CAS with the session it was using.
+ */
+static THREAD_FUNC
+park_thr_f (void *arg)
+{
+  struct pollfd *poll_fds;
+  int *poll_park_ids;
+  int num_fds, n, i;
+  int job_count = 0;
+
+  poll_fds = (struct pollfd *) malloc (sizeof (struct pollfd) * (shm_appl->max_parked_clients + 1));
+  poll_park_ids = (int *) malloc (sizeof (int) * (shm_appl->max_parked_clients + 1));
+  if (poll_fds == NULL || poll_park_ids == NULL)
+    {
+      FREE_MEM (poll_fds);
+      FREE_MEM (poll_park_ids);
+      return NULL;
+    }
+
+  while (process_flag)
+    {
+      poll_fds[0].fd = park_sock_fd;
+      poll_fds[0].events = POLLIN;
+      poll_fds[0].revents = 0;
+      num_fds = 1;
+
+      pthread_mutex_lock (&park_mutex);
+      for (i = 0; i < shm_appl->max_parked_clients; i++)
+	{
+	  if (!IS_INVALID_SOCKET (parked_clients[i].clt_sock_fd) && !parked_clients[i].is_queued)
+	    {
+	      poll_fds[num_fds].fd = parked_clients[i].clt_sock_fd;
+	      poll_fds[num_fds].events = POLLIN;
+	      poll_fds[num_fds].revents = 0;
+	      poll_park_ids[num_fds] = i;
+	      num_fds++;
+	    }
+	}
+      pthread_mutex_unlock (&park_mutex);
+
+      n = poll (poll_fds, num_fds, 100);
+      if (n <= 0)
+	{
+	  continue;
+	}
+
+      if (poll_fds[0].revents & POLLIN)
+	{
+	  park_accept_client ();
+	}
+
+      for (i = 1; i < num_fds; i++)
+	{
+	  if (poll_fds[i].revents != 0)
+	    {
+	      park_wake_client (poll_park_ids[i], &job_count);
+	    }
+	}
+    }
+
+  FREE_MEM (poll_fds);
+  FREE_MEM (poll_park_ids);
+
+  return NULL;
+}
+
+/*
+ * park_accept_client () - receive a client connection from CAS and park it
+ */
+static void
+park_accept_client (void)
+{
+  SOCKET cas_sock_fd, clt_sock_fd;
+  T_PARKED_CLIENT client;
+  int info[5];
+  int park_id, i;
+  int reply = 0;
+
+  cas_sock_fd = accept (park_sock_fd, NULL, NULL);
+  if (IS_INVALID_SOCKET (cas_sock_fd))
+    {
+      return;
+    }
+
+  clt_sock_fd = recv_fd (cas_sock_fd, &client.ip_addr, client.driver_info);
+  if (clt_sock_fd < 0)
+    {
+      CLOSE_SOCKET (cas_sock_fd);
+      return;
+    }
+
+  /* port, client version, client type, pid of the CAS known by the driver and the size of connection info */
+  if (read_nbytes_with_timeout (cas_sock_fd, (char *) info, sizeof (info), SOCKET_TIMEOUT_SEC) < 0)
+    {
+      goto error;
+    }
+  client.port = ntohl (info[0]);
+  client.clt_version = ntohl (info[1]);
+  client.cas_client_type = (char) ntohl (info[2]);
+  client.cas_pid = ntohl (info[3]);
+  client.db_info_size = ntohl (info[4]);
+
+  if (client.cas_client_type < 0 || client.cas_client_type > CAS_CLIENT_TYPE_MAX || client.db_info_size <= 0
+      || client.db_info_size > (int) sizeof (client.db_info))
+    {
+      goto error;
+    }
+  if (read_nbytes_with_timeout (cas_sock_fd, client.db_info, client.db_info_size, SOCKET_TIMEOUT_SEC) < 0)
+    {
+      goto error;
+    }
+
+  client.clt_sock_fd = clt_sock_fd;
+  client.is_queued = false;
+
+  park_id = -1;
+  pthread_mutex_lock (&park_mutex);
+  for (i = 0; i < shm_appl->max_parked_clients; i++)
+    {
+      if (IS_INVALID_SOCKET (parked_clients[i].clt_sock_fd))
+	{
+	  parked_clients[i] = client;
+	  park_id = i;
+	  break;
+	}
+    }
+  pthread_mutex_unlock (&park_mutex);
+
+  if (park_id < 0)
+    {
+      /* no more room; the client is disconnected as without parking */
+      goto error;
+    }
+
+  if (max_open_fd < clt_sock_fd)
+    {
+      max_open_fd = clt_sock_fd;
+    }
+
+  write_to_client_with_timeout (cas_sock_fd, (char *) &reply, sizeof (int), SOCKET_TIMEOUT_SEC);
+  CLOSE_SOCKET (cas_sock_fd);
+  return;
+
+error:
+  memset (client.db_info, 0, sizeof (client.db_info));
+  CLOSE_SOCKET (clt_sock_fd);
+  CLOSE_SOCKET (cas_sock_fd);
+}
+
+/*
+ * park_wake_client () - queue a parked client which sent a request or release it when disconnected
+ */
+static void
+park_wake_client (int park_id, int *job_count)
+{
+  T_PARKED_CLIENT *client;
+  T_MAX_HEAP_NODE new_job;
+  char c;
+
+  pthread_mutex_lock (&park_mutex);
+  client = &parked_clients[park_id];
+
+  if (recv (client->clt_sock_fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) <= 0)
+    {
+      /* the client closed the connection while parked */
+      CLOSE_SOCKET (client->clt_sock_fd);
+      client->clt_sock_fd = INVALID_SOCKET;
+      memset (client->db_info, 0, sizeof (client->db_info));
+      pthread_mutex_unlock (&park_mutex);
+      return;
+    }
+
+  client->is_queued = true;
+
+  *job_count = (*job_count >= JOB_COUNT_MAX) ? 1 : *job_count + 1;
+  new_job.id = *job_count;
+  new_job.clt_sock_fd = client->clt_sock_fd;
+  new_job.recv_time = time (NULL);
+  new_job.priority = 0;
+  new_job.script[0] = '\0';
+  new_job.cas_client_type = client->cas_client_type;
+  new_job.port = (unsigned short) client->port;
+  memcpy (new_job.ip_addr, &client->ip_addr, 4);
+  strcpy (new_job.prg_name, cas_client_type_str[(int) client->cas_client_type]);
+  new_job.clt_version = client->clt_version;
+  memcpy (new_job.driver_info, client->driver_info, SRV_CON_CLIENT_INFO_SIZE);
+  new_job.park_id = park_id;
+  pthread_mutex_unlock (&park_mutex);
+
+  while (process_flag)
+    {
+      pthread_mutex_lock (&clt_table_mutex);
+      if (max_heap_insert (shm_appl->job_queue, shm_appl->job_queue_size, &new_job) < 0)
+	{
+	  pthread_mutex_unlock (&clt_table_mutex);
+	  SLEEP_MILISEC (0, 100);
+	}
+      else
+	{
+	  pthread_cond_signal (&clt_table_cond);
+	  pthread_mutex_unlock (&clt_table_mutex);
+	  break;
+	}
+    }
+}
+
+/*
+ * park_send_client_info () - send the connection info of a parked client to the CAS resuming it
+ *   return: bytes sent, -1 if failed
+ */
+static int
+park_send_client_info (SOCKET srv_sock_fd, int park_id)
+{
+  char buf[sizeof (int) + SRV_CON_DB_INFO_SIZE];
+  int size;
+
+  pthread_mutex_lock (&park_mutex);
+  size = htonl (parked_clients[park_id].db_info_size);
+  memcpy (buf, &size, sizeof (int));
+  memcpy (buf + sizeof (int), parked_clients[park_id].db_info, parked_clients[park_id].db_info_size);
+  size = sizeof (int) + parked_clients[park_id].db_info_size;
+  pthread_mutex_unlock (&park_mutex);
+
+  if (write_to_client_with_timeout (srv_sock_fd, buf, size, SOCKET_TIMEOUT_SEC) != size)
+    {
+      size = -1;
+    }
+  memset (buf, 0, sizeof (buf));
+
+  return size;
+}
+
+/*
+ * park_release_client () - free the slot of a parked client; its connection was handed over or closed by caller
+ */
+static void
+park_release_client (int park_id)
+{
+  pthread_mutex_lock (&park_mutex);
+  parked_clients[park_id].clt_sock_fd = INVALID_SOCKET;
+  parked_clients[park_id].is_queued = false;
+  memset (parked_clients[park_id].db_info, 0, sizeof (parked_clients[park_id].db_info));
+  pthread_mutex_unlock (&park_mutex);
+}
+
+/*
+ * park_get_cas_pid () - get the pid of the CAS the parked client connected to
+ */
+static int
+park_get_cas_pid (int park_id)
+{
+  int pid;
+
+  pthread_mutex_lock (&park_mutex);
+  pid = parked_clients[park_id].cas_pid;
+  pthread_mutex_unlock (&park_mutex);
+
+  return pid;
+}
+
+static int
+read_nbytes_with_timeout (SOCKET sock_fd, char *buf, int size, int timeout_sec)
+{
+  int total_read_size = 0, read_len;
+
+  while (total_read_size < size)
+    {
+      read_len = read_from_client_with_timeout (sock_fd, buf + total_read_size, size - total_read_size, timeout_sec);
+      if (read_len <= 0)
+	{
+	  return -1;
+	}
+      total_read_size += read_len;
+    }
+  return total_read_size;
+}
+#endif /* !WINDOWS */
+
 #if defined(WIN_FW)
 static THREAD_FUNC
 service_thr_f (void *arg)
@@ -2717,7 +3085,7 @@ find_idle_cas (void)
       if (shm_br->br_info[br_index].appl_server_num == shm_br->br_info[br_index].appl_server_max_num
 	  && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY && shm_appl->as_info[i].cur_keep_con == KEEP_CON_AUTO
 	  && shm_appl->as_info[i].con_status == CON_STATUS_OUT_TRAN && shm_appl->as_info[i].num_holdable_results < 1
-	  && shm_appl->as_info[i].cas_change_mode == CAS_CHANGE_MODE_AUTO)
+	  && shm_appl->as_info[i].cas_change_mode == CAS_CHANGE_MODE_AUTO && !shm_appl->as_info[i].pipelined_request)
 	{
 	  time_t wait_time = cur_time - shm_appl->as_info[i].last_access_time;
 	  if (wait_time > max_wait_time || wait_cas_id == -1)
@@ -2733,7 +3101,8 @@ find_idle_cas (void)
       CON_STATUS_LOCK (&(shm_appl->as_info[wait_cas_id]), CON_STATUS_LOCK_BROKER);
       if (shm_appl->as_info[wait_cas_id].con_status == CON_STATUS_OUT_TRAN
 	  && shm_appl->as_info[wait_cas_id].num_holdable_results < 1
-	  && shm_appl->as_info[wait_cas_id].cas_change_mode == CAS_CHANGE_MODE_AUTO)
+	  && shm_appl->as_info[wait_cas_id].cas_change_mode == CAS_CHANGE_MODE_AUTO
+	  && !shm_appl->as_info[wait_cas_id].pipelined_request)
 	{
 	  idle_cas_id = wait_cas_id;
 	  shm_appl->as_info[wait_cas_id].con_status = CON_STATUS_CLOSE_AND_CONNECT;
@@ -2891,6 +3260,68 @@ init_proxy_env ()
 
   return (proxy_sock_fd);
 }
+
+static int
+init_park_env (void)
+{
+  struct sockaddr_un park_sock_addr;
+  char port_name[BROKER_PATH_MAX];
+  int len, i;
+
+  parked_clients = (T_PARKED_CLIENT *) malloc (sizeof (T_PARKED_CLIENT) * shm_appl->max_parked_clients);
+  if (parked_clients == NULL)
+    {
+      UW_SET_ERROR_CODE (UW_ER_NO_MORE_MEMORY, 0);
+      return (-1);
+    }
+  for (i = 0; i < shm_appl->max_parked_clients; i++)
+    {
+      parked_clients[i].clt_sock_fd = INVALID_SOCKET;
+      parked_clients[i].is_queued = false;
+    }
+  pthread_mutex_init (&park_mutex, NULL);
+
+  if ((park_sock_fd = socket (AF_UNIX, SOCK_STREAM, 0)) < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_CREATE_SOCKET, errno);
+      return (-1);
+    }
+
+  ut_get_broker_park_port_name (port_name, shm_br->br_info[br_index].name, BROKER_PATH_MAX);
+  unlink (port_name);
+
+  memset (&park_sock_addr, 0, sizeof (park_sock_addr));
+  park_sock_addr.sun_family = AF_UNIX;
+  strncpy_bufsize (park_sock_addr.sun_path, port_name);
+
+#ifdef  _SOCKADDR_LEN		/* 4.3BSD Reno and later */
+  len = sizeof (park_sock_addr.sun_len) + sizeof (park_sock_addr.sun_family) + strlen (park_sock_addr.sun_path) + 1;
+  park_sock_addr.sun_len = len;
+#else /* vanilla 4.3BSD */
+  len = strlen (park_sock_addr.sun_path) + sizeof (park_sock_addr.sun_family) + 1;
+#endif
+
+  if (bind (park_sock_fd, (struct sockaddr *) &park_sock_addr, len) < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_BIND, errno);
+      CLOSE_SOCKET (park_sock_fd);
+      return (-1);
+    }
+
+  if (listen (park_sock_fd, 127) < 0)
+    {
+      UW_SET_ERROR_CODE (UW_ER_CANT_BIND, errno);
+      CLOSE_SOCKET (park_sock_fd);
+      return (-1);
+    }
+
+  if (max_open_fd < park_sock_fd)
+    {
+      max_open_fd = park_sock_fd;
+    }
+
+  return (park_sock_fd);
+}
 #endif /* !WINDOWS */
 
 static int
@@ -60,6 +60,7 @@
 #define DEFAULT_MYSQL_READ_TIMEOUT      "0"
 #define DEFAULT_MYSQL_KEEPALIVE_INTERVAL	"1800"	/* 30m */
 #define DEFAULT_JOB_QUEUE_SIZE		1024
+#define DEFAULT_MAX_PARKED_CLIENTS	0
 #define DEFAULT_APPL_SERVER		"CAS"
 #define DEFAULT_EMPTY_STRING		"\0"
 #define DEFAULT_FILE_UPLOAD_DELIMITER   "^^"
@@ -582,6 +583,10 @@ broker_config_read_internal (const char *conf_file, T_BROKER_INFO * br_info, int
       br_info[num_brs].job_queue_size =
 	ini_getuint_max (ini, sec_name, "JOB_QUEUE_SIZE", DEFAULT_JOB_QUEUE_SIZE, JOB_QUEUE_MAX_SIZE, &lineno);
 
+      br_info[num_brs].max_parked_clients =
+	ini_getuint_max (ini, sec_name, "MAX_PARKED_CLIENTS", DEFAULT_MAX_PARKED_CLIENTS, PARKED_CLIENT_MAX_NUM,
+			 &lineno);
+
       strncpy_bufsize (time_str, ini_getstr (ini, sec_name, "TIME_TO_KILL", DEFAULT_TIME_TO_KILL, &lineno));
       br_info[num_brs].time_to_kill = (int) ut_time_string_to_sec (time_str, "sec");
       if (br_info[num_brs].time_to_kill < 0)
@@ -1230,6 +1235,7 @@ broker_config_dump (FILE * fp, const T_BROKER_INFO * br_info, int num_broker, in
 	  fprintf (fp, "AUTO_ADD_APPL_SERVER\t=%s\n", tmp_str);
 	}
       fprintf (fp, "JOB_QUEUE_SIZE\t\t=%d\n", br_info[i].job_queue_size);
+      fprintf (fp, "MAX_PARKED_CLIENTS\t=%d\n", br_info[i].max_parked_clients);
       fprintf (fp, "TIME_TO_KILL\t\t=%d\n", br_info[i].time_to_kill);
       tmp_str = get_conf_string (br_info[i].access_log, tbl_on_off);
       if (tmp_str)
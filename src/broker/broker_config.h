@@ -198,6 +198,7 @@ struct t_broker_info
   int mysql_read_timeout;
   int mysql_keepalive_interval;
   int job_queue_size;
+  int max_parked_clients;
   int time_to_kill;
   int err_code;
   int os_err_code;
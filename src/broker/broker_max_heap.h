@@ -47,6 +47,7 @@ struct t_max_heap_node
   T_BROKER_VERSION clt_version;
   char cas_client_type;
   char driver_info[SRV_CON_CLIENT_INFO_SIZE];
+  int park_id;			/* parked client slot, -1 for a new client */
 };
 
 int max_heap_insert (T_MAX_HEAP_NODE * max_heap, int max_heap_size, T_MAX_HEAP_NODE * item);
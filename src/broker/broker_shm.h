@@ -116,6 +116,8 @@
 
 #define		JOB_QUEUE_MAX_SIZE	2048
 
+#define		PARKED_CLIENT_MAX_NUM	65536
+
 #define MAX_CRYPT_STR_LENGTH            32
 
 #define APPL_SERVER_NAME_MAX_SIZE	32
@@ -312,6 +314,10 @@ struct t_appl_server_info
   char cur_sql_log2;
   char cur_slow_log_mode;
   char cur_statement_pooling;
+  char resume_client;		/* the client is resumed after being parked in broker */
+  int clt_cas_pid;		/* pid of the CAS the client connected to, known by the driver for query cancel; it is
+				 * not pid if the client is resumed after being parked in broker */
+  char pipelined_request;	/* more pipelined requests of the client are pending */
 #if defined(WINDOWS)
   char close_flag;
 #endif
@@ -616,6 +622,7 @@ struct t_shm_appl_server
   int num_appl_server;
   int max_string_length;
   int job_queue_size;
+  int max_parked_clients;
   int sql_log_max_size;
   int long_query_time;		/* msec */
   int long_transaction_time;	/* msec */
@@ -233,6 +233,10 @@ ut_kill_broker_process (int pid, char *broker_name)
 
       unlink (tmp);
 
+      ut_get_broker_park_port_name (tmp, broker_name, BROKER_PATH_MAX);
+
+      unlink (tmp);
+
       return 0;
     }
   return -1;
@@ -557,6 +561,20 @@ ut_get_broker_port_name (char *port_name, char *broker_name, int len)
     }
 }
 
+void
+ut_get_broker_park_port_name (char *port_name, char *broker_name, int len)
+{
+  char dir_name[BROKER_PATH_MAX];
+
+  get_cubrid_file (FID_SOCK_DIR, dir_name, BROKER_PATH_MAX);
+
+  if (snprintf (port_name, len, "%s%s.K", dir_name, broker_name) < 0)
+    {
+      assert (false);
+      port_name[0] = '\0';
+    }
+}
+
 void
 ut_get_proxy_port_name (char *port_name, char *broker_name, int proxy_id, int len)
 {
@@ -91,6 +91,7 @@ extern char *ut_get_ipv4_string (char *ip_str, int len, const unsigned char *ip_
 extern float ut_get_avg_from_array (int array[], int size);
 extern bool ut_is_appl_server_ready (int pid, char *ready_flag);
 extern void ut_get_broker_port_name (char *port_name, char *broker_name, int len);
+extern void ut_get_broker_park_port_name (char *port_name, char *broker_name, int len);
 extern void ut_get_proxy_port_name (char *port_name, char *broker_name, int proxy_id, int len);
 extern void ut_get_as_port_name (char *port_name, char *broker_name, int as_id, int len);
 
@@ -68,6 +68,7 @@
 
 #if !defined(WINDOWS)
 #include "broker_recv_fd.h"
+#include "broker_send_fd.h"
 #endif /* !WINDOWS */
 
 #include "broker_shm.h"
@@ -116,6 +117,10 @@ static int get_graceful_down_timeout (void);
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
 static void set_db_parameter (void);
 #endif /* !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL) */
+#if !defined(WINDOWS) && !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+static int cas_park_client (SOCKET client_sock_fd, int client_ip_addr, int client_port, char *db_info,
+			    int db_info_size, char *db_sessionid);
+#endif /* !WINDOWS && !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 
 static int net_read_int_keep_con_auto (SOCKET clt_sock_fd, MSG_HEADER * client_msg_header, T_REQ_INFO * req_info);
 static int net_read_header_keep_con_on (SOCKET clt_sock_fd, MSG_HEADER * client_msg_header);
@@ -168,6 +173,7 @@ char cas_client_type;
 int con_status_before_check_cas;
 bool is_first_request;
 SOCKET new_req_sock_fd = INVALID_SOCKET;
+static bool is_pipeline_aborted = false;
 #endif /* !LIBCAS_FOR_JSP */
 int cas_default_isolation_level = 0;
 int cas_default_lock_timeout = -1;
@@ -226,7 +232,8 @@ static T_SERVER_FUNC server_fn_table[] = {
   fn_not_supported,		/* CAS_FC_PREPARE_AND_EXECUTE */
   fn_not_supported,		/* CAS_FC_CURSOR_CLOSE */
   fn_not_supported,		/* CAS_FC_GET_SHARD_INFO */
-  fn_not_supported		/* CAS_FC_SET_CAS_CHANGE_MODE */
+  fn_not_supported,		/* CAS_FC_SET_CAS_CHANGE_MODE */
+  fn_not_supported		/* CAS_FC_FETCH_STREAM */
 };
 #else /* CAS_FOR_ORACLE || CAS_FOR_MYSQL */
 static T_SERVER_FUNC server_fn_table[] = {
@@ -273,7 +280,8 @@ static T_SERVER_FUNC server_fn_table[] = {
   fn_prepare_and_execute,	/* CAS_FC_PREPARE_AND_EXECUTE */
   fn_cursor_close,		/* CAS_FC_CURSOR_CLOSE */
   fn_not_supported,		/* CAS_FC_GET_SHARD_INFO */
-  fn_set_cas_change_mode	/* CAS_FC_SET_CAS_CHANGE_MODE */
+  fn_set_cas_change_mode,	/* CAS_FC_SET_CAS_CHANGE_MODE */
+  fn_fetch_stream		/* CAS_FC_FETCH_STREAM */
 };
 #endif /* CAS_FOR_ORACLE || CAS_FOR_MYSQL */
 
@@ -322,7 +330,8 @@ static const char *server_func_name[] = {
   "fn_prepare_and_execute",
   "fn_cursor_close",
   "fn_get_shard_info",
-  "fn_set_cas_change_mode"
+  "fn_set_cas_change_mode",
+  "fn_fetch_stream"
 };
 #endif /* !LIBCAS_FOR_JSP */
 
@@ -800,11 +809,14 @@ cas_main (void)
   char cas_info[CAS_INFO_SIZE] = { CAS_INFO_STATUS_INACTIVE,
     CAS_INFO_RESERVED_DEFAULT,
     CAS_INFO_RESERVED_DEFAULT,
-    CAS_INFO_RESERVED_DEFAULT
+    (char) (CAS_INFO_RESERVED_DEFAULT & ~(CAS_INFO_FLAG_MASK_PIPELINE | CAS_INFO_FLAG_MASK_MORE_REPLIES))
   };
   FN_RETURN fn_ret = FN_KEEP_CONN;
   char client_ip_str[16];
   bool is_new_connection;
+  bool is_resumed_client;
+  bool park_client;
+  int client_port = 0;
 
   prev_cas_info[CAS_INFO_STATUS] = CAS_INFO_RESERVED_DEFAULT;
 
@@ -900,9 +912,13 @@ cas_main (void)
 #endif /* WINDOWS */
 	as_info->con_status = CON_STATUS_IN_TRAN;
 	as_info->transaction_start_time = time (0);
+	as_info->pipelined_request = FALSE;
+	is_pipeline_aborted = false;
 	errors_in_transaction = 0;
 
 	client_ip_addr = 0;
+	is_resumed_client = false;
+	park_client = false;
 
 #if defined(WINDOWS)
 	client_sock_fd = br_sock_fd;
@@ -934,6 +950,22 @@ cas_main (void)
 	    CLOSE_SOCKET (br_sock_fd);
 	    goto finish_cas;
 	  }
+	client_port = as_info->cas_clt_port;
+#if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+	if (as_info->resume_client)
+	  {
+	    /* the client was parked in broker; its connection info is sent by broker, not by the client */
+	    if (net_read_int (br_sock_fd, &db_info_size) < 0 || db_info_size <= 0
+		|| db_info_size > (int) sizeof (read_buf) || net_read_stream (br_sock_fd, read_buf, db_info_size) < 0)
+	      {
+		cas_log_write_and_end (0, false, "HANDSHAKE ERROR read resumed client info");
+		CLOSE_SOCKET (br_sock_fd);
+		CLOSE_SOCKET (client_sock_fd);
+		goto finish_cas;
+	      }
+	    is_resumed_client = true;
+	  }
+#endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 	if (net_write_int (br_sock_fd, as_info->uts_status) < 0)
 	  {
 	    cas_log_write_and_end (0, false, "HANDSHAKE ERROR net_write_int(uts_status)");
@@ -980,7 +1012,7 @@ cas_main (void)
 	    goto finish_cas;
 	  }
 #if !defined(WINDOWS)
-	else
+	else if (!is_resumed_client)
 	  {
 	    /* send NO_ERROR to client */
 	    if (net_write_int (client_sock_fd, 0) < 0)
@@ -1007,7 +1039,7 @@ cas_main (void)
 	    db_info_size = SRV_CON_DB_INFO_SIZE;
 	  }
 
-	if (net_read_stream (client_sock_fd, read_buf, db_info_size) < 0)
+	if (!is_resumed_client && net_read_stream (client_sock_fd, read_buf, db_info_size) < 0)
 	  {
 	    cas_info[CAS_INFO_STATUS] = CAS_INFO_STATUS_INACTIVE;
 	    net_write_error (client_sock_fd, req_info.client_version, req_info.driver_info, cas_info, cas_info_size,
@@ -1228,8 +1260,16 @@ cas_main (void)
 	    cas_bi_set_cci_pconnect (shm_appl->cci_pconnect);
 
 	    cas_info[CAS_INFO_STATUS] = CAS_INFO_STATUS_ACTIVE;
-	    /* todo: casting T_BROKER_VERSION to T_CAS_PROTOCOL */
-	    cas_send_connect_reply_to_driver ((T_CAS_PROTOCOL) req_info.client_version, client_sock_fd, cas_info);
+	    if (is_resumed_client)
+	      {
+		/* the driver is already connected; its next request is waiting in the socket */
+		cas_log_write_and_end (0, false, "CLIENT RESUMED");
+	      }
+	    else
+	      {
+		/* todo: casting T_BROKER_VERSION to T_CAS_PROTOCOL */
+		cas_send_connect_reply_to_driver ((T_CAS_PROTOCOL) req_info.client_version, client_sock_fd, cas_info);
+	      }
 
 	    as_info->cci_default_autocommit = shm_appl->cci_default_autocommit;
 	    req_info.need_rollback = TRUE;
@@ -1292,6 +1332,15 @@ cas_main (void)
 		ux_database_shutdown ();
 		ux_database_connect (db_name, db_user, db_passwd, NULL);
 	      }
+#if !defined(WINDOWS) && !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+	    else if (fn_ret == FN_KEEP_SESS && as_info->con_status == CON_STATUS_CLOSE_AND_CONNECT
+		     && shm_appl->max_parked_clients > 0 && as_info->cur_statement_pooling == ON
+		     && as_info->reset_flag == FALSE)
+	      {
+		/* the idle client was taken over by another client; park it in broker instead of disconnecting it */
+		park_client = true;
+	      }
+#endif /* !WINDOWS && !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 
 	    if (as_info->reset_flag == TRUE)
 	      {
@@ -1305,6 +1354,22 @@ cas_main (void)
 #endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 	  }
 
+#if !defined(WINDOWS) && !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+	if (park_client)
+	  {
+	    if (cas_park_client (client_sock_fd, client_ip_addr, client_port, read_buf, db_info_size, db_sessionid) < 0)
+	      {
+		cas_log_write_and_end (0, false, "PARK CLIENT FAILED");
+	      }
+	    else
+	      {
+		cas_log_write_and_end (0, false, "CLIENT PARKED");
+	      }
+	    /* the connection info of the parked client is kept by broker only */
+	    memset (read_buf, 0, sizeof (read_buf));
+	  }
+#endif /* !WINDOWS && !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
+
 	CLOSE_SOCKET (client_sock_fd);
 
       finish_cas:
@@ -1361,6 +1426,58 @@ cas_main (void)
   return 0;
 }
 
+#if !defined(WINDOWS) && !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+/*
+ * cas_park_client () - hand an idle client connection over to broker
+ *   return: 0 if broker parked the client, -1 otherwise
+ *   client_sock_fd(in): client connection
+ *   client_ip_addr(in): client ip address
+ *   client_port(in): client port
+ *   db_info(in/out): connection info read from the client at connect time
+ *   db_info_size(in): size of db_info
+ *   db_sessionid(in/out): session field in db_info, NULL if the client did not send one
+ *
+ * Note: broker keeps the connection and queues it as a new job when the client sends its next request.
+ *       The CAS which takes the job connects to the database with the saved connection info, so the session
+ *       of this connection is written into it.
+ */
+static int
+cas_park_client (SOCKET client_sock_fd, int client_ip_addr, int client_port, char *db_info, int db_info_size,
+		 char *db_sessionid)
+{
+  SOCKET park_sock_fd;
+  int result = -1;
+
+  if (db_sessionid != NULL && DOES_CLIENT_UNDERSTAND_THE_PROTOCOL (req_info.client_version, PROTOCOL_V3))
+    {
+      cas_make_session_for_driver (db_sessionid);
+    }
+
+  park_sock_fd = net_connect_broker_park ();
+  if (IS_INVALID_SOCKET (park_sock_fd))
+    {
+      return -1;
+    }
+
+  net_timeout_set (NET_MIN_TIMEOUT);
+
+  /* broker replies 0 when the client is parked */
+  if (send_fd (park_sock_fd, client_sock_fd, client_ip_addr, req_info.driver_info) < 0
+      || net_write_int (park_sock_fd, client_port) < 0 || net_write_int (park_sock_fd, req_info.client_version) < 0
+      || net_write_int (park_sock_fd, cas_client_type) < 0 || net_write_int (park_sock_fd, as_info->clt_cas_pid) < 0
+      || net_write_int (park_sock_fd, db_info_size) < 0
+      || net_write_stream (park_sock_fd, db_info, db_info_size) < 0 || net_read_int (park_sock_fd, &result) < 0)
+    {
+      result = -1;
+    }
+
+  net_timeout_set (NET_DEFAULT_TIMEOUT);
+  CLOSE_SOCKET (park_sock_fd);
+
+  return (result == 0) ? 0 : -1;
+}
+#endif /* !WINDOWS && !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
+
 #else /* LIBCAS_FOR_JSP */
 int
 libcas_main (SOCKET jsp_sock_fd)
@@ -1635,6 +1752,40 @@ query_cancel (int signo)
 }
 #endif /* !LIBCAS_FOR_JSP */
 
+/*
+ * cas_send_result_page () - send what net_buf holds as a complete reply while the request is still being processed,
+ *                           and empty net_buf for the next reply
+ */
+int
+cas_send_result_page (SOCKET sock_fd, T_NET_BUF * net_buf)
+{
+  MSG_HEADER msg_header;
+  int err_code;
+
+  init_msg_header (&msg_header);
+#ifndef LIBCAS_FOR_JSP
+  if (as_info->con_status == CON_STATUS_IN_TRAN)
+    {
+      msg_header.info_ptr[CAS_INFO_STATUS] = CAS_INFO_STATUS_ACTIVE;
+    }
+  msg_header.info_ptr[CAS_INFO_ADDITIONAL_FLAG] &= ~CAS_INFO_FLAG_MASK_AUTOCOMMIT;
+  msg_header.info_ptr[CAS_INFO_ADDITIONAL_FLAG] |= (as_info->cci_default_autocommit & CAS_INFO_FLAG_MASK_AUTOCOMMIT);
+#endif /* !LIBCAS_FOR_JSP */
+  msg_header.info_ptr[CAS_INFO_ADDITIONAL_FLAG] |= CAS_INFO_FLAG_MASK_MORE_REPLIES;
+
+  *(msg_header.msg_body_size_ptr) = htonl (net_buf->data_size);
+  memcpy (net_buf->data, msg_header.msg_body_size_ptr, NET_BUF_HEADER_MSG_SIZE);
+  if (cas_info_size > 0)
+    {
+      memcpy (net_buf->data + NET_BUF_HEADER_MSG_SIZE, msg_header.info_ptr, cas_info_size);
+    }
+
+  err_code = net_write_stream (sock_fd, net_buf->data, NET_BUF_CURR_SIZE (net_buf));
+  net_buf->data_size = 0;
+
+  return err_code;
+}
+
 static FN_RETURN
 process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 {
@@ -1650,6 +1801,7 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 #endif
   T_SERVER_FUNC server_fn;
   FN_RETURN fn_ret = FN_KEEP_CONN;
+  bool is_pipelined_request = false;
 
   error_info_clear ();
   init_msg_header (&client_msg_header);
@@ -1800,6 +1952,16 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 	}
     }
 
+#ifndef LIBCAS_FOR_JSP
+  if (cas_shard_flag == OFF)
+    {
+      /* while the client has more requests in flight, the CAS must not be given to another client */
+      is_pipelined_request =
+	(client_msg_header.info_ptr[CAS_INFO_ADDITIONAL_FLAG] & CAS_INFO_FLAG_MASK_PIPELINE) ? true : false;
+      as_info->pipelined_request = is_pipelined_request;
+    }
+#endif /* !LIBCAS_FOR_JSP */
+
 #ifndef LIBCAS_FOR_JSP
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
 #if !defined(WINDOWS)
@@ -1965,9 +2127,34 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 
   net_buf->client_version = req_info->client_version;
   set_hang_check_time ();
-  fn_ret = (*server_fn) (sock_fd, argc, argv, net_buf, req_info);
+#ifndef LIBCAS_FOR_JSP
+  if (is_pipeline_aborted)
+    {
+      /* a previous request of the pipeline failed; the rest of the pipeline is not executed */
+      ERROR_INFO_SET (CAS_ER_PIPELINE_ABORTED, CAS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+    }
+  else
+#endif /* !LIBCAS_FOR_JSP */
+    {
+      fn_ret = (*server_fn) (sock_fd, argc, argv, net_buf, req_info);
+    }
   set_hang_check_time ();
 
+#ifndef LIBCAS_FOR_JSP
+  if (is_pipelined_request)
+    {
+      if (err_info.err_number < 0)
+	{
+	  is_pipeline_aborted = true;
+	}
+    }
+  else
+    {
+      is_pipeline_aborted = false;
+    }
+#endif /* !LIBCAS_FOR_JSP */
+
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
   /* set back original utype for enum, date-time, JSON */
   if (DOES_CLIENT_MATCH_THE_PROTOCOL (req_info->client_version, PROTOCOL_V2))
@@ -2035,7 +2222,7 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 	    {
 	      fn_ret = FN_CLOSE_CONN;
 	    }
-	  else if (restart_is_needed ())
+	  else if (restart_is_needed () && !is_pipelined_request)
 	    {
 	      fn_ret = FN_KEEP_SESS;
 	    }
@@ -2136,7 +2323,7 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
     }
 
 #ifndef LIBCAS_FOR_JSP
-  if (as_info->reset_flag
+  if (as_info->reset_flag && !is_pipelined_request
       &&
       ((as_info->con_status != CON_STATUS_IN_TRAN && as_info->num_holdable_results < 1
 	&& as_info->cas_change_mode == CAS_CHANGE_MODE_AUTO) || (cas_get_db_connect_status () == -1)))
@@ -138,6 +138,8 @@ extern void unset_hang_check_time (void);
 
 extern bool check_server_alive (const char *db_name, const char *db_host);
 
+extern int cas_send_result_page (SOCKET sock_fd, struct t_net_buf *net_buf);
+
 extern void cas_set_db_connect_status (int status);
 extern int cas_get_db_connect_status (void);
 extern T_BROKER_VERSION cas_get_client_version (void);
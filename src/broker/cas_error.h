@@ -73,6 +73,9 @@ extern "C"
     CAS_ER_DBSERVER_DISCONNECTED = -10025,
     CAS_ER_MAX_PREPARED_STMT_COUNT_EXCEEDED = -10026,
     CAS_ER_HOLDABLE_NOT_ALLOWED = -10027,
+    CAS_ER_HOLDABLE_NOT_ALLOWED_KEEP_CON_OFF = -10028,	/* set by the JDBC driver */
+    CAS_ER_PIPELINE_ABORTED = -10029,
+    CAS_ER_LAST = CAS_ER_PIPELINE_ABORTED,
     CAS_ER_NOT_IMPLEMENTED = -10100,
     CAS_ER_MAX_CLIENT_EXCEEDED = -10101,
     CAS_ER_INVALID_CURSOR_POS = -10102,
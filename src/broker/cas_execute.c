@@ -5367,6 +5367,7 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
       else if (err_code == DB_CURSOR_END)
 	{
 	  fetch_end_flag = 1;
+	  srv_handle->is_fetch_completed = true;
 
 	  net_buf_cp_int (net_buf, 0, NULL);
 
@@ -5453,6 +5454,7 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
       cursor_pos++;
       if (srv_handle->max_row > 0 && cursor_pos > srv_handle->max_row)
 	{
+	  srv_handle->is_fetch_completed = true;
 	  if (check_auto_commit_after_getting_result (srv_handle) == true)
 	    {
 	      ux_cursor_close (srv_handle);
@@ -5468,6 +5470,7 @@ fetch_result (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count, char f
       else if (err_code == DB_CURSOR_END)
 	{
 	  fetch_end_flag = 1;
+	  srv_handle->is_fetch_completed = true;
 
 	  if (check_auto_commit_after_getting_result (srv_handle) == true)
 	    {
@@ -1094,6 +1094,85 @@ fn_fetch (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO
 }
 
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
+/*
+ * fn_fetch_stream () - fetch up to num_pages result pages, sending each page as a reply without waiting for another
+ *                      request; the client grants num_pages credits and asks again for more
+ *
+ * The stream stops at the end of the result set or at the first error. The last page is sent as the reply of the
+ * request itself; the pages before it carry CAS_INFO_FLAG_MASK_MORE_REPLIES.
+ */
+FN_RETURN
+fn_fetch_stream (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
+{
+  int srv_h_id;
+  int cursor_pos;
+  int num_pages;
+  int page;
+  char fetch_flag;
+  int result_set_index;
+  T_SRV_HANDLE *srv_handle;
+
+  if (argc < 5)
+    {
+      ERROR_INFO_SET (CAS_ER_ARGS, CAS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+      return FN_KEEP_CONN;
+    }
+
+  net_arg_get_int (&srv_h_id, argv[0]);
+  net_arg_get_int (&cursor_pos, argv[1]);
+  net_arg_get_int (&num_pages, argv[2]);
+  net_arg_get_char (fetch_flag, argv[3]);
+  net_arg_get_int (&result_set_index, argv[4]);
+
+  srv_handle = hm_find_srv_handle (srv_h_id);
+  if (srv_handle == NULL)
+    {
+      ERROR_INFO_SET (CAS_ER_SRV_HANDLE, CAS_ERROR_INDICATOR);
+      NET_BUF_ERR_SET (net_buf);
+      return FN_KEEP_CONN;
+    }
+
+  if (num_pages <= 0)
+    {
+      num_pages = 1;
+    }
+  else if (num_pages > FETCH_STREAM_MAX_PAGES)
+    {
+      num_pages = FETCH_STREAM_MAX_PAGES;
+    }
+
+  /* only query results are streamed; the proxy expects one reply per request */
+  if (cas_shard_flag == ON || srv_handle->schema_type >= 0 || (srv_handle->prepare_flag & CCI_PREPARE_CALL))
+    {
+      num_pages = 1;
+    }
+
+  cas_log_write (SRV_HANDLE_QUERY_SEQ_NUM (srv_handle), false, "fetch_stream srv_h_id %d cursor_pos %d num_pages %d",
+		 srv_h_id, cursor_pos, num_pages);
+
+  for (page = 1;; page++)
+    {
+      srv_handle->is_fetch_completed = false;
+
+      ux_fetch (srv_handle, cursor_pos, 0, fetch_flag, result_set_index, net_buf, req_info);
+
+      if (page >= num_pages || net_buf->err_code != 0 || srv_handle->is_fetch_completed
+	  || req_info->need_auto_commit != TRAN_NOT_AUTOCOMMIT || srv_handle->cursor_pos == cursor_pos)
+	{
+	  break;
+	}
+
+      if (cas_send_result_page (sock_fd, net_buf) < 0)
+	{
+	  return FN_CLOSE_CONN;
+	}
+      cursor_pos = srv_handle->cursor_pos;
+    }
+
+  return FN_KEEP_CONN;
+}
+
 FN_RETURN
 fn_schema_info (SOCKET sock_fd, int argc, void **argv, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 {
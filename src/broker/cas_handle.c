@@ -111,6 +111,7 @@ hm_new_srv_handle (T_SRV_HANDLE ** new_handle, unsigned int seq_num)
   srv_handle->use_plan_cache = false;
   srv_handle->use_query_cache = false;
   srv_handle->is_holdable = false;
+  srv_handle->is_fetch_completed = false;
   srv_handle->is_from_current_transaction = true;
 #if defined(CAS_FOR_ORACLE)
   srv_handle->has_out_result = false;
@@ -38,7 +38,8 @@ static char broker_info[BROKER_INFO_SIZE] = {
   CAS_STATEMENT_POOLING_ON,
   CCI_PCONNECT_ON,
   CAS_PROTO_PACK_CURRENT_NET_VER,
-  (char) BROKER_RENEWED_ERROR_CODE | (char) BROKER_SUPPORT_HOLDABLE_RESULT,
+  (char) BROKER_RENEWED_ERROR_CODE | (char) BROKER_SUPPORT_HOLDABLE_RESULT | (char) BROKER_SUPPORT_PIPELINED_REQUEST
+    | (char) BROKER_SUPPORT_STREAMING_FETCH,
   0,
   0
 };
@@ -245,6 +245,45 @@ net_connect_proxy (void)
   net_error_flag = 0;
   return (fd);
 }
+
+#if !defined(WINDOWS)
+/*
+ * net_connect_broker_park () - connect to the broker socket where idle clients are parked
+ */
+SOCKET
+net_connect_broker_park (void)
+{
+  int fd, len;
+  struct sockaddr_un park_sock_addr;
+  char port_name[BROKER_PATH_MAX];
+
+  ut_get_broker_park_port_name (port_name, shm_appl->broker_name, BROKER_PATH_MAX);
+
+  if ((fd = socket (AF_UNIX, SOCK_STREAM, 0)) < 0)
+    {
+      return (INVALID_SOCKET);
+    }
+
+  memset (&park_sock_addr, 0, sizeof (park_sock_addr));
+  park_sock_addr.sun_family = AF_UNIX;
+  strncpy_bufsize (park_sock_addr.sun_path, port_name);
+#ifdef  _SOCKADDR_LEN		/* 4.3BSD Reno and later */
+  len = sizeof (park_sock_addr.sun_len) + sizeof (park_sock_addr.sun_family) + strlen (park_sock_addr.sun_path) + 1;
+  park_sock_addr.sun_len = len;
+#else /* vanilla 4.3BSD */
+  len = strlen (park_sock_addr.sun_path) + sizeof (park_sock_addr.sun_family) + 1;
+#endif
+
+  if (connect (fd, (struct sockaddr *) &park_sock_addr, len) < 0)
+    {
+      CLOSE_SOCKET (fd);
+      return (INVALID_SOCKET);
+    }
+
+  net_error_flag = 0;
+  return (fd);
+}
+#endif /* !WINDOWS */
 #endif /* LIBCAS_FOR_JSP */
 
 SOCKET
@@ -359,6 +398,12 @@ init_msg_header (MSG_HEADER * header)
 
   /* BROKER_RECONNECT_DOWN_SERVER does not supported. so CAS_INFO_FLAG_MASK_NEW_SESSION_ID flag must be disabled. */
   header->info_ptr[CAS_INFO_ADDITIONAL_FLAG] &= ~CAS_INFO_FLAG_MASK_NEW_SESSION_ID;
+
+  /* clients send back the cas info they received, so the pipeline flag must be clear unless they set it */
+  header->info_ptr[CAS_INFO_ADDITIONAL_FLAG] &= ~CAS_INFO_FLAG_MASK_PIPELINE;
+
+  /* only the pages of a streaming fetch but the last are marked */
+  header->info_ptr[CAS_INFO_ADDITIONAL_FLAG] &= ~CAS_INFO_FLAG_MASK_MORE_REPLIES;
 }
 
 
@@ -101,6 +101,8 @@ extern "C"
 #define CAS_INFO_FLAG_MASK_AUTOCOMMIT		0x01
 #define CAS_INFO_FLAG_MASK_FORCE_OUT_TRAN       0x02
 #define CAS_INFO_FLAG_MASK_NEW_SESSION_ID       0x04
+#define CAS_INFO_FLAG_MASK_PIPELINE             0x08	/* more requests of the pipeline follow */
+#define CAS_INFO_FLAG_MASK_MORE_REPLIES         0x10	/* more replies to the request follow */
 
 #define CAS_INFO_SIZE			(4)
 #define CAS_INFO_RESERVED_DEFAULT	(-1)
@@ -114,6 +116,11 @@ extern "C"
 #define BROKER_SUPPORT_HOLDABLE_RESULT          0x40
 /* Do not remove or rename BROKER_RECONNECT_WHEN_SERVER_DOWN */
 #define BROKER_RECONNECT_WHEN_SERVER_DOWN       0x20
+#define BROKER_SUPPORT_PIPELINED_REQUEST        0x10
+#define BROKER_SUPPORT_STREAMING_FETCH          0x08
+
+/* maximum number of result pages the CAS pushes for one streaming fetch request */
+#define FETCH_STREAM_MAX_PAGES                  64
 
 /* For backward compatibility */
 #define BROKER_INFO_MAJOR_VERSION               (BROKER_INFO_PROTO_VERSION)
@@ -197,6 +204,7 @@ extern "C"
     CAS_FC_CURSOR_CLOSE = 42,
     CAS_FC_GET_SHARD_INFO = 43,
     CAS_FC_CAS_CHANGE_MODE = 44,
+    CAS_FC_FETCH_STREAM = 45,
 
     /* Whenever you want to introduce a new function code, you must add a corresponding function entry to
      * server_fn_table of both CUBRID and (MySQL, Oracle). */
@@ -115,7 +115,9 @@ static T_PROXY_CLIENT_FUNC proxy_client_fn_table[] = {
   fn_proxy_client_not_supported,	/* fn_get_last_insert_id */
   fn_proxy_client_prepare_and_execute,	/* fn_prepare_and_execute */
   fn_proxy_client_cursor_close,	/* fn_cursor_close */
-  fn_proxy_get_shard_info	/* fn_get_shard_info */
+  fn_proxy_get_shard_info,	/* fn_get_shard_info */
+  fn_proxy_client_not_supported,	/* fn_set_cas_change_mode */
+  fn_proxy_client_not_supported	/* fn_fetch_stream */
 };
 
 
@@ -162,7 +164,9 @@ static T_PROXY_CAS_FUNC proxy_cas_fn_table[] = {
   fn_proxy_cas_relay_only,	/* fn_get_last_insert_id */
   fn_proxy_cas_prepare_and_execute,	/* fn_prepare_and_execute */
   fn_proxy_cas_relay_only,	/* fn_cursor_close */
-  fn_proxy_cas_relay_only	/* fn_get_shard_info */
+  fn_proxy_cas_relay_only,	/* fn_get_shard_info */
+  fn_proxy_cas_relay_only,	/* fn_set_cas_change_mode */
+  fn_proxy_cas_relay_only	/* fn_fetch_stream */
 };
 
 
@@ -1427,6 +1427,170 @@ execute_end:
   return error;
 }
 
+/*
+ * cci_execute_pipeline () - execute prepared statements of one connection and optionally end the transaction, sending
+ *                           all the requests before waiting for the first reply
+ *   results(out): result of each statement, as cci_execute would return it
+ *   end_tran_type(in): CCI_TRAN_COMMIT or CCI_TRAN_ROLLBACK to end the transaction after the statements, 0 not to
+ *
+ * Execution stops at the first failure: the remaining statements and the end of the transaction fail with
+ * CAS_ER_PIPELINE_ABORTED and the transaction is left to the application to roll back. The requests are sent one by
+ * one when the broker does not support pipelined requests.
+ */
+int
+cci_execute_pipeline (int *mapped_stmt_ids, int num_stmts, char flag, int max_col_size, char end_tran_type,
+		      int *results, T_CCI_ERROR * err_buf)
+{
+  T_CON_HANDLE *con_handle = NULL;
+  T_REQ_HANDLE **req_handles = NULL;
+  int error = CCI_ER_NO_ERROR;
+  int i;
+
+#ifdef CCI_DEBUG
+  CCI_DEBUG_PRINT (print_debug_msg ("cci_execute_pipeline: %d, %d, %d", num_stmts, flag, end_tran_type));
+#endif
+
+  reset_error_buffer (err_buf);
+  if (mapped_stmt_ids == NULL || results == NULL || num_stmts <= 0)
+    {
+      set_error_buffer (err_buf, CCI_ER_INVALID_ARGS, NULL);
+      return CCI_ER_INVALID_ARGS;
+    }
+
+  req_handles = (T_REQ_HANDLE **) MALLOC (sizeof (T_REQ_HANDLE *) * num_stmts);
+  if (req_handles == NULL)
+    {
+      set_error_buffer (err_buf, CCI_ER_NO_MORE_MEMORY, NULL);
+      return CCI_ER_NO_MORE_MEMORY;
+    }
+
+  error = hm_get_statement (mapped_stmt_ids[0], &con_handle, &req_handles[0]);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      FREE_MEM (req_handles);
+      set_error_buffer (err_buf, error, NULL);
+      return error;
+    }
+  reset_error_buffer (&(con_handle->err_buf));
+  con_handle->shard_id = CCI_SHARD_ID_INVALID;
+
+  API_SLOG (con_handle);
+  if (con_handle->log_trace_api)
+    {
+      CCI_LOGF_DEBUG (con_handle->logger, "NUM_STMTS[%d], FLAG[%d], MAX_COL_SIZE[%d], END_TRAN[%d]", num_stmts, flag,
+		      max_col_size, end_tran_type);
+    }
+
+  for (i = 0; i < num_stmts; i++)
+    {
+      results[i] = CAS_ER_PIPELINE_ABORTED;
+    }
+
+  for (i = 1; i < num_stmts; i++)
+    {
+      error = hm_get_statement_of_connection (mapped_stmt_ids[i], con_handle, &req_handles[i]);
+      if (error != CCI_ER_NO_ERROR)
+	{
+	  goto pipeline_end;
+	}
+    }
+
+  if (flag & CCI_EXEC_ONLY_QUERY_PLAN)
+    {
+      flag |= CCI_EXEC_QUERY_INFO;
+    }
+
+  /* Asynchronous mode is unsupported. */
+  flag &= ~CCI_EXEC_ASYNC;
+
+  if (IS_OUT_TRAN (con_handle) && IS_FORCE_FAILBACK (con_handle) && !IS_INVALID_SOCKET (con_handle->sock_fd))
+    {
+      hm_force_close_connection (con_handle);
+    }
+  SET_START_TIME_FOR_QUERY (con_handle, NULL);
+
+  if (IS_OUT_TRAN (con_handle) && IS_INVALID_SOCKET (con_handle->sock_fd))
+    {
+      /* the statements are prepared again on the new connection */
+      error = reset_connect (con_handle, NULL, &(con_handle->err_buf));
+      if (error != CCI_ER_NO_ERROR)
+	{
+	  goto pipeline_end;
+	}
+      for (i = 0; i < num_stmts; i++)
+	{
+	  req_handles[i]->valid = 0;
+	}
+    }
+
+  for (i = 0; i < num_stmts; i++)
+    {
+      if (req_handles[i]->valid == false)
+	{
+	  req_handle_content_free (req_handles[i], 1);
+	  error =
+	    qe_prepare (req_handles[i], con_handle, req_handles[i]->sql_text, req_handles[i]->prepare_flag,
+			&(con_handle->err_buf), 1);
+	  if (error < 0)
+	    {
+	      results[i] = error;
+	      goto pipeline_end;
+	    }
+	}
+    }
+
+  if (hm_broker_support_pipelined_request (con_handle))
+    {
+      error =
+	qe_execute_pipeline (con_handle, req_handles, num_stmts, flag, max_col_size, end_tran_type, results,
+			     &(con_handle->err_buf));
+    }
+  else
+    {
+      for (i = 0; i < num_stmts; i++)
+	{
+	  results[i] = qe_execute (req_handles[i], con_handle, flag, max_col_size, &(con_handle->err_buf));
+	  if (results[i] < 0)
+	    {
+	      error = results[i];
+	      goto pipeline_end;
+	    }
+	}
+
+      if (end_tran_type == CCI_TRAN_COMMIT || end_tran_type == CCI_TRAN_ROLLBACK)
+	{
+	  error = qe_end_tran (con_handle, end_tran_type, &(con_handle->err_buf));
+	}
+      else
+	{
+	  error = CCI_ER_NO_ERROR;
+	}
+    }
+
+pipeline_end:
+  RESET_START_TIME (con_handle);
+
+  if (error == CCI_ER_QUERY_TIMEOUT && con_handle->disconnect_on_query_timeout)
+    {
+      hm_force_close_connection (con_handle);
+    }
+
+  if (IS_OUT_TRAN (con_handle))
+    {
+      hm_check_rc_time (con_handle);
+    }
+
+  API_ELOG (con_handle, error);
+
+  FREE_MEM (req_handles);
+
+  set_error_buffer (&(con_handle->err_buf), error, NULL);
+  get_last_error (con_handle, err_buf);
+  con_handle->used = false;
+
+  return (error < 0) ? error : CCI_ER_NO_ERROR;
+}
+
 /*
  * For the purpose of re-balancing existing connections, cci_prepare,
  * cci_execute, cci_execute_array, cci_prepare_and_execute,
@@ -2316,6 +2480,39 @@ cci_fetch_size (int mapped_stmt_id, int fetch_size)
   return error;
 }
 
+/*
+ * cci_fetch_stream () - make cci_fetch stream the result of the statement: each request to the CAS grants it num_pages
+ *                       result pages, which it sends without waiting for further requests; 0 stops streaming
+ */
+int
+cci_fetch_stream (int mapped_stmt_id, int num_pages)
+{
+  T_CON_HANDLE *con_handle = NULL;
+  T_REQ_HANDLE *req_handle = NULL;
+  int error;
+
+#ifdef CCI_FULL_DEBUG
+  CCI_DEBUG_PRINT (print_debug_msg
+		   ("(%d:%d)cci_fetch_stream: %d", CON_ID (mapped_stmt_id), REQ_ID (mapped_stmt_id), num_pages));
+#endif
+
+  if (num_pages < 0)
+    {
+      return CCI_ER_INVALID_ARGS;
+    }
+
+  error = hm_get_statement (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      return error;
+    }
+
+  req_handle->fetch_stream_pages = num_pages;
+  con_handle->used = false;
+
+  return error;
+}
+
 int
 cci_fetch (int mapped_stmt_id, T_CCI_ERROR * err_buf)
 {
@@ -4643,6 +4840,9 @@ cci_get_err_msg_internal (int error)
     case CAS_ER_STMT_POOLING:
       return "Invalid plan";
 
+    case CAS_ER_PIPELINE_ABORTED:
+      return "Not executed after the failure of a previous pipelined request";
+
     case CAS_ER_DBSERVER_DISCONNECTED:
       return "Cannot communicate with DB Server";
 
@@ -4652,6 +4852,9 @@ cci_get_err_msg_internal (int error)
     case CAS_ER_HOLDABLE_NOT_ALLOWED:
       return "Holdable results may not be updatable or sensitive";
 
+    case CAS_ER_HOLDABLE_NOT_ALLOWED_KEEP_CON_OFF:
+      return "Holdable results are not allowed while KEEP_CONNECTION is off";
+
     case CAS_ER_MAX_CLIENT_EXCEEDED:
       return "Proxy refused client connection. max clients exceeded";
 
@@ -802,6 +802,8 @@ extern "C"
   extern int cci_bind_param_ex (int mapped_stmt_id, int index,
 				T_CCI_A_TYPE a_type, void *value, int length, T_CCI_U_TYPE u_type, char flag);
   extern int cci_execute (int req_handle, char flag, int max_col_size, T_CCI_ERROR * err_buf);
+  extern int cci_execute_pipeline (int *req_handles, int num_stmts, char flag, int max_col_size,
+				   char end_tran_type, int *results, T_CCI_ERROR * err_buf);
   extern int cci_prepare_and_execute (int con_handle, char *sql_stmt,
 				      int max_col_size, int *exec_retval, T_CCI_ERROR * err_buf);
   extern int cci_get_db_parameter (int con_handle, T_CCI_DB_PARAM param_name, void *value, T_CCI_ERROR * err_buf);
@@ -812,6 +814,7 @@ extern "C"
   extern int cci_close_req_handle (int req_handle);
   extern int cci_cursor (int req_handle, int offset, T_CCI_CURSOR_POS origin, T_CCI_ERROR * err_buf);
   extern int cci_fetch_size (int req_handle, int fetch_size);
+  extern int cci_fetch_stream (int req_handle, int num_pages);
   extern int cci_fetch (int req_handle, T_CCI_ERROR * err_buf);
   extern int cci_get_data (int req_handle, int col_no, int type, void *value, int *indicator);
   extern int cci_schema_info (int con_handle, T_CCI_SCH_TYPE type, char *arg1,
@@ -665,6 +665,47 @@ hm_get_statement (int mapped_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** sta
   return CCI_ER_NO_ERROR;
 }
 
+/*
+ * hm_get_statement_of_connection () - resolve a statement of a connection which is already held by the caller
+ */
+T_CCI_ERROR_CODE
+hm_get_statement_of_connection (int mapped_id, T_CON_HANDLE * connection, T_REQ_HANDLE ** statement)
+{
+  int statement_id;
+  T_CCI_ERROR_CODE error;
+
+  if (statement == NULL)
+    {
+      return CCI_ER_REQ_HANDLE;
+    }
+  *statement = NULL;
+
+  error = map_get_ots_value (mapped_id, &statement_id, true);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      return error;
+    }
+
+  if (GET_CON_ID (statement_id) != connection->id)
+    {
+      return CCI_ER_REQ_HANDLE;
+    }
+
+  statement_id = GET_REQ_ID (statement_id);
+  if (statement_id < 1 || statement_id > connection->max_req_handle)
+    {
+      return CCI_ER_REQ_HANDLE;
+    }
+
+  *statement = connection->req_handle_table[statement_id - 1];
+  if (*statement == NULL)
+    {
+      return CCI_ER_REQ_HANDLE;
+    }
+
+  return CCI_ER_NO_ERROR;
+}
+
 static T_CCI_ERROR_CODE
 hm_release_connection_internal (int mapped_id, T_CON_HANDLE ** connection, bool delete_handle)
 {
@@ -825,6 +866,13 @@ hm_req_handle_close_all_unholdable_resultsets (T_CON_HANDLE * con_handle)
 
 void
 hm_req_handle_fetch_buf_free (T_REQ_HANDLE * req_handle)
+{
+  hm_req_handle_tuple_buf_free (req_handle);
+  hm_req_handle_stream_buf_free (req_handle);
+}
+
+void
+hm_req_handle_tuple_buf_free (T_REQ_HANDLE * req_handle)
 {
   int i, fetched_tuple;
 
@@ -853,6 +901,23 @@ hm_req_handle_fetch_buf_free (T_REQ_HANDLE * req_handle)
   req_handle->is_fetch_completed = 0;
 }
 
+void
+hm_req_handle_stream_buf_free (T_REQ_HANDLE * req_handle)
+{
+  int i;
+
+  if (req_handle->stream_pages != NULL)
+    {
+      for (i = req_handle->next_stream_page; i < req_handle->num_stream_pages; i++)
+	{
+	  FREE_MEM (req_handle->stream_pages[i].msg);
+	}
+      FREE_MEM (req_handle->stream_pages);
+    }
+  req_handle->num_stream_pages = 0;
+  req_handle->next_stream_page = 0;
+}
+
 int
 hm_conv_value_buf_alloc (T_VALUE_BUF * val_buf, int size)
 {
@@ -1155,6 +1220,22 @@ hm_broker_support_holdable_result (T_CON_HANDLE * con_handle)
   return (f & BROKER_SUPPORT_HOLDABLE_RESULT) == BROKER_SUPPORT_HOLDABLE_RESULT;
 }
 
+bool
+hm_broker_support_pipelined_request (T_CON_HANDLE * con_handle)
+{
+  char f = con_handle->broker_info[BROKER_INFO_FUNCTION_FLAG];
+
+  return (f & BROKER_SUPPORT_PIPELINED_REQUEST) == BROKER_SUPPORT_PIPELINED_REQUEST;
+}
+
+bool
+hm_broker_support_streaming_fetch (T_CON_HANDLE * con_handle)
+{
+  char f = con_handle->broker_info[BROKER_INFO_FUNCTION_FLAG];
+
+  return (f & BROKER_SUPPORT_STREAMING_FETCH) == BROKER_SUPPORT_STREAMING_FETCH;
+}
+
 bool
 hm_broker_reconnect_when_server_down (T_CON_HANDLE * con_handle)
 {
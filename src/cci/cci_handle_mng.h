@@ -135,6 +135,12 @@ typedef struct
   void *data;
 } T_VALUE_BUF;
 
+typedef struct
+{
+  char *msg;
+  int size;
+} T_FETCH_STREAM_PAGE;
+
 typedef struct
 {
   int req_handle_index;
@@ -157,6 +163,10 @@ typedef struct
   int bind_array_size;
   int num_col_info;
   int fetch_size;
+  int fetch_stream_pages;	/* credits granted per streaming fetch request, 0 not to stream */
+  T_FETCH_STREAM_PAGE *stream_pages;	/* result pages received ahead */
+  int num_stream_pages;
+  int next_stream_page;
   char *msg_buf;
   int cursor_pos;
   int fetched_tuple_begin;
@@ -283,10 +293,14 @@ extern T_CCI_ERROR_CODE hm_get_connection_by_resolved_id (int resolved_id, T_CON
 extern T_CCI_ERROR_CODE hm_get_connection_force (int mapped_id, T_CON_HANDLE ** connection);
 extern T_CCI_ERROR_CODE hm_get_connection (int connection_id, T_CON_HANDLE ** connection);
 extern T_CCI_ERROR_CODE hm_get_statement (int statement_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** statement);
+extern T_CCI_ERROR_CODE hm_get_statement_of_connection (int mapped_id, T_CON_HANDLE * connection,
+							T_REQ_HANDLE ** statement);
 extern T_CCI_ERROR_CODE hm_release_connection (int connection_id, T_CON_HANDLE ** connection);
 extern T_CCI_ERROR_CODE hm_delete_connection (int connection_id, T_CON_HANDLE ** connection);
 extern T_CCI_ERROR_CODE hm_release_statement (int statement_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** statement);
 extern void hm_req_handle_fetch_buf_free (T_REQ_HANDLE * req_handle);
+extern void hm_req_handle_tuple_buf_free (T_REQ_HANDLE * req_handle);
+extern void hm_req_handle_stream_buf_free (T_REQ_HANDLE * req_handle);
 extern int hm_conv_value_buf_alloc (T_VALUE_BUF * val_buf, int size);
 
 extern void req_handle_col_info_free (T_REQ_HANDLE * req_handle);
@@ -306,6 +320,8 @@ extern bool hm_broker_understand_the_protocol (T_BROKER_VERSION broker_version,
 extern bool hm_broker_match_the_protocol (T_BROKER_VERSION broker_version, int require);
 
 extern bool hm_broker_support_holdable_result (T_CON_HANDLE * con_handle);
+extern bool hm_broker_support_pipelined_request (T_CON_HANDLE * con_handle);
+extern bool hm_broker_support_streaming_fetch (T_CON_HANDLE * con_handle);
 extern bool hm_broker_reconnect_when_server_down (T_CON_HANDLE * con_handle);
 
 extern void hm_set_con_handle_holdable (T_CON_HANDLE * con_handle, int holdable);
@@ -202,6 +202,16 @@ static int decode_fetch_result (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_ha
 				char *result_msg_start, int result_msg_size);
 static int qe_close_req_handle_internal (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, bool force_close);
 static int qe_send_close_handle_msg (T_CON_HANDLE * con_handle, int server_handle_id);
+static int qe_execute_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size,
+			    int *recv_timeout);
+static int qe_execute_recv (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int recv_timeout,
+			    T_CCI_ERROR * err_buf);
+static int qe_end_tran_send (T_CON_HANDLE * con_handle, char type);
+static int qe_end_tran_recv (T_CON_HANDLE * con_handle, char type, T_CCI_ERROR * err_buf);
+static int qe_fetch_stream (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, int result_set_index,
+			    T_CCI_ERROR * err_buf);
+static int qe_fetch_stream_request (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, int result_set_index,
+				    T_CCI_ERROR * err_buf);
 #if defined(WINDOWS)
 static int get_windows_charset_code (char *str);
 #endif
@@ -268,12 +278,27 @@ con_close_end:
 
 int
 qe_end_tran (T_CON_HANDLE * con_handle, char type, T_CCI_ERROR * err_buf)
+{
+  int err_code;
+
+  err_code = qe_end_tran_send (con_handle, type);
+  if (err_code < 0)
+    {
+      return err_code;
+    }
+
+  return qe_end_tran_recv (con_handle, type, err_buf);
+}
+
+/*
+ * qe_end_tran_send () - send an end transaction request without waiting for the reply
+ */
+static int
+qe_end_tran_send (T_CON_HANDLE * con_handle, char type)
 {
   T_NET_BUF net_buf;
   char func_code = CAS_FC_END_TRAN;
   int err_code;
-  bool keep_connection;
-  time_t cur_time, failure_time;
 #ifdef END_TRAN2
   char type_str[2];
 #endif
@@ -311,7 +336,25 @@ qe_end_tran (T_CON_HANDLE * con_handle, char type, T_CCI_ERROR * err_buf)
       return err_code;
     }
 
+  return 0;
+}
+
+/*
+ * qe_end_tran_recv () - receive the reply of an end transaction request
+ */
+static int
+qe_end_tran_recv (T_CON_HANDLE * con_handle, char type, T_CCI_ERROR * err_buf)
+{
+  int err_code;
+  bool keep_connection;
+  time_t cur_time, failure_time;
+
   err_code = net_recv_msg (con_handle, NULL, NULL, err_buf);
+  if (err_code == CAS_ER_PIPELINE_ABORTED)
+    {
+      /* not executed; the transaction is still active */
+      return err_code;
+    }
 
   if (con_handle->broker_info[BROKER_INFO_STATEMENT_POOLING] != CAS_STATEMENT_POOLING_ON)
     {
@@ -563,25 +606,22 @@ qe_bind_param (T_REQ_HANDLE * req_handle, int index, T_CCI_A_TYPE a_type, void *
   return err_code;
 }
 
-int
-qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size, T_CCI_ERROR * err_buf)
+/*
+ * qe_execute_send () - send an execute request without waiting for the reply
+ *   recv_timeout(out): timeout to use when receiving the reply
+ */
+static int
+qe_execute_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size, int *recv_timeout)
 {
   T_NET_BUF net_buf;
   char func_code = CAS_FC_EXECUTE;
   char autocommit_flag;
   int i;
   int err_code = 0;
-  int res_count;
-  char *result_msg = NULL, *msg;
-  int result_msg_size;
-  T_CCI_QUERY_RESULT *qr = NULL;
   char fetch_flag;
   char forward_only_cursor;
-  char include_column_info;
-  int remain_msg_size = 0;
   int remaining_time = 0;
   bool use_server_query_cancel = false;
-  int shard_id;
   T_BROKER_VERSION broker_ver;
 
   req_handle->is_fetch_completed = 0;
@@ -677,9 +717,32 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
 
   net_buf_clear (&net_buf);
 
-  res_count =
-    net_recv_msg_timeout (con_handle, &result_msg, &result_msg_size, err_buf,
-			  ((use_server_query_cancel) ? 0 : remaining_time));
+  *recv_timeout = (use_server_query_cancel) ? 0 : remaining_time;
+  return 0;
+
+execute_error:
+  net_buf_clear (&net_buf);
+  return err_code;
+}
+
+/*
+ * qe_execute_recv () - receive and decode the reply of an execute request
+ */
+static int
+qe_execute_recv (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int recv_timeout,
+		 T_CCI_ERROR * err_buf)
+{
+  int err_code = 0;
+  int res_count;
+  char *result_msg = NULL, *msg;
+  int result_msg_size;
+  T_CCI_QUERY_RESULT *qr = NULL;
+  char include_column_info;
+  int remain_msg_size = 0;
+  int shard_id;
+  T_BROKER_VERSION broker_ver;
+
+  res_count = net_recv_msg_timeout (con_handle, &result_msg, &result_msg_size, err_buf, recv_timeout);
 
   if (res_count < 0)
     {
@@ -728,6 +791,7 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
   hm_req_handle_fetch_buf_free (req_handle);
   req_handle->cursor_pos = 0;
 
+  broker_ver = hm_get_broker_version (con_handle);
   if (hm_broker_understand_the_protocol (broker_ver, PROTOCOL_V2))
     {
       msg = result_msg + (result_msg_size - remain_msg_size);
@@ -785,9 +849,121 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
   req_handle->is_from_current_transaction = 1;
 
   return res_count;
+}
+
+int
+qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size, T_CCI_ERROR * err_buf)
+{
+  int err_code;
+  int recv_timeout = 0;
+
+  err_code = qe_execute_send (req_handle, con_handle, flag, max_col_size, &recv_timeout);
+  if (err_code < 0)
+    {
+      return err_code;
+    }
+
+  return qe_execute_recv (req_handle, con_handle, flag, recv_timeout, err_buf);
+}
+
+/*
+ * qe_execute_pipeline () - send the execute requests of several statements, and optionally an end transaction
+ *                          request, at once and then receive the replies in order
+ *   return: error code of the first failed request, or 0
+ *   results(out): result of each execute request
+ *
+ * All requests but the last are flagged CAS_INFO_FLAG_MASK_PIPELINE, so that the CAS is not given to another client
+ * while the pipeline is in flight. After a request fails, the CAS replies CAS_ER_PIPELINE_ABORTED to the remaining
+ * ones without running them.
+ */
+int
+qe_execute_pipeline (T_CON_HANDLE * con_handle, T_REQ_HANDLE ** req_handles, int num_req, char flag, int max_col_size,
+		     char end_tran_type, int *results, T_CCI_ERROR * err_buf)
+{
+  int *recv_timeouts = NULL;
+  int num_sent = 0;
+  int err_code = 0;
+  int res;
+  int i;
+  bool end_tran = (end_tran_type == CCI_TRAN_COMMIT || end_tran_type == CCI_TRAN_ROLLBACK);
+  T_CCI_ERROR tmp_err_buf;
+
+  recv_timeouts = (int *) MALLOC (sizeof (int) * num_req);
+  if (recv_timeouts == NULL)
+    {
+      return CCI_ER_NO_MORE_MEMORY;
+    }
+
+  for (i = 0; i < num_req; i++)
+    {
+      results[i] = CAS_ER_PIPELINE_ABORTED;
+    }
+
+  for (i = 0; i < num_req; i++)
+    {
+      if (i < num_req - 1 || end_tran)
+	{
+	  con_handle->cas_info[CAS_INFO_ADDITIONAL_FLAG] |= CAS_INFO_FLAG_MASK_PIPELINE;
+	}
+      else
+	{
+	  con_handle->cas_info[CAS_INFO_ADDITIONAL_FLAG] &= ~CAS_INFO_FLAG_MASK_PIPELINE;
+	}
+
+      err_code = qe_execute_send (req_handles[i], con_handle, flag, max_col_size, &recv_timeouts[i]);
+      if (err_code < 0)
+	{
+	  results[i] = err_code;
+	  break;
+	}
+      num_sent++;
+    }
+
+  con_handle->cas_info[CAS_INFO_ADDITIONAL_FLAG] &= ~CAS_INFO_FLAG_MASK_PIPELINE;
+
+  if (err_code < 0 && num_sent > 0)
+    {
+      /* the CAS waits for the rest of the pipeline; it can not be resumed */
+      hm_force_close_connection (con_handle);
+    }
+
+  if (err_code == 0 && end_tran)
+    {
+      err_code = qe_end_tran_send (con_handle, end_tran_type);
+    }
+
+  for (i = 0; i < num_sent; i++)
+    {
+      if (IS_INVALID_SOCKET (con_handle->sock_fd))
+	{
+	  results[i] = CCI_ER_COMMUNICATION;
+	  if (err_code == 0)
+	    {
+	      err_code = CCI_ER_COMMUNICATION;
+	    }
+	  continue;
+	}
+
+      res =
+	qe_execute_recv (req_handles[i], con_handle, flag, recv_timeouts[i], (err_code == 0) ? err_buf : &tmp_err_buf);
+      results[i] = res;
+      if (res < 0 && err_code == 0)
+	{
+	  err_code = res;
+	}
+    }
+
+  if (end_tran && num_sent == num_req && !IS_INVALID_SOCKET (con_handle->sock_fd))
+    {
+      res = qe_end_tran_recv (con_handle, end_tran_type, (err_code == 0) ? err_buf : &tmp_err_buf);
+      if (res < 0 && err_code == 0)
+	{
+	  err_code = res;
+	}
+    }
+
+  FREE_MEM (recv_timeouts);
 
-execute_error:
-  net_buf_clear (&net_buf);
   return err_code;
 }
 
@@ -1630,6 +1806,11 @@ qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int r
       return 0;
     }
 
+  if (req_handle->fetch_stream_pages > 0 && flag == 0 && hm_broker_support_streaming_fetch (con_handle))
+    {
+      return qe_fetch_stream (req_handle, con_handle, result_set_index, err_buf);
+    }
+
   hm_req_handle_fetch_buf_free (req_handle);
 
   net_buf_init (&net_buf);
@@ -1687,6 +1868,130 @@ qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int r
   return 0;
 }
 
+/*
+ * qe_fetch_stream () - fetch the next result page from the pages received ahead by streaming fetch, asking the CAS
+ *                      for another window of pages when none is left
+ */
+static int
+qe_fetch_stream (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, int result_set_index, T_CCI_ERROR * err_buf)
+{
+  T_FETCH_STREAM_PAGE *page;
+  char *result_msg;
+  int result_msg_size;
+  int num_tuple;
+  int err_code;
+
+  if (req_handle->next_stream_page >= req_handle->num_stream_pages
+      || req_handle->cursor_pos != req_handle->fetched_tuple_end + 1)
+    {
+      /* the pages received ahead do not follow the current cursor position */
+      hm_req_handle_fetch_buf_free (req_handle);
+
+      err_code = qe_fetch_stream_request (req_handle, con_handle, result_set_index, err_buf);
+      if (err_code < 0)
+	{
+	  return err_code;
+	}
+    }
+
+  page = &(req_handle->stream_pages[req_handle->next_stream_page++]);
+  result_msg = page->msg;
+  result_msg_size = page->size;
+  page->msg = NULL;
+
+  hm_req_handle_tuple_buf_free (req_handle);
+
+  num_tuple = decode_fetch_result (con_handle, req_handle, result_msg, result_msg + 4, result_msg_size - 4);
+  if (num_tuple < 0)
+    {
+      FREE_MEM (result_msg);
+      return num_tuple;
+    }
+
+  return 0;
+}
+
+/*
+ * qe_fetch_stream_request () - grant the CAS credits for fetch_stream_pages result pages from the cursor position and
+ *                              receive the pages it pushes
+ *
+ * The CAS marks every page but the last with CAS_INFO_FLAG_MASK_MORE_REPLIES. It stops early at the end of the result
+ * set or at an error; an error after the first page is left to be reported by the next request.
+ */
+static int
+qe_fetch_stream_request (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, int result_set_index,
+			 T_CCI_ERROR * err_buf)
+{
+  T_NET_BUF net_buf;
+  char func_code = CAS_FC_FETCH_STREAM;
+  char fetch_flag = 0;
+  char *result_msg = NULL;
+  int result_msg_size;
+  int num_pages;
+  int err_code;
+  bool more_replies;
+  T_CCI_ERROR tmp_err_buf;
+
+  num_pages = MIN (req_handle->fetch_stream_pages, FETCH_STREAM_MAX_PAGES);
+
+  req_handle->stream_pages = (T_FETCH_STREAM_PAGE *) MALLOC (sizeof (T_FETCH_STREAM_PAGE) * num_pages);
+  if (req_handle->stream_pages == NULL)
+    {
+      return CCI_ER_NO_MORE_MEMORY;
+    }
+
+  net_buf_init (&net_buf);
+  net_buf_cp_str (&net_buf, &func_code, 1);
+  ADD_ARG_INT (&net_buf, req_handle->server_handle_id);
+  ADD_ARG_INT (&net_buf, req_handle->cursor_pos);
+  ADD_ARG_INT (&net_buf, num_pages);
+  ADD_ARG_BYTES (&net_buf, &fetch_flag, 1);
+  ADD_ARG_INT (&net_buf, result_set_index);
+
+  if (net_buf.err_code < 0)
+    {
+      err_code = net_buf.err_code;
+      net_buf_clear (&net_buf);
+      return err_code;
+    }
+
+  err_code = net_send_msg (con_handle, net_buf.data, net_buf.data_size);
+  net_buf_clear (&net_buf);
+  if (err_code < 0)
+    {
+      return err_code;
+    }
+
+  do
+    {
+      err_code =
+	net_recv_msg (con_handle, &result_msg, &result_msg_size,
+		      (req_handle->num_stream_pages == 0) ? err_buf : &tmp_err_buf);
+      if (err_code < 0)
+	{
+	  return (req_handle->num_stream_pages == 0) ? err_code : 0;
+	}
+
+      more_replies = (con_handle->cas_info[CAS_INFO_ADDITIONAL_FLAG] & CAS_INFO_FLAG_MASK_MORE_REPLIES) != 0;
+      /* the cas info is sent back with the next request */
+      con_handle->cas_info[CAS_INFO_ADDITIONAL_FLAG] &= ~CAS_INFO_FLAG_MASK_MORE_REPLIES;
+      if (more_replies && req_handle->num_stream_pages == num_pages - 1)
+	{
+	  /* the CAS sent more pages than granted */
+	  FREE_MEM (result_msg);
+	  hm_force_close_connection (con_handle);
+	  return CCI_ER_COMMUNICATION;
+	}
+
+      req_handle->stream_pages[req_handle->num_stream_pages].msg = result_msg;
+      req_handle->stream_pages[req_handle->num_stream_pages].size = result_msg_size;
+      req_handle->num_stream_pages++;
+    }
+  while (more_replies);
+
+  return 0;
+}
+
 int
 qe_get_data (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, int a_type, void *value, int *indicator)
 {
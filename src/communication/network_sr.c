@@ -1170,6 +1170,7 @@ loop:
 		    case THREAD_LOCK_SUSPENDED:
 		    case THREAD_PGBUF_SUSPENDED:
 		    case THREAD_JOB_QUEUE_SUSPENDED:
+		    case THREAD_LOG_GROUP_COMMIT_SUSPENDED:
 		      /* never try to wake thread up while the thread is waiting for a critical section or a lock. */
 		      wakeup_now = false;
 		      break;
@@ -1195,6 +1196,7 @@ loop:
 		    case THREAD_LOGWR_RESUMED:
 		    case THREAD_ALLOC_BCB_RESUMED:
 		    case THREAD_DWB_QUEUE_RESUMED:
+		    case THREAD_LOG_GROUP_COMMIT_RESUMED:
 		      /* thread is in resumed status, we don't need to wake up */
 		      wakeup_now = false;
 		      break;
@@ -70,11 +70,26 @@
 #include "system_parameter.h"
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <stack>
+#include <vector>
 
 #define TODO_OPTIMIZE_JSON_BODY_STRING true
 
+/*
+ * Serialized json layout (see db_json_serialize):
+ *   scalar : TYPE | VALUE
+ *   object : TYPE | COUNT | TABLE_OFFSET | (KEY VALUE) * COUNT | OFFSET * COUNT
+ *   array  : TYPE | COUNT | TABLE_OFFSET | VALUE * COUNT | OFFSET * COUNT
+ *
+ * The offset table follows the members/elements; its offsets are relative to the container TYPE and point to the key of
+ * each member or to each element. It lets db_json_deserialize_path reach a value without reading the values before it.
+ * Containers serialized by older versions have neither TABLE_OFFSET nor the offset table; they are told apart by
+ * DB_JSON_SERIALIZED_INDEXED flag set in COUNT.
+ */
+const int DB_JSON_SERIALIZED_INDEXED = 0x40000000;
+
 
 #if TODO_OPTIMIZE_JSON_BODY_STRING
 struct JSON_RAW_STRING_DELETER
@@ -518,7 +533,7 @@ class JSON_SERIALIZER : public JSON_BASE_HANDLER
     explicit JSON_SERIALIZER (OR_BUF &buffer)
       : m_error (NO_ERROR)
       , m_buffer (&buffer)
-      , m_size_pointers ()
+      , m_containers ()
     {
       //
     }
@@ -540,8 +555,16 @@ class JSON_SERIALIZER : public JSON_BASE_HANDLER
     bool EndArray (SizeType elementCount) override;
 
   private:
-    bool SaveSizePointers (char *ptr);
-    void SetSizePointers (SizeType size);
+    struct CONTAINER
+    {
+      char *m_start;                        // position of the container type in buffer
+      bool m_is_array;
+      std::vector<int> m_offsets;           // offsets of the members/elements, relative to m_start
+    };
+
+    bool StartContainer (const DB_JSON_TYPE &type);
+    bool EndContainer (SizeType count);
+    void SaveElementOffset ();
 
     bool PackType (const DB_JSON_TYPE &type);
     bool PackString (const char *str);
@@ -553,8 +576,8 @@ class JSON_SERIALIZER : public JSON_BASE_HANDLER
 
     int m_error;                            // internal error code
     OR_BUF *m_buffer;                       // buffer to serialize to
-    std::stack<char *> m_size_pointers;     // stack used by nested arrays & objects to save starting pointer.
-    // member/element count is saved at the end
+    std::stack<CONTAINER> m_containers;     // stack used by nested arrays & objects to save starting pointer and
+    // offsets. member/element count and offset table are saved at the end
 };
 
 /*
@@ -682,6 +705,11 @@ static int db_json_unpack_bigint_to_value (OR_BUF *buf, JSON_VALUE &value);
 static int db_json_unpack_bool_to_value (OR_BUF *buf, JSON_VALUE &value);
 static int db_json_unpack_object_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator);
 static int db_json_unpack_array_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMPOOL &doc_allocator);
+static int db_json_unpack_container_size (OR_BUF *buf, int &size, int &table_offset);
+static int db_json_serialized_seek (OR_BUF *buf, char *pos);
+static int db_json_serialized_skip_string (OR_BUF *buf);
+static int db_json_serialized_skip_value (OR_BUF *buf);
+static int db_json_serialized_seek_token (OR_BUF *buf, const PATH_TOKEN &token, bool &found);
 
 static void db_json_add_element_to_array (JSON_DOC *doc, const JSON_VALUE *value);
 
@@ -3432,27 +3460,71 @@ JSON_WALKER::WalkValue (const JSON_VALUE &value)
 }
 
 bool
-JSON_SERIALIZER::SaveSizePointers (char *ptr)
+JSON_SERIALIZER::StartContainer (const DB_JSON_TYPE &type)
 {
-  // save the current pointer
-  m_size_pointers.push (ptr);
+  CONTAINER container;
+
+  SaveElementOffset ();
+
+  container.m_start = m_buffer->ptr;
+  container.m_is_array = (type == DB_JSON_ARRAY);
+
+  if (!PackType (type))
+    {
+      return false;
+    }
 
-  // skip the size
+  // skip the count and the offset of the table; we will know them in EndContainer
+  m_error = or_put_int (m_buffer, 0);
+  if (HasError ())
+    {
+      return false;
+    }
   m_error = or_put_int (m_buffer, 0);
+  if (HasError ())
+    {
+      return false;
+    }
 
-  return !HasError ();
+  m_containers.push (std::move (container));
+  return true;
 }
 
-void
-JSON_SERIALIZER::SetSizePointers (SizeType size)
+bool
+JSON_SERIALIZER::EndContainer (SizeType count)
 {
-  char *buf = m_size_pointers.top ();
-  m_size_pointers.pop ();
+  CONTAINER &container = m_containers.top ();
+  int table_offset = (int) (m_buffer->ptr - container.m_start);
+
+  assert (container.m_start >= m_buffer->buffer && container.m_start < m_buffer->ptr);
+  assert (container.m_offsets.size () == count);
+
+  // append the offset table
+  for (int offset : container.m_offsets)
+    {
+      m_error = or_put_int (m_buffer, offset);
+      if (HasError ())
+	{
+	  return false;
+	}
+    }
 
-  assert (buf >= m_buffer->buffer && buf < m_buffer->ptr);
+  // overwrite the count and the offset of the table
+  or_pack_int (container.m_start + OR_INT_SIZE, (int) count | DB_JSON_SERIALIZED_INDEXED);
+  or_pack_int (container.m_start + OR_INT_SIZE * 2, table_offset);
 
-  // overwrite that pointer with the correct size
-  or_pack_int (buf, (int) size);
+  m_containers.pop ();
+  return true;
+}
+
+void
+JSON_SERIALIZER::SaveElementOffset ()
+{
+  // members of an object are saved by their key
+  if (!m_containers.empty () && m_containers.top ().m_is_array)
+    {
+      m_containers.top ().m_offsets.push_back ((int) (m_buffer->ptr - m_containers.top ().m_start));
+    }
 }
 
 bool
@@ -3479,6 +3551,7 @@ JSON_SERIALIZER_LENGTH::Null ()
 bool
 JSON_SERIALIZER::Null ()
 {
+  SaveElementOffset ();
   return PackType (DB_JSON_NULL);
 }
 
@@ -3493,6 +3566,8 @@ JSON_SERIALIZER_LENGTH::Bool (bool b)
 bool
 JSON_SERIALIZER::Bool (bool b)
 {
+  SaveElementOffset ();
+
   if (!PackType (DB_JSON_BOOL))
     {
       return false;
@@ -3513,6 +3588,8 @@ JSON_SERIALIZER_LENGTH::Int (int i)
 bool
 JSON_SERIALIZER::Int (int i)
 {
+  SaveElementOffset ();
+
   if (!PackType (DB_JSON_INT))
     {
       return false;
@@ -3536,6 +3613,8 @@ JSON_SERIALIZER_LENGTH::Uint (unsigned i)
 bool
 JSON_SERIALIZER::Uint (unsigned i)
 {
+  SaveElementOffset ();
+
   if (!PackType (DB_JSON_INT))
     {
       return false;
@@ -3559,6 +3638,8 @@ JSON_SERIALIZER_LENGTH::Int64 (std::int64_t i)
 bool
 JSON_SERIALIZER::Int64 (std::int64_t i)
 {
+  SaveElementOffset ();
+
   if (!PackType (DB_JSON_BIGINT))
     {
       return false;
@@ -3582,6 +3663,8 @@ JSON_SERIALIZER_LENGTH::Uint64 (std::uint64_t i)
 bool
 JSON_SERIALIZER::Uint64 (std::uint64_t i)
 {
+  SaveElementOffset ();
+
   if (!PackType (DB_JSON_BIGINT))
     {
       return false;
@@ -3605,6 +3688,8 @@ JSON_SERIALIZER_LENGTH::Double (double d)
 bool
 JSON_SERIALIZER::Double (double d)
 {
+  SaveElementOffset ();
+
   if (!PackType (DB_JSON_DOUBLE))
     {
       return false;
@@ -3624,6 +3709,7 @@ JSON_SERIALIZER_LENGTH::String (const Ch *str, SizeType length, bool copy)
 bool
 JSON_SERIALIZER::String (const Ch *str, SizeType length, bool copy)
 {
+  SaveElementOffset ();
   return PackType (DB_JSON_STRING) && PackString (str);
 }
 
@@ -3638,77 +3724,72 @@ JSON_SERIALIZER_LENGTH::Key (const Ch *str, SizeType length, bool copy)
 bool
 JSON_SERIALIZER::Key (const Ch *str, SizeType length, bool copy)
 {
+  assert (!m_containers.empty () && !m_containers.top ().m_is_array);
+
+  m_containers.top ().m_offsets.push_back ((int) (m_buffer->ptr - m_containers.top ().m_start));
   return PackString (str);
 }
 
 bool
 JSON_SERIALIZER_LENGTH::StartObject ()
 {
+  // type, member count and offset of the offset table
   m_length += GetTypePackedSize ();
-  m_length += OR_INT_SIZE;
+  m_length += OR_INT_SIZE + OR_INT_SIZE;
   return true;
 }
 
 bool
 JSON_SERIALIZER::StartObject ()
 {
-  if (!PackType (DB_JSON_OBJECT))
-    {
-      return false;
-    }
-
-  // add pointer to stack, because we need to come back to overwrite this pointer with the correct size
-  // we will know that in EndObject function
-  return SaveSizePointers (m_buffer->ptr);
+  // add container to stack, because we need to come back to overwrite the size and table offset
+  // we will know them in EndObject function
+  return StartContainer (DB_JSON_OBJECT);
 }
 
 bool
 JSON_SERIALIZER_LENGTH::StartArray ()
 {
+  // type, element count and offset of the offset table
   m_length += GetTypePackedSize ();
-  m_length += OR_INT_SIZE;
+  m_length += OR_INT_SIZE + OR_INT_SIZE;
   return true;
 }
 
 bool
 JSON_SERIALIZER::StartArray ()
 {
-  if (!PackType (DB_JSON_ARRAY))
-    {
-      return false;
-    }
-
-  // add pointer to stack, because we need to come back to overwrite this pointer with the correct size
-  // we will know that in EndObject function
-  return SaveSizePointers (m_buffer->ptr);
+  // add container to stack, because we need to come back to overwrite the size and table offset
+  // we will know them in EndArray function
+  return StartContainer (DB_JSON_ARRAY);
 }
 
 bool
 JSON_SERIALIZER_LENGTH::EndObject (SizeType memberCount)
 {
+  // offset table
+  m_length += memberCount * OR_INT_SIZE;
   return true;
 }
 
 bool
 JSON_SERIALIZER::EndObject (SizeType memberCount)
 {
-  // overwrite the count
-  SetSizePointers (memberCount);
-  return true;
+  return EndContainer (memberCount);
 }
 
 bool
 JSON_SERIALIZER_LENGTH::EndArray (SizeType elementCount)
 {
+  // offset table
+  m_length += elementCount * OR_INT_SIZE;
   return true;
 }
 
 bool
 JSON_SERIALIZER::EndArray (SizeType elementCount)
 {
-  // overwrite the count
-  SetSizePointers (elementCount);
-  return true;
+  return EndContainer (elementCount);
 }
 
 void
@@ -4113,14 +4194,14 @@ db_json_unpack_object_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEM
 {
   int rc = NO_ERROR;
   int size;
+  int table_offset;
 
   value.SetObject ();
 
   // get the member count of the object
-  size = or_get_int (buf, &rc);
+  rc = db_json_unpack_container_size (buf, size, table_offset);
   if (rc != NO_ERROR)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
       return rc;
     }
 
@@ -4148,6 +4229,12 @@ db_json_unpack_object_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEM
       value.AddMember (key, child, doc_allocator);
     }
 
+  if (table_offset > 0)
+    {
+      // skip the offset table, members were read in sequence
+      return db_json_serialized_seek (buf, buf->ptr + size * OR_INT_SIZE);
+    }
+
   return NO_ERROR;
 }
 
@@ -4156,14 +4243,14 @@ db_json_unpack_array_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMP
 {
   int rc = NO_ERROR;
   int size;
+  int table_offset;
 
   value.SetArray ();
 
   // get the member count of the array
-  size = or_get_int (buf, &rc);
+  rc = db_json_unpack_container_size (buf, size, table_offset);
   if (rc != NO_ERROR)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
       return rc;
     }
 
@@ -4183,6 +4270,329 @@ db_json_unpack_array_to_value (OR_BUF *buf, JSON_VALUE &value, JSON_PRIVATE_MEMP
       value.PushBack (child, doc_allocator);
     }
 
+  if (table_offset > 0)
+    {
+      // skip the offset table, elements were read in sequence
+      return db_json_serialized_seek (buf, buf->ptr + size * OR_INT_SIZE);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * db_json_unpack_container_size () - unpack the member/element count of a serialized object or array
+ *
+ * return            : error_code
+ * buf (in)          : the buffer, positioned after the container type
+ * size (out)        : member/element count
+ * table_offset (out): offset of the offset table from the container type; 0 if container has no offset table
+ */
+static int
+db_json_unpack_container_size (OR_BUF *buf, int &size, int &table_offset)
+{
+  int rc = NO_ERROR;
+
+  size = or_get_int (buf, &rc);
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  table_offset = 0;
+  if ((size & DB_JSON_SERIALIZED_INDEXED) == 0)
+    {
+      // serialized by an older version
+      return NO_ERROR;
+    }
+
+  size &= ~DB_JSON_SERIALIZED_INDEXED;
+  table_offset = or_get_int (buf, &rc);
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * db_json_serialized_seek () - move the buffer pointer to a position of the serialized json
+ *
+ * return   : error_code
+ * buf (in) : the buffer
+ * pos (in) : new position
+ */
+static int
+db_json_serialized_seek (OR_BUF *buf, char *pos)
+{
+  if (pos < buf->buffer || pos > buf->endptr)
+    {
+      return or_underflow (buf);
+    }
+
+  buf->ptr = pos;
+  return NO_ERROR;
+}
+
+static int
+db_json_serialized_skip_string (OR_BUF *buf)
+{
+  int rc = NO_ERROR;
+  int str_length;
+
+  str_length = or_get_int (buf, &rc);
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  rc = db_json_or_buf_underflow (buf, str_length);
+  if (rc != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return rc;
+    }
+  buf->ptr += str_length;
+
+  rc = or_align (buf, INT_ALIGNMENT);
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * db_json_serialized_skip_value () - move the buffer pointer after the serialized value it points to
+ *
+ * return   : error_code
+ * buf (in) : the buffer, positioned at the value type
+ *
+ * Objects and arrays with an offset table are skipped without visiting their members.
+ */
+static int
+db_json_serialized_skip_value (OR_BUF *buf)
+{
+  char *start = buf->ptr;
+  DB_JSON_TYPE json_type;
+  int size, table_offset;
+  int rc = NO_ERROR;
+
+  json_type = static_cast<DB_JSON_TYPE> (or_get_int (buf, &rc));
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  switch (json_type)
+    {
+    case DB_JSON_NULL:
+      return NO_ERROR;
+
+    case DB_JSON_BOOL:
+      return db_json_serialized_seek (buf, buf->ptr + OR_INT_SIZE);
+
+    case DB_JSON_INT:
+      return db_json_serialized_seek (buf, buf->ptr + OR_INT_SIZE + OR_INT_SIZE);
+
+    case DB_JSON_BIGINT:
+      return db_json_serialized_seek (buf, buf->ptr + OR_INT_SIZE + OR_BIGINT_SIZE);
+
+    case DB_JSON_DOUBLE:
+      return db_json_serialized_seek (buf, buf->ptr + OR_DOUBLE_SIZE);
+
+    case DB_JSON_STRING:
+      return db_json_serialized_skip_string (buf);
+
+    case DB_JSON_OBJECT:
+    case DB_JSON_ARRAY:
+      rc = db_json_unpack_container_size (buf, size, table_offset);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      if (table_offset > 0)
+	{
+	  // jump after the offset table
+	  return db_json_serialized_seek (buf, start + table_offset + size * OR_INT_SIZE);
+	}
+
+      for (int i = 0; i < size; i++)
+	{
+	  if (json_type == DB_JSON_OBJECT)
+	    {
+	      rc = db_json_serialized_skip_string (buf);
+	      if (rc != NO_ERROR)
+		{
+		  return rc;
+		}
+	    }
+	  rc = db_json_serialized_skip_value (buf);
+	  if (rc != NO_ERROR)
+	    {
+	      return rc;
+	    }
+	}
+      return NO_ERROR;
+
+    default:
+      /* we shouldn't get here */
+      assert (false);
+      return ER_FAILED;
+    }
+}
+
+/*
+ * db_json_serialized_seek_token () - move the buffer pointer to the member/element of the serialized value it points
+ *                                    to, as selected by path token
+ *
+ * return     : error_code
+ * buf (in)   : the buffer, positioned at the value type
+ * token (in) : object key or array index token
+ * found (out): false if the value has no such member/element
+ */
+static int
+db_json_serialized_seek_token (OR_BUF *buf, const PATH_TOKEN &token, bool &found)
+{
+  char *start = buf->ptr;
+  DB_JSON_TYPE json_type;
+  int size, table_offset;
+  int offset;
+  int rc = NO_ERROR;
+
+  found = false;
+
+  json_type = static_cast<DB_JSON_TYPE> (or_get_int (buf, &rc));
+  if (rc != NO_ERROR)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+      return rc;
+    }
+
+  if (json_type == DB_JSON_ARRAY && token.m_type == PATH_TOKEN::token_type::array_index)
+    {
+      rc = db_json_unpack_container_size (buf, size, table_offset);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      unsigned long idx = token.get_array_index ();
+      if (idx >= (unsigned long) size)
+	{
+	  return NO_ERROR;
+	}
+
+      if (table_offset > 0)
+	{
+	  rc = db_json_serialized_seek (buf, start + table_offset + idx * OR_INT_SIZE);
+	  if (rc != NO_ERROR)
+	    {
+	      return rc;
+	    }
+	  offset = or_get_int (buf, &rc);
+	  if (rc != NO_ERROR)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+	      return rc;
+	    }
+	  rc = db_json_serialized_seek (buf, start + offset);
+	}
+      else
+	{
+	  for (unsigned long i = 0; i < idx && rc == NO_ERROR; i++)
+	    {
+	      rc = db_json_serialized_skip_value (buf);
+	    }
+	}
+
+      found = (rc == NO_ERROR);
+      return rc;
+    }
+
+  if (json_type == DB_JSON_OBJECT && token.m_type == PATH_TOKEN::token_type::object_key)
+    {
+      std::string encoded_key = db_json_json_string_as_utf8 (token.get_object_key ());
+
+      rc = db_json_unpack_container_size (buf, size, table_offset);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      for (int i = 0; i < size; i++)
+	{
+	  if (table_offset > 0)
+	    {
+	      // go directly to the key, the values of previous members are not visited
+	      rc = db_json_serialized_seek (buf, start + table_offset + i * OR_INT_SIZE);
+	      if (rc != NO_ERROR)
+		{
+		  return rc;
+		}
+	      offset = or_get_int (buf, &rc);
+	      if (rc != NO_ERROR)
+		{
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+		  return rc;
+		}
+	      rc = db_json_serialized_seek (buf, start + offset);
+	      if (rc != NO_ERROR)
+		{
+		  return rc;
+		}
+	    }
+
+	  // the key length includes the null terminator
+	  int key_length = or_get_int (buf, &rc);
+	  if (rc != NO_ERROR)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+	      return rc;
+	    }
+	  rc = db_json_or_buf_underflow (buf, key_length);
+	  if (rc != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return rc;
+	    }
+
+	  bool is_match = (key_length == (int) encoded_key.size () + 1
+			   && std::memcmp (buf->ptr, encoded_key.c_str (), encoded_key.size ()) == 0);
+
+	  buf->ptr += key_length;
+	  rc = or_align (buf, INT_ALIGNMENT);
+	  if (rc != NO_ERROR)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TF_BUFFER_OVERFLOW, 0);
+	      return rc;
+	    }
+	  if (is_match)
+	    {
+	      found = true;
+	      return NO_ERROR;
+	    }
+
+	  if (table_offset == 0)
+	    {
+	      rc = db_json_serialized_skip_value (buf);
+	      if (rc != NO_ERROR)
+		{
+		  return rc;
+		}
+	    }
+	}
+      return NO_ERROR;
+    }
+
+  // scalar value or token type does not match the container
   return NO_ERROR;
 }
 
@@ -4282,3 +4692,54 @@ db_json_deserialize (OR_BUF *buf, JSON_DOC *&doc)
 
   return error_code;
 }
+
+/*
+ * db_json_deserialize_path () - deserialize only the value found at given path of a serialized json
+ *
+ * return        : error code
+ * buf (in)      : buffer of the json serialized
+ * raw_path (in) : path to the value; wildcards are not allowed
+ * doc (out)     : json document deserialized or NULL if path does not exist
+ *
+ * Only the containers on the path are visited; the offset tables let us jump over the members before the value.
+ * The buffer pointer is left after the deserialized value.
+ */
+int
+db_json_deserialize_path (OR_BUF *buf, const char *raw_path, JSON_DOC *&doc)
+{
+  JSON_PATH path;
+  bool found = true;
+  int error_code = NO_ERROR;
+
+  doc = NULL;
+
+  error_code = path.parse (raw_path);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  if (path.contains_wildcard ())
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_JSON_INVALID_PATH, 0);
+      return ER_JSON_INVALID_PATH;
+    }
+
+  for (size_t i = 0; i < path.get_token_count () && found; i++)
+    {
+      error_code = db_json_serialized_seek_token (buf, *path.get_token (i), found);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+    }
+
+  if (!found)
+    {
+      return NO_ERROR;
+    }
+
+  return db_json_deserialize (buf, doc);
+}
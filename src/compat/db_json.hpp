@@ -100,6 +100,7 @@ JSON_DOC *db_json_get_copy_of_doc (const JSON_DOC *doc);
 int db_json_serialize (const JSON_DOC &doc, or_buf &buffer);
 std::size_t db_json_serialize_length (const JSON_DOC &doc);
 int db_json_deserialize (or_buf *buf, JSON_DOC *&doc);
+int db_json_deserialize_path (or_buf *buf, const char *raw_path, JSON_DOC *&doc);
 
 int db_json_insert_func (const JSON_DOC *doc_to_be_inserted, JSON_DOC &doc_destination, const char *raw_path);
 int db_json_replace_func (const JSON_DOC *value, JSON_DOC &doc, const char *raw_path);
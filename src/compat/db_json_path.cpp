@@ -1049,6 +1049,12 @@ JSON_PATH::erase (JSON_DOC &jd) const
   return false;
 }
 
+const PATH_TOKEN *
+JSON_PATH::get_token (size_t idx) const
+{
+  return idx < get_token_count () ? &m_path_tokens[idx] : NULL;
+}
+
 const PATH_TOKEN *
 JSON_PATH::get_last_token () const
 {
@@ -82,6 +82,7 @@ class JSON_PATH
     void set (JSON_VALUE &jd, const JSON_VALUE &jv, JSON_PRIVATE_MEMPOOL &allocator) const;
     bool erase (JSON_DOC &jd) const;
 
+    const PATH_TOKEN *get_token (size_t idx) const;
     const PATH_TOKEN *get_last_token () const;
     size_t get_token_count () const;
     bool is_root_path () const;
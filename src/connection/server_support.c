@@ -49,6 +49,16 @@
 #include <netinet/in.h>
 #endif /* !WINDOWS */
 #include <assert.h>
+#if defined (LINUX)
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#endif /* LINUX */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "porting.h"
 #include "memory_alloc.h"
@@ -82,6 +92,8 @@
 #include "heartbeat.h"
 #endif
 #include "dbtype.h"
+#include "perf_monitor.h"
+#include "tsc_timer.h"
 
 #define CSS_WAIT_COUNT 5	/* # of retry to connect to master */
 #define CSS_GOING_DOWN_IMMEDIATELY "Server going down immediately"
@@ -94,6 +106,10 @@
 
 #define RMUTEX_NAME_TEMP_CONN_ENTRY "TEMP_CONN_ENTRY"
 
+#define CSS_PEER_ALIVE_TIMEOUT_MSECS 5000	/* idle time before checking the peer of a connection */
+#define CSS_REACTOR_WAIT_MSECS 100	/* epoll timeout of connection reactors */
+#define CSS_REACTOR_MAX_EVENTS 256
+
 static bool css_Server_shutdown_inited = false;
 static struct timeval css_Shutdown_timeout = { 0, 0 };
 
@@ -203,6 +219,146 @@ private:
   CSS_CONN_ENTRY &m_conn;
 };
 
+#if defined (LINUX)
+// css_watched_conn - a connection watched by a reactor; shared with its peer alive check
+struct css_watched_conn : public std::enable_shared_from_this<css_watched_conn>
+{
+  CSS_CONN_ENTRY *conn;
+  SOCKET fd;
+  int client_id;			// to detect the reuse of conn
+  std::chrono::steady_clock::time_point last_active_time;
+  std::atomic<bool> is_checking;	// peer alive check is running
+  std::atomic<bool> is_peer_dead;	// peer alive check failed
+  std::atomic<bool> is_reading;		// rest of a packet is read on a connection thread; fd is not armed
+  int read_status;			// result of the last read on a connection thread; protected by reactor mutex
+  bool is_removed;
+
+  css_watched_conn (CSS_CONN_ENTRY & conn_arg)
+  : conn (&conn_arg)
+  , fd (conn_arg.fd)
+  , client_id (conn_arg.client_id)
+  , last_active_time (std::chrono::steady_clock::now ())
+  , is_checking (false)
+  , is_peer_dead (false)
+  , is_reading (false)
+  , read_status (NO_ERRORS)
+  , is_removed (false)
+  {
+  }
+};
+
+// css_connection_reactor - event driven alternative to connection threads
+//
+// description:
+//    instead of one connection thread per client, a few reactor threads watch all connections with epoll. a reactor
+//    reads the requests of ready connections and pushes them to transaction workers, like connection threads do.
+//    closed connections are handed to connection threads that call the connection error handler. peer alive checks
+//    may block for seconds, so they run on connection threads too.
+//
+//    a reactor never blocks on a socket: it reads a request only when the whole packet is already received. when only
+//    part of it is, the blocking read is handed to a connection thread. fds are armed one shot, so a connection is
+//    not reported again until its packet is read and the fd is armed again.
+//
+//    the number of reactors is set by thread_connection_reactor_count; zero keeps one thread per connection.
+//
+class css_connection_reactor
+{
+public:
+  css_connection_reactor (void);
+  ~css_connection_reactor (void);
+
+  int init (void);
+  bool add_connection (CSS_CONN_ENTRY & conn);
+  void loop (cubthread::entry & thread_ref);
+  void finish_read (css_watched_conn & watched, int status);
+
+private:
+  bool arm (css_watched_conn & watched);
+  void handle_event (cubthread::entry & thread_ref, css_watched_conn & watched, unsigned int events);
+  void check_connections (cubthread::entry & thread_ref);
+  void remove_connection (cubthread::entry & thread_ref, css_watched_conn & watched, int status);
+
+  int m_epoll_fd;
+  std::mutex m_mutex;	// protects m_conns
+  std::vector<std::shared_ptr<css_watched_conn>> m_conns;
+};
+
+// css_connection_reactor_task - runs the loop of a reactor on a connection thread until shutdown
+class css_connection_reactor_task : public cubthread::entry_task
+{
+public:
+  css_connection_reactor_task (void) = delete;
+
+  css_connection_reactor_task (css_connection_reactor & reactor)
+  : m_reactor (reactor)
+  {
+  }
+
+  void execute (context_type & thread_ref) override final;
+
+private:
+  css_connection_reactor &m_reactor;
+};
+
+// css_connection_close_task - calls the connection error handler for a connection removed from its reactor
+class css_connection_close_task : public cubthread::entry_task
+{
+public:
+  css_connection_close_task (void) = delete;
+
+  css_connection_close_task (CSS_CONN_ENTRY & conn)
+  : m_conn (conn)
+  {
+  }
+
+  void execute (context_type & thread_ref) override final;
+
+private:
+  CSS_CONN_ENTRY &m_conn;
+};
+
+// css_connection_check_task - checks the peer of an idle connection watched by a reactor
+class css_connection_check_task : public cubthread::entry_task
+{
+public:
+  css_connection_check_task (void) = delete;
+
+  css_connection_check_task (const std::shared_ptr<css_watched_conn> &watched)
+  : m_watched (watched)
+  {
+  }
+
+  void execute (context_type & thread_ref) override final;
+
+private:
+  std::shared_ptr<css_watched_conn> m_watched;
+};
+
+// css_connection_read_task - reads the rest of a packet that reactor found partially received
+class css_connection_read_task : public cubthread::entry_task
+{
+public:
+  css_connection_read_task (void) = delete;
+
+  css_connection_read_task (css_connection_reactor & reactor, const std::shared_ptr<css_watched_conn> &watched)
+  : m_reactor (reactor)
+  , m_watched (watched)
+  {
+  }
+
+  void execute (context_type & thread_ref) override final;
+
+private:
+  css_connection_reactor &m_reactor;
+  std::shared_ptr<css_watched_conn> m_watched;
+};
+
+static bool css_is_packet_received (SOCKET fd);
+
+static css_connection_reactor *css_Connection_reactors = NULL;
+static int css_Num_connection_reactors = 0;
+#endif /* LINUX */
+
 static const size_t CSS_JOB_QUEUE_SCAN_COLUMN_COUNT = 4;
 
 static void css_setup_server_loop (void);
@@ -234,6 +390,10 @@ static bool css_check_ha_log_applier_done (void);
 static bool css_check_ha_log_applier_working (void);
 
 static void css_push_server_task (CSS_CONN_ENTRY & conn_ref);
+#if defined (LINUX)
+static void css_start_connection_reactors (void);
+static void css_destroy_connection_reactors (void);
+#endif /* LINUX */
 static void css_stop_non_log_writer (THREAD_ENTRY & thread_ref, bool &, THREAD_ENTRY & stopper_thread_ref);
 static void css_stop_log_writer (THREAD_ENTRY & thread_ref, bool &);
 static void css_find_not_stopped (THREAD_ENTRY & thread_ref, bool & stop, bool is_log_writer, bool & found);
@@ -257,6 +417,7 @@ static bool css_get_connection_thread_pooling_configuration (void);
 static cubthread::wait_seconds css_get_connection_thread_timeout_configuration (void);
 static bool css_get_server_request_thread_pooling_configuration (void);
 static cubthread::wait_seconds css_get_server_request_thread_timeout_configuration (void);
+static bool css_get_server_request_thread_stealing_configuration (void);
 static void css_start_all_threads (void);
 // *INDENT-ON*
 
@@ -1000,7 +1161,7 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
 
   thread_p->type = TT_SERVER;	/* server thread */
 
-  css_peer_alive_timeout = 5000;
+  css_peer_alive_timeout = CSS_PEER_ALIVE_TIMEOUT_MSECS;
   poll_timeout = 100;
   max_num_loop = css_peer_alive_timeout / poll_timeout;
   num_loop = 0;
@@ -1182,6 +1343,14 @@ css_internal_connection_handler (CSS_CONN_ENTRY * conn)
 {
   css_insert_into_active_conn_list (conn);
 
+#if defined (LINUX)
+  if (css_Num_connection_reactors > 0
+      && css_Connection_reactors[conn->idx % css_Num_connection_reactors].add_connection (*conn))
+    {
+      return NO_ERRORS;
+    }
+#endif /* LINUX */
+
   // push connection handler task
   cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_task (*conn));
 
@@ -1332,7 +1501,8 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
 						   cubthread::is_logging_configured
 						   (cubthread::LOG_WORKER_POOL_TRAN_WORKERS),
 						   css_get_server_request_thread_pooling_configuration (),
-						   css_get_server_request_thread_timeout_configuration ());
+						   css_get_server_request_thread_timeout_configuration (),
+						   css_get_server_request_thread_stealing_configuration ());
   if (css_Server_request_worker_pool == NULL)
     {
       assert (false);
@@ -1356,6 +1526,11 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
       goto shutdown;
     }
 
+#if defined (LINUX)
+  // connection reactors run on connection threads
+  css_start_connection_reactors ();
+#endif /* LINUX */
+
   css_Server_connection_socket = INVALID_SOCKET;
 
   conn = css_connect_to_master_server (port_id, server_name, name_length);
@@ -1424,6 +1599,9 @@ shutdown:
   // destroy thread worker pools
   thread_get_manager ()->destroy_worker_pool (css_Server_request_worker_pool);
   thread_get_manager ()->destroy_worker_pool (css_Connection_worker_pool);
+#if defined (LINUX)
+  css_destroy_connection_reactors ();
+#endif /* LINUX */
 
   if (!HA_DISABLED ())
     {
@@ -2809,6 +2987,510 @@ css_connection_task::execute (context_type & thread_ref)
   thread_ref.conn_entry = NULL;
 }
 
+#if defined (LINUX)
+css_connection_reactor::css_connection_reactor (void)
+  : m_epoll_fd (-1)
+  , m_mutex ()
+  , m_conns ()
+{
+}
+
+css_connection_reactor::~css_connection_reactor (void)
+{
+  if (m_epoll_fd >= 0)
+    {
+      close (m_epoll_fd);
+    }
+}
+
+//
+// init () - create the epoll instance of the reactor
+//
+int
+css_connection_reactor::init (void)
+{
+  m_epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+  if (m_epoll_fd < 0)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+      return ER_GENERIC_ERROR;
+    }
+  return NO_ERROR;
+}
+
+//
+// add_connection () - start watching a new connection
+//
+// return    : false if connection cannot be watched
+// conn (in) : connection
+//
+bool
+css_connection_reactor::add_connection (CSS_CONN_ENTRY & conn)
+{
+  std::shared_ptr<css_watched_conn> watched = std::make_shared<css_watched_conn> (conn);
+  struct epoll_event ev;
+
+  ev.events = EPOLLIN | EPOLLONESHOT;
+  ev.data.ptr = watched.get ();
+
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  if (epoll_ctl (m_epoll_fd, EPOLL_CTL_ADD, conn.fd, &ev) != 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::add_connection: epoll_ctl() error %d\n", errno);
+      return false;
+    }
+  m_conns.push_back (watched);
+  return true;
+}
+
+//
+// loop () - read and dispatch requests of watched connections until shutdown
+//
+void
+css_connection_reactor::loop (cubthread::entry & thread_ref)
+{
+  struct epoll_event events[CSS_REACTOR_MAX_EVENTS];
+  std::chrono::steady_clock::time_point last_check_time = std::chrono::steady_clock::now ();
+  std::chrono::steady_clock::time_point now;
+  TSC_TICKS start_tick, end_tick;
+  bool is_timed;
+  int n, i;
+
+  thread_ref.type = TT_SERVER;	/* server thread */
+
+  while (thread_ref.shutdown == false)
+    {
+      n = epoll_wait (m_epoll_fd, events, CSS_REACTOR_MAX_EVENTS, CSS_REACTOR_WAIT_MSECS);
+      if (n < 0)
+	{
+	  if (errno != EINTR)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::loop: epoll_wait() error %d\n", errno);
+	    }
+	  n = 0;
+	}
+
+      is_timed = n > 0 && perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM);
+      if (is_timed)
+	{
+	  tsc_getticks (&start_tick);
+	}
+
+      for (i = 0; i < n; i++)
+	{
+	  // watched connections are released only by check_connections (), on this thread
+	  handle_event (thread_ref, *static_cast<css_watched_conn *> (events[i].data.ptr), events[i].events);
+	}
+
+      if (is_timed)
+	{
+	  tsc_getticks (&end_tick);
+	  perfmon_time_latency (PERF_LATENCY_CONN_REACTOR_LOOP, tsc_elapsed_utime (end_tick, start_tick));
+	}
+
+      // check connections as often as connection threads do
+      now = std::chrono::steady_clock::now ();
+      if (now - last_check_time >= std::chrono::milliseconds (CSS_REACTOR_WAIT_MSECS))
+	{
+	  check_connections (thread_ref);
+	  last_check_time = now;
+	}
+    }
+}
+
+//
+// arm () - report the next event of a connection; fds are armed one shot
+//
+// return       : false if epoll_ctl fails
+// watched (in) : watched connection
+//
+bool
+css_connection_reactor::arm (css_watched_conn & watched)
+{
+  struct epoll_event ev;
+
+  ev.events = EPOLLIN | EPOLLONESHOT;
+  ev.data.ptr = &watched;
+
+  if (epoll_ctl (m_epoll_fd, EPOLL_CTL_MOD, watched.fd, &ev) != 0)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::arm: epoll_ctl() error %d\n", errno);
+      return false;
+    }
+  return true;
+}
+
+//
+// finish_read () - give back a connection whose packet was read on a connection thread
+//
+// watched (in) : watched connection
+// status (in)  : result of css_read_and_queue
+//
+void
+css_connection_reactor::finish_read (css_watched_conn & watched, int status)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  assert (watched.is_reading && !watched.is_removed);
+
+  // arm only the fd of the same connection; if the entry was reused, check_connections () drops it
+  if (status == NO_ERRORS && watched.conn->client_id == watched.client_id && !arm (watched))
+    {
+      status = ERROR_ON_READ;
+    }
+  watched.read_status = status;
+  watched.is_reading = false;
+}
+
+//
+// handle_event () - read a request from a ready connection, like css_connection_handler_thread
+//
+void
+css_connection_reactor::handle_event (cubthread::entry & thread_ref, css_watched_conn & watched, unsigned int events)
+{
+  CSS_CONN_ENTRY *conn = watched.conn;
+  int status, type;
+
+  if (watched.is_removed)
+    {
+      // removed by previous event
+      return;
+    }
+  if (conn->stop_talk == true)
+    {
+      remove_connection (thread_ref, watched, NO_ERRORS);
+      return;
+    }
+
+  watched.last_active_time = std::chrono::steady_clock::now ();
+
+  if ((events & EPOLLERR) || (events & EPOLLHUP))
+    {
+      remove_connection (thread_ref, watched, ERROR_ON_READ);
+      return;
+    }
+
+  if (!css_is_packet_received (watched.fd))
+    {
+      // reading the rest would block the other connections; check_connections () leaves it alone meanwhile
+      watched.is_reading = true;
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool,
+                                            new css_connection_read_task (*this, watched.shared_from_this ()));
+      return;
+    }
+
+  /* read command/data/etc request from socket, and enqueue it to appr. queue */
+  status = css_read_and_queue (conn, &type);
+  if (status != NO_ERRORS)
+    {
+      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::handle_event: css_read_and_queue() error\n");
+      remove_connection (thread_ref, watched, status);
+      return;
+    }
+
+  /* if new command request has arrived, make new job and add it to job queue */
+  if (type == COMMAND_TYPE)
+    {
+      css_push_server_task (*conn);
+    }
+
+  if (!arm (watched))
+    {
+      remove_connection (thread_ref, watched, ERROR_ON_READ);
+    }
+}
+
+//
+// check_connections () - check status, peer and HA state of watched connections, like css_connection_handler_thread,
+//                        and release removed connections
+//
+void
+css_connection_reactor::check_connections (cubthread::entry & thread_ref)
+{
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now ();
+  CSS_CONN_ENTRY *conn;
+  int conn_status;
+  std::size_t i;
+
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  for (i = 0; i < m_conns.size ();)
+    {
+      css_watched_conn &watched = *m_conns[i];
+
+      conn = watched.conn;
+      if (watched.is_removed)
+	{
+	  // already removed
+	}
+      else if (watched.is_reading)
+	{
+	  // owned by its read task until finish_read ()
+	}
+      else if (conn->client_id != watched.client_id)
+	{
+	  // the entry was freed by someone else and reused; its socket was closed and left epoll
+	  watched.is_removed = true;
+	}
+      else if (conn->stop_talk == true)
+	{
+	  remove_connection (thread_ref, watched, NO_ERRORS);
+	}
+      else if (watched.read_status != NO_ERRORS)
+	{
+	  er_log_debug (ARG_FILE_LINE, "css_connection_reactor::check_connections: css_read_and_queue() error\n");
+	  remove_connection (thread_ref, watched, watched.read_status);
+	}
+      else
+	{
+	  conn_status = conn->status;
+	  if (conn_status == CONN_CLOSING)
+	    {
+	      /* synchronize with worker thread which may be in sboot_notify_unregister_client to let it have a chance
+	       * to send reply to client. see css_connection_handler_thread. */
+	      rmutex_lock (&thread_ref, &conn->rmutex);
+
+	      conn_status = conn->status;
+
+	      rmutex_unlock (&thread_ref, &conn->rmutex);
+	    }
+
+	  if (conn_status != CONN_OPEN)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::check_connections: conn->status (%d) is not "
+			    "CONN_OPEN.", conn_status);
+	      remove_connection (thread_ref, watched, CONNECTION_CLOSED);
+	    }
+	  else if (watched.is_peer_dead)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "css_connection_reactor::check_connections: css_peer_alive() error\n");
+	      remove_connection (thread_ref, watched, CONNECTION_CLOSED);
+	    }
+	  else if (now - watched.last_active_time >= std::chrono::milliseconds (CSS_PEER_ALIVE_TIMEOUT_MSECS))
+	    {
+	      watched.last_active_time = now;
+
+	      /* check server's HA state */
+	      if (ha_Server_state == HA_SERVER_STATE_TO_BE_STANDBY && conn->in_transaction == false
+		  && css_count_transaction_worker_threads (&thread_ref, conn->get_tran_index (), conn->client_id) == 0)
+		{
+		  remove_connection (thread_ref, watched, REQUEST_REFUSED);
+		}
+	      else if (CHECK_CLIENT_IS_ALIVE () && !watched.is_checking.exchange (true))
+		{
+		  cubthread::get_manager ()->push_task (css_Connection_worker_pool,
+		                                        new css_connection_check_task (m_conns[i]));
+		}
+	    }
+	}
+
+      if (watched.is_removed)
+	{
+	  // release; check and read tasks keep their own reference
+	  m_conns[i] = m_conns.back ();
+	  m_conns.pop_back ();
+	}
+      else
+	{
+	  i++;
+	}
+    }
+}
+
+//
+// remove_connection () - stop watching a connection; connection error handler is called on a connection thread
+//
+void
+css_connection_reactor::remove_connection (cubthread::entry & thread_ref, css_watched_conn & watched, int status)
+{
+  CSS_CONN_ENTRY *conn = watched.conn;
+  struct epoll_event ev;	// ignored; required by old kernels
+
+  assert (!watched.is_removed);
+
+  watched.is_removed = true;
+  (void) epoll_ctl (m_epoll_fd, EPOLL_CTL_DEL, watched.fd, &ev);
+
+  /* check the connection and call connection error handler */
+  if (status != NO_ERRORS || css_check_conn (conn) != NO_ERROR)
+    {
+      er_log_debug (ARG_FILE_LINE,
+		    "css_connection_reactor::remove_connection: status %d conn { status %d transaction_id %d "
+		    "db_error %d stop_talk %d stop_phase %d }\n", status, conn->status, conn->get_tran_index (),
+		    conn->db_error, conn->stop_talk, conn->stop_phase);
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_close_task (*conn));
+    }
+  else
+    {
+      assert (thread_ref.shutdown == true || conn->stop_talk == true);
+    }
+}
+
+void
+css_connection_reactor_task::execute (context_type & thread_ref)
+{
+  m_reactor.loop (thread_ref);
+}
+
+void
+css_connection_close_task::execute (context_type & thread_ref)
+{
+  thread_ref.conn_entry = &m_conn;
+  thread_ref.type = TT_SERVER;	/* server thread */
+
+  // connection error handler expects tran_index_lock to be locked, see css_connection_handler_thread
+  pthread_mutex_lock (&thread_ref.tran_index_lock);
+  (*css_Connection_error_handler) (&thread_ref, &m_conn);
+
+  thread_ref.conn_entry = NULL;
+}
+
+void
+css_connection_check_task::execute (context_type & thread_ref)
+{
+  // the socket may be closed and reused meanwhile; then the result is ignored because reactor removed the connection
+  if (css_peer_alive (m_watched->fd, CSS_PEER_ALIVE_TIMEOUT_MSECS) == false)
+    {
+      m_watched->is_peer_dead = true;
+    }
+  m_watched->is_checking = false;
+}
+
+void
+css_connection_read_task::execute (context_type & thread_ref)
+{
+  CSS_CONN_ENTRY *conn = m_watched->conn;
+  int status, type;
+
+  thread_ref.type = TT_SERVER;	/* server thread */
+
+  status = css_read_and_queue (conn, &type);
+  if (status == NO_ERRORS && type == COMMAND_TYPE)
+    {
+      css_push_server_task (*conn);
+    }
+
+  m_reactor.finish_read (*m_watched, status);
+}
+
+//
+// css_is_packet_received () - check whether the next request of a connection is received, so css_read_and_queue
+//                             does not block on it
+//
+// return  : true if css_read_and_queue does not block
+// fd (in) : socket of the connection
+//
+// note: a request is a header, optionally followed by its data. a command with arguments is followed by a data
+//       header and its data. each header and data is prefixed by its size.
+//
+static bool
+css_is_packet_received (SOCKET fd)
+{
+  char buf[2 * (sizeof (int) + sizeof (NET_HEADER))];
+  NET_HEADER header;
+  ssize_t nbytes;
+  int available = 0;
+  int needed = 0;
+  int length, type, size;
+  int i;
+
+  nbytes = recv (fd, buf, sizeof (buf), MSG_PEEK | MSG_DONTWAIT);
+  if (nbytes < 0)
+    {
+      // on error, the read fails right away
+      return errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR;
+    }
+  if (nbytes == 0)
+    {
+      // closed by peer
+      return true;
+    }
+
+  for (i = 0; i < 2; i++)
+    {
+      if (nbytes < needed + (int) (sizeof (int) + sizeof (NET_HEADER)))
+	{
+	  return false;
+	}
+
+      memcpy (&length, buf + needed, sizeof (int));
+      if ((int) ntohl (length) != (int) sizeof (NET_HEADER))
+	{
+	  // unexpected; let the read handle it on a connection thread
+	  return false;
+	}
+      memcpy (&header, buf + needed + sizeof (int), sizeof (NET_HEADER));
+      needed += sizeof (int) + sizeof (NET_HEADER);
+
+      type = (int) ntohl (header.type);
+      size = (int) ntohl (header.buffer_size);
+      if (size <= 0)
+	{
+	  break;
+	}
+      if (type != COMMAND_TYPE)
+	{
+	  // data follows
+	  needed += sizeof (int) + size;
+	  break;
+	}
+      // data header follows
+    }
+
+  if (ioctl (fd, FIONREAD, &available) != 0)
+    {
+      return false;
+    }
+  return available >= needed;
+}
+
+//
+// css_start_connection_reactors () - start the configured connection reactors; without them, each connection is
+//                                    handled by its own connection thread
+//
+static void
+css_start_connection_reactors (void)
+{
+  int count = prm_get_integer_value (PRM_ID_THREAD_CONNECTION_REACTOR_COUNT);
+  int i;
+
+  if (count <= 0)
+    {
+      return;
+    }
+
+  css_Connection_reactors = new css_connection_reactor[count];
+  for (i = 0; i < count; i++)
+    {
+      if (css_Connection_reactors[i].init () != NO_ERROR)
+	{
+	  // fall back to connection threads
+	  delete [] css_Connection_reactors;
+	  css_Connection_reactors = NULL;
+	  return;
+	}
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool,
+                                            new css_connection_reactor_task (css_Connection_reactors[i]));
+    }
+  css_Num_connection_reactors = count;
+}
+
+//
+// css_destroy_connection_reactors () - destroy connection reactors; their tasks must be stopped
+//
+static void
+css_destroy_connection_reactors (void)
+{
+  css_Num_connection_reactors = 0;
+  delete [] css_Connection_reactors;
+  css_Connection_reactors = NULL;
+}
+#endif /* LINUX */
+
 //
 // css_stop_non_log_writer () - function mapped over worker pools to search and stop non-log writer workers
 //
@@ -3265,6 +3947,12 @@ css_get_server_request_thread_timeout_configuration (void)
   return cubthread::wait_seconds (std::chrono::seconds (prm_get_integer_value (PRM_ID_THREAD_WORKER_TIMEOUT_SECONDS)));
 }
 
+static bool
+css_get_server_request_thread_stealing_configuration (void)
+{
+  return prm_get_bool_value (PRM_ID_THREAD_WORKER_STEALING);
+}
+
 static void
 css_start_all_threads (void)
 {
@@ -465,6 +465,7 @@ static UTIL_ARG_MAP ua_Load_Option_Map[] = {
   {LOAD_SA_MODE_S, {ARG_BOOLEAN}, {(void *) 1}},
   {LOAD_TABLE_NAME_S, {ARG_STRING}, {0}},
   {LOAD_COMPARE_STORAGE_ORDER_S, {ARG_BOOLEAN}, {0}},
+  {LOAD_DEFER_INDEX_BUILD_S, {ARG_BOOLEAN}, {0}},
   {0, {0}, {0}}
 };
 
@@ -489,6 +490,7 @@ static GETOPT_LONG ua_Load_Option[] = {
   {LOAD_SA_MODE_L, 0, 0, LOAD_SA_MODE_S},
   {LOAD_TABLE_NAME_L, 1, 0, LOAD_TABLE_NAME_S},
   {LOAD_COMPARE_STORAGE_ORDER_L, 0, 0, LOAD_COMPARE_STORAGE_ORDER_S},
+  {LOAD_DEFER_INDEX_BUILD_L, 0, 0, LOAD_DEFER_INDEX_BUILD_S},
   {0, 0, 0, 0}
 };
 
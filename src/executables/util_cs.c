@@ -2898,6 +2898,14 @@ applylogdb (UTIL_FUNCTION_ARG * arg)
 
   if (!HA_DISABLED ())
     {
+      /* the apply workers have their own connections; fork them before any connection is made */
+      error = la_start_apply_workers (arg->command_name, database_name);
+      if (error != NO_ERROR)
+	{
+	  util_log_write_errstr ("%s\n", db_error_string (3));
+	  return EXIT_FAILURE;
+	}
+
       /* initialize heartbeat */
       error = hb_process_init (database_name, log_path, HB_PTYPE_APPLYLOGDB);
       if (error != NO_ERROR)
@@ -103,6 +103,7 @@ abstract public class UErrorCode {
 	public static final int CAS_ER_MAX_PREPARED_STMT_COUNT_EXCEEDED = -10026;
 	public static final int CAS_ER_HOLDABLE_NOT_ALLOWED = -10027;
 	public static final int CAS_ER_HOLDABLE_NOT_ALLOWED_KEEP_CON_OFF = -10028;
+	public static final int CAS_ER_PIPELINE_ABORTED = -10029;
 	public static final int CAS_ER_NOT_IMPLEMENTED = -10100;
 	public static final int CAS_ER_MAX_CLIENT_EXCEEDED = -10101;
 	public static final int CAS_ER_INVALID_CURSOR_POS = -10102;
@@ -234,6 +235,8 @@ abstract public class UErrorCode {
 				"Holdable results may not be updatable or sensitive");
 		CASMessageString.put(new Integer(CAS_ER_HOLDABLE_NOT_ALLOWED_KEEP_CON_OFF),
 				"Holdable results are not allowed while KEEP_CONNECTION is off");
+		CASMessageString.put(new Integer(CAS_ER_PIPELINE_ABORTED),
+				"Not executed after the failure of a previous pipelined request");
 		CASMessageString.put(new Integer(CAS_ER_NOT_IMPLEMENTED),
 				"Attempt to use a not supported service");
 		CASMessageString.put(new Integer(CAS_ER_MAX_CLIENT_EXCEEDED), "Proxy refused client connection. max clients exceeded");
@@ -182,6 +182,7 @@ namespace cubload
     , error_file ()
     , ignore_logging (false)
     , compare_storage_order (false)
+    , defer_index_build (false)
     , table_name ()
     , ignore_class_file ()
     , ignore_classes ()
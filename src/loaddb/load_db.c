@@ -38,15 +38,32 @@
 
 #include <fstream>
 #include <thread>
+#include <vector>
 
 const int LOAD_INDEX_MIN_SORT_BUFFER_PAGES = 8192;
 const char *LOAD_INDEX_MIN_SORT_BUFFER_PAGES_STRING = "8192";
 const char *LOADDB_LOG_FILENAME_SUFFIX = "loaddb.log";
+const char *LOADDB_DEFERRED_INDEX_FILENAME_SUFFIX = "loaddb_deferred_indexes.sql";
 
 using namespace cubload;
 
 static FILE *loaddb_log_file;
 
+/* indexes dropped by --defer-index-build, rebuilt after the load */
+/* *INDENT-OFF* */
+struct ldr_deferred_class
+{
+  std::string class_name;
+  SM_CONSTRAINT_INFO *constraints;
+};
+static std::vector<ldr_deferred_class> ldr_Deferred_classes;
+
+/* DDL of the dropped indexes, to recreate them by hand if loaddb stops before rebuilding them */
+static std::string ldr_Deferred_ddl_file_name;
+static std::string ldr_Deferred_ddl_replay;
+/* *INDENT-ON* */
+static FILE *ldr_Deferred_ddl_file = NULL;
+
 int interrupt_query = false;
 bool load_interrupted = false;
 
@@ -70,6 +87,12 @@ static int load_has_authorization (const std::string & class_name, DB_AUTH au_ty
 /* *INDENT-ON* */
 static int load_object_file (load_args * args, int *exit_status);
 static void print_er_msg ();
+/* *INDENT-OFF* */
+static int ldr_defer_class_indexes (const std::string & class_name);
+static void ldr_write_constraint_ddl (FILE * fp, const std::string & class_name, const SM_CONSTRAINT_INFO * saved);
+static int ldr_write_deferred_ddl (const std::string & class_name, const SM_CONSTRAINT_INFO * constraints);
+/* *INDENT-ON* */
+static void ldr_rebuild_deferred_indexes (int *exit_status);
 
 /*
  * print_log_msg - print log message
@@ -507,7 +530,8 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
   sprintf (log_file_name, "%s_%s.err", args.volume.c_str (), arg->command_name);
   er_init (log_file_name, ER_NEVER_EXIT);
 
-  if (!args.index_file.empty () && prm_get_integer_value (PRM_ID_SR_NBUFFERS) < LOAD_INDEX_MIN_SORT_BUFFER_PAGES)
+  if ((!args.index_file.empty () || args.defer_index_build)
+      && prm_get_integer_value (PRM_ID_SR_NBUFFERS) < LOAD_INDEX_MIN_SORT_BUFFER_PAGES)
     {
       sysprm_set_force (prm_get_name (PRM_ID_SR_NBUFFERS), LOAD_INDEX_MIN_SORT_BUFFER_PAGES_STRING);
     }
@@ -674,8 +698,22 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
       print_log_msg (1, "\n--load-only parameter is not supported on Client-Server mode. ");
       print_log_msg (1, "The default behavior of loaddb is loading without checking the file.\n");
     }
+#else
+  if (args.defer_index_build)
+    {
+      print_log_msg (1, "\n--%s parameter is not supported on Standalone mode. ", LOAD_DEFER_INDEX_BUILD_L);
+      print_log_msg (1, "Indexes are maintained while loading.\n");
+      args.defer_index_build = false;
+    }
 #endif
 
+  if (args.defer_index_build)
+    {
+      ldr_Deferred_ddl_file_name = args.volume + "_" + LOADDB_DEFERRED_INDEX_FILENAME_SUFFIX;
+      ldr_Deferred_ddl_replay = "csql -u " + (args.user_name.empty ()? std::string ("dba") : args.user_name)
+	+ " -i " + ldr_Deferred_ddl_file_name + " " + args.volume;
+    }
+
   /* if schema file is specified, do schema loading */
   if (schema_file != NULL)
     {
@@ -1087,6 +1125,7 @@ get_loaddb_args (UTIL_ARG_MAP * arg_map, load_args * args)
   args->error_file = error_file ? error_file : empty;
   args->ignore_logging = utility_get_option_bool_value (arg_map, LOAD_IGNORE_LOGGING_S);
   args->compare_storage_order = utility_get_option_bool_value (arg_map, LOAD_COMPARE_STORAGE_ORDER_S);
+  args->defer_index_build = utility_get_option_bool_value (arg_map, LOAD_DEFER_INDEX_BUILD_S);
   args->table_name = table_name ? table_name : empty;
   args->ignore_class_file = ignore_class_file ? ignore_class_file : empty;
 }
@@ -1147,6 +1186,9 @@ ldr_server_load (load_args * args, int *exit_status, bool * interrupted)
     }
   while (!(status.is_load_completed () || status.is_load_failed ()) && *exit_status != 3);
 
+  /* rows are committed periodically, so the dropped indexes are rebuilt whatever the outcome of the load */
+  ldr_rebuild_deferred_indexes (exit_status);
+
   if (load_interrupted)
     {
       print_log_msg (1, msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_LOADDB, LOADDB_MSG_SIG1));
@@ -1277,6 +1319,15 @@ load_object_file (load_args * args, int *exit_status)
 	{
 	  return error_code;
 	}
+
+      if (args->defer_index_build && !args->syntax_check)
+	{
+	  error_code = ldr_defer_class_indexes (args->table_name);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
     }
 
   /* *INDENT-OFF* */
@@ -1302,7 +1353,7 @@ load_object_file (load_args * args, int *exit_status)
     return error_code;
   };
 
-  class_handler c_handler = [] (const batch &batch, bool &is_ignored) -> int
+  class_handler c_handler = [&] (const batch &batch, bool &is_ignored) -> int
   {
     std::string class_name;
     int error_code = loaddb_install_class (batch, is_ignored, class_name);
@@ -1315,6 +1366,11 @@ load_object_file (load_args * args, int *exit_status)
     if (!is_ignored && !class_name.empty ())
       {
 	error_code = load_has_authorization (class_name, AU_INSERT);
+	if (error_code == NO_ERROR && args->defer_index_build && !args->syntax_check)
+	  {
+	    // no batch of this class was sent yet, so none of its rows is indexed
+	    error_code = ldr_defer_class_indexes (class_name);
+	  }
       }
 
     return error_code;
@@ -1324,3 +1380,335 @@ load_object_file (load_args * args, int *exit_status)
   // here we are sure that object_file exists since it was validated by loaddb_internal function
   return split (args->periodic_commit, args->object_file, c_handler, b_handler);
 }
+
+/*
+ * ldr_defer_class_indexes - drop the indexes of a class before its objects are loaded
+ *    return: NO_ERROR if successful, error code otherwise
+ *    class_name(in): class to be loaded
+ *
+ * NOTE: the dropped constraints are saved and recreated by ldr_rebuild_deferred_indexes using the sort based index
+ *       loading. The drop is committed right away, so that the loaddb workers can insert into the class. Until the
+ *       rebuild, unique and primary keys of the class are not enforced for any session; their definitions are also
+ *       written to a DDL file first, so they can be recreated by hand if loaddb stops before the rebuild.
+ */
+static int
+ldr_defer_class_indexes (const std::string & class_name)
+{
+  SM_CONSTRAINT_INFO *constraints = NULL;
+  DB_OBJECT *class_mop;
+  int error_code;
+
+  /* *INDENT-OFF* */
+  for (const ldr_deferred_class &deferred : ldr_Deferred_classes)
+    {
+      if (deferred.class_name == class_name)
+	{
+	  // already done, class is referred more than once in object file
+	  return NO_ERROR;
+	}
+    }
+  /* *INDENT-ON* */
+
+  class_mop = db_find_class (class_name.c_str ());
+  if (class_mop == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  error_code = sm_drop_indexes_for_bulk_load (class_mop, &constraints);
+  if (error_code != NO_ERROR)
+    {
+      (void) db_abort_transaction ();
+      return error_code;
+    }
+
+  // the definitions must be on disk before the drop is committed
+  error_code = ldr_write_deferred_ddl (class_name, constraints);
+  if (error_code != NO_ERROR)
+    {
+      sm_free_constraint_info (&constraints);
+      (void) db_abort_transaction ();
+      return error_code;
+    }
+
+  error_code = db_commit_transaction ();
+  if (error_code != NO_ERROR)
+    {
+      sm_free_constraint_info (&constraints);
+      return error_code;
+    }
+
+  if (constraints != NULL)
+    {
+      print_log_msg (1, "Indexes of class %s are dropped and will be rebuilt after loading.\n", class_name.c_str ());
+      ldr_Deferred_classes.push_back ({class_name, constraints});
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * ldr_write_constraint_ddl - write the statement that recreates a dropped constraint
+ *    return: void
+ *    fp(in): output file
+ *    class_name(in): class of the constraint
+ *    saved(in): saved constraint
+ */
+static void
+ldr_write_constraint_ddl (FILE * fp, const std::string & class_name, const SM_CONSTRAINT_INFO * saved)
+{
+  const char *type;
+  int i, k, n_cols;
+
+  switch (saved->constraint_type)
+    {
+    case DB_CONSTRAINT_PRIMARY_KEY:
+    case DB_CONSTRAINT_FOREIGN_KEY:
+      fprintf (fp, "ALTER TABLE [%s] ADD CONSTRAINT [%s] %s (", class_name.c_str (), saved->name,
+	       (saved->constraint_type == DB_CONSTRAINT_PRIMARY_KEY) ? "PRIMARY KEY" : "FOREIGN KEY");
+      for (i = 0; saved->att_names[i] != NULL; i++)
+	{
+	  fprintf (fp, "%s[%s]", (i > 0) ? ", " : "", saved->att_names[i]);
+	}
+      fprintf (fp, ")");
+
+      if (saved->constraint_type == DB_CONSTRAINT_FOREIGN_KEY)
+	{
+	  fprintf (fp, " REFERENCES [%s] (", saved->ref_cls_name);
+	  for (i = 0; saved->ref_attrs != NULL && saved->ref_attrs[i] != NULL; i++)
+	    {
+	      fprintf (fp, "%s[%s]", (i > 0) ? ", " : "", saved->ref_attrs[i]);
+	    }
+	  fprintf (fp, ") ON DELETE %s ON UPDATE %s", classobj_describe_foreign_key_action (saved->fk_delete_action),
+		   classobj_describe_foreign_key_action (saved->fk_update_action));
+	}
+      fprintf (fp, ";\n");
+      return;
+
+    case DB_CONSTRAINT_UNIQUE:
+      type = "UNIQUE ";
+      break;
+    case DB_CONSTRAINT_REVERSE_UNIQUE:
+      type = "REVERSE UNIQUE ";
+      break;
+    case DB_CONSTRAINT_REVERSE_INDEX:
+      type = "REVERSE ";
+      break;
+    default:
+      type = "";
+      break;
+    }
+
+  fprintf (fp, "CREATE %sINDEX [%s] ON [%s] (", type, saved->name, class_name.c_str ());
+
+  if (saved->func_index_info != NULL)
+    {
+      n_cols = saved->func_index_info->attr_index_start + 1;
+    }
+  else
+    {
+      for (n_cols = 0; saved->att_names[n_cols] != NULL; n_cols++)
+	{
+	  ;
+	}
+    }
+
+  for (i = 0, k = 0; k < n_cols; k++)
+    {
+      if (k > 0)
+	{
+	  fprintf (fp, ", ");
+	}
+
+      if (saved->func_index_info != NULL && k == saved->func_index_info->col_id)
+	{
+	  fprintf (fp, "%s%s", saved->func_index_info->expr_str,
+		   saved->func_index_info->fi_domain->is_desc ? " DESC" : "");
+	  continue;
+	}
+
+      fprintf (fp, "[%s]", saved->att_names[i]);
+      if (saved->prefix_length != NULL && saved->prefix_length[i] >= 0)
+	{
+	  fprintf (fp, " (%d)", saved->prefix_length[i]);
+	}
+      if (saved->asc_desc != NULL && saved->asc_desc[i] == 1)
+	{
+	  fprintf (fp, " DESC");
+	}
+      i++;
+    }
+  fprintf (fp, ")");
+
+  if (saved->filter_predicate != NULL && saved->filter_predicate->pred_string != NULL)
+    {
+      fprintf (fp, " WHERE %s", saved->filter_predicate->pred_string);
+    }
+  fprintf (fp, ";\n");
+}
+
+/*
+ * ldr_write_deferred_ddl - write the DDL of the constraints dropped on a class and sync it to disk
+ *    return: NO_ERROR if successful, error code otherwise
+ *    class_name(in): class of the constraints
+ *    constraints(in): dropped constraints
+ */
+static int
+ldr_write_deferred_ddl (const std::string & class_name, const SM_CONSTRAINT_INFO * constraints)
+{
+  const SM_CONSTRAINT_INFO *saved;
+  int pass;
+
+  if (constraints == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  if (ldr_Deferred_ddl_file == NULL)
+    {
+      ldr_Deferred_ddl_file = fopen (ldr_Deferred_ddl_file_name.c_str (), "w");
+      if (ldr_Deferred_ddl_file == NULL)
+	{
+	  PRINT_AND_LOG_ERR_MSG ("Cannot open file %s\n", ldr_Deferred_ddl_file_name.c_str ());
+	  return ER_FAILED;
+	}
+
+      print_log_msg (1, "Definitions of the dropped indexes are saved in %s. If loaddb stops before rebuilding them, "
+		     "recreate them with: %s\n", ldr_Deferred_ddl_file_name.c_str (), ldr_Deferred_ddl_replay.c_str ());
+    }
+
+  // foreign keys last, as they are rebuilt
+  for (pass = 0; pass < 2; pass++)
+    {
+      for (saved = constraints; saved != NULL; saved = saved->next)
+	{
+	  if ((saved->constraint_type == DB_CONSTRAINT_FOREIGN_KEY) == (pass == 1))
+	    {
+	      ldr_write_constraint_ddl (ldr_Deferred_ddl_file, class_name, saved);
+	    }
+	}
+    }
+
+  if (fflush (ldr_Deferred_ddl_file) != 0 || fsync (fileno (ldr_Deferred_ddl_file)) != 0)
+    {
+      PRINT_AND_LOG_ERR_MSG ("Cannot write file %s\n", ldr_Deferred_ddl_file_name.c_str ());
+      return ER_FAILED;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * ldr_rebuild_deferred_indexes - recreate the indexes dropped by ldr_defer_class_indexes
+ *    return: void
+ *    exit_status(out): set to 3 if any index could not be rebuilt
+ *
+ * NOTE: each index is built by btree_load_index from the sorted keys of the loaded heap. Unique and foreign key
+ *       violations are detected while building; the failing constraint is reported and the others are still rebuilt.
+ *       All other indexes are rebuilt before the foreign keys, which may refer to a primary key dropped on another
+ *       loaded class. The DDL file is left with the constraints that could not be rebuilt, or removed.
+ */
+static void
+ldr_rebuild_deferred_indexes (int *exit_status)
+{
+  SM_CONSTRAINT_INFO *saved;
+  DB_OBJECT *class_mop;
+  /* *INDENT-OFF* */
+  std::vector<std::pair<std::string, SM_CONSTRAINT_INFO *>> failed;
+  /* *INDENT-ON* */
+  FILE *fp;
+  int error_code;
+  int pass;
+
+  if (ldr_Deferred_classes.empty ())
+    {
+      return;
+    }
+
+  print_log_msg (1, "\nStart deferred index building.\n");
+
+  for (pass = 0; pass < 2; pass++)
+    {
+      /* *INDENT-OFF* */
+      for (ldr_deferred_class &deferred : ldr_Deferred_classes)
+	{
+	  class_mop = db_find_class (deferred.class_name.c_str ());
+
+	  for (saved = deferred.constraints; saved != NULL; saved = saved->next)
+	    {
+	      if ((saved->constraint_type == DB_CONSTRAINT_FOREIGN_KEY) != (pass == 1))
+		{
+		  continue;
+		}
+
+	      if (class_mop == NULL)
+		{
+		  error_code = ER_FAILED;
+		}
+	      else
+		{
+		  error_code = sm_recreate_constraint (class_mop, saved);
+		  if (error_code == NO_ERROR)
+		    {
+		      error_code = db_commit_transaction ();
+		    }
+		}
+
+	      if (error_code != NO_ERROR)
+		{
+		  print_er_msg ();
+		  print_log_msg (1, "Index %s of class %s could not be rebuilt.\n", saved->name,
+				 deferred.class_name.c_str ());
+		  util_log_write_errstr ("Index %s of class %s could not be rebuilt.\n", saved->name,
+					 deferred.class_name.c_str ());
+		  (void) db_abort_transaction ();
+		  *exit_status = 3;
+		  failed.emplace_back (deferred.class_name, saved);
+		}
+	      else
+		{
+		  print_log_msg (1, "Index %s of class %s is rebuilt.\n", saved->name, deferred.class_name.c_str ());
+		}
+	    }
+	}
+      /* *INDENT-ON* */
+    }
+
+  if (ldr_Deferred_ddl_file != NULL)
+    {
+      fclose (ldr_Deferred_ddl_file);
+      ldr_Deferred_ddl_file = NULL;
+
+      if (failed.empty ())
+	{
+	  (void) remove (ldr_Deferred_ddl_file_name.c_str ());
+	}
+      else
+	{
+	  fp = fopen (ldr_Deferred_ddl_file_name.c_str (), "w");
+	  if (fp != NULL)
+	    {
+	      /* *INDENT-OFF* */
+	      for (const std::pair<std::string, SM_CONSTRAINT_INFO *> &f : failed)
+		{
+		  ldr_write_constraint_ddl (fp, f.first, f.second);
+		}
+	      /* *INDENT-ON* */
+	      fclose (fp);
+	    }
+	  print_log_msg (1, "Definitions of the indexes that could not be rebuilt are kept in %s. After fixing the data, "
+			 "recreate them with: %s\n", ldr_Deferred_ddl_file_name.c_str (), ldr_Deferred_ddl_replay.c_str ());
+	}
+    }
+
+  /* *INDENT-OFF* */
+  for (ldr_deferred_class &deferred : ldr_Deferred_classes)
+    {
+      sm_free_constraint_info (&deferred.constraints);
+    }
+  /* *INDENT-ON* */
+  ldr_Deferred_classes.clear ();
+
+  print_log_msg (1, "Deferred index building finished.\n");
+}
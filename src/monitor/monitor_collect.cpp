@@ -19,6 +19,8 @@
 
 #include "monitor_collect.hpp"
 
+#include <algorithm>
+
 namespace cubmonitor
 {
   void
@@ -27,4 +29,138 @@ namespace cubmonitor
     names.push_back (std::string (prefix) + basename);
   }
 
+  //////////////////////////////////////////////////////////////////////////
+  // time_histogram_statistic
+  //////////////////////////////////////////////////////////////////////////
+
+  time_histogram_statistic::time_histogram_statistic (void)
+  {
+    for (shard &shd : m_shards)
+      {
+	for (std::atomic<std::uint64_t> &bucket : shd.m_buckets)
+	  {
+	    bucket = 0;
+	  }
+	shd.m_max_nsec = 0;
+      }
+  }
+
+  std::size_t
+  time_histogram_statistic::get_shard_index (void)
+  {
+    // threads are spread on shards in the order they first collect any histogram
+    static std::atomic<std::size_t> next_index (0);
+    static thread_local std::size_t shard_index = next_index.fetch_add (1) % SHARD_COUNT;
+
+    return shard_index;
+  }
+
+  void
+  time_histogram_statistic::collect (const time_rep &d)
+  {
+    std::uint64_t nsec = (std::uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds> (d).count ();
+    shard &shd = m_shards[get_shard_index ()];
+    std::uint64_t max_nsec;
+
+    shd.m_buckets[histogram_bucket_index (nsec)].fetch_add (1, std::memory_order_relaxed);
+
+    max_nsec = shd.m_max_nsec.load (std::memory_order_relaxed);
+    while (nsec > max_nsec && !shd.m_max_nsec.compare_exchange_weak (max_nsec, nsec, std::memory_order_relaxed))
+      {
+	// max_nsec was reloaded; try again
+      }
+  }
+
+  std::size_t
+  time_histogram_statistic::get_statistics_count (void) const
+  {
+    return 6;
+  }
+
+  void
+  time_histogram_statistic::fetch (statistic_value *destination, fetch_mode mode /* = FETCH_GLOBAL */) const
+  {
+    std::uint64_t buckets[HISTOGRAM_BUCKET_COUNT];
+    const std::uint64_t per_mille[] = { 500, 900, 990, 999 };
+    time_rep max_time;
+    std::size_t index = 0;
+
+    if (mode == FETCH_TRANSACTION_SHEET)
+      {
+	// no transaction sheet
+	return;
+      }
+
+    get_buckets (buckets);
+    max_time = get_max_time ();
+
+    destination[index++] = statistic_value_cast (histogram_total_count (buckets));
+    for (std::uint64_t pm : per_mille)
+      {
+	std::chrono::nanoseconds percentile (histogram_percentile (buckets, pm));
+	destination[index++] = statistic_value_cast (std::min (std::chrono::duration_cast<time_rep> (percentile), max_time));
+      }
+    destination[index++] = statistic_value_cast (max_time);
+
+    assert (index == get_statistics_count ());
+  }
+
+  void
+  time_histogram_statistic::get_buckets (std::uint64_t *buckets) const
+  {
+    for (std::size_t index = 0; index < HISTOGRAM_BUCKET_COUNT; index++)
+      {
+	buckets[index] = 0;
+      }
+    for (const shard &shd : m_shards)
+      {
+	for (std::size_t index = 0; index < HISTOGRAM_BUCKET_COUNT; index++)
+	  {
+	    buckets[index] += shd.m_buckets[index].load (std::memory_order_relaxed);
+	  }
+      }
+  }
+
+  amount_rep
+  time_histogram_statistic::get_count (void) const
+  {
+    std::uint64_t buckets[HISTOGRAM_BUCKET_COUNT];
+
+    get_buckets (buckets);
+    return histogram_total_count (buckets);
+  }
+
+  time_rep
+  time_histogram_statistic::get_percentile (std::uint64_t per_mille) const
+  {
+    std::uint64_t buckets[HISTOGRAM_BUCKET_COUNT];
+    time_rep max_time = get_max_time ();
+
+    get_buckets (buckets);
+    std::chrono::nanoseconds percentile (histogram_percentile (buckets, per_mille));
+    return std::min (std::chrono::duration_cast<time_rep> (percentile), max_time);
+  }
+
+  time_rep
+  time_histogram_statistic::get_max_time (void) const
+  {
+    std::uint64_t max_nsec = 0;
+
+    for (const shard &shd : m_shards)
+      {
+	max_nsec = std::max (max_nsec, shd.m_max_nsec.load (std::memory_order_relaxed));
+      }
+    return std::chrono::duration_cast<time_rep> (std::chrono::nanoseconds (max_nsec));
+  }
+
+  void
+  time_histogram_statistic::register_to_monitor (monitor &mon, const char *basename) const
+  {
+    std::vector<std::string> names;
+    build_name_vector (names, basename, "Num_", "P50_time_", "P90_time_", "P99_time_", "P999_time_", "Max_time_");
+
+    assert (get_statistics_count () == names.size ());
+    mon.register_statistics (*this, names);
+  }
+
 }  // namespace cubmonitor
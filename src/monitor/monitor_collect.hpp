@@ -28,6 +28,8 @@
 #include "monitor_statistic.hpp"
 #include "monitor_transaction.hpp"
 
+#include <atomic>
+
 namespace cubmonitor
 {
 
@@ -230,6 +232,65 @@ namespace cubmonitor
   template class counter_timer_max_statistic<transaction_statistic<amount_accumulator_atomic_statistic>,
       transaction_statistic<time_accumulator_atomic_statistic>, transaction_statistic<time_max_atomic_statistic>>;
 
+  //////////////////////////////////////////////////////////////////////////
+  // Time histogram statistic - distribution of event durations
+  //
+  // Durations are counted in a log-linear histogram (see histogram layout in monitor_definition.hpp). Collecting is
+  // lock-free: each thread counts in one of several shards, so concurrent threads seldom update the same cache lines.
+  // Fetching adds up the shards and provides six statistics: count, 50th, 90th, 99th and 99.9th percentiles and max
+  // duration. Percentiles are bucket upper bounds, never above max.
+  //
+  // There are no transaction sheets.
+  //////////////////////////////////////////////////////////////////////////
+  class time_histogram_statistic
+  {
+    public:
+      // autotimer collects the duration from its construction to its destruction
+      class autotimer
+      {
+	public:
+	  autotimer () = delete;
+	  inline autotimer (time_histogram_statistic &hist_stat, bool active = true);
+	  inline ~autotimer ();
+	private:
+	  time_histogram_statistic &m_stat;
+	  time_point m_start_pt;
+	  bool m_active;
+      };
+
+      time_histogram_statistic (void);
+
+      void collect (const time_rep &d);         // count one duration
+
+      // fetch interface
+      std::size_t get_statistics_count (void) const;
+      void fetch (statistic_value *destination, fetch_mode mode = FETCH_GLOBAL) const;
+
+      // getters
+      // copy the bucket counts (HISTOGRAM_BUCKET_COUNT values) of all shards added up
+      void get_buckets (std::uint64_t *buckets) const;
+      amount_rep get_count (void) const;
+      time_rep get_percentile (std::uint64_t per_mille) const;
+      time_rep get_max_time (void) const;
+
+      // register statistic to monitor
+      // six statistics are registered: counter, p50, p90, p99, p999 and max time
+      void register_to_monitor (monitor &mon, const char *basename) const;
+
+    private:
+      static const std::size_t SHARD_COUNT = 16;
+
+      struct shard
+      {
+	std::atomic<std::uint64_t> m_buckets[HISTOGRAM_BUCKET_COUNT];
+	std::atomic<std::uint64_t> m_max_nsec;
+      };
+
+      static std::size_t get_shard_index (void);
+
+      shard m_shards[SHARD_COUNT];
+  };
+
   //////////////////////////////////////////////////////////////////////////
   // template and inline implementation
   //////////////////////////////////////////////////////////////////////////
@@ -540,6 +601,29 @@ namespace cubmonitor
     mon.register_statistics (stat_count, fetch_func, names);
   }
 
+  //////////////////////////////////////////////////////////////////////////
+  // time_histogram_statistic
+  //////////////////////////////////////////////////////////////////////////
+
+  time_histogram_statistic::autotimer::autotimer (time_histogram_statistic &hist_stat, bool active)
+    : m_stat (hist_stat)
+    , m_start_pt ()
+    , m_active (active)
+  {
+    if (m_active)
+      {
+	m_start_pt = clock_type::now ();
+      }
+  }
+
+  time_histogram_statistic::autotimer::~autotimer ()
+  {
+    if (m_active)
+      {
+	m_stat.collect (clock_type::now () - m_start_pt);
+      }
+  }
+
   //
   // timer
   //
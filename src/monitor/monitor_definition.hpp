@@ -26,6 +26,7 @@
 
 #include <chrono>
 
+#include <cstddef>
 #include <cstdint>
 
 namespace cubmonitor
@@ -43,6 +44,117 @@ namespace cubmonitor
   const fetch_mode FETCH_GLOBAL = true;
   const fetch_mode FETCH_TRANSACTION_SHEET = false;
 
+  // log-linear histogram layout
+  //
+  //    values (nanoseconds for time histograms) are counted in buckets. the first HISTOGRAM_SUB_BUCKET_COUNT buckets
+  //    hold one value each; after them, each power of two range is split into HISTOGRAM_SUB_BUCKET_COUNT buckets of
+  //    equal width, so a bucket is never wider than 1 / HISTOGRAM_SUB_BUCKET_COUNT of its values. values of
+  //    HISTOGRAM_MAX_VALUE or more are counted in the last bucket.
+  //
+  //    the layout is shared by collectors and by whoever computes percentiles out of bucket counts (e.g. statdump).
+  //
+  const std::size_t HISTOGRAM_SUB_BUCKET_BITS = 3;
+  const std::size_t HISTOGRAM_SUB_BUCKET_COUNT = 1 << HISTOGRAM_SUB_BUCKET_BITS;
+  const std::size_t HISTOGRAM_VALUE_BITS = 40;      // about 18 minutes in nanoseconds
+  const std::uint64_t HISTOGRAM_MAX_VALUE = ((std::uint64_t) 1) << HISTOGRAM_VALUE_BITS;
+  const std::size_t HISTOGRAM_BUCKET_COUNT =
+	  (HISTOGRAM_VALUE_BITS - HISTOGRAM_SUB_BUCKET_BITS + 1) * HISTOGRAM_SUB_BUCKET_COUNT;
+
+  inline std::size_t
+  histogram_bucket_index (std::uint64_t value)
+  {
+    std::size_t msb;
+    std::size_t shift;
+
+    if (value < HISTOGRAM_SUB_BUCKET_COUNT)
+      {
+	return (std::size_t) value;
+      }
+    if (value >= HISTOGRAM_MAX_VALUE)
+      {
+	value = HISTOGRAM_MAX_VALUE - 1;
+      }
+
+#if defined (__GNUC__)
+    msb = 63 - __builtin_clzll (value);
+#else
+    for (msb = HISTOGRAM_SUB_BUCKET_BITS; (value >> (msb + 1)) != 0; msb++)
+      {
+	;
+      }
+#endif
+    shift = msb - HISTOGRAM_SUB_BUCKET_BITS;
+    return (shift + 1) * HISTOGRAM_SUB_BUCKET_COUNT + (std::size_t) ((value >> shift) - HISTOGRAM_SUB_BUCKET_COUNT);
+  }
+
+  // smallest value counted in bucket
+  inline std::uint64_t
+  histogram_bucket_lower_bound (std::size_t index)
+  {
+    std::size_t shift;
+
+    if (index < HISTOGRAM_SUB_BUCKET_COUNT)
+      {
+	return index;
+      }
+    shift = index / HISTOGRAM_SUB_BUCKET_COUNT - 1;
+    return ((std::uint64_t) (HISTOGRAM_SUB_BUCKET_COUNT + index % HISTOGRAM_SUB_BUCKET_COUNT)) << shift;
+  }
+
+  // biggest value counted in bucket
+  inline std::uint64_t
+  histogram_bucket_upper_bound (std::size_t index)
+  {
+    if (index + 1 >= HISTOGRAM_BUCKET_COUNT)
+      {
+	return HISTOGRAM_MAX_VALUE - 1;
+      }
+    return histogram_bucket_lower_bound (index + 1) - 1;
+  }
+
+  // count of values in all HISTOGRAM_BUCKET_COUNT buckets
+  inline std::uint64_t
+  histogram_total_count (const std::uint64_t *buckets)
+  {
+    std::uint64_t total = 0;
+
+    for (std::size_t index = 0; index < HISTOGRAM_BUCKET_COUNT; index++)
+      {
+	total += buckets[index];
+      }
+    return total;
+  }
+
+  // value below which are per_mille / 1000 of all values; the upper bound of the bucket is returned, so the
+  // result is overestimated by at most the bucket width. if there is no value, 0 is returned.
+  inline std::uint64_t
+  histogram_percentile (const std::uint64_t *buckets, std::uint64_t per_mille)
+  {
+    std::uint64_t total = histogram_total_count (buckets);
+    std::uint64_t rank;
+    std::uint64_t count = 0;
+
+    if (total == 0)
+      {
+	return 0;
+      }
+
+    rank = (total * per_mille + 999) / 1000;
+    if (rank == 0)
+      {
+	rank = 1;
+      }
+    for (std::size_t index = 0; index < HISTOGRAM_BUCKET_COUNT; index++)
+      {
+	count += buckets[index];
+	if (count >= rank)
+	  {
+	    return histogram_bucket_upper_bound (index);
+	  }
+      }
+    return HISTOGRAM_MAX_VALUE - 1;
+  }
+
 } // namespace cubmonitor
 
 #endif // _MONITOR_DEFINITION_HPP_
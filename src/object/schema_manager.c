@@ -15848,6 +15848,201 @@ error_exit:
   return error;
 }
 
+/*
+ * sm_drop_indexes_for_bulk_load () - drops the indexes of a class before a bulk load, saving the information needed
+ *                                    to recreate them once the load is finished
+ *   return: NO_ERROR on success, non-zero for ERROR
+ *   class_mop(in): class to be loaded
+ *   save_info(out): saved constraints, in the order they must be recreated
+ *
+ * NOTE: Like in sm_truncate_class, a PRIMARY KEY referred by a FOREIGN KEY and constraints which may hold OIDs of
+ *       other classes in the hierarchy are kept and maintained by the load.
+ *       The caller must commit so that the loader transactions can use the class.
+ */
+int
+sm_drop_indexes_for_bulk_load (MOP class_mop, SM_CONSTRAINT_INFO ** save_info)
+{
+  SM_CLASS *class_ = NULL;
+  SM_CLASS_CONSTRAINT *c = NULL;
+  SM_CONSTRAINT_INFO *unique_save_info = NULL;
+  SM_CONSTRAINT_INFO *fk_save_info = NULL;
+  SM_CONSTRAINT_INFO *index_save_info = NULL;
+  SM_CONSTRAINT_INFO *saved = NULL;
+  DB_CTMPL *ctmpl = NULL;
+  bool keep_pk = false;
+  int error = NO_ERROR;
+
+  assert (class_mop != NULL && save_info != NULL && *save_info == NULL);
+
+  error = au_fetch_class (class_mop, &class_, AU_FETCH_WRITE, DB_AUTH_ALTER);
+  if (error != NO_ERROR || class_ == NULL)
+    {
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
+
+  c = classobj_find_cons_primary_key (class_->constraints);
+  if (c != NULL && classobj_is_pk_referred (class_mop, c->fk_info, false, NULL))
+    {
+      /* the PK can't be dropped while it is referred */
+      keep_pk = true;
+    }
+
+  for (c = class_->constraints; c; c = c->next)
+    {
+      if (!SM_IS_CONSTRAINT_INDEX_FAMILY (c->type))
+	{
+	  continue;
+	}
+
+      if ((keep_pk == true && c->type == SM_CONSTRAINT_PRIMARY_KEY)
+	  || !sm_is_possible_to_recreate_constraint (class_mop, class_, c))
+	{
+	  continue;
+	}
+
+      if (SM_IS_CONSTRAINT_UNIQUE_FAMILY (c->type))
+	{
+	  error = sm_save_constraint_info (&unique_save_info, c);
+	}
+      else if (c->type == SM_CONSTRAINT_FOREIGN_KEY)
+	{
+	  error = sm_save_constraint_info (&fk_save_info, c);
+	}
+      else
+	{
+	  error = sm_save_constraint_info (&index_save_info, c);
+	}
+
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+    }
+
+  /* FK must be dropped earlier than PK, because of self referencing case */
+  if (fk_save_info != NULL)
+    {
+      ctmpl = dbt_edit_class (class_mop);
+      if (ctmpl == NULL)
+	{
+	  assert (er_errid () != NO_ERROR);
+	  error = er_errid ();
+	  goto error_exit;
+	}
+
+      for (saved = fk_save_info; saved != NULL; saved = saved->next)
+	{
+	  error = dbt_drop_constraint (ctmpl, saved->constraint_type, saved->name, (const char **) saved->att_names, 0);
+	  if (error != NO_ERROR)
+	    {
+	      dbt_abort_class (ctmpl);
+	      goto error_exit;
+	    }
+	}
+
+      if (dbt_finish_class (ctmpl) == NULL)
+	{
+	  dbt_abort_class (ctmpl);
+	  assert (er_errid () != NO_ERROR);
+	  error = er_errid ();
+	  goto error_exit;
+	}
+    }
+
+  for (saved = unique_save_info; saved != NULL; saved = saved->next)
+    {
+      error =
+	sm_drop_constraint (class_mop, saved->constraint_type, saved->name, (const char **) saved->att_names, 0, false);
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+    }
+
+  for (saved = index_save_info; saved != NULL; saved = saved->next)
+    {
+      error = sm_drop_index (class_mop, saved->name);
+      if (error != NO_ERROR)
+	{
+	  goto error_exit;
+	}
+    }
+
+  /* Normal index must be created earlier than unique constraint or FK, because of shared btree case.
+   * PK must be created earlier than FK, because of self referencing case. */
+  *save_info = index_save_info;
+  while (*save_info != NULL)
+    {
+      save_info = &((*save_info)->next);
+    }
+  *save_info = unique_save_info;
+  while (*save_info != NULL)
+    {
+      save_info = &((*save_info)->next);
+    }
+  *save_info = fk_save_info;
+
+  return NO_ERROR;
+
+error_exit:
+  sm_free_constraint_info (&unique_save_info);
+  sm_free_constraint_info (&fk_save_info);
+  sm_free_constraint_info (&index_save_info);
+
+  return error;
+}
+
+/*
+ * sm_recreate_constraint () - recreates a constraint saved by sm_drop_indexes_for_bulk_load
+ *   return: NO_ERROR on success, non-zero for ERROR
+ *   class_mop(in): class
+ *   saved(in): the constraint to be recreated
+ *
+ * NOTE: The index of a class holding instances is built by btree_load_index, which sorts the keys of the heap and
+ *       checks the UNIQUE and FOREIGN KEY constraints while building.
+ */
+int
+sm_recreate_constraint (MOP class_mop, const SM_CONSTRAINT_INFO * saved)
+{
+  DB_CTMPL *ctmpl = NULL;
+  int error = NO_ERROR;
+
+  assert (class_mop != NULL && saved != NULL);
+
+  if (saved->constraint_type != DB_CONSTRAINT_FOREIGN_KEY)
+    {
+      return sm_add_constraint (class_mop, saved->constraint_type, saved->name, (const char **) saved->att_names,
+				saved->asc_desc, saved->prefix_length, false, saved->filter_predicate,
+				saved->func_index_info, saved->comment, saved->index_status);
+    }
+
+  ctmpl = dbt_edit_class (class_mop);
+  if (ctmpl == NULL)
+    {
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
+
+  error = dbt_add_foreign_key (ctmpl, saved->name, (const char **) saved->att_names, saved->ref_cls_name,
+			       (const char **) saved->ref_attrs, saved->fk_delete_action, saved->fk_update_action,
+			       saved->comment);
+  if (error != NO_ERROR)
+    {
+      dbt_abort_class (ctmpl);
+      return error;
+    }
+
+  if (dbt_finish_class (ctmpl) == NULL)
+    {
+      dbt_abort_class (ctmpl);
+      assert (er_errid () != NO_ERROR);
+      return er_errid ();
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * sm_has_non_null_attribute () - check if whether there is at least
  *                                one non null constraint in a given
@@ -155,6 +155,8 @@ extern int sm_force_method_link (MOP obj);
 extern char *sm_get_method_source_file (MOP obj, const char *name);
 
 extern int sm_truncate_class (MOP class_mop);
+extern int sm_drop_indexes_for_bulk_load (MOP class_mop, SM_CONSTRAINT_INFO ** save_info);
+extern int sm_recreate_constraint (MOP class_mop, const SM_CONSTRAINT_INFO * saved);
 
 extern int sm_save_constraint_info (SM_CONSTRAINT_INFO ** save_info, const SM_CLASS_CONSTRAINT * const c);
 extern int sm_save_function_index_info (SM_FUNCTION_INFO ** save_info, SM_FUNCTION_INFO * func_index_info);
@@ -162,7 +162,8 @@ make_fetch_proc (QO_ENV * env, QO_PLAN * plan)
  *   rght_elist(in): The join terms expr list of right expr segs
  *
  * Note: Make a MERGELIST_PROC XASL node that will eventually reside
- *	on the merge_list_ptr of some other XASL node.
+ *	on the merge_list_ptr of some other XASL node. The same node
+ *	implements hash joins; the lists are not sorted then.
  *	Thes initializes the left and right procs  things
  *	live in such a specialized environment that there is no need
  *	to initialize anything other than the type and the access
@@ -204,6 +205,7 @@ make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * l
   ls_merge = &merge->proc.mergelist.ls_merge;
 
   ls_merge->join_type = plan->plan_un.join.join_type;
+  ls_merge->hash_join = (plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN);
 
   ncols = ls_merge->ls_column_cnt = bitset_cardinality (&(plan->plan_un.join.join_terms));
   assert (ncols > 0);
@@ -299,6 +301,13 @@ make_mergelist_proc (QO_ENV * env, QO_PLAN * plan, XASL_NODE * left, PT_NODE * l
 	}
       ls_merge->ls_inner_unique[cnt] = false;	/* currently, unused */
 
+      if (ls_merge->hash_join)
+	{
+	  /* hash join does not need sorted lists */
+	  cnt++;
+	  continue;
+	}
+
       /* set outer list order entry */
       prev_order = NULL;
       for (order = left->orderby_list; order; order = order->next)
@@ -921,7 +930,8 @@ add_sort_spec (QO_ENV * env, XASL_NODE * xasl, QO_PLAN * plan, DB_VALUE * ordby_
   if (instnum_flag)
     {
       if (xasl && subplan->plan_type == QO_PLANTYPE_JOIN
-	  && subplan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+	  && (subplan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+	      || subplan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN))
 	{
 	  PT_NODE *instnum_pred;
 
@@ -1807,6 +1817,7 @@ gen_outer (QO_ENV * env, QO_PLAN * plan, BITSET * subqueries, XASL_NODE * inner_
 	  break;
 
 	case QO_JOINMETHOD_MERGE_JOIN:
+	case QO_JOINMETHOD_HASH_JOIN:
 	  /*
 	   * The optimizer isn't supposed to produce plans in which a
 	   * merge join isn't "shielded" by a sort (temp file) plan,
@@ -4118,7 +4129,8 @@ qo_check_join_for_multi_range_opt (QO_PLAN * plan)
 
   /* verify that this is a valid join for multi range optimization */
   if (plan == NULL || plan->plan_type != QO_PLANTYPE_JOIN || plan->plan_un.join.join_type != JOIN_INNER
-      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN)
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_MERGE_JOIN
+      || plan->plan_un.join.join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       return false;
     }
@@ -4836,6 +4836,9 @@ qo_get_attr_info_func_index (QO_ENV * env, QO_SEGMENT * seg, const char *expr_st
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (QO_ATTR_INFO));
       return NULL;
     }
+  attr_infop->ndv = 0;
+  attr_infop->n_hist_bounds = 0;
+  attr_infop->hist_bounds = NULL;
 
   cum_statsp = &attr_infop->cum_stats;
   cum_statsp->type = pt_type_enum_to_db (QO_SEG_PT_NODE (seg)->type_enum);
@@ -5005,6 +5008,9 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (QO_ATTR_INFO));
       return NULL;
     }
+  attr_infop->ndv = 0;
+  attr_infop->n_hist_bounds = 0;
+  attr_infop->hist_bounds = NULL;
 
   /* initialize QO_ATTR_CUM_STATS structure of QO_ATTR_INFO */
   cum_statsp = &attr_infop->cum_stats;
@@ -5082,6 +5088,29 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
 	  cum_statsp->valid_limits = true;
 	}
 
+      /* the column statistics do not depend on indexes */
+      attr_infop->ndv = MAX (attr_infop->ndv, attr_statsp->ndv);
+      if (n == 1 && attr_statsp->n_hist_bounds > 0)
+	{
+	  attr_infop->hist_bounds = (DB_VALUE *) malloc (attr_statsp->n_hist_bounds * sizeof (DB_VALUE));
+	  if (attr_infop->hist_bounds == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		      attr_statsp->n_hist_bounds * sizeof (DB_VALUE));
+	      qo_free_attr_info (env, attr_infop);
+	      return NULL;
+	    }
+	  for (j = 0; j < attr_statsp->n_hist_bounds; j++)
+	    {
+	      if (pr_clone_value (&attr_statsp->hist_bounds[j], &attr_infop->hist_bounds[j]) != NO_ERROR)
+		{
+		  qo_free_attr_info (env, attr_infop);
+		  return NULL;
+		}
+	      attr_infop->n_hist_bounds++;
+	    }
+	}
+
       n_func_indexes = 0;
       n_unavail_indexes = 0;
       for (j = 0; j < attr_statsp->n_btstats; j++)
@@ -5219,6 +5248,7 @@ static void
 qo_free_attr_info (QO_ENV * env, QO_ATTR_INFO * info)
 {
   QO_ATTR_CUM_STATS *cum_statsp;
+  int i;
 
   if (info)
     {
@@ -5227,6 +5257,14 @@ qo_free_attr_info (QO_ENV * env, QO_ATTR_INFO * info)
 	{
 	  free_and_init (cum_statsp->pkeys);
 	}
+      if (info->hist_bounds)
+	{
+	  for (i = 0; i < info->n_hist_bounds; i++)
+	    {
+	      pr_clear_value (&info->hist_bounds[i]);
+	    }
+	  free_and_init (info->hist_bounds);
+	}
       free_and_init (info);
     }
 }
@@ -95,6 +95,13 @@ struct qo_attr_info
 {
   /* cumulative stats for all attributes under this umbrella */
   QO_ATTR_CUM_STATS cum_stats;
+
+  /* column statistics: the largest number of distinct values of the attributes; 0 if unknown */
+  int ndv;
+
+  /* equi-depth histogram bounds; only if the segment represents a single attribute */
+  int n_hist_bounds;
+  DB_VALUE *hist_bounds;
 };
 
 struct qo_index_entry
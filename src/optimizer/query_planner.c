@@ -142,6 +142,7 @@ static void qo_sscan_cost (QO_PLAN *);
 static void qo_iscan_cost (QO_PLAN *);
 static void qo_sort_cost (QO_PLAN *);
 static void qo_mjoin_cost (QO_PLAN *);
+static void qo_hjoin_cost (QO_PLAN *);
 static void qo_follow_cost (QO_PLAN *);
 static void qo_worst_cost (QO_PLAN *);
 static void qo_zero_cost (QO_PLAN *);
@@ -179,6 +180,7 @@ static int qo_examine_nl_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSE
 			       BITSET *, int);
 static int qo_examine_merge_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *, BITSET *,
 				  BITSET *);
+static int qo_examine_hash_join (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *);
 static int qo_examine_correlated_index (QO_INFO *, JOIN_TYPE, QO_INFO *, QO_INFO *, BITSET *, BITSET *, BITSET *);
 static int qo_examine_follow (QO_INFO *, QO_TERM *, QO_INFO *, BITSET *, BITSET *);
 static void qo_compute_projected_segs (QO_PLANNER *, BITSET *, BITSET *, BITSET *);
@@ -323,6 +325,17 @@ static QO_PLAN_VTBL qo_merge_join_plan_vtbl = {
   "Merge join"
 };
 
+static QO_PLAN_VTBL qo_hash_join_plan_vtbl = {
+  "h-join",
+  qo_join_fprint,
+  qo_join_walk,
+  qo_join_free,
+  qo_hjoin_cost,
+  qo_hjoin_cost,
+  qo_join_info,
+  "Hash join"
+};
+
 static QO_PLAN_VTBL qo_follow_plan_vtbl = {
   "follow",
   qo_follow_fprint,
@@ -363,6 +376,7 @@ QO_PLAN_VTBL *all_vtbls[] = {
   &qo_nl_join_plan_vtbl,
   &qo_idx_join_plan_vtbl,
   &qo_merge_join_plan_vtbl,
+  &qo_hash_join_plan_vtbl,
   &qo_follow_plan_vtbl,
   &qo_set_follow_plan_vtbl,
   &qo_worst_plan_vtbl
@@ -410,6 +424,20 @@ static PRED_CLASS qo_classify (PT_NODE * attr);
 
 static int qo_index_cardinality (QO_ENV * env, PT_NODE * attr);
 
+static QO_ATTR_INFO *qo_get_attr_info_of_name (QO_ENV * env, PT_NODE * attr);
+
+static DB_VALUE *qo_get_const_db_value (QO_ENV * env, PT_NODE * node);
+
+static double qo_attr_const_equal_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * const_node);
+
+static double qo_attr_equijoin_selectivity (QO_ENV * env, PT_NODE * lhs, PT_NODE * rhs);
+
+static double qo_hist_range_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * low, PT_NODE * high);
+
+static double qo_hist_fraction_below (QO_ATTR_INFO * info, DB_VALUE * value);
+
+static bool qo_hist_value_to_double (const DB_VALUE * value, double *result);
+
 /*
  * log3 () -
  *   return:
@@ -2719,6 +2747,26 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
 	}
 
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+
+      plan->vtbl = &qo_hash_join_plan_vtbl;
+
+      /* The build side is read into a hash table in arbitrary order, so the result has no useful order. Both sides
+       * are read from list files, just like for merge joins, but they don't have to be sorted.
+       */
+      plan->order = QO_UNORDERED;
+
+      if (outer->plan_type != QO_PLANTYPE_SORT)
+	{
+	  outer = qo_sort_new (outer, QO_UNORDERED, SORT_TEMP);
+	}
+      if (inner->plan_type != QO_PLANTYPE_SORT)
+	{
+	  inner = qo_sort_new (inner, QO_UNORDERED, SORT_TEMP);
+	}
+
+      break;
     }
 
   assert (inner != NULL && outer != NULL);
@@ -2817,7 +2865,7 @@ qo_join_new (QO_INFO * info, JOIN_TYPE join_type, QO_JOINMETHOD join_method, QO_
    * not storing them into a listfile. We could push the cost into the merge plan itself, I suppose, but a rational
    * implementation wouldn't impose this cost, and so I have hope that one day we'll be able to eliminate it.
    */
-  if (join_method == QO_JOINMETHOD_MERGE_JOIN)
+  if (join_method == QO_JOINMETHOD_MERGE_JOIN || join_method == QO_JOINMETHOD_HASH_JOIN)
     {
       plan = qo_sort_new (plan, plan->order, SORT_TEMP);
     }
@@ -3214,6 +3262,92 @@ qo_mjoin_cost (QO_PLAN * planp)
   planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
 }
 
+/*
+ * qo_hjoin_cost () -
+ *   return:
+ *   planp(in):
+ *
+ * Note: the smaller input is loaded into a hash table that is probed with every tuple of the other input. When the
+ *       build input does not fit in max_hash_join_size, both inputs are first partitioned into temporary list files,
+ *       which costs writing and reading them once more.
+ */
+static void
+qo_hjoin_cost (QO_PLAN * planp)
+{
+  QO_PLAN *inner;
+  QO_PLAN *outer;
+  QO_ENV *env;
+  double outer_cardinality = 0.0, inner_cardinality = 0.0;
+  double outer_pages, inner_pages, build_cardinality, build_size;
+
+  inner = planp->plan_un.join.inner;
+
+  /* for worst cost */
+  if (inner->fixed_cpu_cost == QO_INFINITY || inner->fixed_io_cost == QO_INFINITY
+      || inner->variable_cpu_cost == QO_INFINITY || inner->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  outer = planp->plan_un.join.outer;
+
+  /* for worst cost */
+  if (outer->fixed_cpu_cost == QO_INFINITY || outer->fixed_io_cost == QO_INFINITY
+      || outer->variable_cpu_cost == QO_INFINITY || outer->variable_io_cost == QO_INFINITY)
+    {
+      qo_worst_cost (planp);
+      return;
+    }
+
+  env = outer->info->env;
+  if (outer->has_sort_limit)
+    {
+      outer_cardinality = (double) db_get_bigint (&QO_ENV_LIMIT_VALUE (env));
+    }
+  else
+    {
+      outer_cardinality = outer->info->cardinality;
+    }
+
+  if (inner->has_sort_limit)
+    {
+      inner_cardinality = (double) db_get_bigint (&QO_ENV_LIMIT_VALUE (env));
+    }
+  else
+    {
+      inner_cardinality = inner->info->cardinality;
+    }
+
+  outer_pages = MAX (1.0, outer_cardinality * (double) (outer->info)->projected_size / (double) IO_PAGESIZE);
+  inner_pages = MAX (1.0, inner_cardinality * (double) (inner->info)->projected_size / (double) IO_PAGESIZE);
+
+  if (outer_pages < inner_pages)
+    {
+      build_cardinality = outer_cardinality;
+      build_size = outer_pages * (double) IO_PAGESIZE;
+    }
+  else
+    {
+      build_cardinality = inner_cardinality;
+      build_size = inner_pages * (double) IO_PAGESIZE;
+    }
+
+  /* CPU and IO costs which are fixed against join */
+  planp->fixed_cpu_cost = outer->fixed_cpu_cost + inner->fixed_cpu_cost;
+  planp->fixed_io_cost = outer->fixed_io_cost + inner->fixed_io_cost;
+  /* CPU and IO costs which are variable according to the join plan */
+  planp->variable_cpu_cost = outer->variable_cpu_cost + inner->variable_cpu_cost;
+  /* hash every tuple once and copy the build tuples into the hash table */
+  planp->variable_cpu_cost += (outer_cardinality + inner_cardinality + build_cardinality) * (double) QO_CPU_WEIGHT;
+  planp->variable_io_cost = outer->variable_io_cost + inner->variable_io_cost;
+  if (build_size > (double) prm_get_bigint_value (PRM_ID_MAX_HASH_JOIN_SIZE))
+    {
+      /* partitions are written and read back */
+      planp->variable_io_cost += 2 * (outer_pages + inner_pages);
+    }
+}
+
 /*
  * qo_follow_new () -
  *   return:
@@ -5954,6 +6088,79 @@ exit:
   return n;
 }
 
+/*
+ * qo_examine_hash_join () -
+ *   return:
+ *   info(in):
+ *   join_type(in):
+ *   outer(in):
+ *   inner(in):
+ *   sm_join_terms(in): equi-join terms
+ *   sarged_terms(in):
+ *   pinned_subqueries(in):
+ *
+ * Note: hash joins use the same equi-join terms as merge joins but do not need sorted inputs. Only inner joins are
+ *       considered.
+ */
+static int
+qo_examine_hash_join (QO_INFO * info, JOIN_TYPE join_type, QO_INFO * outer, QO_INFO * inner, BITSET * sm_join_terms,
+		      BITSET * sarged_terms, BITSET * pinned_subqueries)
+{
+  int n = 0;
+  QO_PLAN *outer_plan, *inner_plan;
+  QO_NODE *inner_node;
+  BITSET empty_terms;
+
+  bitset_init (&empty_terms, info->env);
+
+  if (join_type != JOIN_INNER)
+    {
+      goto exit;
+    }
+
+  /* fake terms need the nested-loop evaluation order; see qo_examine_merge_join () */
+  if (bitset_intersects (sarged_terms, &(info->env->fake_terms)))
+    {
+      goto exit;
+    }
+
+  /* At here, inner is single class spec */
+  inner_node = QO_ENV_NODE (inner->env, bitset_first_member (&(inner->nodes)));
+
+  if (QO_NODE_HINT (inner_node) & (PT_HINT_USE_NL | PT_HINT_USE_IDX | PT_HINT_USE_MERGE))
+    {
+      /* join hint: force nl-join, idx-join, m-join; */
+      goto exit;
+    }
+  else if (!prm_get_bool_value (PRM_ID_OPTIMIZER_ENABLE_HASH_JOIN))
+    {
+      /* optimizer prm: keep out h-join; */
+      goto exit;
+    }
+
+  outer_plan = qo_find_best_plan_on_info (outer, QO_UNORDERED, 1.0);
+  if (outer_plan == NULL)
+    {
+      goto exit;
+    }
+
+  inner_plan = qo_find_best_plan_on_info (inner, QO_UNORDERED, 1.0);
+  if (inner_plan == NULL)
+    {
+      goto exit;
+    }
+
+  n =
+    qo_check_plan_on_info (info,
+			   qo_join_new (info, join_type, QO_JOINMETHOD_HASH_JOIN, outer_plan, inner_plan,
+					sm_join_terms, &empty_terms, &empty_terms, sarged_terms, pinned_subqueries));
+
+exit:
+  bitset_delset (&empty_terms);
+
+  return n;
+}
+
 /*
  * qo_examine_correlated_index () -
  *   return: int
@@ -7076,6 +7283,14 @@ planner_visit_node (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
 				     &sarged_terms, &pinned_subqueries);
 	  }
 #endif /* MERGE_JOINS */
+
+	/* STEP 5-5: examine hash-join */
+	if (!bitset_is_empty (&sm_join_terms))
+	  {
+	    kept +=
+	      qo_examine_hash_join (new_info, join_type, head_info, tail_info, &sm_join_terms, &sarged_terms,
+				    &pinned_subqueries);
+	  }
       }
 
     /* At this point, kept indicates the number of worthwhile plans generated by examine_joins (i.e., plans that where
@@ -9185,7 +9400,6 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
   PT_NODE *lhs, *rhs;
   PRED_CLASS pc_lhs, pc_rhs;
-  int lhs_icard, rhs_icard, icard;
   double selectivity;
 
   lhs = pt_expr->info.expr.arg1;
@@ -9206,20 +9420,7 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	case PC_ATTR:
 	  /* attr = attr */
 
-	  /* check for indexes on either of the attributes */
-	  lhs_icard = qo_index_cardinality (env, lhs);
-	  rhs_icard = qo_index_cardinality (env, rhs);
-
-	  icard = MAX (lhs_icard, rhs_icard);
-	  if (icard != 0)
-	    {
-	      selectivity = (1.0 / icard);
-	    }
-	  else
-	    {
-	      selectivity = DEFAULT_EQUIJOIN_SELECTIVITY;
-	    }
-
+	  selectivity = qo_attr_equijoin_selectivity (env, lhs, rhs);
 	  break;
 
 	case PC_CONST:
@@ -9229,17 +9430,8 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	case PC_OTHER:
 	  /* attr = const */
 
-	  /* check for index on the attribute.  NOTE: For an equality predicate, we treat subqueries as constants. */
-	  lhs_icard = qo_index_cardinality (env, lhs);
-	  if (lhs_icard != 0)
-	    {
-	      selectivity = (1.0 / lhs_icard);
-	    }
-	  else
-	    {
-	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
-	    }
-
+	  /* NOTE: For an equality predicate, we treat subqueries as constants. */
+	  selectivity = qo_attr_const_equal_selectivity (env, lhs, rhs);
 	  break;
 	}
 
@@ -9256,17 +9448,8 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	case PC_ATTR:
 	  /* const = attr */
 
-	  /* check for index on the attribute.  NOTE: For an equality predicate, we treat subqueries as constants. */
-	  rhs_icard = qo_index_cardinality (env, rhs);
-	  if (rhs_icard != 0)
-	    {
-	      selectivity = (1.0 / rhs_icard);
-	    }
-	  else
-	    {
-	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
-	    }
-
+	  /* NOTE: For an equality predicate, we treat subqueries as constants. */
+	  selectivity = qo_attr_const_equal_selectivity (env, rhs, lhs);
 	  break;
 
 	case PC_CONST:
@@ -9292,12 +9475,51 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
  *   env(in): Pointer to an environment structure
  *   pt_expr(in): comparison expression
  *
- * Note: This uses the System R algorithm
+ * Note: An attribute compared with a constant is estimated from the histogram of the attribute, if any.
  */
 static double
 qo_comp_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
-  return DEFAULT_COMP_SELECTIVITY;
+  PT_NODE *attr, *const_node;
+  PRED_CLASS pc1, pc2;
+  PT_OP_TYPE op_type;
+  double selectivity;
+
+  op_type = pt_expr->info.expr.op;
+  pc1 = qo_classify (pt_expr->info.expr.arg1);
+  pc2 = qo_classify (pt_expr->info.expr.arg2);
+  if (pc1 == PC_ATTR && (pc2 == PC_CONST || pc2 == PC_HOST_VAR))
+    {
+      attr = pt_expr->info.expr.arg1;
+      const_node = pt_expr->info.expr.arg2;
+    }
+  else if (pc2 == PC_ATTR && (pc1 == PC_CONST || pc1 == PC_HOST_VAR))
+    {
+      /* const op attr: same as attr converse_op const */
+      attr = pt_expr->info.expr.arg2;
+      const_node = pt_expr->info.expr.arg1;
+      op_type = pt_converse_op (op_type);
+    }
+  else
+    {
+      return DEFAULT_COMP_SELECTIVITY;
+    }
+
+  if (op_type == PT_LT || op_type == PT_LE)
+    {
+      selectivity = qo_hist_range_selectivity (env, attr, NULL, const_node);
+    }
+  else
+    {
+      selectivity = qo_hist_range_selectivity (env, attr, const_node, NULL);
+    }
+
+  if (selectivity < 0)
+    {
+      return DEFAULT_COMP_SELECTIVITY;
+    }
+
+  return selectivity;
 }
 
 /*
@@ -9306,19 +9528,32 @@ qo_comp_selectivity (QO_ENV * env, PT_NODE * pt_expr)
  *   env(in): Pointer to an environment structure
  *   pt_expr(in): between expression
  *
- * Note: This uses the System R algorithm
+ * Note: An attribute between two constants is estimated from the histogram of the attribute, if any.
  */
 static double
 qo_between_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 {
   PT_NODE *and_node;
+  double selectivity;
 
   and_node = pt_expr->info.expr.arg2;
 
   QO_ASSERT (env, and_node->node_type == PT_EXPR);
   QO_ASSERT (env, pt_is_between_range_op (and_node->info.expr.op));
 
-  return DEFAULT_BETWEEN_SELECTIVITY;
+  if (qo_classify (pt_expr->info.expr.arg1) != PC_ATTR)
+    {
+      return DEFAULT_BETWEEN_SELECTIVITY;
+    }
+
+  selectivity = qo_hist_range_selectivity (env, pt_expr->info.expr.arg1, and_node->info.expr.arg1,
+					   and_node->info.expr.arg2);
+  if (selectivity < 0)
+    {
+      return DEFAULT_BETWEEN_SELECTIVITY;
+    }
+
+  return selectivity;
 }
 
 /*
@@ -9333,7 +9568,6 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
   PT_NODE *lhs, *arg1, *arg2;
   PRED_CLASS pc1;
   double total_selectivity, selectivity;
-  int lhs_icard, rhs_icard, icard;
   PT_NODE *range_node;
   PT_OP_TYPE op_type;
 
@@ -9349,9 +9583,6 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
   QO_ASSERT (env, !PT_EXPR_INFO_IS_FLAGED (pt_expr, PT_EXPR_INFO_FULL_RANGE));
 #endif
 
-  /* get index cardinality */
-  lhs_icard = qo_index_cardinality (env, lhs);
-
   total_selectivity = 0.0;
 
   for (range_node = pt_expr->info.expr.arg2; range_node; range_node = range_node->or_next)
@@ -9369,7 +9600,11 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
       if (op_type == PT_BETWEEN_GE_LE || op_type == PT_BETWEEN_GE_LT || op_type == PT_BETWEEN_GT_LE
 	  || op_type == PT_BETWEEN_GT_LT)
 	{
-	  selectivity = DEFAULT_BETWEEN_SELECTIVITY;
+	  selectivity = qo_hist_range_selectivity (env, lhs, arg1, arg2);
+	  if (selectivity < 0)
+	    {
+	      selectivity = DEFAULT_BETWEEN_SELECTIVITY;
+	    }
 	}
       else if (op_type == PT_BETWEEN_EQ_NA)
 	{
@@ -9380,36 +9615,30 @@ qo_range_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	  if (pc1 == PC_ATTR)
 	    {
 	      /* attr1 range (attr2 = ) */
-	      rhs_icard = qo_index_cardinality (env, arg1);
-
-	      icard = MAX (lhs_icard, rhs_icard);
-	      if (icard != 0)
-		{
-		  selectivity = (1.0 / icard);
-		}
-	      else
-		{
-		  selectivity = DEFAULT_EQUIJOIN_SELECTIVITY;
-		}
+	      selectivity = qo_attr_equijoin_selectivity (env, lhs, arg1);
 	    }
 	  else
 	    {
 	      /* attr1 range (const = ) */
-	      if (lhs_icard != 0)
-		{
-		  selectivity = (1.0 / lhs_icard);
-		}
-	      else
-		{
-		  selectivity = DEFAULT_EQUAL_SELECTIVITY;
-		}
+	      selectivity = qo_attr_const_equal_selectivity (env, lhs, arg1);
 	    }
 	}
       else
 	{
 	  /* PT_BETWEEN_INF_LE, PT_BETWEEN_INF_LT, PT_BETWEEN_GE_INF, and PT_BETWEEN_GT_INF have only one argument */
 
-	  selectivity = DEFAULT_COMP_SELECTIVITY;
+	  if (op_type == PT_BETWEEN_INF_LE || op_type == PT_BETWEEN_INF_LT)
+	    {
+	      selectivity = qo_hist_range_selectivity (env, lhs, NULL, arg1);
+	    }
+	  else
+	    {
+	      selectivity = qo_hist_range_selectivity (env, lhs, arg1, NULL);
+	    }
+	  if (selectivity < 0)
+	    {
+	      selectivity = DEFAULT_COMP_SELECTIVITY;
+	    }
 	}
 
       selectivity = MAX (selectivity, 0.0);
@@ -9533,11 +9762,40 @@ qo_classify (PT_NODE * attr)
  */
 static int
 qo_index_cardinality (QO_ENV * env, PT_NODE * attr)
+{
+  QO_ATTR_INFO *info;
+
+  info = qo_get_attr_info_of_name (env, attr);
+  if (info == NULL)
+    {
+      return 0;
+    }
+
+  if (info->cum_stats.is_indexed != true)
+    {
+      return 0;
+    }
+
+  QO_ASSERT (env, info->cum_stats.pkeys_size > 0);
+  QO_ASSERT (env, info->cum_stats.pkeys_size <= BTREE_STATS_PKEYS_NUM);
+  QO_ASSERT (env, info->cum_stats.pkeys != NULL);
+
+  /* return number of the first partial-key of the index on the attribute shown in the expression */
+  return info->cum_stats.pkeys[0];
+}
+
+/*
+ * qo_get_attr_info_of_name () - Find the statistics of the segment of an attribute
+ *   return: attribute info of the segment, NULL if not found
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ */
+static QO_ATTR_INFO *
+qo_get_attr_info_of_name (QO_ENV * env, PT_NODE * attr)
 {
   PT_NODE *dummy;
   QO_NODE *nodep;
   QO_SEGMENT *segp;
-  QO_ATTR_INFO *info;
 
   if (attr->node_type == PT_DOT_)
     {
@@ -9549,37 +9807,351 @@ qo_index_cardinality (QO_ENV * env, PT_NODE * attr)
   nodep = lookup_node (attr, env, &dummy);
   if (nodep == NULL)
     {
-      return 0;
+      return NULL;
     }
 
   segp = lookup_seg (nodep, attr, env);
   if (segp == NULL)
     {
-      return 0;
+      return NULL;
     }
 
   if (attr->info.name.meta_class == PT_RESERVED)
     {
-      return 0;
+      return NULL;
     }
 
-  info = QO_SEG_INFO (segp);
-  if (info == NULL)
+  return QO_SEG_INFO (segp);
+}
+
+/*
+ * qo_get_const_db_value () - Get the value of a constant known at optimization time
+ *   return: value, NULL if the constant is not known or is null
+ *   env(in): optimizer environment
+ *   node(in): pt node of the constant
+ *
+ * Note: Literals of the predicates are usually auto-parameterized by qo_do_auto_parameterize before the plan is
+ *       generated, their values are read from the host variables of the parser. The XASL cache entry is looked up
+ *       by the auto-parameterized text, so the plan built for these values is reused for the same query with other
+ *       literals until the entry is recompiled, e.g. when the number of pages of a class goes past the threshold
+ *       checked by xcache_check_recompilation_threshold. Host variables given by the user are not bound when the
+ *       query is prepared, they keep the default selectivities.
+ */
+static DB_VALUE *
+qo_get_const_db_value (QO_ENV * env, PT_NODE * node)
+{
+  PARSER_CONTEXT *parser = QO_ENV_PARSER (env);
+  DB_VALUE *value;
+
+  if (node == NULL)
     {
-      return 0;
+      return NULL;
     }
 
-  if (info->cum_stats.is_indexed != true)
+  if (node->node_type == PT_VALUE)
     {
-      return 0;
+      value = pt_value_to_db (parser, node);
+    }
+  else if (node->node_type == PT_HOST_VAR && node->info.host_var.index >= parser->host_var_count)
+    {
+      /* auto-parameterized literal */
+      value = pt_host_var_db_value (parser, node);
+    }
+  else
+    {
+      return NULL;
     }
 
-  QO_ASSERT (env, info->cum_stats.pkeys_size > 0);
-  QO_ASSERT (env, info->cum_stats.pkeys_size <= BTREE_STATS_PKEYS_NUM);
-  QO_ASSERT (env, info->cum_stats.pkeys != NULL);
+  if (value == NULL || DB_IS_NULL (value))
+    {
+      return NULL;
+    }
 
-  /* return number of the first partial-key of the index on the attribute shown in the expression */
-  return info->cum_stats.pkeys[0];
+  return value;
+}
+
+/*
+ * qo_attr_const_equal_selectivity () - Compute the selectivity of attr = const
+ *   return: double
+ *   env(in): optimizer environment
+ *   attr(in): attribute
+ *   const_node(in): constant, host variable or subquery
+ *
+ * Note: A value found in more than one bound of the equi-depth histogram is a frequent value, it is selected by
+ *       the buckets it spans. Otherwise, the values are assumed to be uniformly distributed among the distinct
+ *       keys of the index or, if there is no index, the distinct values of the attribute.
+ */
+static double
+qo_attr_const_equal_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * const_node)
+{
+  QO_ATTR_INFO *info;
+  DB_VALUE *value;
+  int icard, n_equal, i;
+
+  info = qo_get_attr_info_of_name (env, attr);
+
+  value = qo_get_const_db_value (env, const_node);
+  if (info != NULL && info->n_hist_bounds > 1 && value != NULL)
+    {
+      n_equal = 0;
+      for (i = 0; i < info->n_hist_bounds; i++)
+	{
+	  if (tp_value_compare (&info->hist_bounds[i], value, 1, 0) == DB_EQ)
+	    {
+	      n_equal++;
+	    }
+	}
+
+      if (n_equal > 1)
+	{
+	  return (double) (n_equal - 1) / (info->n_hist_bounds - 1);
+	}
+    }
+
+  icard = qo_index_cardinality (env, attr);
+  if (icard != 0)
+    {
+      return 1.0 / icard;
+    }
+
+  if (info != NULL && info->ndv > 0)
+    {
+      return 1.0 / info->ndv;
+    }
+
+  return DEFAULT_EQUAL_SELECTIVITY;
+}
+
+/*
+ * qo_attr_equijoin_selectivity () - Compute the selectivity of attr = attr
+ *   return: double
+ *   env(in): optimizer environment
+ *   lhs(in): attribute
+ *   rhs(in): attribute
+ */
+static double
+qo_attr_equijoin_selectivity (QO_ENV * env, PT_NODE * lhs, PT_NODE * rhs)
+{
+  QO_ATTR_INFO *lhs_info, *rhs_info;
+  int lhs_icard, rhs_icard, icard;
+  int ndv;
+
+  /* check for indexes on either of the attributes */
+  lhs_icard = qo_index_cardinality (env, lhs);
+  rhs_icard = qo_index_cardinality (env, rhs);
+
+  icard = MAX (lhs_icard, rhs_icard);
+  if (icard != 0)
+    {
+      return 1.0 / icard;
+    }
+
+  /* each value of the attribute with less distinct values is assumed to be found in the other */
+  lhs_info = qo_get_attr_info_of_name (env, lhs);
+  rhs_info = qo_get_attr_info_of_name (env, rhs);
+
+  ndv = MAX (lhs_info ? lhs_info->ndv : 0, rhs_info ? rhs_info->ndv : 0);
+  if (ndv > 0)
+    {
+      return 1.0 / ndv;
+    }
+
+  return DEFAULT_EQUIJOIN_SELECTIVITY;
+}
+
+/*
+ * qo_hist_range_selectivity () - Compute the selectivity of a range of an attribute from its histogram
+ *   return: selectivity, or -1 if it cannot be estimated
+ *   env(in): optimizer environment
+ *   attr(in): attribute
+ *   low(in): lower bound of the range; NULL if unbounded
+ *   high(in): upper bound of the range; NULL if unbounded
+ *
+ * Note: Whether the bounds are included or not is not considered.
+ */
+static double
+qo_hist_range_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * low, PT_NODE * high)
+{
+  QO_ATTR_INFO *info;
+  DB_VALUE *value;
+  double low_fraction = 0.0, high_fraction = 1.0;
+  double selectivity, min_selectivity;
+
+  info = qo_get_attr_info_of_name (env, attr);
+  if (info == NULL || info->n_hist_bounds < 2)
+    {
+      return -1.0;
+    }
+
+  if (low != NULL)
+    {
+      value = qo_get_const_db_value (env, low);
+      if (value == NULL)
+	{
+	  return -1.0;
+	}
+      low_fraction = qo_hist_fraction_below (info, value);
+      if (low_fraction < 0)
+	{
+	  return -1.0;
+	}
+    }
+
+  if (high != NULL)
+    {
+      value = qo_get_const_db_value (env, high);
+      if (value == NULL)
+	{
+	  return -1.0;
+	}
+      high_fraction = qo_hist_fraction_below (info, value);
+      if (high_fraction < 0)
+	{
+	  return -1.0;
+	}
+    }
+
+  selectivity = high_fraction - low_fraction;
+
+  /* a range ending at a bound still selects the values equal to it */
+  min_selectivity = (info->ndv > 0) ? 1.0 / info->ndv : DEFAULT_EQUAL_SELECTIVITY;
+  selectivity = MAX (selectivity, min_selectivity);
+  selectivity = MIN (selectivity, 1.0);
+
+  return selectivity;
+}
+
+/*
+ * qo_hist_fraction_below () - Estimate the fraction of the values of an attribute that are lower than a value
+ *   return: fraction, or -1 if the value cannot be compared with the histogram bounds
+ *   info(in): attribute info with a histogram
+ *   value(in): value
+ *
+ * Note: The values are assumed to be uniformly distributed inside a bucket. The position inside the bucket is
+ *       interpolated for numeric and date/time values and is the middle of the bucket otherwise.
+ */
+static double
+qo_hist_fraction_below (QO_ATTR_INFO * info, DB_VALUE * value)
+{
+  DB_VALUE *bounds = info->hist_bounds;
+  int n_buckets = info->n_hist_bounds - 1;
+  DB_VALUE_COMPARE_RESULT cmp;
+  double low_bound, high_bound, v, fraction;
+  int low, high, mid;
+
+  assert (n_buckets > 0);
+
+  cmp = tp_value_compare (value, &bounds[0], 1, 0);
+  if (cmp == DB_UNK)
+    {
+      return -1.0;
+    }
+  if (cmp != DB_GT)
+    {
+      return 0.0;
+    }
+
+  cmp = tp_value_compare (value, &bounds[n_buckets], 1, 0);
+  if (cmp == DB_UNK)
+    {
+      return -1.0;
+    }
+  if (cmp != DB_LT)
+    {
+      return 1.0;
+    }
+
+  /* find the bucket: bounds[low] < value <= bounds[high] */
+  low = 0;
+  high = n_buckets;
+  while (high - low > 1)
+    {
+      mid = (low + high) / 2;
+      cmp = tp_value_compare (&bounds[mid], value, 1, 0);
+      if (cmp == DB_UNK)
+	{
+	  return -1.0;
+	}
+      if (cmp == DB_LT)
+	{
+	  low = mid;
+	}
+      else
+	{
+	  high = mid;
+	}
+    }
+
+  fraction = 0.5;
+  if (qo_hist_value_to_double (&bounds[low], &low_bound) && qo_hist_value_to_double (&bounds[high], &high_bound)
+      && qo_hist_value_to_double (value, &v) && high_bound > low_bound)
+    {
+      fraction = (v - low_bound) / (high_bound - low_bound);
+      fraction = MAX (fraction, 0.0);
+      fraction = MIN (fraction, 1.0);
+    }
+
+  return (low + fraction) / n_buckets;
+}
+
+/*
+ * qo_hist_value_to_double () - Map a value on the real line to interpolate inside a histogram bucket
+ *   return: true if the value type can be interpolated
+ *   value(in): value
+ *   result(out): position of the value
+ */
+static bool
+qo_hist_value_to_double (const DB_VALUE * value, double *result)
+{
+  switch (DB_VALUE_TYPE (value))
+    {
+    case DB_TYPE_SHORT:
+      *result = db_get_short (value);
+      return true;
+
+    case DB_TYPE_INTEGER:
+      *result = db_get_int (value);
+      return true;
+
+    case DB_TYPE_BIGINT:
+      *result = (double) db_get_bigint (value);
+      return true;
+
+    case DB_TYPE_FLOAT:
+      *result = db_get_float (value);
+      return true;
+
+    case DB_TYPE_DOUBLE:
+      *result = db_get_double (value);
+      return true;
+
+    case DB_TYPE_MONETARY:
+      *result = db_get_monetary (value)->amount;
+      return true;
+
+    case DB_TYPE_NUMERIC:
+      numeric_coerce_num_to_double (db_locate_numeric (value), db_value_scale (value), result);
+      return true;
+
+    case DB_TYPE_DATE:
+      *result = *db_get_date (value);
+      return true;
+
+    case DB_TYPE_TIME:
+      *result = *db_get_time (value);
+      return true;
+
+    case DB_TYPE_TIMESTAMP:
+      *result = *db_get_timestamp (value);
+      return true;
+
+    case DB_TYPE_DATETIME:
+      *result = db_get_datetime (value)->date * 86400000.0 + db_get_datetime (value)->time;
+      return true;
+
+    default:
+      return false;
+    }
 }
 
 /*
@@ -10498,7 +11070,7 @@ qo_plan_compute_iscan_sort_list (QO_PLAN * root, PT_NODE * group_by, bool * is_i
 	    }
 	  else
 	    {
-	      /* QO_JOINMETHOD_MERGE_JOIN */
+	      /* QO_JOINMETHOD_MERGE_JOIN, QO_JOINMETHOD_HASH_JOIN */
 	      plan = NULL;
 	    }
 	  break;
@@ -11042,6 +11614,10 @@ qo_plan_join_print_json (QO_PLAN * plan)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
@@ -11353,6 +11929,10 @@ qo_plan_join_print_text (FILE * fp, QO_PLAN * plan, int indent)
     case QO_JOINMETHOD_MERGE_JOIN:
       method = "MERGE JOIN";
       break;
+
+    case QO_JOINMETHOD_HASH_JOIN:
+      method = "HASH JOIN";
+      break;
     }
 
   switch (plan->plan_un.join.join_type)
@@ -65,7 +65,8 @@ typedef enum
 {
   QO_JOINMETHOD_NL_JOIN,
   QO_JOINMETHOD_IDX_JOIN,
-  QO_JOINMETHOD_MERGE_JOIN
+  QO_JOINMETHOD_MERGE_JOIN,
+  QO_JOINMETHOD_HASH_JOIN
 } QO_JOINMETHOD;
 
 typedef struct qo_plan_vtbl QO_PLAN_VTBL;
@@ -178,7 +179,7 @@ struct qo_plan
     struct
     {
       JOIN_TYPE join_type;	/* JOIN_INNER, _LEFT, _RIGHT, _OUTER */
-      QO_JOINMETHOD join_method;	/* NL_JOIN, MERGE_JOIN */
+      QO_JOINMETHOD join_method;	/* NL_JOIN, MERGE_JOIN, HASH_JOIN */
       QO_PLAN *outer;
       QO_PLAN *inner;
       BITSET join_terms;	/* all join edges */
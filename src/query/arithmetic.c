@@ -5578,6 +5578,70 @@ db_evaluate_json_extract (DB_VALUE * result, DB_VALUE * const *args, int num_arg
   return NO_ERROR;
 }
 
+/*
+ * db_evaluate_json_extract_serialized () - extract the value at path from a serialized json without deserializing
+ *                                          the whole document
+ *
+ * return            : error code
+ * result (out)      : extracted value or null if path does not exist
+ * source (in)       : buffer of the serialized json, e.g. the disk value of a record
+ * path_value (in)   : path
+ * is_evaluated (out): false if path contains wildcards; the caller has to use db_evaluate_json_extract
+ */
+int
+db_evaluate_json_extract_serialized (DB_VALUE * result, OR_BUF * source, const DB_VALUE * path_value,
+				     bool * is_evaluated)
+{
+  std::string raw_path;
+  JSON_DOC *doc = NULL;
+  int error_code = NO_ERROR;
+
+  db_make_null (result);
+  *is_evaluated = false;
+
+  if (DB_IS_NULL (path_value))
+    {
+      *is_evaluated = true;
+      return NO_ERROR;
+    }
+
+  error_code = db_value_to_json_path (*path_value, F_JSON_EXTRACT, raw_path);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  if (db_json_path_contains_wildcard (raw_path.c_str ()))
+    {
+      // result is an array of all matches
+      return NO_ERROR;
+    }
+
+  error_code = db_json_deserialize_path (source, raw_path.c_str (), doc);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  *is_evaluated = true;
+
+  if (doc == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  if (db_json_get_type (doc) == DB_JSON_NULL)
+    {
+      db_json_delete_doc (doc);
+      return NO_ERROR;
+    }
+
+  db_make_json (result, doc, true);
+  return NO_ERROR;
+}
+
 int
 db_evaluate_json_object (DB_VALUE * result, DB_VALUE * const *arg, int const num_args)
 {
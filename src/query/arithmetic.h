@@ -32,6 +32,9 @@
 #include <vector>
 #include <string>
 
+// forward definitions
+struct or_buf;
+
 #define PI ((double) (3.14159265358979323846264338))
 
 extern int db_floor_dbval (DB_VALUE * result, DB_VALUE * value);
@@ -79,6 +82,8 @@ extern int db_evaluate_json_contains (DB_VALUE * result, DB_VALUE * const *arg,
 extern int db_evaluate_json_contains_path (DB_VALUE * result, DB_VALUE * const *arg, const int num_args);
 extern int db_evaluate_json_depth (DB_VALUE * result, DB_VALUE * const *args, int num_args);
 extern int db_evaluate_json_extract (DB_VALUE * result, DB_VALUE * const *args, int num_args);
+extern int db_evaluate_json_extract_serialized (DB_VALUE * result, struct or_buf *source, const DB_VALUE * path_value,
+						bool * is_evaluated);
 extern int db_evaluate_json_get_all_paths (DB_VALUE * result, DB_VALUE * const *arg, int const num_args);
 extern int db_evaluate_json_insert (DB_VALUE * result, DB_VALUE * const *arg, const int num_args);
 extern int db_evaluate_json_keys (DB_VALUE * result, DB_VALUE * const *arg, const int num_args);
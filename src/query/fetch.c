@@ -3796,6 +3796,11 @@ fetch_peek_dbval (THREAD_ENTRY * thread_p, REGU_VARIABLE * regu_var, val_descr *
 	      goto exit_on_error;
 	    }
 	}
+      if (regu_var->value.attr_descr.cache_attrinfo->defer_json && DB_VALUE_DOMAIN_TYPE (*peek_dbval) == DB_TYPE_JSON)
+	{
+	  /* deferred values are read by heap_attrinfo_access; do not cache the pointer */
+	  break;
+	}
       regu_var->value.attr_descr.cache_dbvalp = *peek_dbval;	/* cache */
       break;
 
@@ -32,7 +32,8 @@ typedef enum
   HEAP_READ_ATTRVALUE,
   HEAP_WRITTEN_ATTRVALUE,
   HEAP_UNINIT_ATTRVALUE,
-  HEAP_WRITTEN_LOB_ATTRVALUE
+  HEAP_WRITTEN_LOB_ATTRVALUE,
+  HEAP_DEFERRED_ATTRVALUE	/* located in the record, dbvalue is read when accessed */
 } HEAP_ATTRVALUE_STATE;
 
 typedef enum
@@ -53,6 +54,8 @@ struct heap_attrvalue
   OR_ATTRIBUTE *last_attrepr;	/* Used for default values */
   OR_ATTRIBUTE *read_attrepr;	/* Pointer to a desired attribute information */
   DB_VALUE dbvalue;		/* DB values of the attribute in memory */
+  char *deferred_data;		/* disk value in the record if state is HEAP_DEFERRED_ATTRVALUE */
+  int deferred_length;		/* length of the deferred disk value */
 };
 
 typedef struct heap_cache_attrinfo HEAP_CACHE_ATTRINFO;
@@ -69,6 +72,7 @@ struct heap_cache_attrinfo
   int inst_chn;			/* Current chn of instance object */
   int num_values;		/* Number of desired attribute values */
   HEAP_ATTRVALUE *values;	/* Value for the attributes */
+  bool defer_json;		/* JSON values are only located when the instance is read, see heap_attrinfo_access */
 };
 
 #else /* !defined (SERVER_MODE) && !defined (SA_MODE) */
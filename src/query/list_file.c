@@ -4240,6 +4240,8 @@ qfile_scan_next (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * scan_id_p)
 	    {
 	      return S_ERROR;
 	    }
+	  /* list file pages are allocated in file order; have the next ones read ahead */
+	  pgbuf_read_ahead (thread_p, &next_vpid);
 
 	  qmgr_free_old_page_and_init (thread_p, scan_id_p->curr_pgptr, scan_id_p->list_id.tfile_vfid);
 	  QFILE_COPY_VPID (&scan_id_p->curr_vpid, &next_vpid);
@@ -237,7 +237,8 @@ qdump_print_list_merge_info (QFILE_LIST_MERGE_INFO * merge_info_p)
     }
 
   fprintf (foutput, "[join type:%d]", merge_info_p->join_type);
-  fprintf (foutput, "[single fetch:%d]\n", merge_info_p->single_fetch);
+  fprintf (foutput, "[single fetch:%d]", merge_info_p->single_fetch);
+  fprintf (foutput, "[hash join:%d]\n", merge_info_p->hash_join);
 
   qdump_print_column ("outer column position", merge_info_p->ls_column_cnt, merge_info_p->ls_outer_column);
   qdump_print_column ("outer column is unique", merge_info_p->ls_column_cnt, merge_info_p->ls_outer_unique);
@@ -364,6 +364,45 @@ struct upddel_class_info_internal
   UPDATE_MVCC_REEV_ASSIGNMENT *mvcc_reev_assigns;
 };
 
+/* hash join: both lists are split in this many partitions when the build list does not fit in max_hash_join_size */
+#define QEXEC_HASH_JOIN_PARTITION_BITS 5
+#define QEXEC_HASH_JOIN_PARTITION_CNT (1 << QEXEC_HASH_JOIN_PARTITION_BITS)
+/* partitions are split again at most this many times; deeper partitions are joined in memory regardless of the limit
+ * (they are made of duplicate keys that cannot be split) */
+#define QEXEC_HASH_JOIN_MAX_DEPTH 4
+#define QEXEC_HASH_JOIN_BLOCK_SIZE (64 * 1024)
+
+/* copy of a build tuple in the hash join table */
+typedef struct qexec_hash_join_entry QEXEC_HASH_JOIN_ENTRY;
+struct qexec_hash_join_entry
+{
+  QEXEC_HASH_JOIN_ENTRY *next;	/* next entry in the same bucket */
+  unsigned int hash_key;	/* hash of the join columns */
+  QFILE_TUPLE tpl;		/* tuple copy, follows the entry */
+};
+
+/* memory block holding hash join entries */
+typedef struct qexec_hash_join_block QEXEC_HASH_JOIN_BLOCK;
+struct qexec_hash_join_block
+{
+  QEXEC_HASH_JOIN_BLOCK *next;
+  size_t size;
+  size_t used;
+};
+
+typedef struct qexec_hash_join_context QEXEC_HASH_JOIN_CONTEXT;
+struct qexec_hash_join_context
+{
+  QFILE_LIST_MERGE_INFO *merge_info;
+  QFILE_LIST_ID *list_id;	/* result list file */
+  QFILE_TUPLE_RECORD tplrec;	/* result tuple */
+  TP_DOMAIN **outer_domp;	/* outer join column domains */
+  TP_DOMAIN **inner_domp;	/* inner join column domains */
+  char **outer_valp;		/* outer join column values */
+  char **inner_valp;		/* inner join column values */
+  UINT64 mem_limit;		/* memory limit of the build table */
+};
+
 enum analytic_stage
 {
   ANALYTIC_INTERM_PROC = 1,
@@ -501,6 +540,23 @@ static QFILE_LIST_ID *qexec_merge_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID *
 static QFILE_LIST_ID *qexec_merge_list_outer (THREAD_ENTRY * thread_p, SCAN_ID * outer_sid, SCAN_ID * inner_sid,
 					      QFILE_LIST_MERGE_INFO * merge_infop, PRED_EXPR * other_outer_join_pred,
 					      XASL_STATE * xasl_state, int ls_flag);
+static bool qexec_hash_join_is_hashable (TP_DOMAIN * outer_dom, TP_DOMAIN * inner_dom);
+static int qexec_hash_join_hash_key (QFILE_TUPLE tpl, int *indp, TP_DOMAIN ** domp, char **valp, int nvals,
+				     unsigned int *hash_key, bool * has_null);
+static QEXEC_HASH_JOIN_ENTRY *qexec_hash_join_alloc_entry (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_BLOCK ** blocks,
+							   int tpl_len);
+static int qexec_hash_join_build_probe (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_CONTEXT * ctx,
+					QFILE_LIST_ID * build_list_idp, QFILE_LIST_ID * probe_list_idp,
+					bool build_is_outer);
+static int qexec_hash_join_partition (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_idp, int *indp, TP_DOMAIN ** domp,
+				      char **valp, int nvals, int depth, QFILE_LIST_ID ** parts);
+static int qexec_hash_join_lists (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_CONTEXT * ctx,
+				  QFILE_LIST_ID * outer_list_idp, QFILE_LIST_ID * inner_list_idp, int depth);
+static int qexec_hash_join_sort_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_idp, int *indp,
+				      TP_DOMAIN ** domp, int nvals);
+static QFILE_LIST_ID *qexec_hash_join_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp,
+					    QFILE_LIST_ID * inner_list_idp, QFILE_LIST_MERGE_INFO * merge_infop,
+					    int ls_flag);
 static int qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_state);
 static int qexec_open_scan (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * curr_spec, VAL_LIST * val_list, VAL_DESCR * vd,
 			    bool force_select_lock, int fixed, int grouped, bool iscan_oid_order, SCAN_ID * s_id,
@@ -6286,6 +6342,695 @@ exit_on_error:
   goto exit_on_end;
 }
 
+/*
+ * qexec_hash_join_is_hashable () - can the join column be hashed?
+ *   return: true if equal values of the two domains always have equal hash keys
+ *   outer_dom(in) : outer join column domain
+ *   inner_dom(in) : inner join column domain
+ *
+ * Note: merge joins compare values with coercion; a hash join is only possible when both sides have the same type (and
+ *       scale or collation), because the hash of a value depends on its representation.
+ */
+static bool
+qexec_hash_join_is_hashable (TP_DOMAIN * outer_dom, TP_DOMAIN * inner_dom)
+{
+  if (outer_dom == NULL || inner_dom == NULL || TP_DOMAIN_TYPE (outer_dom) != TP_DOMAIN_TYPE (inner_dom))
+    {
+      return false;
+    }
+
+  switch (TP_DOMAIN_TYPE (outer_dom))
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SMALLINT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_TIMESTAMPLTZ:
+    case DB_TYPE_TIMESTAMPTZ:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_DATETIMELTZ:
+    case DB_TYPE_DATETIMETZ:
+    case DB_TYPE_OID:
+      return true;
+
+    case DB_TYPE_NUMERIC:
+      /* the hash is computed on the unscaled value */
+      return outer_dom->scale == inner_dom->scale;
+
+    case DB_TYPE_BIT:
+    case DB_TYPE_VARBIT:
+      return true;
+
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARNCHAR:
+      return TP_DOMAIN_COLLATION (outer_dom) == TP_DOMAIN_COLLATION (inner_dom);
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * qexec_hash_join_hash_key () - hash the join columns of a tuple
+ *   return: NO_ERROR, or ER_code
+ *   tpl(in)       : list file tuple
+ *   indp(in)      : join column positions
+ *   domp(in)      : join column domains
+ *   valp(in)      : join column value pointers, set by this function
+ *   nvals(in)     : join column count
+ *   hash_key(out) : hash key
+ *   has_null(out) : true if a join column is NULL; such a tuple never joins
+ */
+static int
+qexec_hash_join_hash_key (QFILE_TUPLE tpl, int *indp, TP_DOMAIN ** domp, char **valp, int nvals,
+			  unsigned int *hash_key, bool * has_null)
+{
+  OR_BUF buf;
+  DB_VALUE dbval;
+  unsigned int key = 0;
+  int k, len;
+
+  *has_null = false;
+
+  for (k = 0; k < nvals; k++)
+    {
+      QFILE_GET_TUPLE_VALUE_HEADER_POSITION (tpl, indp[k], valp[k]);
+
+      len = QFILE_GET_TUPLE_VALUE_LENGTH (valp[k]);
+      if (QFILE_GET_TUPLE_VALUE_FLAG (valp[k]) == V_UNBOUND || len == 0)
+	{
+	  *has_null = true;
+	  return NO_ERROR;
+	}
+
+      or_init (&buf, (char *) (valp[k] + QFILE_TUPLE_VALUE_HEADER_SIZE), len);
+      if (domp[k]->type->data_readval (&buf, &dbval, domp[k], -1, false, NULL, 0) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+      if (DB_IS_NULL (&dbval))
+	{
+	  *has_null = true;
+	  return NO_ERROR;
+	}
+
+      /* 0.0 and -0.0 are equal but have different representations */
+      if (DB_VALUE_TYPE (&dbval) == DB_TYPE_DOUBLE && db_get_double (&dbval) == 0.0)
+	{
+	  db_make_double (&dbval, 0.0);
+	}
+      else if (DB_VALUE_TYPE (&dbval) == DB_TYPE_FLOAT && db_get_float (&dbval) == 0.0f)
+	{
+	  db_make_float (&dbval, 0.0f);
+	}
+
+      key = key * 31 + mht_get_hash_number (INT_MAX, &dbval);
+      pr_clear_value (&dbval);
+    }
+
+  /* spread the key on all bits; the high bits choose the partition and the low bits the bucket */
+  key ^= key >> 16;
+  key *= 0x85ebca6b;
+  key ^= key >> 13;
+  key *= 0xc2b2ae35;
+  key ^= key >> 16;
+
+  *hash_key = key;
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_join_alloc_entry () - allocate a hash join entry and room for its tuple
+ *   return: entry, or NULL
+ *   blocks(in/out) : memory blocks of the hash table
+ *   tpl_len(in)    : tuple length
+ */
+static QEXEC_HASH_JOIN_ENTRY *
+qexec_hash_join_alloc_entry (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_BLOCK ** blocks, int tpl_len)
+{
+  QEXEC_HASH_JOIN_BLOCK *block = *blocks;
+  QEXEC_HASH_JOIN_ENTRY *entry;
+  size_t header_size = DB_ALIGN (sizeof (QEXEC_HASH_JOIN_BLOCK), MAX_ALIGNMENT);
+  size_t entry_size = DB_ALIGN (sizeof (QEXEC_HASH_JOIN_ENTRY), MAX_ALIGNMENT) + DB_ALIGN (tpl_len, MAX_ALIGNMENT);
+  size_t block_size;
+
+  if (block == NULL || block->size - block->used < entry_size)
+    {
+      block_size = MAX (QEXEC_HASH_JOIN_BLOCK_SIZE, header_size + entry_size);
+      block = (QEXEC_HASH_JOIN_BLOCK *) db_private_alloc (thread_p, block_size);
+      if (block == NULL)
+	{
+	  return NULL;
+	}
+      block->next = *blocks;
+      block->size = block_size;
+      block->used = header_size;
+      *blocks = block;
+    }
+
+  entry = (QEXEC_HASH_JOIN_ENTRY *) ((char *) block + block->used);
+  entry->tpl = (char *) entry + DB_ALIGN (sizeof (QEXEC_HASH_JOIN_ENTRY), MAX_ALIGNMENT);
+  block->used += entry_size;
+
+  return entry;
+}
+
+/*
+ * qexec_hash_join_build_probe () - join two lists with an in-memory hash table
+ *   return: NO_ERROR, or ER_code
+ *   ctx(in)            : hash join context
+ *   build_list_idp(in) : list loaded in the hash table
+ *   probe_list_idp(in) : list that probes the hash table
+ *   build_is_outer(in) : true if the build list is the outer list
+ */
+static int
+qexec_hash_join_build_probe (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_CONTEXT * ctx, QFILE_LIST_ID * build_list_idp,
+			     QFILE_LIST_ID * probe_list_idp, bool build_is_outer)
+{
+  QFILE_LIST_MERGE_INFO *merge_infop = ctx->merge_info;
+  int nvals = merge_infop->ls_column_cnt;
+  int *build_indp, *probe_indp;
+  TP_DOMAIN **build_domp, **probe_domp;
+  char **build_valp, **probe_valp;
+  QEXEC_HASH_JOIN_ENTRY **buckets = NULL;
+  QEXEC_HASH_JOIN_ENTRY *entry;
+  QEXEC_HASH_JOIN_BLOCK *blocks = NULL, *block;
+  unsigned int bucket_cnt, hash_key;
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  QFILE_TUPLE_RECORD build_tplrec;
+  SCAN_CODE scan;
+  DB_VALUE_COMPARE_RESULT cmp;
+  bool has_null;
+  int tpl_len, k, error = NO_ERROR;
+
+  if (build_is_outer)
+    {
+      build_indp = merge_infop->ls_outer_column;
+      build_domp = ctx->outer_domp;
+      build_valp = ctx->outer_valp;
+      probe_indp = merge_infop->ls_inner_column;
+      probe_domp = ctx->inner_domp;
+      probe_valp = ctx->inner_valp;
+    }
+  else
+    {
+      build_indp = merge_infop->ls_inner_column;
+      build_domp = ctx->inner_domp;
+      build_valp = ctx->inner_valp;
+      probe_indp = merge_infop->ls_outer_column;
+      probe_domp = ctx->outer_domp;
+      probe_valp = ctx->outer_valp;
+    }
+
+  scan_id.status = S_CLOSED;
+
+  /* bucket count is a power of two, not smaller than the tuple count */
+  for (bucket_cnt = 64; bucket_cnt < (unsigned int) build_list_idp->tuple_cnt && bucket_cnt < (1U << 24);
+       bucket_cnt <<= 1)
+    {
+      ;
+    }
+
+  buckets = (QEXEC_HASH_JOIN_ENTRY **) db_private_alloc (thread_p, bucket_cnt * sizeof (QEXEC_HASH_JOIN_ENTRY *));
+  if (buckets == NULL)
+    {
+      error = ER_FAILED;
+      goto exit;
+    }
+  memset (buckets, 0, bucket_cnt * sizeof (QEXEC_HASH_JOIN_ENTRY *));
+
+  /* build */
+  if (qfile_open_list_scan (build_list_idp, &scan_id) != NO_ERROR)
+    {
+      error = ER_FAILED;
+      goto exit;
+    }
+
+  while ((scan = qfile_scan_list_next (thread_p, &scan_id, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      error = qexec_hash_join_hash_key (tplrec.tpl, build_indp, build_domp, build_valp, nvals, &hash_key, &has_null);
+      if (error != NO_ERROR)
+	{
+	  goto exit;
+	}
+      if (has_null)
+	{
+	  continue;
+	}
+
+      tpl_len = QFILE_GET_TUPLE_LENGTH (tplrec.tpl);
+      entry = qexec_hash_join_alloc_entry (thread_p, &blocks, tpl_len);
+      if (entry == NULL)
+	{
+	  error = ER_FAILED;
+	  goto exit;
+	}
+      memcpy (entry->tpl, tplrec.tpl, tpl_len);
+      entry->hash_key = hash_key;
+      entry->next = buckets[hash_key & (bucket_cnt - 1)];
+      buckets[hash_key & (bucket_cnt - 1)] = entry;
+    }
+  if (scan != S_END)
+    {
+      error = ER_FAILED;
+      goto exit;
+    }
+  qfile_close_scan (thread_p, &scan_id);
+
+  /* probe */
+  if (qfile_open_list_scan (probe_list_idp, &scan_id) != NO_ERROR)
+    {
+      error = ER_FAILED;
+      goto exit;
+    }
+
+  while ((scan = qfile_scan_list_next (thread_p, &scan_id, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      error = qexec_hash_join_hash_key (tplrec.tpl, probe_indp, probe_domp, probe_valp, nvals, &hash_key, &has_null);
+      if (error != NO_ERROR)
+	{
+	  goto exit;
+	}
+      if (has_null)
+	{
+	  continue;
+	}
+
+      for (entry = buckets[hash_key & (bucket_cnt - 1)]; entry != NULL; entry = entry->next)
+	{
+	  if (entry->hash_key != hash_key)
+	    {
+	      continue;
+	    }
+
+	  for (k = 0; k < nvals; k++)
+	    {
+	      QFILE_GET_TUPLE_VALUE_HEADER_POSITION (entry->tpl, build_indp[k], build_valp[k]);
+	    }
+	  cmp = qexec_cmp_tpl_vals_merge (ctx->outer_valp, ctx->outer_domp, ctx->inner_valp, ctx->inner_domp, nvals);
+	  if (cmp == DB_UNK)
+	    {
+	      /* is error */
+	      error = ER_FAILED;
+	      goto exit;
+	    }
+	  if (cmp != DB_EQ)
+	    {
+	      continue;
+	    }
+
+	  build_tplrec.tpl = entry->tpl;
+	  build_tplrec.size = QFILE_GET_TUPLE_LENGTH (entry->tpl);
+	  error =
+	    qexec_merge_tuple_add_list (thread_p, ctx->list_id, build_is_outer ? &build_tplrec : &tplrec,
+					build_is_outer ? &tplrec : &build_tplrec, merge_infop, &ctx->tplrec);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	}
+    }
+  if (scan != S_END)
+    {
+      error = ER_FAILED;
+    }
+
+exit:
+  qfile_close_scan (thread_p, &scan_id);
+
+  while (blocks != NULL)
+    {
+      block = blocks;
+      blocks = block->next;
+      db_private_free_and_init (thread_p, block);
+    }
+  if (buckets != NULL)
+    {
+      db_private_free_and_init (thread_p, buckets);
+    }
+
+  return error;
+}
+
+/*
+ * qexec_hash_join_partition () - split a list file by the hash of its join columns
+ *   return: NO_ERROR, or ER_code
+ *   list_idp(in) : list file
+ *   indp(in)     : join column positions
+ *   domp(in)     : join column domains
+ *   valp(in)     : join column value pointers
+ *   nvals(in)    : join column count
+ *   depth(in)    : partitioning depth; each depth uses other bits of the hash key
+ *   parts(out)   : QEXEC_HASH_JOIN_PARTITION_CNT partition list files
+ *
+ * Note: tuples having NULL join columns are dropped since they never join.
+ */
+static int
+qexec_hash_join_partition (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_idp, int *indp, TP_DOMAIN ** domp,
+			   char **valp, int nvals, int depth, QFILE_LIST_ID ** parts)
+{
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE scan;
+  unsigned int hash_key;
+  int shift = 32 - QEXEC_HASH_JOIN_PARTITION_BITS * (depth + 1);
+  bool has_null;
+  int i, error = NO_ERROR;
+
+  scan_id.status = S_CLOSED;
+
+  for (i = 0; i < QEXEC_HASH_JOIN_PARTITION_CNT; i++)
+    {
+      parts[i] = qfile_open_list (thread_p, &list_idp->type_list, NULL, list_idp->query_id, QFILE_FLAG_ALL);
+      if (parts[i] == NULL)
+	{
+	  error = ER_FAILED;
+	  goto exit;
+	}
+    }
+
+  if (qfile_open_list_scan (list_idp, &scan_id) != NO_ERROR)
+    {
+      error = ER_FAILED;
+      goto exit;
+    }
+
+  while ((scan = qfile_scan_list_next (thread_p, &scan_id, &tplrec, PEEK)) == S_SUCCESS)
+    {
+      error = qexec_hash_join_hash_key (tplrec.tpl, indp, domp, valp, nvals, &hash_key, &has_null);
+      if (error != NO_ERROR)
+	{
+	  goto exit;
+	}
+      if (has_null)
+	{
+	  continue;
+	}
+
+      i = (hash_key >> shift) & (QEXEC_HASH_JOIN_PARTITION_CNT - 1);
+      error = qfile_add_tuple_to_list (thread_p, parts[i], tplrec.tpl);
+      if (error != NO_ERROR)
+	{
+	  goto exit;
+	}
+    }
+  if (scan != S_END)
+    {
+      error = ER_FAILED;
+    }
+
+exit:
+  qfile_close_scan (thread_p, &scan_id);
+
+  for (i = 0; i < QEXEC_HASH_JOIN_PARTITION_CNT; i++)
+    {
+      if (parts[i] != NULL)
+	{
+	  qfile_close_list (thread_p, parts[i]);
+	}
+    }
+
+  return error;
+}
+
+/*
+ * qexec_hash_join_lists () - hash join two lists, partitioning them first if the build list is too big
+ *   return: NO_ERROR, or ER_code
+ *   ctx(in)            : hash join context
+ *   outer_list_idp(in) : outer list file
+ *   inner_list_idp(in) : inner list file
+ *   depth(in)          : partitioning depth
+ */
+static int
+qexec_hash_join_lists (THREAD_ENTRY * thread_p, QEXEC_HASH_JOIN_CONTEXT * ctx, QFILE_LIST_ID * outer_list_idp,
+		       QFILE_LIST_ID * inner_list_idp, int depth)
+{
+  QFILE_LIST_MERGE_INFO *merge_infop = ctx->merge_info;
+  QFILE_LIST_ID *outer_parts[QEXEC_HASH_JOIN_PARTITION_CNT];
+  QFILE_LIST_ID *inner_parts[QEXEC_HASH_JOIN_PARTITION_CNT];
+  QFILE_LIST_ID *build_list_idp;
+  bool build_is_outer;
+  int i, error = NO_ERROR;
+
+  if (outer_list_idp->tuple_cnt == 0 || inner_list_idp->tuple_cnt == 0)
+    {
+      return NO_ERROR;
+    }
+
+  /* build the hash table on the smaller list */
+  build_is_outer = (outer_list_idp->page_cnt < inner_list_idp->page_cnt
+		    || (outer_list_idp->page_cnt == inner_list_idp->page_cnt
+			&& outer_list_idp->tuple_cnt <= inner_list_idp->tuple_cnt));
+  build_list_idp = build_is_outer ? outer_list_idp : inner_list_idp;
+
+  if ((UINT64) build_list_idp->page_cnt * DB_PAGESIZE <= ctx->mem_limit || depth >= QEXEC_HASH_JOIN_MAX_DEPTH)
+    {
+      return qexec_hash_join_build_probe (thread_p, ctx, build_list_idp,
+					  build_is_outer ? inner_list_idp : outer_list_idp, build_is_outer);
+    }
+
+  /* spill: join the partitions one by one */
+  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_HJOIN_SPILLS);
+
+  memset (outer_parts, 0, sizeof (outer_parts));
+  memset (inner_parts, 0, sizeof (inner_parts));
+
+  error =
+    qexec_hash_join_partition (thread_p, outer_list_idp, merge_infop->ls_outer_column, ctx->outer_domp,
+			       ctx->outer_valp, merge_infop->ls_column_cnt, depth, outer_parts);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  error =
+    qexec_hash_join_partition (thread_p, inner_list_idp, merge_infop->ls_inner_column, ctx->inner_domp,
+			       ctx->inner_valp, merge_infop->ls_column_cnt, depth, inner_parts);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  for (i = 0; i < QEXEC_HASH_JOIN_PARTITION_CNT; i++)
+    {
+      error = qexec_hash_join_lists (thread_p, ctx, outer_parts[i], inner_parts[i], depth + 1);
+      if (error != NO_ERROR)
+	{
+	  goto exit;
+	}
+
+      /* release the partitions as soon as possible */
+      qfile_destroy_list (thread_p, outer_parts[i]);
+      QFILE_FREE_AND_INIT_LIST_ID (outer_parts[i]);
+      qfile_destroy_list (thread_p, inner_parts[i]);
+      QFILE_FREE_AND_INIT_LIST_ID (inner_parts[i]);
+    }
+
+exit:
+  for (i = 0; i < QEXEC_HASH_JOIN_PARTITION_CNT; i++)
+    {
+      if (outer_parts[i] != NULL)
+	{
+	  qfile_destroy_list (thread_p, outer_parts[i]);
+	  QFILE_FREE_AND_INIT_LIST_ID (outer_parts[i]);
+	}
+      if (inner_parts[i] != NULL)
+	{
+	  qfile_destroy_list (thread_p, inner_parts[i]);
+	  QFILE_FREE_AND_INIT_LIST_ID (inner_parts[i]);
+	}
+    }
+
+  return error;
+}
+
+/*
+ * qexec_hash_join_sort_list () - sort a list file on its join columns
+ *   return: NO_ERROR, or ER_code
+ *   list_idp(in/out) : list file, replaced by the sorted one
+ *   indp(in)         : join column positions
+ *   domp(in)         : join column domains
+ *   nvals(in)        : join column count
+ */
+static int
+qexec_hash_join_sort_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_idp, int *indp, TP_DOMAIN ** domp,
+			   int nvals)
+{
+  SORT_LIST *sort_list, *sort_col;
+  QFILE_LIST_ID *sorted_list_idp;
+  int k;
+
+  sort_list = qfile_allocate_sort_list (thread_p, nvals);
+  if (sort_list == NULL)
+    {
+      return ER_FAILED;
+    }
+
+  for (k = 0, sort_col = sort_list; k < nvals; k++, sort_col = sort_col->next)
+    {
+      sort_col->s_order = S_ASC;
+      sort_col->s_nulls = S_NULLS_FIRST;
+      sort_col->pos_descr.dom = domp[k];
+      sort_col->pos_descr.pos_no = indp[k];
+    }
+
+  sorted_list_idp = qfile_sort_list (thread_p, list_idp, sort_list, Q_ALL, true);
+  qfile_free_sort_list (thread_p, sort_list);
+
+  return (sorted_list_idp != NULL) ? NO_ERROR : ER_FAILED;
+}
+
+/*
+ * qexec_hash_join_list () -
+ *   return: QFILE_LIST_ID *, or NULL
+ *   outer_list_idp(in) : First (left) list file to be joined
+ *   inner_list_idp(in) : Second (right) list file to be joined
+ *   merge_infop(in)    : List file merge information
+ *   ls_flag(in)        :
+ *
+ * Note: This routine joins the given two unsorted list files on equal join columns, by loading the smaller one in a
+ * hash table (see qexec_hash_join_lists) and returns the result list file identifier. The result has the same tuples
+ * as the result of qexec_merge_list, in no particular order.
+ *
+ * Note: If a join column cannot be hashed (e.g. the columns have different types), both lists are sorted and merged
+ * instead.
+ */
+static QFILE_LIST_ID *
+qexec_hash_join_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * outer_list_idp, QFILE_LIST_ID * inner_list_idp,
+		      QFILE_LIST_MERGE_INFO * merge_infop, int ls_flag)
+{
+  QEXEC_HASH_JOIN_CONTEXT ctx;
+  QFILE_TUPLE_VALUE_TYPE_LIST type_list;
+  int nvals = merge_infop->ls_column_cnt;
+  int k;
+
+  memset (&ctx, 0, sizeof (ctx));
+  ctx.merge_info = merge_infop;
+  ctx.mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_JOIN_SIZE);
+
+  type_list.domp = NULL;
+
+  /* join column domain info */
+  ctx.outer_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  ctx.inner_domp = (TP_DOMAIN **) db_private_alloc (thread_p, nvals * sizeof (TP_DOMAIN *));
+  ctx.outer_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
+  ctx.inner_valp = (char **) db_private_alloc (thread_p, nvals * sizeof (char *));
+  if (ctx.outer_domp == NULL || ctx.inner_domp == NULL || ctx.outer_valp == NULL || ctx.inner_valp == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  for (k = 0; k < nvals; k++)
+    {
+      ctx.outer_domp[k] = outer_list_idp->type_list.domp[merge_infop->ls_outer_column[k]];
+      ctx.inner_domp[k] = inner_list_idp->type_list.domp[merge_infop->ls_inner_column[k]];
+    }
+
+  for (k = 0; k < nvals; k++)
+    {
+      if (!qexec_hash_join_is_hashable (ctx.outer_domp[k], ctx.inner_domp[k]))
+	{
+	  break;
+	}
+    }
+  if (k < nvals)
+    {
+      /* fall back to sort merge */
+      if (qexec_hash_join_sort_list (thread_p, outer_list_idp, merge_infop->ls_outer_column, ctx.outer_domp, nvals)
+	  != NO_ERROR
+	  || qexec_hash_join_sort_list (thread_p, inner_list_idp, merge_infop->ls_inner_column, ctx.inner_domp,
+					nvals) != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+
+      ctx.list_id = qexec_merge_list (thread_p, outer_list_idp, inner_list_idp, merge_infop, ls_flag);
+      goto exit_on_end;
+    }
+
+  perfmon_inc_stat (thread_p, PSTAT_QM_NUM_HJOINS);
+
+  /* form the typelist for the resultant list file */
+  type_list.type_cnt = merge_infop->ls_pos_cnt;
+  type_list.domp = (TP_DOMAIN **) malloc (type_list.type_cnt * sizeof (TP_DOMAIN *));
+  if (type_list.domp == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  for (k = 0; k < type_list.type_cnt; k++)
+    {
+      type_list.domp[k] = ((merge_infop->ls_outer_inner_list[k] == QFILE_OUTER_LIST)
+			   ? outer_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]
+			   : inner_list_idp->type_list.domp[merge_infop->ls_pos_list[k]]);
+    }
+
+  /* open the result list file; same query id with outer(inner) list file */
+  ctx.list_id = qfile_open_list (thread_p, &type_list, NULL, outer_list_idp->query_id, ls_flag);
+  if (ctx.list_id == NULL)
+    {
+      goto exit_on_error;
+    }
+
+  /* allocate the area to store the merged tuple */
+  if (qfile_reallocate_tuple (&ctx.tplrec, DB_PAGESIZE) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  if (qexec_hash_join_lists (thread_p, &ctx, outer_list_idp, inner_list_idp, 0) != NO_ERROR)
+    {
+      goto exit_on_error;
+    }
+
+  qfile_close_list (thread_p, ctx.list_id);
+
+exit_on_end:
+  if (type_list.domp)
+    {
+      free_and_init (type_list.domp);
+    }
+  if (ctx.tplrec.tpl)
+    {
+      db_private_free_and_init (thread_p, ctx.tplrec.tpl);
+    }
+  if (ctx.outer_domp)
+    {
+      db_private_free_and_init (thread_p, ctx.outer_domp);
+    }
+  if (ctx.inner_domp)
+    {
+      db_private_free_and_init (thread_p, ctx.inner_domp);
+    }
+  if (ctx.outer_valp)
+    {
+      db_private_free_and_init (thread_p, ctx.outer_valp);
+    }
+  if (ctx.inner_valp)
+    {
+      db_private_free_and_init (thread_p, ctx.inner_valp);
+    }
+
+  return ctx.list_id;
+
+exit_on_error:
+  if (ctx.list_id)
+    {
+      qfile_close_list (thread_p, ctx.list_id);
+      QFILE_FREE_AND_INIT_LIST_ID (ctx.list_id);
+    }
+
+  ctx.list_id = NULL;
+  goto exit_on_end;
+}
+
 /*
  * qexec_merge_listfiles () -
  *   return: NO_ERROR, or ER_code
@@ -6342,7 +7087,12 @@ qexec_merge_listfiles (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * x
       QFILE_SET_FLAG (ls_flag, QFILE_FLAG_RESULT_FILE);
     }
 
-  if (merge_infop->join_type == JOIN_INNER)
+  if (merge_infop->join_type == JOIN_INNER && merge_infop->hash_join)
+    {
+      /* call list file hash join routine */
+      list_id = qexec_hash_join_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
+    }
+  else if (merge_infop->join_type == JOIN_INNER)
     {
       /* call list file merge routine */
       list_id = qexec_merge_list (thread_p, outer_xasl->list_id, inner_xasl->list_id, merge_infop, ls_flag);
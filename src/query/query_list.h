@@ -338,6 +338,7 @@ struct qfile_list_merge_info
 {
   JOIN_TYPE join_type;		/* inner, left, right or outer */
   QPROC_SINGLE_FETCH single_fetch;	/* merge in single fetch mode */
+  int hash_join;		/* join by hashing instead of merging sorted lists */
   int ls_column_cnt;		/* join columns count */
   int ls_pos_cnt;		/* tuple value fetch count */
   int *ls_outer_column;		/* outer list join columns number */
@@ -1243,6 +1243,8 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
   bool saved_is_stats_on;
   bool xasl_trace;
   bool is_xasl_pinned_reference;
+  bool is_exec_timed;
+  TSC_TICKS start_tick, end_tick;
 
   cached_result = false;
   query_p = NULL;
@@ -1319,6 +1321,12 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
       *ret_cache_entry_p = xasl_cache_entry_p;
     }
 
+  is_exec_timed = perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM);
+  if (is_exec_timed)
+    {
+      tsc_getticks (&start_tick);
+    }
+
   if (IS_TRIGGER_INVOLVED (*flag_p))
     {
       session_set_trigger_state (thread_p, true);
@@ -1581,6 +1589,12 @@ end:
   qmgr_reset_query_exec_info (tran_index);
 #endif
 
+  if (is_exec_timed)
+    {
+      tsc_getticks (&end_tick);
+      perfmon_time_latency (PERF_LATENCY_QUERY_EXEC, tsc_elapsed_utime (end_tick, start_tick));
+    }
+
   return list_id_p;
 
 exit_on_error:
@@ -215,6 +215,8 @@ static int qdata_elt (THREAD_ENTRY * thread_p, FUNCTION_TYPE * function_p, VAL_D
 		      QFILE_TUPLE tuple);
 static int qdata_benchmark (THREAD_ENTRY * thread_p, FUNCTION_TYPE * function_p, VAL_DESCR * val_desc_p,
 			    OID * obj_oid_p, QFILE_TUPLE tuple);
+static int qdata_json_extract_function (THREAD_ENTRY * thread_p, FUNCTION_TYPE * function_p, VAL_DESCR * val_desc_p,
+					OID * obj_oid_p, QFILE_TUPLE tuple);
 
 static int qdata_convert_operands_to_value_and_call (THREAD_ENTRY * thread_p, FUNCTION_TYPE * function_p,
 						     VAL_DESCR * val_desc_p, OID * obj_oid_p, QFILE_TUPLE tuple,
@@ -6816,8 +6818,7 @@ qdata_evaluate_function (THREAD_ENTRY * thread_p, regu_variable_node * function_
 						       db_evaluate_json_depth);
 
     case F_JSON_EXTRACT:
-      return qdata_convert_operands_to_value_and_call (thread_p, funcp, val_desc_p, obj_oid_p, tuple,
-						       db_evaluate_json_extract);
+      return qdata_json_extract_function (thread_p, funcp, val_desc_p, obj_oid_p, tuple);
 
     case F_JSON_GET_ALL_PATHS:
       return qdata_convert_operands_to_value_and_call (thread_p, funcp, val_desc_p, obj_oid_p, tuple,
@@ -8373,6 +8374,75 @@ error_exit:
   return error_status;
 }
 
+/*
+ * qdata_json_extract_function () - JSON_EXTRACT and -> evaluation
+ *   return: NO_ERROR, or ER_code
+ *   function_p(in): function descriptor
+ *   val_desc_p(in): value descriptor
+ *   obj_oid_p(in): object identifier
+ *   tuple(in): tuple
+ *
+ * Note: When the document is an attribute not yet read from the instance (see heap_attrinfo_peek_deferred), the
+ *       path is walked on its disk value and only the extracted value is deserialized. Otherwise the document is
+ *       read and the value is extracted by db_evaluate_json_extract.
+ */
+static int
+qdata_json_extract_function (THREAD_ENTRY * thread_p, FUNCTION_TYPE * function_p, VAL_DESCR * val_desc_p,
+			     OID * obj_oid_p, QFILE_TUPLE tuple)
+{
+  REGU_VARIABLE *doc_regu_p;
+  DB_VALUE *path_p = NULL;
+  char *disk_data = NULL;
+  int disk_length = 0;
+  OR_BUF buf;
+  bool is_evaluated = false;
+  int error_status = NO_ERROR;
+
+  /* should sync with fetch_peek_dbval () */
+
+  assert (function_p != NULL);
+  assert (function_p->value != NULL);
+  assert (function_p->operand != NULL);
+
+  doc_regu_p = &function_p->operand->value;
+  if (doc_regu_p->type != TYPE_ATTR_ID || doc_regu_p->value.attr_descr.cache_attrinfo == NULL
+      || !doc_regu_p->value.attr_descr.cache_attrinfo->defer_json || function_p->operand->next == NULL
+      || function_p->operand->next->next != NULL)
+    {
+      goto extract_document;
+    }
+
+  error_status =
+    heap_attrinfo_peek_deferred (doc_regu_p->value.attr_descr.id, doc_regu_p->value.attr_descr.cache_attrinfo,
+				 &disk_data, &disk_length);
+  if (error_status != NO_ERROR)
+    {
+      return error_status;
+    }
+  if (disk_data == NULL || disk_length <= 0)
+    {
+      goto extract_document;
+    }
+
+  error_status =
+    fetch_peek_dbval (thread_p, &function_p->operand->next->value, val_desc_p, NULL, obj_oid_p, tuple, &path_p);
+  if (error_status != NO_ERROR)
+    {
+      return error_status;
+    }
+
+  OR_BUF_INIT2 (buf, disk_data, disk_length);
+  error_status = db_evaluate_json_extract_serialized (function_p->value, &buf, path_p, &is_evaluated);
+  if (error_status != NO_ERROR || is_evaluated)
+    {
+      return error_status;
+    }
+
+extract_document:
+  return qdata_convert_operands_to_value_and_call (thread_p, function_p, val_desc_p, obj_oid_p, tuple,
+						   db_evaluate_json_extract);
+}
+
 //
 // qdata_benchmark () - "benchmark" function execution; repeatedly run nested operation
 //
@@ -50,6 +50,17 @@
 #include "dbtype.h"
 #include "xasl_predicate.hpp"
 #include "xasl.h"
+#if defined (SERVER_MODE)
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+#endif /* SERVER_MODE */
 
 #if !defined(SERVER_MODE)
 #define pthread_mutex_init(a, b)
@@ -200,6 +211,208 @@ static SCAN_CODE call_get_next_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID *
 					     bool should_go_to_next_value);
 static int scan_key_compare (DB_VALUE * val1, DB_VALUE * val2, int num_index_term);
 
+#if defined (SERVER_MODE)
+/*
+ * Parallel heap scan
+ *
+ * A forward heap scan that only reads a large heap can be helped by the parallel heap scan workers. The scanning
+ * thread and its helpers claim the pages of the heap in chain order. Each of them reads the visible version of the
+ * objects of its page, using the snapshot of the scanning transaction and its own scan cache, and copies them into the
+ * batch of the page. The scanning thread returns the records of the batches in page order and evaluates the predicates
+ * as usual; the predicates, regulator variables and value lists of the XASL are not safe to share with other threads.
+ *
+ * Pages are claimed without keeping the previous page fixed, so vacuum can remove the next page from the chain before
+ * it is fixed. Such a page has no objects, but the page that follows it is not known anymore; the chain is then walked
+ * again from the heap header, skipping the pages already claimed.
+ *
+ * A scanning thread that keeps pages fixed (e.g. the inner scan of a join) is not helped: a helper could wait for its
+ * page behind a writer that waits for a page of the scanning thread.
+ */
+
+/* Minimum number of heap pages for a parallel scan */
+#define SCAN_PARALLEL_HEAP_MIN_PAGES 64
+
+/* Number of pages claimed ahead of the scanning thread for each thread of the scan */
+#define SCAN_PARALLEL_HEAP_BATCHES_PER_EXECUTOR 4
+
+/* Maximum number of tasks queued in the parallel heap scan worker pool for each worker */
+#define SCAN_PARALLEL_HEAP_MAX_TASKS_PER_WORKER 2
+
+/* Size of the area used to pass the error of a helper to the scanning thread */
+#define SCAN_PARALLEL_HEAP_ERROR_AREA_SIZE 1024
+
+#define SCAN_PARALLEL_HEAP_PAGE_KEY(vpid) (((UINT64) (unsigned short) (vpid)->volid << 32) | (UINT32) (vpid)->pageid)
+
+// *INDENT-OFF*
+// scan_parallel_heap_job - pages of a heap scan claimed by the scanning thread and its helpers
+class scan_parallel_heap_job
+{
+  public:
+    scan_parallel_heap_job (const HFID &hfid, const OID &cls_oid, MVCC_SNAPSHOT *mvcc_snapshot, int tran_index,
+			    int executor_count);
+
+    void execute_helper (cubthread::entry &thread_ref);
+    SCAN_CODE next (cubthread::entry &thread_ref, OID *oid, RECDES *recdes);
+    void stop (cubthread::entry &thread_ref);
+
+  private:
+    enum claim_result
+    {
+      CLAIM_PAGE,
+      CLAIM_WAIT,
+      CLAIM_END
+    };
+
+    // page_batch - visible records of a page
+    struct page_batch
+    {
+      std::vector<OID> oids;
+      std::vector<std::size_t> offsets;
+      std::vector<int> lengths;
+      std::vector<INT16> types;
+      std::vector<char> data;
+      bool is_ready;
+    };
+
+    claim_result claim_page (cubthread::entry &thread_ref, HEAP_SCANCACHE &scan_cache, int &seq);
+    int fill_batch (cubthread::entry &thread_ref, HEAP_SCANCACHE &scan_cache, page_batch &batch);
+    void set_error (int error);
+
+    HFID m_hfid;
+    OID m_cls_oid;
+    MVCC_SNAPSHOT *m_mvcc_snapshot;
+    int m_tran_index;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cond;	/* a batch is ready or released, or a helper is done */
+    VPID m_next_vpid;			/* next page to claim */
+    VPID m_prev_vpid;			/* page the link to next page was read from */
+    bool m_has_prev;			/* false when next page is the heap header */
+    bool m_is_chain_end;
+    bool m_is_stopped;
+    std::vector<UINT64> m_claimed_pages;
+    std::vector<page_batch> m_batches;	/* the batch of the page claimed as seq is m_batches[seq % size] */
+    int m_next_seq;			/* sequence of the next claimed page */
+    int m_read_seq;			/* sequence of the page read by the scanning thread */
+    int m_active_helpers;
+    int m_error;
+    OR_ALIGNED_BUF (SCAN_PARALLEL_HEAP_ERROR_AREA_SIZE) m_error_area;	/* error of a helper */
+
+    /* used by the scanning thread only */
+    HEAP_SCANCACHE m_scan_cache;
+    bool m_is_scan_cache_started;
+    page_batch *m_read_batch;
+    std::size_t m_read_pos;
+};
+
+class scan_parallel_heap_task : public cubthread::entry_task
+{
+  public:
+    scan_parallel_heap_task (const std::shared_ptr<scan_parallel_heap_job> &job);
+
+    void execute (cubthread::entry &thread_ref) override;
+
+  private:
+    std::shared_ptr<scan_parallel_heap_job> m_job;
+};
+
+struct scan_parallel_heap
+{
+  std::shared_ptr<scan_parallel_heap_job> job;
+};
+// *INDENT-ON*
+
+static cubthread::entry_workpool *scan_Parallel_heap_workers = NULL;
+
+static void scan_parallel_heap_start (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static SCAN_CODE scan_parallel_heap_next (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp, RECDES * recdes);
+static void scan_parallel_heap_end (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp);
+#endif /* SERVER_MODE */
+
+/*
+ * Vectorized data filter of heap scans
+ *
+ * The conjuncts of a heap scan data filter that compare a fixed size numeric attribute with a constant or a host
+ * variable (e.g. col > ? AND col2 = ?) are evaluated for a batch of records at a time. A forward select heap scan reads
+ * up to SCAN_HEAP_BATCH_MAX_ROWS records ahead and copies them into its batch. For each conjunct, the attribute values
+ * of the batch are decoded from the records into a column, then a loop over the column compares them with the constant
+ * and clears the rows that fail in the selection vector. The loops have no branches, so the compiler can vectorize
+ * them.
+ *
+ * A conjunct only clears rows that can not qualify. The selected rows are still passed to the data filter, which
+ * evaluates the whole predicate and reads the predicate attributes used by the rest of the query. A value that can not
+ * be decoded directly (the attribute has another type or is missing in the representation of the record) keeps the row
+ * selected.
+ */
+
+/* Maximum number of records read ahead by a heap scan */
+#define SCAN_HEAP_BATCH_MAX_ROWS 256
+
+/* Size of the records read ahead after which the batch is considered full */
+#define SCAN_HEAP_BATCH_DATA_SIZE (DB_PAGESIZE * 2)
+
+/* Maximum number of conjuncts evaluated on the batch */
+#define SCAN_HEAP_BATCH_MAX_TERMS 8
+
+/* clear the selected rows of the batch whose column value does not satisfy "value op constant" */
+#define SCAN_HEAP_BATCH_FILTER(batch, column, op, constant) \
+  do \
+    { \
+      int _i; \
+      for (_i = 0; _i < (batch)->n_rows; _i++) \
+	{ \
+	  (batch)->selected[_i] &= \
+	    (unsigned char) ((((column)[_i] op (constant)) & (batch)->is_value[_i]) | (batch)->is_undecided[_i]); \
+	} \
+    } \
+  while (0)
+
+/* a conjunct of the data filter: attribute rel_op constant */
+typedef struct scan_heap_batch_term SCAN_HEAP_BATCH_TERM;
+struct scan_heap_batch_term
+{
+  ATTR_ID attrid;
+  REL_OP rel_op;
+  REGU_VARIABLE *constant;	/* TYPE_DBVAL or TYPE_POS_VALUE */
+};
+
+struct scan_heap_batch
+{
+  SCAN_HEAP_BATCH_TERM terms[SCAN_HEAP_BATCH_MAX_TERMS];
+  int n_terms;
+  bool is_used;			/* the scan reads its records through the batch */
+  bool is_end;			/* the heap has no records after the batch */
+  OID next_oid;			/* last object read into the batch, where the heap scan continues */
+
+  int n_rows;
+  int read_pos;			/* next row returned by the scan */
+  OID oids[SCAN_HEAP_BATCH_MAX_ROWS];
+  int offsets[SCAN_HEAP_BATCH_MAX_ROWS];
+  int lengths[SCAN_HEAP_BATCH_MAX_ROWS];
+  INT16 types[SCAN_HEAP_BATCH_MAX_ROWS];
+  char *data;			/* records of the batch */
+  int data_size;
+  int data_length;
+  unsigned char selected[SCAN_HEAP_BATCH_MAX_ROWS];
+
+  /* column of the attribute of a term */
+  DB_BIGINT bigints[SCAN_HEAP_BATCH_MAX_ROWS];
+  double doubles[SCAN_HEAP_BATCH_MAX_ROWS];
+  unsigned char is_value[SCAN_HEAP_BATCH_MAX_ROWS];	/* value is decoded and not null */
+  unsigned char is_undecided[SCAN_HEAP_BATCH_MAX_ROWS];	/* value is not decoded, the term keeps the row */
+};
+
+static int scan_heap_batch_start (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static void scan_heap_batch_compile (const PRED_EXPR * pr, HEAP_CACHE_ATTRINFO * attr_cache,
+				     SCAN_HEAP_BATCH_TERM * terms, int *n_terms);
+static void scan_heap_batch_reset (SCAN_HEAP_BATCH * batch);
+static SCAN_CODE scan_heap_batch_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, RECDES * recdes);
+static SCAN_CODE scan_heap_batch_fill (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static int scan_heap_batch_select (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static void scan_heap_batch_apply (SCAN_HEAP_BATCH * batch, REL_OP rel_op, bool is_double, DB_BIGINT bigint_constant,
+				   double double_constant);
+static void scan_heap_batch_end (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp);
+
 /*
  * scan_init_iss () - initialize index skip scan structure
  *   return: error code
@@ -2828,6 +3041,8 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* do not reset hsidp->caches_inited here */
   hsidp->scancache_inited = false;
   hsidp->scanrange_inited = false;
+  hsidp->parallel = NULL;
+  hsidp->batch = NULL;
 
   hsidp->cache_recordinfo = cache_recordinfo;
   hsidp->recordinfo_regu_list = regu_list_recordinfo;
@@ -3967,6 +4182,8 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    {
 	      goto exit_on_error;
 	    }
+	  /* predicates like JSON_EXTRACT (col, path) = value read only the extracted value from the record */
+	  hsidp->pred_attrs.attr_cache->defer_json = true;
 	  hsidp->rest_attrs.attr_cache->num_values = -1;
 	  ret =
 	    heap_attrinfo_start (thread_p, &hsidp->cls_oid, hsidp->rest_attrs.num_attrs, hsidp->rest_attrs.attr_ids,
@@ -3986,6 +4203,11 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	  hsidp->caches_inited = true;
 	}
+      ret = scan_heap_batch_start (thread_p, scan_id);
+      if (ret != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
       break;
 
     case S_HEAP_PAGE_SCAN:
@@ -4229,6 +4451,10 @@ scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
 	{
 	  s_id->position = (s_id->direction == S_FORWARD) ? S_BEFORE : S_AFTER;
 	  OID_SET_NULL (&s_id->s.hsid.curr_oid);
+	  if (s_id->s.hsid.batch != NULL)
+	    {
+	      scan_heap_batch_reset (s_id->s.hsid.batch);
+	    }
 	}
       break;
 
@@ -4525,6 +4751,9 @@ scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	}
       else
 	{
+#if defined (SERVER_MODE)
+	  scan_parallel_heap_end (thread_p, hsidp);
+#endif /* SERVER_MODE */
 	  if (hsidp->scancache_inited)
 	    {
 	      (void) heap_scancache_end (thread_p, &hsidp->scan_cache);
@@ -4626,6 +4855,12 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     {
     case S_HEAP_SCAN:
     case S_HEAP_SCAN_RECORD_INFO:
+#if defined (SERVER_MODE)
+      scan_parallel_heap_end (thread_p, &scan_id->s.hsid);
+#endif /* SERVER_MODE */
+      scan_heap_batch_end (thread_p, &scan_id->s.hsid);
+      break;
+
     case S_HEAP_PAGE_SCAN:
     case S_CLASS_ATTR_SCAN:
     case S_VALUES_SCAN:
@@ -5002,6 +5237,11 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     {
       is_peeking = PEEK;
     }
+  else if (hsidp->batch != NULL && hsidp->batch->is_used)
+    {
+      /* records are copied into the batch, they do not change with the heap page */
+      is_peeking = COPY;
+    }
 
   if (data_filter.val_list)
     {
@@ -5014,6 +5254,15 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	}
     }
 
+#if defined (SERVER_MODE)
+  if (OID_ISNULL (&hsidp->curr_oid))
+    {
+      /* the scan starts from the first object; get help if it qualifies */
+      scan_parallel_heap_end (thread_p, hsidp);
+      scan_parallel_heap_start (thread_p, scan_id);
+    }
+#endif /* SERVER_MODE */
+
   while (1)
     {
       COPY_OID (&retry_oid, &hsidp->curr_oid);
@@ -5035,9 +5284,22 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	      /* move forward */
 	      if (scan_id->type == S_HEAP_SCAN)
 		{
-		  sp_scan =
-		    heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes, &hsidp->scan_cache,
-			       is_peeking);
+		  if (hsidp->batch != NULL && hsidp->batch->is_used)
+		    {
+		      sp_scan = scan_heap_batch_next (thread_p, scan_id, &recdes);
+		    }
+#if defined (SERVER_MODE)
+		  else if (hsidp->parallel != NULL)
+		    {
+		      sp_scan = scan_parallel_heap_next (thread_p, hsidp, &recdes);
+		    }
+#endif /* SERVER_MODE */
+		  else
+		    {
+		      sp_scan =
+			heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes,
+				   &hsidp->scan_cache, is_peeking);
+		    }
 		}
 	      else
 		{
@@ -5337,143 +5599,1181 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 }
 
 /*
- * scan_next_heap_page_scan () - The scan is moved to the next page.
- *
- * return	 : Error code.
- * thread_p (in) : Thread entry.
- * scan_id (in)	 : Scan data.
+ * scan_heap_batch_start () - prepare the batch of a heap scan whose data filter can be evaluated on batches
+ *   return: error code
+ *   scan_id(in/out): Scan identifier
  */
-static SCAN_CODE
-scan_next_heap_page_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+static int
+scan_heap_batch_start (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 {
-  HEAP_PAGE_SCAN_ID *hpsidp = NULL;
-  FILTER_INFO data_filter;
-  SCAN_CODE sp_scan;
-  DB_LOGICAL ev_res;
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  SCAN_HEAP_BATCH *batch = hsidp->batch;
 
-  hpsidp = &scan_id->s.hpsid;
+  if (batch == NULL)
+    {
+      SCAN_HEAP_BATCH_TERM terms[SCAN_HEAP_BATCH_MAX_TERMS];
+      int n_terms = 0;
 
-  scan_init_filter_info (&data_filter, &hpsidp->scan_pred, NULL, scan_id->val_list, scan_id->vd, &hpsidp->cls_oid, 0,
-			 NULL, NULL, NULL);
+      if (scan_id->type != S_HEAP_SCAN || scan_id->grouped || hsidp->pred_attrs.attr_cache == NULL)
+	{
+	  return NO_ERROR;
+	}
 
-  while (true)
-    {
-      if (scan_id->direction == S_FORWARD)
+      scan_heap_batch_compile (hsidp->scan_pred.pred_expr, hsidp->pred_attrs.attr_cache, terms, &n_terms);
+      if (n_terms == 0)
 	{
-	  /* move forward */
-	  sp_scan = heap_page_next (thread_p, &hpsidp->cls_oid, &hpsidp->hfid, &hpsidp->curr_vpid,
-				    hpsidp->cache_page_info);
+	  return NO_ERROR;
 	}
-      else
+
+      batch = (SCAN_HEAP_BATCH *) db_private_alloc (thread_p, sizeof (SCAN_HEAP_BATCH));
+      if (batch == NULL)
 	{
-	  /* move backward */
-	  sp_scan = heap_page_prev (thread_p, &hpsidp->cls_oid, &hpsidp->hfid, &hpsidp->curr_vpid,
-				    hpsidp->cache_page_info);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (SCAN_HEAP_BATCH));
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
 	}
 
-      if (sp_scan != S_SUCCESS)
+      memcpy (batch->terms, terms, n_terms * sizeof (SCAN_HEAP_BATCH_TERM));
+      batch->n_terms = n_terms;
+      batch->data = NULL;
+      batch->data_size = 0;
+      hsidp->batch = batch;
+    }
+
+  /* the scan direction is switched for further iterations */
+  batch->is_used = (scan_id->direction == S_FORWARD && scan_id->scan_op_type == S_SELECT
+		    && !scan_id->mvcc_select_lock_needed && !mvcc_is_mvcc_disabled_class (&hsidp->cls_oid));
+  scan_heap_batch_reset (batch);
+
+  return NO_ERROR;
+}
+
+/*
+ * scan_heap_batch_compile () - collect the conjuncts of a data filter that can be evaluated on batches
+ *   pr(in): Predicate expression
+ *   attr_cache(in): Attribute cache of the predicate attributes
+ *   terms(in/out): Conjuncts
+ *   n_terms(in/out): Number of conjuncts
+ */
+static void
+scan_heap_batch_compile (const PRED_EXPR * pr, HEAP_CACHE_ATTRINFO * attr_cache, SCAN_HEAP_BATCH_TERM * terms,
+			 int *n_terms)
+{
+  const COMP_EVAL_TERM *et_comp;
+  REGU_VARIABLE *attr, *constant;
+  REL_OP rel_op;
+
+  if (pr == NULL || *n_terms >= SCAN_HEAP_BATCH_MAX_TERMS)
+    {
+      return;
+    }
+
+  if (pr->type == T_PRED)
+    {
+      if (pr->pe.m_pred.bool_op == B_AND)
 	{
-	  return (sp_scan == S_END) ? S_END : S_ERROR;
+	  scan_heap_batch_compile (pr->pe.m_pred.lhs, attr_cache, terms, n_terms);
+	  scan_heap_batch_compile (pr->pe.m_pred.rhs, attr_cache, terms, n_terms);
 	}
+      return;
+    }
 
-      /* evaluate filter to see if the page qualifies */
-      ev_res = eval_data_filter (thread_p, &hpsidp->cls_oid, NULL, NULL, &data_filter);
+  if (pr->type != T_EVAL_TERM || pr->pe.m_eval_term.et_type != T_COMP_EVAL_TERM)
+    {
+      return;
+    }
 
-      if (ev_res == V_ERROR)
+  et_comp = &pr->pe.m_eval_term.et.et_comp;
+  attr = et_comp->lhs;
+  constant = et_comp->rhs;
+  rel_op = et_comp->rel_op;
+  if (attr == NULL || constant == NULL)
+    {
+      return;
+    }
+
+  if (attr->type != TYPE_ATTR_ID)
+    {
+      /* constant op attribute */
+      attr = et_comp->rhs;
+      constant = et_comp->lhs;
+      switch (rel_op)
 	{
-	  return S_ERROR;
+	case R_LT:
+	  rel_op = R_GT;
+	  break;
+	case R_LE:
+	  rel_op = R_GE;
+	  break;
+	case R_GT:
+	  rel_op = R_LT;
+	  break;
+	case R_GE:
+	  rel_op = R_LE;
+	  break;
+	default:
+	  break;
 	}
-      else if (ev_res != V_TRUE)
+    }
+
+  if (attr->type != TYPE_ATTR_ID || attr->value.attr_descr.cache_attrinfo != attr_cache
+      || (constant->type != TYPE_DBVAL && constant->type != TYPE_POS_VALUE) || constant->xasl != NULL)
+    {
+      return;
+    }
+
+  switch (rel_op)
+    {
+    case R_EQ:
+    case R_NE:
+    case R_LT:
+    case R_LE:
+    case R_GT:
+    case R_GE:
+      terms[*n_terms].attrid = attr->value.attr_descr.id;
+      terms[*n_terms].rel_op = rel_op;
+      terms[*n_terms].constant = constant;
+      (*n_terms)++;
+      break;
+
+    default:
+      break;
+    }
+}
+
+/*
+ * scan_heap_batch_reset () - discard the records of the batch; the heap scan restarts from the first object
+ *   batch(in/out): Batch of a heap scan
+ */
+static void
+scan_heap_batch_reset (SCAN_HEAP_BATCH * batch)
+{
+  batch->is_end = false;
+  OID_SET_NULL (&batch->next_oid);
+  batch->n_rows = 0;
+  batch->read_pos = 0;
+  batch->data_length = 0;
+}
+
+/*
+ * scan_heap_batch_next () - get the next selected record of the batch, reading a new batch when needed
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   scan_id(in/out): Scan identifier
+ *   recdes(out): Record of the object; it stays valid until the batch is read again
+ */
+static SCAN_CODE
+scan_heap_batch_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, RECDES * recdes)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  SCAN_HEAP_BATCH *batch = hsidp->batch;
+  SCAN_CODE scan;
+  int pos;
+
+  while (true)
+    {
+      for (pos = batch->read_pos; pos < batch->n_rows && !batch->selected[pos]; pos++)
 	{
-	  /* V_FALSE || V_UNKNOWN */
-	  continue;
+	  /* rejected by the batch filter; counted here as the scan does not see it */
+	  scan_id->scan_stats.read_rows++;
 	}
 
-      if (hpsidp->page_info_regu_list != NULL)
+      if (pos < batch->n_rows)
 	{
-	  /* fetch the page info values */
-	  if (scan_id->val_list)
-	    {
-	      if (fetch_val_list (thread_p, hpsidp->page_info_regu_list, scan_id->vd, &hpsidp->cls_oid, NULL, NULL,
-				  PEEK) != NO_ERROR)
-		{
-		  return S_ERROR;
-		}
-	    }
+	  break;
 	}
 
-      return S_SUCCESS;
+      scan = scan_heap_batch_fill (thread_p, scan_id);
+      if (scan != S_SUCCESS)
+	{
+	  return scan;
+	}
     }
+
+  batch->read_pos = pos + 1;
+  COPY_OID (&hsidp->curr_oid, &batch->oids[pos]);
+  recdes->data = batch->data + batch->offsets[pos];
+  recdes->length = batch->lengths[pos];
+  recdes->area_size = batch->lengths[pos];
+  recdes->type = batch->types[pos];
+
+  return S_SUCCESS;
 }
 
 /*
- * scan_next_class_attr_scan () - The scan is moved to the next class attribute scan item.
+ * scan_heap_batch_fill () - read the next records of the heap into the batch and select them
  *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
  *   scan_id(in/out): Scan identifier
- *
- * Note: If there are no more scan items, S_END is returned. If an error occurs, S_ERROR is returned.
  */
 static SCAN_CODE
-scan_next_class_attr_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+scan_heap_batch_fill (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 {
-  HEAP_SCAN_ID *hsidp;
-  FILTER_INFO data_filter;
-  DB_LOGICAL ev_res;
-
-  hsidp = &scan_id->s.hsid;
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  SCAN_HEAP_BATCH *batch = hsidp->batch;
+  RECDES recdes = RECDES_INITIALIZER;
+  SCAN_CODE scan = S_SUCCESS;
 
-  /* set data filter information */
-  scan_init_filter_info (&data_filter, &hsidp->scan_pred, &hsidp->pred_attrs, scan_id->val_list, scan_id->vd,
-			 &hsidp->cls_oid, 0, NULL, NULL, NULL);
+  batch->n_rows = 0;
+  batch->read_pos = 0;
+  batch->data_length = 0;
 
-  if (scan_id->position == S_BEFORE)
+  if (batch->is_end)
     {
-      /* Class attribute scans are always single row scan. */
-      scan_id->position = S_AFTER;
+      /* like heap_next, end the scan with a null object identifier */
+      batch->is_end = false;
+      OID_SET_NULL (&hsidp->curr_oid);
+      return S_END;
+    }
 
-      /* evaluate the predicates to see if the object qualifies */
-      ev_res = eval_data_filter (thread_p, NULL, NULL, NULL, &data_filter);
-      if (ev_res == V_ERROR)
+  /* the heap scan continues after the last object read into the batch */
+  COPY_OID (&hsidp->curr_oid, &batch->next_oid);
+
+  while (batch->n_rows < SCAN_HEAP_BATCH_MAX_ROWS && batch->data_length < SCAN_HEAP_BATCH_DATA_SIZE)
+    {
+      recdes.data = NULL;
+#if defined (SERVER_MODE)
+      if (hsidp->parallel != NULL)
 	{
-	  return S_ERROR;
+	  scan = scan_parallel_heap_next (thread_p, hsidp, &recdes);
 	}
-
-      if (scan_id->qualification == QPROC_QUALIFIED)
+      else
+#endif /* SERVER_MODE */
 	{
-	  if (ev_res != V_TRUE)
-	    {			/* V_FALSE || V_UNKNOWN */
-	      return S_END;	/* not qualified */
-	    }
+	  scan = heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes, &hsidp->scan_cache,
+			    scan_id->fixed);
 	}
-      else if (scan_id->qualification == QPROC_NOT_QUALIFIED)
+      if (scan != S_SUCCESS)
 	{
-	  if (ev_res != V_FALSE)
-	    {			/* V_TRUE || V_UNKNOWN */
-	      return S_END;	/* qualified */
-	    }
+	  break;
 	}
-      else if (scan_id->qualification == QPROC_QUALIFIED_OR_NOT)
+
+      if (batch->data_length + recdes.length > batch->data_size)
 	{
-	  if (ev_res == V_TRUE)
+	  int new_size = MAX (batch->data_size * 2, batch->data_length + recdes.length);
+	  char *new_data;
+
+	  if (batch->data == NULL)
 	    {
-	      scan_id->qualification = QPROC_QUALIFIED;
+	      new_data = (char *) db_private_alloc (thread_p, new_size);
 	    }
-	  else if (ev_res == V_FALSE)
+	  else
 	    {
-	      scan_id->qualification = QPROC_NOT_QUALIFIED;
+	      new_data = (char *) db_private_realloc (thread_p, batch->data, new_size);
 	    }
-	  else			/* V_UNKNOWN */
+
+	  if (new_data == NULL)
 	    {
-	      /* nop */
-	      ;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) new_size);
+	      return S_ERROR;
 	    }
+	  batch->data = new_data;
+	  batch->data_size = new_size;
 	}
-      else
-	{			/* invalid value; the same as QPROC_QUALIFIED */
-	  if (ev_res != V_TRUE)
-	    {			/* V_FALSE || V_UNKNOWN */
-	      return S_END;	/* not qualified */
-	    }
+
+      COPY_OID (&batch->oids[batch->n_rows], &hsidp->curr_oid);
+      batch->offsets[batch->n_rows] = batch->data_length;
+      batch->lengths[batch->n_rows] = recdes.length;
+      batch->types[batch->n_rows] = recdes.type;
+      memcpy (batch->data + batch->data_length, recdes.data, recdes.length);
+      /* keep the records aligned like in the heap pages */
+      batch->data_length = DB_ALIGN (batch->data_length + recdes.length, MAX_ALIGNMENT);
+      batch->n_rows++;
+    }
+
+  if (scan == S_ERROR)
+    {
+      return S_ERROR;
+    }
+
+  COPY_OID (&batch->next_oid, &hsidp->curr_oid);
+  if (scan == S_END)
+    {
+      if (batch->n_rows == 0)
+	{
+	  return S_END;
+	}
+      /* end the scan after the rows of this batch */
+      batch->is_end = true;
+    }
+
+  if (scan_heap_batch_select (thread_p, scan_id) != NO_ERROR)
+    {
+      return S_ERROR;
+    }
+
+  return S_SUCCESS;
+}
+
+/*
+ * scan_heap_batch_select () - evaluate the conjuncts of the batch filter on the records of the batch
+ *   return: error code
+ *   scan_id(in/out): Scan identifier
+ */
+static int
+scan_heap_batch_select (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  SCAN_HEAP_BATCH *batch = hsidp->batch;
+  SCAN_HEAP_BATCH_TERM *term;
+  DB_VALUE *constant;
+  DB_TYPE constant_type, type;
+  DB_BIGINT bigint_constant = 0;
+  double double_constant = 0;
+  bool is_double;
+  RECDES recdes;
+  char *disk_data;
+  int error = NO_ERROR;
+  int i, t;
+
+  memset (batch->selected, 1, batch->n_rows);
+
+  if (scan_id->qualification != QPROC_QUALIFIED)
+    {
+      /* the rows that do not qualify are needed too */
+      return NO_ERROR;
+    }
+
+  for (t = 0; t < batch->n_terms; t++)
+    {
+      term = &batch->terms[t];
+
+      error = fetch_peek_dbval (thread_p, term->constant, scan_id->vd, NULL, NULL, NULL, &constant);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      if (DB_IS_NULL (constant))
+	{
+	  /* the comparison is never true */
+	  memset (batch->selected, 0, batch->n_rows);
+	  return NO_ERROR;
+	}
+
+      constant_type = DB_VALUE_DOMAIN_TYPE (constant);
+      switch (constant_type)
+	{
+	case DB_TYPE_SHORT:
+	  is_double = false;
+	  bigint_constant = db_get_short (constant);
+	  break;
+	case DB_TYPE_INTEGER:
+	  is_double = false;
+	  bigint_constant = db_get_int (constant);
+	  break;
+	case DB_TYPE_BIGINT:
+	  is_double = false;
+	  bigint_constant = db_get_bigint (constant);
+	  break;
+	case DB_TYPE_DOUBLE:
+	  is_double = true;
+	  double_constant = db_get_double (constant);
+	  break;
+	default:
+	  /* left to the data filter */
+	  continue;
+	}
+
+      /* decode the column of the attribute; integers are compared with integers and doubles with doubles only */
+      for (i = 0; i < batch->n_rows; i++)
+	{
+	  batch->is_value[i] = 0;
+	  batch->is_undecided[i] = 0;
+	  batch->bigints[i] = 0;
+	  batch->doubles[i] = 0;
+
+	  if (!batch->selected[i])
+	    {
+	      continue;
+	    }
+
+	  recdes.data = batch->data + batch->offsets[i];
+	  recdes.length = batch->lengths[i];
+	  recdes.area_size = batch->lengths[i];
+	  recdes.type = batch->types[i];
+
+	  error = heap_attrinfo_peek_fixed (thread_p, &recdes, term->attrid, hsidp->pred_attrs.attr_cache, &type,
+					    &disk_data);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+
+	  switch (type)
+	    {
+	    case DB_TYPE_SHORT:
+	      if (!is_double && disk_data != NULL)
+		{
+		  batch->bigints[i] = OR_GET_SHORT (disk_data);
+		  batch->is_value[i] = 1;
+		}
+	      batch->is_undecided[i] = is_double;
+	      break;
+	    case DB_TYPE_INTEGER:
+	      if (!is_double && disk_data != NULL)
+		{
+		  batch->bigints[i] = OR_GET_INT (disk_data);
+		  batch->is_value[i] = 1;
+		}
+	      batch->is_undecided[i] = is_double;
+	      break;
+	    case DB_TYPE_BIGINT:
+	      if (!is_double && disk_data != NULL)
+		{
+		  OR_GET_BIGINT (disk_data, &batch->bigints[i]);
+		  batch->is_value[i] = 1;
+		}
+	      batch->is_undecided[i] = is_double;
+	      break;
+	    case DB_TYPE_DOUBLE:
+	      if (is_double && disk_data != NULL)
+		{
+		  OR_GET_DOUBLE (disk_data, &batch->doubles[i]);
+		  batch->is_value[i] = 1;
+		}
+	      batch->is_undecided[i] = !is_double;
+	      break;
+	    default:
+	      batch->is_undecided[i] = 1;
+	      break;
+	    }
+	}
+
+      scan_heap_batch_apply (batch, term->rel_op, is_double, bigint_constant, double_constant);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * scan_heap_batch_apply () - clear the selected rows of the batch whose column value does not satisfy a conjunct
+ *   batch(in/out): Batch of a heap scan
+ *   rel_op(in): Relational operator of the conjunct
+ *   is_double(in): The column is decoded as doubles, otherwise as big integers
+ *   bigint_constant(in): The constant of the conjunct if the column has big integers
+ *   double_constant(in): The constant of the conjunct if the column has doubles
+ */
+static void
+scan_heap_batch_apply (SCAN_HEAP_BATCH * batch, REL_OP rel_op, bool is_double, DB_BIGINT bigint_constant,
+		       double double_constant)
+{
+  switch (rel_op)
+    {
+    case R_EQ:
+      if (is_double)
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->doubles, ==, double_constant);
+	}
+      else
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->bigints, ==, bigint_constant);
+	}
+      break;
+    case R_NE:
+      if (is_double)
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->doubles, !=, double_constant);
+	}
+      else
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->bigints, !=, bigint_constant);
+	}
+      break;
+    case R_LT:
+      if (is_double)
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->doubles, <, double_constant);
+	}
+      else
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->bigints, <, bigint_constant);
+	}
+      break;
+    case R_LE:
+      if (is_double)
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->doubles, <=, double_constant);
+	}
+      else
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->bigints, <=, bigint_constant);
+	}
+      break;
+    case R_GT:
+      if (is_double)
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->doubles, >, double_constant);
+	}
+      else
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->bigints, >, bigint_constant);
+	}
+      break;
+    case R_GE:
+      if (is_double)
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->doubles, >=, double_constant);
+	}
+      else
+	{
+	  SCAN_HEAP_BATCH_FILTER (batch, batch->bigints, >=, bigint_constant);
+	}
+      break;
+    default:
+      assert (false);
+      break;
+    }
+}
+
+/*
+ * scan_heap_batch_end () - free the batch of a heap scan
+ *   hsidp(in/out): Heap scan identifier
+ */
+static void
+scan_heap_batch_end (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp)
+{
+  if (hsidp->batch == NULL)
+    {
+      return;
+    }
+
+  if (hsidp->batch->data != NULL)
+    {
+      db_private_free (thread_p, hsidp->batch->data);
+    }
+  db_private_free_and_init (thread_p, hsidp->batch);
+}
+
+#if defined (SERVER_MODE)
+/*
+ * scan_parallel_heap_start () - have the heap scan helped by the parallel heap scan workers, if it qualifies
+ *   scan_id(in/out): Scan identifier
+ */
+static void
+scan_parallel_heap_start (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  int worker_count = prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_WORKERS);
+  int npages = 0;
+  int helpers;
+
+  assert (hsidp->parallel == NULL);
+
+  if (scan_Parallel_heap_workers == NULL || scan_id->type != S_HEAP_SCAN || scan_id->grouped
+      || scan_id->direction != S_FORWARD || scan_id->scan_op_type != S_SELECT || scan_id->mvcc_select_lock_needed
+      || !hsidp->scancache_inited || hsidp->scan_cache.mvcc_snapshot == NULL
+      || mvcc_is_mvcc_disabled_class (&hsidp->cls_oid))
+    {
+      return;
+    }
+
+  /* helpers check whether objects were changed by the transaction while it could change more */
+  if (MVCCID_IS_VALID (logtb_find_current_mvccid (thread_p)))
+    {
+      return;
+    }
+
+  if (pgbuf_has_any_fixed_page (thread_p))
+    {
+      return;
+    }
+
+  if (file_get_num_user_pages (thread_p, &hsidp->hfid.vfid, &npages) != NO_ERROR)
+    {
+      /* scan without help */
+      er_clear ();
+      return;
+    }
+  if (npages < SCAN_PARALLEL_HEAP_MIN_PAGES)
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  std::shared_ptr<scan_parallel_heap_job> job =
+    std::make_shared<scan_parallel_heap_job> (hsidp->hfid, hsidp->cls_oid, hsidp->scan_cache.mvcc_snapshot,
+                                              LOG_FIND_THREAD_TRAN_INDEX (thread_p), worker_count + 1);
+
+  for (helpers = 0; helpers < worker_count && !cubthread::get_manager ()->is_pool_full (scan_Parallel_heap_workers);
+       helpers++)
+    {
+      cubthread::get_manager ()->push_task (scan_Parallel_heap_workers, new scan_parallel_heap_task (job));
+    }
+  // *INDENT-ON*
+
+  if (helpers == 0)
+    {
+      job->stop (*thread_p);
+      return;
+    }
+
+  hsidp->parallel = new scan_parallel_heap ();
+  hsidp->parallel->job = job;
+  scan_id->scan_stats.parallel_workers = MAX (scan_id->scan_stats.parallel_workers, helpers);
+}
+
+/*
+ * scan_parallel_heap_next () - get the next object of a heap scan helped by other threads
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   hsidp(in/out): Heap scan identifier
+ *   recdes(out): Record of the object; it stays valid until the next call
+ */
+static SCAN_CODE
+scan_parallel_heap_next (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp, RECDES * recdes)
+{
+  SCAN_CODE scan;
+
+  scan = hsidp->parallel->job->next (*thread_p, &hsidp->curr_oid, recdes);
+  if (scan == S_END)
+    {
+      /* like heap_next, end the scan with a null object identifier */
+      scan_parallel_heap_end (thread_p, hsidp);
+      OID_SET_NULL (&hsidp->curr_oid);
+    }
+
+  return scan;
+}
+
+/*
+ * scan_parallel_heap_end () - stop the helpers of a heap scan
+ *   hsidp(in/out): Heap scan identifier
+ */
+static void
+scan_parallel_heap_end (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp)
+{
+  if (hsidp->parallel == NULL)
+    {
+      return;
+    }
+
+  hsidp->parallel->job->stop (*thread_p);
+  delete hsidp->parallel;
+  hsidp->parallel = NULL;
+}
+
+// *INDENT-OFF*
+scan_parallel_heap_job::scan_parallel_heap_job (const HFID &hfid, const OID &cls_oid, MVCC_SNAPSHOT *mvcc_snapshot,
+						int tran_index, int executor_count)
+  : m_hfid (hfid)
+  , m_cls_oid (cls_oid)
+  , m_mvcc_snapshot (mvcc_snapshot)
+  , m_tran_index (tran_index)
+  , m_mutex ()
+  , m_cond ()
+  , m_next_vpid ()
+  , m_prev_vpid ()
+  , m_has_prev (false)
+  , m_is_chain_end (false)
+  , m_is_stopped (false)
+  , m_claimed_pages ()
+  , m_batches (executor_count * SCAN_PARALLEL_HEAP_BATCHES_PER_EXECUTOR)
+  , m_next_seq (0)
+  , m_read_seq (0)
+  , m_active_helpers (0)
+  , m_error (NO_ERROR)
+  , m_error_area ()
+  , m_scan_cache ()
+  , m_is_scan_cache_started (false)
+  , m_read_batch (NULL)
+  , m_read_pos (0)
+{
+  VPID_SET (&m_next_vpid, hfid.vfid.volid, hfid.hpgid);
+  VPID_SET_NULL (&m_prev_vpid);
+}
+
+//
+// execute_helper () - claim and read pages until the scan is stopped or all pages are claimed
+//
+void
+scan_parallel_heap_job::execute_helper (cubthread::entry &thread_ref)
+{
+  HEAP_SCANCACHE scan_cache;
+  int save_tran_index = thread_ref.tran_index;
+  int seq;
+  int error;
+
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  if (m_is_stopped || m_is_chain_end || m_error != NO_ERROR)
+    {
+      /* started too late */
+      return;
+    }
+  m_active_helpers++;
+  ulock.unlock ();
+
+  /* visibility is checked on behalf of the scanning transaction */
+  thread_ref.tran_index = m_tran_index;
+
+  error = heap_scancache_start_helper (&thread_ref, &scan_cache, &m_hfid, &m_cls_oid, m_mvcc_snapshot);
+
+  ulock.lock ();
+  if (error != NO_ERROR)
+    {
+      set_error (error);
+    }
+  else
+    {
+      while (true)
+	{
+	  claim_result result = claim_page (thread_ref, scan_cache, seq);
+	  if (result == CLAIM_END)
+	    {
+	      break;
+	    }
+	  if (result == CLAIM_WAIT)
+	    {
+	      m_cond.wait (ulock);
+	      continue;
+	    }
+
+	  page_batch &batch = m_batches[seq % m_batches.size ()];
+
+	  ulock.unlock ();
+	  error = fill_batch (thread_ref, scan_cache, batch);
+	  ulock.lock ();
+
+	  if (error != NO_ERROR)
+	    {
+	      set_error (error);
+	      break;
+	    }
+	  batch.is_ready = true;
+	  m_cond.notify_all ();
+	}
+
+      ulock.unlock ();
+      (void) heap_scancache_end (&thread_ref, &scan_cache);
+      ulock.lock ();
+    }
+
+  thread_ref.tran_index = save_tran_index;
+
+  m_active_helpers--;
+  m_cond.notify_all ();
+}
+
+//
+// next () - get the next record, in page order; the scanning thread reads pages itself while waiting for helpers
+//
+SCAN_CODE
+scan_parallel_heap_job::next (cubthread::entry &thread_ref, OID *oid, RECDES *recdes)
+{
+  page_batch *batch;
+  int seq;
+  int error;
+
+  while (m_read_batch == NULL || m_read_pos >= m_read_batch->oids.size ())
+    {
+      std::unique_lock<std::mutex> ulock (m_mutex);
+
+      if (m_read_batch != NULL)
+	{
+	  /* release the batch for a page claimed later */
+	  m_read_batch->is_ready = false;
+	  m_read_batch = NULL;
+	  m_read_seq++;
+	  m_cond.notify_all ();
+	}
+
+      while (m_read_batch == NULL)
+	{
+	  if (m_error != NO_ERROR)
+	    {
+	      (void) er_set_area_error (OR_ALIGNED_BUF_START (m_error_area));
+	      return S_ERROR;
+	    }
+
+	  batch = &m_batches[m_read_seq % m_batches.size ()];
+	  if (batch->is_ready)
+	    {
+	      m_read_batch = batch;
+	      m_read_pos = 0;
+	      break;
+	    }
+	  if (m_is_chain_end && m_read_seq == m_next_seq)
+	    {
+	      return S_END;
+	    }
+
+	  if (!m_is_scan_cache_started)
+	    {
+	      error = heap_scancache_start_helper (&thread_ref, &m_scan_cache, &m_hfid, &m_cls_oid, m_mvcc_snapshot);
+	      if (error != NO_ERROR)
+		{
+		  set_error (error);
+		  continue;
+		}
+	      m_is_scan_cache_started = true;
+	    }
+
+	  if (claim_page (thread_ref, m_scan_cache, seq) != CLAIM_PAGE)
+	    {
+	      /* the page is read by a helper */
+	      m_cond.wait (ulock);
+	      continue;
+	    }
+
+	  ulock.unlock ();
+	  error = fill_batch (thread_ref, m_scan_cache, m_batches[seq % m_batches.size ()]);
+	  ulock.lock ();
+
+	  if (error != NO_ERROR)
+	    {
+	      set_error (error);
+	      continue;
+	    }
+	  m_batches[seq % m_batches.size ()].is_ready = true;
+	}
+    }
+
+  *oid = m_read_batch->oids[m_read_pos];
+  recdes->data = m_read_batch->data.data () + m_read_batch->offsets[m_read_pos];
+  recdes->length = m_read_batch->lengths[m_read_pos];
+  recdes->area_size = recdes->length;
+  recdes->type = m_read_batch->types[m_read_pos];
+  m_read_pos++;
+
+  return S_SUCCESS;
+}
+
+//
+// stop () - stop claiming pages and wait for the helpers that started
+//
+void
+scan_parallel_heap_job::stop (cubthread::entry &thread_ref)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  m_is_stopped = true;
+  m_cond.notify_all ();
+  m_cond.wait (ulock, [this] { return m_active_helpers == 0; });
+  ulock.unlock ();
+
+  if (m_is_scan_cache_started)
+    {
+      (void) heap_scancache_end (&thread_ref, &m_scan_cache);
+      m_is_scan_cache_started = false;
+    }
+}
+
+//
+// claim_page () - claim the next page of the chain; it is left fixed in scan_cache. m_mutex must be locked; the links
+//                 of the chain are read while holding it.
+//
+scan_parallel_heap_job::claim_result
+scan_parallel_heap_job::claim_page (cubthread::entry &thread_ref, HEAP_SCANCACHE &scan_cache, int &seq)
+{
+  std::vector<UINT64> skip_pages;
+  VPID vpid;
+  VPID next_vpid;
+  bool is_linked;
+  int error;
+
+  while (true)
+    {
+      if (m_error != NO_ERROR || m_is_stopped || m_is_chain_end)
+	{
+	  return CLAIM_END;
+	}
+      if (m_next_seq >= m_read_seq + (int) m_batches.size ())
+	{
+	  /* too far ahead of the scanning thread */
+	  return CLAIM_WAIT;
+	}
+
+      vpid = m_next_vpid;
+      error = heap_page_fix_in_chain (&thread_ref, &scan_cache, &vpid, m_has_prev ? &m_prev_vpid : NULL, &next_vpid,
+				      &is_linked);
+      if (error != NO_ERROR)
+	{
+	  set_error (error);
+	  return CLAIM_END;
+	}
+
+      if (!is_linked)
+	{
+	  if (!m_has_prev)
+	    {
+	      /* the heap header is never unlinked */
+	      assert_release (false);
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HEAP_UNKNOWN_HEAP, 3, "", m_hfid.vfid.fileid, m_hfid.hpgid);
+	      set_error (ER_HEAP_UNKNOWN_HEAP);
+	      return CLAIM_END;
+	    }
+
+	  /* the page was removed from the chain; walk it again from the header, skipping claimed pages */
+	  skip_pages = m_claimed_pages;
+	  std::sort (skip_pages.begin (), skip_pages.end ());
+	  VPID_SET (&m_next_vpid, m_hfid.vfid.volid, m_hfid.hpgid);
+	  m_has_prev = false;
+	  continue;
+	}
+
+      m_prev_vpid = vpid;
+      m_has_prev = true;
+      m_next_vpid = next_vpid;
+      m_is_chain_end = VPID_ISNULL (&next_vpid);
+
+      if (std::binary_search (skip_pages.begin (), skip_pages.end (), SCAN_PARALLEL_HEAP_PAGE_KEY (&vpid)))
+	{
+	  pgbuf_ordered_unfix (&thread_ref, &scan_cache.page_watcher);
+	  continue;
+	}
+
+      m_claimed_pages.push_back (SCAN_PARALLEL_HEAP_PAGE_KEY (&vpid));
+      seq = m_next_seq++;
+      return CLAIM_PAGE;
+    }
+}
+
+//
+// fill_batch () - copy the visible objects of the page fixed in scan_cache into batch
+//
+int
+scan_parallel_heap_job::fill_batch (cubthread::entry &thread_ref, HEAP_SCANCACHE &scan_cache, page_batch &batch)
+{
+  RECDES recdes = RECDES_INITIALIZER;
+  VPID vpid;
+  OID oid;
+  std::size_t offset;
+  SCAN_CODE scan;
+  int error;
+
+  batch.oids.clear ();
+  batch.offsets.clear ();
+  batch.lengths.clear ();
+  batch.types.clear ();
+  batch.data.clear ();
+
+  assert (scan_cache.page_watcher.pgptr != NULL);
+  pgbuf_get_vpid (scan_cache.page_watcher.pgptr, &vpid);
+  oid.volid = vpid.volid;
+  oid.pageid = vpid.pageid;
+  oid.slotid = NULL_SLOTID;
+
+  while (true)
+    {
+      recdes.data = NULL;
+      scan = heap_page_next (&thread_ref, &oid, &recdes, &scan_cache, COPY);
+      if (scan == S_END)
+	{
+	  return NO_ERROR;
+	}
+      if (scan != S_SUCCESS)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+
+      /* keep records aligned like in pages */
+      offset = DB_ALIGN (batch.data.size (), MAX_ALIGNMENT);
+      batch.data.resize (offset + recdes.length);
+      std::memcpy (batch.data.data () + offset, recdes.data, recdes.length);
+
+      batch.oids.push_back (oid);
+      batch.offsets.push_back (offset);
+      batch.lengths.push_back (recdes.length);
+      batch.types.push_back (recdes.type);
+    }
+}
+
+//
+// set_error () - save the error of the first thread that fails; m_mutex must be locked
+//
+void
+scan_parallel_heap_job::set_error (int error)
+{
+  int length;
+
+  if (m_error == NO_ERROR)
+    {
+      m_error = error;
+      length = SCAN_PARALLEL_HEAP_ERROR_AREA_SIZE;
+      (void) er_get_area_error (OR_ALIGNED_BUF_START (m_error_area), &length);
+    }
+  m_cond.notify_all ();
+}
+
+scan_parallel_heap_task::scan_parallel_heap_task (const std::shared_ptr<scan_parallel_heap_job> &job)
+  : m_job (job)
+{
+}
+
+void
+scan_parallel_heap_task::execute (cubthread::entry &thread_ref)
+{
+  m_job->execute_helper (thread_ref);
+  er_clear ();
+}
+// *INDENT-ON*
+
+/*
+ * scan_parallel_heap_workers_init () - initialize the workers helping heap scans
+ */
+void
+scan_parallel_heap_workers_init (void)
+{
+  int worker_count = prm_get_integer_value (PRM_ID_PARALLEL_HEAP_SCAN_WORKERS);
+
+  if (worker_count <= 0)
+    {
+      /* Heap scans are done by the scanning threads only. */
+      scan_Parallel_heap_workers = NULL;
+      return;
+    }
+
+  scan_Parallel_heap_workers =
+    cubthread::get_manager ()->create_worker_pool (worker_count,
+						   worker_count * SCAN_PARALLEL_HEAP_MAX_TASKS_PER_WORKER,
+						   "parallel heap scan workers", NULL, 1, false);
+}
+
+/*
+ * scan_parallel_heap_workers_destroy () - destroy the workers helping heap scans
+ */
+void
+scan_parallel_heap_workers_destroy (void)
+{
+  cubthread::get_manager ()->destroy_worker_pool (scan_Parallel_heap_workers);
+}
+#endif /* SERVER_MODE */
+
+/*
+ * scan_next_heap_page_scan () - The scan is moved to the next page.
+ *
+ * return	 : Error code.
+ * thread_p (in) : Thread entry.
+ * scan_id (in)	 : Scan data.
+ */
+static SCAN_CODE
+scan_next_heap_page_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_PAGE_SCAN_ID *hpsidp = NULL;
+  FILTER_INFO data_filter;
+  SCAN_CODE sp_scan;
+  DB_LOGICAL ev_res;
+
+  hpsidp = &scan_id->s.hpsid;
+
+  scan_init_filter_info (&data_filter, &hpsidp->scan_pred, NULL, scan_id->val_list, scan_id->vd, &hpsidp->cls_oid, 0,
+			 NULL, NULL, NULL);
+
+  while (true)
+    {
+      if (scan_id->direction == S_FORWARD)
+	{
+	  /* move forward */
+	  sp_scan = heap_page_next (thread_p, &hpsidp->cls_oid, &hpsidp->hfid, &hpsidp->curr_vpid,
+				    hpsidp->cache_page_info);
+	}
+      else
+	{
+	  /* move backward */
+	  sp_scan = heap_page_prev (thread_p, &hpsidp->cls_oid, &hpsidp->hfid, &hpsidp->curr_vpid,
+				    hpsidp->cache_page_info);
+	}
+
+      if (sp_scan != S_SUCCESS)
+	{
+	  return (sp_scan == S_END) ? S_END : S_ERROR;
+	}
+
+      /* evaluate filter to see if the page qualifies */
+      ev_res = eval_data_filter (thread_p, &hpsidp->cls_oid, NULL, NULL, &data_filter);
+
+      if (ev_res == V_ERROR)
+	{
+	  return S_ERROR;
+	}
+      else if (ev_res != V_TRUE)
+	{
+	  /* V_FALSE || V_UNKNOWN */
+	  continue;
+	}
+
+      if (hpsidp->page_info_regu_list != NULL)
+	{
+	  /* fetch the page info values */
+	  if (scan_id->val_list)
+	    {
+	      if (fetch_val_list (thread_p, hpsidp->page_info_regu_list, scan_id->vd, &hpsidp->cls_oid, NULL, NULL,
+				  PEEK) != NO_ERROR)
+		{
+		  return S_ERROR;
+		}
+	    }
+	}
+
+      return S_SUCCESS;
+    }
+}
+
+/*
+ * scan_next_class_attr_scan () - The scan is moved to the next class attribute scan item.
+ *   return: SCAN_CODE (S_SUCCESS, S_END, S_ERROR)
+ *   scan_id(in/out): Scan identifier
+ *
+ * Note: If there are no more scan items, S_END is returned. If an error occurs, S_ERROR is returned.
+ */
+static SCAN_CODE
+scan_next_class_attr_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_SCAN_ID *hsidp;
+  FILTER_INFO data_filter;
+  DB_LOGICAL ev_res;
+
+  hsidp = &scan_id->s.hsid;
+
+  /* set data filter information */
+  scan_init_filter_info (&data_filter, &hsidp->scan_pred, &hsidp->pred_attrs, scan_id->val_list, scan_id->vd,
+			 &hsidp->cls_oid, 0, NULL, NULL, NULL);
+
+  if (scan_id->position == S_BEFORE)
+    {
+      /* Class attribute scans are always single row scan. */
+      scan_id->position = S_AFTER;
+
+      /* evaluate the predicates to see if the object qualifies */
+      ev_res = eval_data_filter (thread_p, NULL, NULL, NULL, &data_filter);
+      if (ev_res == V_ERROR)
+	{
+	  return S_ERROR;
+	}
+
+      if (scan_id->qualification == QPROC_QUALIFIED)
+	{
+	  if (ev_res != V_TRUE)
+	    {			/* V_FALSE || V_UNKNOWN */
+	      return S_END;	/* not qualified */
+	    }
+	}
+      else if (scan_id->qualification == QPROC_NOT_QUALIFIED)
+	{
+	  if (ev_res != V_FALSE)
+	    {			/* V_TRUE || V_UNKNOWN */
+	      return S_END;	/* qualified */
+	    }
+	}
+      else if (scan_id->qualification == QPROC_QUALIFIED_OR_NOT)
+	{
+	  if (ev_res == V_TRUE)
+	    {
+	      scan_id->qualification = QPROC_QUALIFIED;
+	    }
+	  else if (ev_res == V_FALSE)
+	    {
+	      scan_id->qualification = QPROC_NOT_QUALIFIED;
+	    }
+	  else			/* V_UNKNOWN */
+	    {
+	      /* nop */
+	      ;
+	    }
+	}
+      else
+	{			/* invalid value; the same as QPROC_QUALIFIED */
+	  if (ev_res != V_TRUE)
+	    {			/* V_FALSE || V_UNKNOWN */
+	      return S_END;	/* not qualified */
+	    }
 	}
 
       if (hsidp->rest_regu_list)
@@ -7475,6 +8775,11 @@ scan_print_stats_json (SCAN_ID * scan_id, json_t * scan_stats)
       json_object_set_new (scan, "readrows", json_integer (scan_id->scan_stats.read_rows));
       json_object_set_new (scan, "rows", json_integer (scan_id->scan_stats.qualified_rows));
 
+      if (scan_id->scan_stats.parallel_workers > 0)
+	{
+	  json_object_set_new (scan, "parallel", json_integer (scan_id->scan_stats.parallel_workers));
+	}
+
       if (scan_id->type == S_HEAP_SCAN)
 	{
 	  json_object_set_new (scan_stats, "heap", scan);
@@ -7596,7 +8901,12 @@ scan_print_stats_text (FILE * fp, SCAN_ID * scan_id)
     {
     case S_HEAP_SCAN:
     case S_LIST_SCAN:
-      fprintf (fp, ", readrows: %d, rows: %d)", scan_id->scan_stats.read_rows, scan_id->scan_stats.qualified_rows);
+      fprintf (fp, ", readrows: %d, rows: %d", scan_id->scan_stats.read_rows, scan_id->scan_stats.qualified_rows);
+      if (scan_id->scan_stats.parallel_workers > 0)
+	{
+	  fprintf (fp, ", parallel: %d", scan_id->scan_stats.parallel_workers);
+	}
+      fprintf (fp, ")");
       break;
 
     case S_INDX_SCAN:
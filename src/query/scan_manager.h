@@ -90,6 +90,9 @@ typedef enum
   S_INDX_NODE_INFO_SCAN		/* scans b-tree nodes for info */
 } SCAN_TYPE;
 
+typedef struct scan_parallel_heap SCAN_PARALLEL_HEAP;
+typedef struct scan_heap_batch SCAN_HEAP_BATCH;
+
 typedef struct heap_scan_id HEAP_SCAN_ID;
 struct heap_scan_id
 {
@@ -107,6 +110,8 @@ struct heap_scan_id
   bool scanrange_inited;
   DB_VALUE **cache_recordinfo;	/* cache for record information */
   regu_variable_list_node *recordinfo_regu_list;	/* regulator variable list for record info */
+  SCAN_PARALLEL_HEAP *parallel;	/* pages read with the help of other threads, or NULL */
+  SCAN_HEAP_BATCH *batch;	/* records read ahead and prefiltered by vectorized comparisons, or NULL */
 };				/* Regular Heap File Scan Identifier */
 
 typedef struct heap_page_scan_id HEAP_PAGE_SCAN_ID;
@@ -308,6 +313,7 @@ struct scan_stats
   /* for heap & list scan */
   int read_rows;		/* # of rows read */
   int qualified_rows;		/* # of rows qualified by data filter */
+  int parallel_workers;		/* # of threads that helped a heap scan */
 
   /* for btree scan */
   int read_keys;		/* # of keys read */
@@ -470,6 +476,10 @@ extern void scan_init_index_scan (INDX_SCAN_ID * isidp, struct btree_iscan_oid_l
 				  MVCC_SNAPSHOT * mvcc_snapshot);
 extern int scan_initialize (void);
 extern void scan_finalize (void);
+#if defined (SERVER_MODE)
+extern void scan_parallel_heap_workers_init (void);
+extern void scan_parallel_heap_workers_destroy (void);
+#endif /* SERVER_MODE */
 extern void scan_init_filter_info (FILTER_INFO * filter_info_p, SCAN_PRED * scan_pred, SCAN_ATTRS * scan_attrs,
 				   val_list_node * val_list, val_descr * val_descr, OID * class_oid,
 				   int btree_num_attrs, ATTR_ID * btree_attr_ids, int *num_vstr_ptr,
@@ -3063,6 +3063,8 @@ stx_build_ls_merge_info (THREAD_ENTRY * thread_p, char *ptr, QFILE_LIST_MERGE_IN
   ptr = or_unpack_int (ptr, &single_fetch);
   list_merge_info->single_fetch = (QPROC_SINGLE_FETCH) single_fetch;
 
+  ptr = or_unpack_int (ptr, &list_merge_info->hash_join);
+
   ptr = or_unpack_int (ptr, &list_merge_info->ls_column_cnt);
 
   ptr = or_unpack_int (ptr, &offset);
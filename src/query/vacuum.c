@@ -55,8 +55,10 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 #include <stack>
+#include <vector>
 
 #include <cstring>
 
@@ -694,6 +696,12 @@ static int vacuum_compare_heap_object (const void *a, const void *b);
 static int vacuum_collect_heap_objects (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, OID * oid, VFID * vfid);
 static void vacuum_cleanup_collected_by_vfid (VACUUM_WORKER * worker, VFID * vfid);
 static int vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted);
+static int vacuum_heap_objects (THREAD_ENTRY * thread_p, VACUUM_HEAP_OBJECT * heap_objects, int n_heap_objects,
+				MVCCID threshold_mvccid, bool was_interrupted);
+#if defined (SERVER_MODE)
+static int vacuum_heap_split (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid,
+			      bool was_interrupted);
+#endif /* SERVER_MODE */
 static int vacuum_heap_prepare_record (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
 static int vacuum_heap_record_insid_and_prev_version (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
 static int vacuum_heap_record (THREAD_ENTRY * thread_p, VACUUM_HEAP_HELPER * helper);
@@ -918,6 +926,123 @@ class vacuum_worker_task : public cubthread::entry_task
     VACUUM_DATA_ENTRY m_data;
 };
 
+#if defined (SERVER_MODE)
+// class vacuum_heap_split_job
+//
+//  description:
+//    heap objects collected by one block job, cut at heap page boundaries into sub-jobs. the worker owning the block
+//    job and helper workers claim sub-jobs until none is left; the owner waits for all claimed sub-jobs to finish
+//    before it marks the block as vacuumed.
+//
+//    helper tasks may be executed after all sub-jobs were claimed (even after the owner moved to another block). they
+//    must not touch heap objects in that case; the job object itself is kept alive by shared ownership.
+//
+class vacuum_heap_split_job
+{
+  public:
+    vacuum_heap_split_job (VACUUM_HEAP_OBJECT *heap_objects, std::vector<int> &&bounds, MVCCID threshold_mvccid,
+			   bool was_interrupted)
+      : m_heap_objects (heap_objects)
+      , m_bounds (std::move (bounds))
+      , m_subjob_count ((int) m_bounds.size () - 1)
+      , m_next_subjob { 0 }
+      , m_finished_count (0)
+      , m_error_code (NO_ERROR)
+      , m_threshold_mvccid (threshold_mvccid)
+      , m_was_interrupted (was_interrupted)
+      , m_mutex ()
+      , m_cond_finished ()
+    {
+    }
+
+    // claim and execute one sub-job; return false if all sub-jobs were claimed
+    bool execute_next_subjob (cubthread::entry &thread_ref)
+    {
+      int subjob = m_next_subjob++;
+      if (subjob >= m_subjob_count)
+	{
+	  return false;
+	}
+
+      int error_code = vacuum_heap_objects (&thread_ref, m_heap_objects + m_bounds[subjob],
+					    m_bounds[subjob + 1] - m_bounds[subjob], m_threshold_mvccid,
+					    m_was_interrupted);
+
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      if (error_code != NO_ERROR && m_error_code == NO_ERROR)
+	{
+	  m_error_code = error_code;
+	}
+      if (++m_finished_count == m_subjob_count)
+	{
+	  m_cond_finished.notify_all ();
+	}
+      return true;
+    }
+
+    // wait for all sub-jobs to finish and return the first error
+    int wait_finished ()
+    {
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      m_cond_finished.wait (ulock, [this] { return m_finished_count == m_subjob_count; });
+      return m_error_code;
+    }
+
+    int get_subjob_count () const
+    {
+      return m_subjob_count;
+    }
+
+  private:
+    VACUUM_HEAP_OBJECT *m_heap_objects;     // owner worker objects; valid only while sub-jobs are left
+    std::vector<int> m_bounds;              // sub-job i covers objects [m_bounds[i], m_bounds[i + 1])
+    int m_subjob_count;
+    std::atomic<int> m_next_subjob;
+    int m_finished_count;                   // protected by m_mutex
+    int m_error_code;                       // protected by m_mutex
+    MVCCID m_threshold_mvccid;
+    bool m_was_interrupted;
+    std::mutex m_mutex;
+    std::condition_variable m_cond_finished;
+};
+
+// class vacuum_heap_helper_task
+//
+//  description:
+//    task pushed to vacuum workers to help with sub-jobs of a split block job
+//
+class vacuum_heap_helper_task : public cubthread::entry_task
+{
+  public:
+    vacuum_heap_helper_task (const std::shared_ptr<vacuum_heap_split_job> &split_job)
+      : m_split_job (split_job)
+    {
+    }
+
+    void execute (cubthread::entry &thread_ref) final
+    {
+      VACUUM_WORKER *worker = vacuum_get_vacuum_worker (&thread_ref);
+
+      assert (!thread_ref.check_interrupt);
+
+      worker->state = VACUUM_WORKER_STATE_EXECUTE;
+      while (m_split_job->execute_next_subjob (thread_ref))
+	{
+	  perfmon_inc_stat (&thread_ref, PSTAT_VAC_NUM_HELPER_SUBJOBS);
+	}
+      worker->state = VACUUM_WORKER_STATE_INACTIVE;
+
+      /* Normally all pages should already be unfixed. */
+      pgbuf_unfix_all (&thread_ref);
+    }
+
+  private:
+    vacuum_heap_helper_task ();
+
+    std::shared_ptr<vacuum_heap_split_job> m_split_job;
+};
+#endif // SERVER_MODE
+
 // vacuum master globals
 static cubthread::daemon *vacuum_Master_daemon = NULL;                       // daemon thread
 static vacuum_master_context_manager *vacuum_Master_context_manager = NULL;  // context manager
@@ -1400,22 +1525,13 @@ vacuum_finalize (THREAD_ENTRY * thread_p)
  *
  * return		 : Error code.
  * thread_p (in)	 : Thread entry.
- * heap_objects (in)	 : Array of heap objects (VFID & OID).
- * n_heap_objects (in)	 : Number of heap objects.
+ * worker (in)		 : Vacuum worker with heap objects (VFID & OID) collected by job.
  * threshold_mvccid (in) : Threshold MVCCID used for vacuum check.
  * was_interrutped (in)  : True if same job was executed and interrupted.
  */
 static int
 vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted)
 {
-  VACUUM_HEAP_OBJECT *page_ptr;
-  VACUUM_HEAP_OBJECT *obj_ptr;
-  int error_code = NO_ERROR;
-  VFID vfid = VFID_INITIALIZER;
-  HFID hfid = HFID_INITIALIZER;
-  bool reusable = false;
-  int object_count = 0;
-
   if (worker->n_heap_objects == 0)
     {
       return NO_ERROR;
@@ -1429,8 +1545,44 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
    * each different heap page. */
   qsort (worker->heap_objects, worker->n_heap_objects, sizeof (VACUUM_HEAP_OBJECT), vacuum_compare_heap_object);
 
+#if defined (SERVER_MODE)
+  if (vacuum_Worker_threads != NULL && VACUUM_IS_THREAD_VACUUM_WORKER (thread_p)
+      && prm_get_integer_value (PRM_ID_VACUUM_HEAP_SPLIT_MIN_OBJECTS) > 0
+      && worker->n_heap_objects >= 2 * prm_get_integer_value (PRM_ID_VACUUM_HEAP_SPLIT_MIN_OBJECTS))
+    {
+      /* Too many objects for one worker. Share them with other workers. */
+      return vacuum_heap_split (thread_p, worker, threshold_mvccid, was_interrupted);
+    }
+#endif /* SERVER_MODE */
+
+  return vacuum_heap_objects (thread_p, worker->heap_objects, worker->n_heap_objects, threshold_mvccid,
+			      was_interrupted);
+}
+
+/*
+ * vacuum_heap_objects () - Vacuum heap objects page by page.
+ *
+ * return		 : Error code.
+ * thread_p (in)	 : Thread entry.
+ * heap_objects (in)	 : Array of heap objects (VFID & OID) sorted by vacuum_compare_heap_object.
+ * n_heap_objects (in)	 : Number of heap objects.
+ * threshold_mvccid (in) : Threshold MVCCID used for vacuum check.
+ * was_interrutped (in)  : True if same job was executed and interrupted.
+ */
+static int
+vacuum_heap_objects (THREAD_ENTRY * thread_p, VACUUM_HEAP_OBJECT * heap_objects, int n_heap_objects,
+		     MVCCID threshold_mvccid, bool was_interrupted)
+{
+  VACUUM_HEAP_OBJECT *page_ptr;
+  VACUUM_HEAP_OBJECT *obj_ptr;
+  int error_code = NO_ERROR;
+  VFID vfid = VFID_INITIALIZER;
+  HFID hfid = HFID_INITIALIZER;
+  bool reusable = false;
+  int object_count = 0;
+
   /* Start parsing array. Vacuum objects page by page. */
-  for (page_ptr = worker->heap_objects; page_ptr < worker->heap_objects + worker->n_heap_objects;)
+  for (page_ptr = heap_objects; page_ptr < heap_objects + n_heap_objects;)
     {
       if (!VFID_EQ (&vfid, &page_ptr->vfid))
 	{
@@ -1442,7 +1594,7 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
       /* Find all objects for this page. */
       object_count = 1;
       for (obj_ptr = page_ptr + 1;
-	   obj_ptr < worker->heap_objects + worker->n_heap_objects && obj_ptr->oid.pageid == page_ptr->oid.pageid
+	   obj_ptr < heap_objects + n_heap_objects && obj_ptr->oid.pageid == page_ptr->oid.pageid
 	   && obj_ptr->oid.volid == page_ptr->oid.volid; obj_ptr++)
 	{
 	  object_count++;
@@ -1476,6 +1628,87 @@ vacuum_heap (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_m
   return NO_ERROR;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * vacuum_heap_split () - Vacuum heap objects of a large job using several vacuum workers. Objects are cut into
+ *			  sub-jobs at heap page boundaries, helper tasks are pushed to vacuum worker pool and current
+ *			  worker executes sub-jobs too. Returns only after all sub-jobs are finished.
+ *
+ * return		 : Error code.
+ * thread_p (in)	 : Thread entry.
+ * worker (in)		 : Vacuum worker with sorted heap objects.
+ * threshold_mvccid (in) : Threshold MVCCID used for vacuum check.
+ * was_interrutped (in)  : True if same job was executed and interrupted.
+ */
+static int
+vacuum_heap_split (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, MVCCID threshold_mvccid, bool was_interrupted)
+{
+  int min_objects = prm_get_integer_value (PRM_ID_VACUUM_HEAP_SPLIT_MIN_OBJECTS);
+  int max_subjobs = prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT);
+  int subjob_count;
+  int subjob_size;
+  int bound;
+  int helper_count;
+  int i;
+  /* *INDENT-OFF* */
+  std::vector<int> bounds;
+  std::shared_ptr<vacuum_heap_split_job> split_job;
+  /* *INDENT-ON* */
+
+  assert (min_objects > 0);
+
+  subjob_count = MIN (worker->n_heap_objects / min_objects, max_subjobs);
+  if (subjob_count < 2)
+    {
+      return vacuum_heap_objects (thread_p, worker->heap_objects, worker->n_heap_objects, threshold_mvccid,
+				  was_interrupted);
+    }
+  subjob_size = worker->n_heap_objects / subjob_count;
+
+  /* Cut objects into sub-jobs of similar size. All objects of a heap page must belong to same sub-job. */
+  bounds.push_back (0);
+  for (bound = subjob_size; bound < worker->n_heap_objects; bound += subjob_size)
+    {
+      while (bound < worker->n_heap_objects
+	     && worker->heap_objects[bound].oid.pageid == worker->heap_objects[bound - 1].oid.pageid
+	     && worker->heap_objects[bound].oid.volid == worker->heap_objects[bound - 1].oid.volid)
+	{
+	  bound++;
+	}
+      if (bound >= worker->n_heap_objects)
+	{
+	  break;
+	}
+      bounds.push_back (bound);
+    }
+  bounds.push_back (worker->n_heap_objects);
+
+  /* *INDENT-OFF* */
+  split_job = std::make_shared<vacuum_heap_split_job> (worker->heap_objects, std::move (bounds), threshold_mvccid,
+						       was_interrupted);
+  /* *INDENT-ON* */
+
+  vacuum_er_log (VACUUM_ER_LOG_WORKER | VACUUM_ER_LOG_HEAP, "Split vacuum of %d heap objects into %d sub-jobs.",
+		 worker->n_heap_objects, split_job->get_subjob_count ());
+  perfmon_inc_stat (thread_p, PSTAT_VAC_NUM_SPLIT_JOBS);
+
+  /* Push helpers only while worker pool has room; current worker executes any sub-job left by missing helpers. */
+  helper_count = split_job->get_subjob_count () - 1;
+  for (i = 0; i < helper_count && !cubthread::get_manager ()->is_pool_full (vacuum_Worker_threads); i++)
+    {
+      cubthread::get_manager ()->push_task (vacuum_Worker_threads, new vacuum_heap_helper_task (split_job));
+    }
+
+  while (split_job->execute_next_subjob (*thread_p))
+    {
+      /* continue */
+    }
+
+  /* Heap objects may be reused only after helpers are finished. */
+  return split_job->wait_finished ();
+}
+#endif /* SERVER_MODE */
+
 /*
  * vacuum_heap_page () - Vacuum objects in one heap page.
  *
@@ -3535,6 +3535,8 @@ xts_process_ls_merge_info (char *ptr, const QFILE_LIST_MERGE_INFO * qfile_list_m
 
   ptr = or_pack_int (ptr, qfile_list_merge_info->single_fetch);
 
+  ptr = or_pack_int (ptr, qfile_list_merge_info->hash_join);
+
   ptr = or_pack_int (ptr, qfile_list_merge_info->ls_column_cnt);
 
   offset = xts_save_int_array (qfile_list_merge_info->ls_outer_column, qfile_list_merge_info->ls_column_cnt);
@@ -6008,6 +6010,7 @@ xts_sizeof_ls_merge_info (const QFILE_LIST_MERGE_INFO * qfile_list_merge_info)
 
   size += (OR_INT_SIZE		/* join_type */
 	   + OR_INT_SIZE	/* single_fetch */
+	   + OR_INT_SIZE	/* hash_join */
 	   + OR_INT_SIZE	/* ls_column_cnt */
 	   + PTR_SIZE		/* ls_outer_column */
 	   + PTR_SIZE		/* ls_outer_unique */
@@ -1155,6 +1155,40 @@ typedef enum btree_rv_debug_id BTREE_RV_DEBUG_ID;
 /* logging btid */
 #define BTREE_ID_MSG "index = %d, %d|%d"
 
+/*
+ * Normalized key prefixes
+ *
+ * A normalized prefix is a fixed width integer image of the leading bytes of a key (or of the first midxkey column
+ * that is not common to all page keys), built so that comparing two prefixes gives the order of their keys whenever
+ * the prefixes are different. Page searches compare prefixes first and decode and compare the actual keys only on
+ * prefix ties.
+ *
+ * Prefixes are not stored in pages. Each thread keeps the prefixes of a few recently searched pages, identified by
+ * VPID and page LSA. Any change of a page changes its LSA, so inserts, splits and merges invalidate the prefixes.
+ */
+#define BTREE_KEY_PREFIX_CACHE_PAGES 16
+/* pages with fewer keys are cheap enough to binary search the usual way */
+#define BTREE_KEY_PREFIX_MIN_KEYS 8
+
+typedef struct btree_key_prefix_page BTREE_KEY_PREFIX_PAGE;
+struct btree_key_prefix_page
+{
+  VPID vpid;			/* page identifier */
+  LOG_LSA lsa;			/* page LSA when page was registered */
+  int key_cnt;			/* page key count */
+  int col;			/* normalized midxkey column */
+  bool is_built;		/* prefixes are built on the second search of an unchanged page */
+  int alloc_cnt;		/* allocated prefix count */
+  UINT64 *prefixes;		/* normalized prefix of each slot key */
+  bool *is_normalized;		/* false if slot key has no prefix (dummy key, overflow key, unsupported value) */
+};
+
+struct btree_key_prefix_cache
+{
+  BTREE_KEY_PREFIX_PAGE pages[BTREE_KEY_PREFIX_CACHE_PAGES];
+  int next_victim;
+};
+
 /* logging b-tree mvcc info */
 #define BTREE_MVCC_INFO_AS_ARGS(mvcc_info) \
   (unsigned long long) BTREE_MVCC_INFO_INSID (mvcc_info), (unsigned long long) BTREE_MVCC_INFO_DELID (mvcc_info)
@@ -1298,6 +1332,12 @@ static int btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAG
 				   BTREE_SEARCH_KEY_HELPER * search_key);
 static int btree_leaf_is_key_between_min_max (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf,
 					      DB_VALUE * key, BTREE_SEARCH_KEY_HELPER * search_key);
+static bool btree_key_normalize_value (DB_VALUE * value, TP_DOMAIN * domain, UINT64 * prefix);
+static bool btree_key_normalize_prefix (DB_VALUE * key, TP_DOMAIN * key_domain, int col, UINT64 * prefix);
+static BTREE_KEY_PREFIX_PAGE *btree_key_prefix_get_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr,
+							 BTREE_NODE_TYPE node_type, int key_cnt, int col);
+static int btree_key_prefix_build_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr,
+					BTREE_NODE_TYPE node_type, BTREE_KEY_PREFIX_PAGE * prefix_page);
 static int xbtree_test_unique (THREAD_ENTRY * thread_p, BTID * btid);
 #if defined(ENABLE_UNUSED_FUNCTION)
 static int btree_get_subtree_stats (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pg_ptr, BTREE_STATS_ENV * env);
@@ -4961,6 +5001,400 @@ btree_initialize_new_page (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args)
   return NO_ERROR;
 }
 
+/*
+ * btree_key_normalize_value () - Get normalized prefix of a single key value.
+ *
+ * return      : True if value was normalized, false if its type or collation is not supported.
+ * value (in)  : Key value.
+ * domain (in) : Value domain in index.
+ * prefix (out): Normalized prefix; if two prefixes are different, they have the order of their values.
+ */
+static bool
+btree_key_normalize_value (DB_VALUE * value, TP_DOMAIN * domain, UINT64 * prefix)
+{
+  const unsigned char *str;
+  int size, i;
+  UINT64 bytes;
+
+  if (DB_IS_NULL (value))
+    {
+      /* null is ordered before any value */
+      *prefix = 0;
+      return true;
+    }
+
+  switch (TP_DOMAIN_TYPE (domain))
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+      switch (DB_VALUE_DOMAIN_TYPE (value))
+	{
+	case DB_TYPE_SHORT:
+	  *prefix = (UINT64) (DB_BIGINT) db_get_short (value);
+	  break;
+	case DB_TYPE_INTEGER:
+	  *prefix = (UINT64) (DB_BIGINT) db_get_int (value);
+	  break;
+	case DB_TYPE_BIGINT:
+	  *prefix = (UINT64) db_get_bigint (value);
+	  break;
+	default:
+	  return false;
+	}
+      /* flip sign bit to order negative values before positive values */
+      *prefix ^= ((UINT64) 1) << 63;
+      return true;
+
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+      /* only binary collations order strings by their bytes; trailing spaces are ignored by all of them */
+      if (domain->collation_id != LANG_COLL_ISO_BINARY && domain->collation_id != LANG_COLL_UTF8_BINARY
+	  && domain->collation_id != LANG_COLL_BINARY)
+	{
+	  return false;
+	}
+      if (!TP_IS_CHAR_TYPE (DB_VALUE_DOMAIN_TYPE (value)) || db_get_string_collation (value) != domain->collation_id)
+	{
+	  return false;
+	}
+      if (value->data.ch.info.is_max_string)
+	{
+	  *prefix = ~((UINT64) 0);
+	  return true;
+	}
+
+      str = REINTERPRET_CAST (const unsigned char *, db_get_string (value));
+      size = db_get_string_size (value);
+      if (str == NULL)
+	{
+	  return false;
+	}
+      if (size < 0)
+	{
+	  size = (int) strlen ((const char *) str);
+	}
+
+      /* missing bytes are padded with zero, like the compare functions of binary collations do */
+      for (i = 0, bytes = 0; i < (int) sizeof (bytes); i++)
+	{
+	  unsigned char c = i < size ? str[i] : 0;
+
+	  if (c == ' ' && domain->collation_id != LANG_COLL_BINARY)
+	    {
+	      /* space is the smallest character */
+	      c = 0;
+	    }
+	  bytes = (bytes << 8) | c;
+	}
+      *prefix = bytes;
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * btree_key_normalize_prefix () - Get normalized prefix of a b-tree key.
+ *
+ * return	   : True if key was normalized.
+ * key (in)	   : Key.
+ * key_domain (in) : Index key domain.
+ * col (in)	   : Normalized column for midxkey; all columns before it must be equal for all compared keys.
+ * prefix (out)    : Normalized prefix.
+ */
+static bool
+btree_key_normalize_prefix (DB_VALUE * key, TP_DOMAIN * key_domain, int col, UINT64 * prefix)
+{
+  DB_MIDXKEY *midxkey;
+  TP_DOMAIN *col_domain;
+  DB_VALUE col_value;
+  int i;
+
+  if (TP_DOMAIN_TYPE (key_domain) != DB_TYPE_MIDXKEY)
+    {
+      if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY || !btree_key_normalize_value (key, key_domain, prefix))
+	{
+	  return false;
+	}
+      if (key_domain->is_desc)
+	{
+	  *prefix = ~*prefix;
+	}
+      return true;
+    }
+
+  if (DB_VALUE_DOMAIN_TYPE (key) != DB_TYPE_MIDXKEY)
+    {
+      return false;
+    }
+  midxkey = db_get_midxkey (key);
+  if (midxkey == NULL || midxkey->domain == NULL || col >= midxkey->ncolumns)
+    {
+      return false;
+    }
+
+  for (i = 0, col_domain = key_domain->setdomain; i < col && col_domain != NULL; i++)
+    {
+      col_domain = col_domain->next;
+    }
+  if (col_domain == NULL)
+    {
+      return false;
+    }
+
+  if (!OR_MULTI_ATT_IS_BOUND (midxkey->buf, col))
+    {
+      /* null; or min/max marker of a range search key. null < min < any value < max */
+      if (midxkey->min_max_val.position == col && midxkey->min_max_val.type == MAX_COLUMN)
+	{
+	  *prefix = ~((UINT64) 0);
+	}
+      else
+	{
+	  *prefix = 0;
+	}
+    }
+  else
+    {
+      if (pr_midxkey_get_element_nocopy (midxkey, col, &col_value, NULL, NULL) != NO_ERROR)
+	{
+	  return false;
+	}
+      if (!btree_key_normalize_value (&col_value, col_domain, prefix))
+	{
+	  return false;
+	}
+    }
+
+  if (col_domain->is_desc)
+    {
+      *prefix = ~*prefix;
+    }
+  return true;
+}
+
+/*
+ * btree_key_prefix_get_page () - Get normalized key prefixes of page from thread cache.
+ *
+ * return	  : Page prefixes or NULL if they are not available.
+ * thread_p (in)  : Thread entry.
+ * btid (in)	  : B-tree info.
+ * page_ptr (in)  : B-tree node.
+ * node_type (in) : Node type.
+ * key_cnt (in)	  : Node key count.
+ * col (in)	  : Normalized midxkey column.
+ *
+ * Note: A page is registered on first search and its prefixes are built on the next search if page did not change
+ *	 meanwhile. Pages that are visited only once (e.g. leaves of a range scan) do not pay for building prefixes.
+ */
+static BTREE_KEY_PREFIX_PAGE *
+btree_key_prefix_get_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, BTREE_NODE_TYPE node_type,
+			   int key_cnt, int col)
+{
+  BTREE_KEY_PREFIX_CACHE *cache;
+  BTREE_KEY_PREFIX_PAGE *prefix_page = NULL;
+  VPID *vpid;
+  LOG_LSA *page_lsa;
+  int i;
+
+  if (key_cnt < BTREE_KEY_PREFIX_MIN_KEYS || !prm_get_bool_value (PRM_ID_BT_KEY_PREFIX_SEARCH))
+    {
+      return NULL;
+    }
+
+  /* a writer may search a page it has changed but not yet logged; use prefixes only when page cannot be changed */
+  if (pgbuf_get_latch_mode (page_ptr) != PGBUF_LATCH_READ)
+    {
+      return NULL;
+    }
+  page_lsa = pgbuf_get_lsa (page_ptr);
+  if (page_lsa == NULL || LSA_ISNULL (page_lsa))
+    {
+      return NULL;
+    }
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  cache = thread_p->btree_key_prefix_cache;
+  if (cache == NULL)
+    {
+      cache = (BTREE_KEY_PREFIX_CACHE *) calloc (1, sizeof (BTREE_KEY_PREFIX_CACHE));
+      if (cache == NULL)
+	{
+	  /* optimization only; search without prefixes */
+	  return NULL;
+	}
+      for (i = 0; i < BTREE_KEY_PREFIX_CACHE_PAGES; i++)
+	{
+	  VPID_SET_NULL (&cache->pages[i].vpid);
+	}
+      thread_p->btree_key_prefix_cache = cache;
+    }
+
+  vpid = pgbuf_get_vpid_ptr (page_ptr);
+  for (i = 0; i < BTREE_KEY_PREFIX_CACHE_PAGES; i++)
+    {
+      if (VPID_EQ (&cache->pages[i].vpid, vpid))
+	{
+	  prefix_page = &cache->pages[i];
+	  break;
+	}
+    }
+
+  if (prefix_page != NULL && LSA_EQ (&prefix_page->lsa, page_lsa) && prefix_page->key_cnt == key_cnt
+      && prefix_page->col == col)
+    {
+      if (!prefix_page->is_built)
+	{
+	  if (btree_key_prefix_build_page (thread_p, btid, page_ptr, node_type, prefix_page) != NO_ERROR)
+	    {
+	      VPID_SET_NULL (&prefix_page->vpid);
+	      return NULL;
+	    }
+	  prefix_page->is_built = true;
+	}
+      return prefix_page;
+    }
+
+  if (prefix_page == NULL)
+    {
+      prefix_page = &cache->pages[cache->next_victim];
+      cache->next_victim = (cache->next_victim + 1) % BTREE_KEY_PREFIX_CACHE_PAGES;
+    }
+
+  /* register page (or its new version) */
+  prefix_page->vpid = *vpid;
+  LSA_COPY (&prefix_page->lsa, page_lsa);
+  prefix_page->key_cnt = key_cnt;
+  prefix_page->col = col;
+  prefix_page->is_built = false;
+  return NULL;
+}
+
+/*
+ * btree_key_prefix_build_page () - Build normalized prefixes of all page keys.
+ *
+ * return	     : Error code.
+ * thread_p (in)     : Thread entry.
+ * btid (in)	     : B-tree info.
+ * page_ptr (in)     : B-tree node.
+ * node_type (in)    : Node type.
+ * prefix_page (in)  : Cached page prefixes.
+ */
+static int
+btree_key_prefix_build_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, BTREE_NODE_TYPE node_type,
+			     BTREE_KEY_PREFIX_PAGE * prefix_page)
+{
+  RECDES rec;
+  DB_VALUE key;
+  bool clear_key = false;
+  LEAF_REC leaf_rec;
+  NON_LEAF_REC non_leaf_rec;
+  void *rec_header;
+  int slot_id, offset;
+  int error = NO_ERROR;
+
+  if (prefix_page->alloc_cnt < prefix_page->key_cnt + 1)
+    {
+      UINT64 *new_prefixes;
+      bool *new_is_normalized;
+      int new_alloc_cnt = prefix_page->key_cnt + 1;
+
+      new_prefixes = (UINT64 *) realloc (prefix_page->prefixes, new_alloc_cnt * sizeof (UINT64));
+      if (new_prefixes == NULL)
+	{
+	  return ER_FAILED;
+	}
+      prefix_page->prefixes = new_prefixes;
+
+      new_is_normalized = (bool *) realloc (prefix_page->is_normalized, new_alloc_cnt * sizeof (bool));
+      if (new_is_normalized == NULL)
+	{
+	  return ER_FAILED;
+	}
+      prefix_page->is_normalized = new_is_normalized;
+      prefix_page->alloc_cnt = new_alloc_cnt;
+    }
+
+  btree_init_temp_key_value (&clear_key, &key);
+  rec_header = (node_type == BTREE_LEAF_NODE) ? (void *) &leaf_rec : (void *) &non_leaf_rec;
+
+  prefix_page->is_normalized[0] = false;
+  for (slot_id = 1; slot_id <= prefix_page->key_cnt; slot_id++)
+    {
+      prefix_page->is_normalized[slot_id] = false;
+
+      if (spage_get_record (thread_p, page_ptr, slot_id, &rec, PEEK) != S_SUCCESS)
+	{
+	  assert (false);
+	  return ER_FAILED;
+	}
+
+      if (node_type == BTREE_LEAF_NODE)
+	{
+	  if (btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_OVERFLOW_KEY))
+	    {
+	      /* do not fix overflow pages; key is compared when probed */
+	      continue;
+	    }
+	}
+      else
+	{
+	  if (slot_id == 1)
+	    {
+	      /* dummy key */
+	      continue;
+	    }
+	  btree_read_fixed_portion_of_non_leaf_record (&rec, &non_leaf_rec);
+	  if (non_leaf_rec.key_len < 0)
+	    {
+	      /* overflow key */
+	      continue;
+	    }
+	}
+
+      error = btree_read_record_without_decompression (thread_p, btid, &rec, &key, rec_header, node_type, &clear_key,
+						       &offset, PEEK_KEY_VALUE);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      prefix_page->is_normalized[slot_id] =
+	btree_key_normalize_prefix (&key, btid->key_type, prefix_page->col, &prefix_page->prefixes[slot_id]);
+      btree_clear_key_value (&clear_key, &key);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_key_prefix_cache_free () - Free normalized key prefixes cached by a thread.
+ *
+ * return     : Void.
+ * cache (in) : Thread cache.
+ */
+void
+btree_key_prefix_cache_free (BTREE_KEY_PREFIX_CACHE * cache)
+{
+  int i;
+
+  if (cache == NULL)
+    {
+      return;
+    }
+  for (i = 0; i < BTREE_KEY_PREFIX_CACHE_PAGES; i++)
+    {
+      free_and_init (cache->pages[i].prefixes);
+      free_and_init (cache->pages[i].is_normalized);
+    }
+  free (cache);
+}
+
 /*
  * btree_search_nonleaf_page () -
  *   return: NO_ERROR
@@ -4987,6 +5421,9 @@ btree_search_nonleaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pa
   DB_VALUE temp_key;
   RECDES rec;
   NON_LEAF_REC non_leaf_rec;
+  BTREE_KEY_PREFIX_PAGE *prefix_page = NULL;
+  UINT64 key_prefix;
+  bool is_middle_read = false;
 
   /* initialize child page identifier */
   VPID_SET_NULL (child_vpid);
@@ -5035,6 +5472,11 @@ btree_search_nonleaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pa
   /* for non-compressed midxkey; separator is not compressed */
   left_start_col = right_start_col = 0;
 
+  if (btree_key_normalize_prefix (key, btid->key_type, 0, &key_prefix))
+    {
+      prefix_page = btree_key_prefix_get_page (thread_p, btid, page_ptr, BTREE_NON_LEAF_NODE, key_cnt, 0);
+    }
+
   left = 2;			/* Ignore dummy key (neg-inf or 1st key) */
   right = key_cnt;
 
@@ -5044,6 +5486,29 @@ btree_search_nonleaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pa
 
       middle = CEIL_PTVDIV ((left + right), 2);	/* get the middle record */
 
+      if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
+	{
+	  start_col = MIN (left_start_col, right_start_col);
+	}
+
+      if (prefix_page != NULL && prefix_page->is_normalized[middle] && prefix_page->prefixes[middle] != key_prefix)
+	{
+	  /* prefixes decide; no need to read the key */
+	  c = (key_prefix < prefix_page->prefixes[middle]) ? DB_LT : DB_GT;
+	  is_middle_read = false;
+	  if (c < 0)
+	    {
+	      right = middle - 1;
+	      right_start_col = start_col;
+	    }
+	  else
+	    {
+	      left = middle + 1;
+	      left_start_col = start_col;
+	    }
+	  continue;
+	}
+
       assert (middle > 0);
       if (spage_get_record (thread_p, page_ptr, middle, &rec, PEEK) != S_SUCCESS)
 	{
@@ -5055,11 +5520,7 @@ btree_search_nonleaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pa
 	{
 	  return ER_FAILED;
 	}
-
-      if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
-	{
-	  start_col = MIN (left_start_col, right_start_col);
-	}
+      is_middle_read = true;
 
       c = btree_compare_key (key, &temp_key, btid->key_type, 1, 1, &start_col);
 
@@ -5098,6 +5559,20 @@ btree_search_nonleaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pa
 	}
     }
 
+  if (!is_middle_read)
+    {
+      /* last compare was decided by prefixes; child pointer and page bounds need the middle record */
+      if (spage_get_record (thread_p, page_ptr, middle, &rec, PEEK) != S_SUCCESS)
+	{
+	  return ER_FAILED;
+	}
+      if (btree_read_record_without_decompression (thread_p, btid, &rec, &temp_key, &non_leaf_rec, BTREE_NON_LEAF_NODE,
+						   &clear_key, &offset, PEEK_KEY_VALUE) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
   if (c < 0)
     {
       /* child page is the one pointed by the record left to the middle */
@@ -5337,6 +5812,9 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
   bool is_record_read = false;
   LEAF_REC leaf_pnt;
   int error = NO_ERROR;
+  BTREE_KEY_PREFIX_PAGE *prefix_page = NULL;
+  UINT64 key_prefix;
+  bool is_middle_read = false;
 
   /* Assert expected arguments. */
   assert (btid != NULL);
@@ -5394,6 +5872,12 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
    * located to preserve the order of keys
    */
 
+  /* Normalized prefixes of compressed midxkeys start with the first column that is not common to all keys. */
+  if (btree_key_normalize_prefix (key, btid->key_type, n_prefix, &key_prefix))
+    {
+      prefix_page = btree_key_prefix_get_page (thread_p, btid, page_ptr, BTREE_LEAF_NODE, key_cnt, n_prefix);
+    }
+
   /* Initialize binary search range to first and last key in page. */
   left = 1;
   right = key_cnt;
@@ -5406,6 +5890,29 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
       /* Safe guard. */
       assert (middle > 0);
 
+      if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
+	{
+	  start_col = MIN (left_start_col, right_start_col);
+	}
+
+      if (prefix_page != NULL && prefix_page->is_normalized[middle] && prefix_page->prefixes[middle] != key_prefix)
+	{
+	  /* Prefixes decide; no need to read the key. Since prefixes differ, key cannot be equal to a fence key. */
+	  c = (key_prefix < prefix_page->prefixes[middle]) ? DB_LT : DB_GT;
+	  is_middle_read = false;
+	  if (c < 0)
+	    {
+	      right = middle - 1;
+	      right_start_col = start_col;
+	    }
+	  else
+	    {
+	      left = middle + 1;
+	      left_start_col = start_col;
+	    }
+	  continue;
+	}
+
       /* Get current middle key. */
       if (spage_get_record (thread_p, page_ptr, middle, &rec, PEEK) != S_SUCCESS)
 	{
@@ -5426,11 +5933,7 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
 	}
 
       is_record_read = true;
-
-      if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
-	{
-	  start_col = MIN (left_start_col, right_start_col);
-	}
+      is_middle_read = true;
 
       /* Compare searched key with current middle key. */
       c = btree_compare_key (key, &temp_key, btid->key_type, 1, 1, &start_col);
@@ -5493,6 +5996,17 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
 	}
     }
 
+  if (middle > 0 && !is_middle_read)
+    {
+      /* last compare was decided by prefixes; fence flag is checked on the middle record */
+      if (spage_get_record (thread_p, page_ptr, middle, &rec, PEEK) != S_SUCCESS)
+	{
+	  assert (false);
+	  return ER_FAILED;
+	}
+      is_record_read = true;
+    }
+
   if (c < 0)
     {
       if (is_record_read && btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_FENCE))
@@ -856,4 +856,8 @@ extern int btree_online_index_check_unique_constraint (THREAD_ENTRY * thread_p,
 extern int btree_get_class_oid_of_unique_btid (THREAD_ENTRY * thread_p, BTID * btid, OID * class_oid);
 extern bool btree_is_btid_online_index (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid);
 
+/* normalized key prefixes of recently searched pages, kept by each thread */
+typedef struct btree_key_prefix_cache BTREE_KEY_PREFIX_CACHE;
+extern void btree_key_prefix_cache_free (BTREE_KEY_PREFIX_CACHE * cache);
+
 #endif /* _BTREE_H_ */
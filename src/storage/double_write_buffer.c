@@ -26,6 +26,12 @@
 #include <assert.h>
 #include <math.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "double_write_buffer.h"
 
 #include "system_parameter.h"
@@ -218,6 +224,7 @@ struct double_write_block
 
   char *write_buffer;		/* The block write buffer, used to write all pages once. */
   DWB_SLOT *slots;		/* The slots containing the data. Used to write individual pages. */
+  FILEIO_ASYNC_QUEUE *io_queue;	/* Queue used to write the slots to their home location. */
   volatile unsigned int count_wb_pages;	/* Count the pages added to write buffer. */
 
   unsigned int block_no;	/* The block number. */
@@ -351,6 +358,9 @@ STATIC_INLINE int dwb_block_create_ordered_slots (DWB_BLOCK * block, DWB_SLOT **
 static int dwb_compare_vol_fd (const void *v1, const void *v2);
 STATIC_INLINE FLUSH_VOLUME_INFO *dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
 								     int vol_fd) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int dwb_write_queued_pages (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
+					  FLUSH_VOLUME_INFO * flush_volume_info, int *count_writes)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_slots,
 				   unsigned int ordered_slots_length, bool file_sync_helper_can_flush,
 				   bool remove_from_hash) __attribute__ ((ALWAYS_INLINE));
@@ -374,8 +384,9 @@ STATIC_INLINE void dwb_initialize_slot (DWB_SLOT * slot, FILEIO_PAGE * io_page,
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void dwb_initialize_block (DWB_BLOCK * block, unsigned int block_no,
 					 unsigned int count_wb_pages, char *write_buffer, DWB_SLOT * slots,
-					 FLUSH_VOLUME_INFO * flush_volumes_info, unsigned int count_flush_volumes_info,
-					 unsigned int max_to_flush_vdes) __attribute__ ((ALWAYS_INLINE));
+					 FILEIO_ASYNC_QUEUE * io_queue, FLUSH_VOLUME_INFO * flush_volumes_info,
+					 unsigned int count_flush_volumes_info, unsigned int max_to_flush_vdes)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned int num_block_pages,
 				     DWB_BLOCK ** p_blocks) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void dwb_finalize_block (DWB_BLOCK * block) __attribute__ ((ALWAYS_INLINE));
@@ -400,6 +411,101 @@ STATIC_INLINE int dwb_slots_hash_delete (THREAD_ENTRY * thread_p, DWB_SLOT * slo
 #if defined (SERVER_MODE)
 static cubthread::daemon *dwb_flush_block_daemon = NULL;
 static cubthread::daemon *dwb_file_sync_helper_daemon = NULL;
+static cubthread::entry_workpool *dwb_volume_sync_workers = NULL;
+
+// class dwb_volume_sync_job
+//
+//  description:
+//    volumes claimed by dwb flush thread after writing a block to home locations. the flush thread and helper workers
+//    claim volumes until none is left and synchronize them in parallel; the flush thread waits for all of them before
+//    it releases the block.
+//
+class dwb_volume_sync_job
+{
+  public:
+    dwb_volume_sync_job ()
+      : m_volumes ()
+      , m_next_volume { 0 }
+      , m_finished_count (0)
+      , m_mutex ()
+      , m_cond_finished ()
+    {
+    }
+
+    // add a volume to synchronize; must be called before the job is shared with helpers
+    void add_volume (int vdes)
+    {
+      m_volumes.push_back (vdes);
+    }
+
+    // claim and synchronize one volume; return false if all volumes were claimed
+    bool sync_next_volume (cubthread::entry &thread_ref)
+    {
+      std::size_t index = m_next_volume++;
+      if (index >= m_volumes.size ())
+	{
+	  return false;
+	}
+
+      (void) fileio_synchronize (&thread_ref, m_volumes[index], NULL, FILEIO_SYNC_ONLY);
+      dwb_log ("dwb_volume_sync_job: Synchronized volume %d\n", m_volumes[index]);
+
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      if (++m_finished_count == m_volumes.size ())
+	{
+	  m_cond_finished.notify_all ();
+	}
+      return true;
+    }
+
+    // wait for all volumes to be synchronized
+    void wait_finished ()
+    {
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      m_cond_finished.wait (ulock, [this] { return m_finished_count == m_volumes.size (); });
+    }
+
+    std::size_t get_volume_count () const
+    {
+      return m_volumes.size ();
+    }
+
+  private:
+    std::vector<int> m_volumes;
+    std::atomic<std::size_t> m_next_volume;
+    std::size_t m_finished_count;           // protected by m_mutex
+    std::mutex m_mutex;
+    std::condition_variable m_cond_finished;
+};
+
+// class dwb_volume_sync_helper_task
+//
+//  description:
+//    task pushed to volume sync workers to help dwb flush thread synchronize volumes
+//
+class dwb_volume_sync_helper_task : public cubthread::entry_task
+{
+  public:
+    dwb_volume_sync_helper_task (const std::shared_ptr<dwb_volume_sync_job> &sync_job)
+      : m_sync_job (sync_job)
+    {
+    }
+
+    void execute (cubthread::entry &thread_ref) final
+    {
+      while (m_sync_job->sync_next_volume (thread_ref))
+	{
+	  perfmon_inc_stat (&thread_ref, PSTAT_FILE_NUM_DWB_HELPER_IOSYNCHES);
+	}
+    }
+
+  private:
+    dwb_volume_sync_helper_task ();
+
+    std::shared_ptr<dwb_volume_sync_job> m_sync_job;
+};
+
+static void dwb_synchronize_volumes (THREAD_ENTRY * thread_p, const std::shared_ptr<dwb_volume_sync_job> &sync_job);
 #endif
 // *INDENT-ON*
 
@@ -956,14 +1062,15 @@ dwb_initialize_slot (DWB_SLOT * slot, FILEIO_PAGE * io_page, unsigned int positi
  * count_wb_pages (in): Count DWB pages.
  * write_buffer(in): The write buffer.
  * slots(in): The slots.
+ * io_queue(in): The queue used to write the slots.
  * flush_volumes_info(in): The area containing volume descriptors to flush.
  * count_flush_volumes_info(in): Count volumes to flush.
  * max_to_flush_vdes(in): The maximum volumes to flush.
  */
 STATIC_INLINE void
 dwb_initialize_block (DWB_BLOCK * block, unsigned int block_no, unsigned int count_wb_pages, char *write_buffer,
-		      DWB_SLOT * slots, FLUSH_VOLUME_INFO * flush_volumes_info, unsigned int count_flush_volumes_info,
-		      unsigned int max_to_flush_vdes)
+		      DWB_SLOT * slots, FILEIO_ASYNC_QUEUE * io_queue, FLUSH_VOLUME_INFO * flush_volumes_info,
+		      unsigned int count_flush_volumes_info, unsigned int max_to_flush_vdes)
 {
   assert (block != NULL);
 
@@ -976,6 +1083,7 @@ dwb_initialize_block (DWB_BLOCK * block, unsigned int block_no, unsigned int cou
 
   block->write_buffer = write_buffer;
   block->slots = slots;
+  block->io_queue = io_queue;
   block->count_wb_pages = count_wb_pages;
   block->block_no = block_no;
   block->version = 0;
@@ -999,6 +1107,7 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
   char *blocks_write_buffer[DWB_MAX_BLOCKS];
   FLUSH_VOLUME_INFO *flush_volumes_info[DWB_MAX_BLOCKS];
   DWB_SLOT *slots[DWB_MAX_BLOCKS];
+  FILEIO_ASYNC_QUEUE *io_queues[DWB_MAX_BLOCKS];
   unsigned int block_buffer_size, i, j;
   int error_code;
   FILEIO_PAGE *io_page;
@@ -1012,6 +1121,7 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
       blocks_write_buffer[i] = NULL;
       slots[i] = NULL;
       flush_volumes_info[i] = NULL;
+      io_queues[i] = NULL;
     }
 
   blocks = (DWB_BLOCK *) malloc (num_blocks * sizeof (DWB_BLOCK));
@@ -1061,6 +1171,16 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
       memset (flush_volumes_info[i], 0, num_block_pages * sizeof (FLUSH_VOLUME_INFO));
     }
 
+  for (i = 0; i < num_blocks; i++)
+    {
+      io_queues[i] = fileio_async_queue_create (num_block_pages, IO_PAGESIZE, FILEIO_WRITE_NO_COMPENSATE_WRITE);
+      if (io_queues[i] == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto exit_on_error;
+	}
+    }
+
   for (i = 0; i < num_blocks; i++)
     {
       /* No need to initialize FILEIO_PAGE header here, since is overwritten before flushing */
@@ -1072,8 +1192,8 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
 	  dwb_initialize_slot (&slots[i][j], io_page, j, i);
 	}
 
-      dwb_initialize_block (&blocks[i], i, 0, blocks_write_buffer[i], slots[i], flush_volumes_info[i], 0,
-			    num_block_pages);
+      dwb_initialize_block (&blocks[i], i, 0, blocks_write_buffer[i], slots[i], io_queues[i], flush_volumes_info[i],
+			    0, num_block_pages);
     }
 
   *p_blocks = blocks;
@@ -1097,6 +1217,12 @@ exit_on_error:
 	{
 	  free_and_init (flush_volumes_info[i]);
 	}
+
+      if (io_queues[i] != NULL)
+	{
+	  fileio_async_queue_destroy (io_queues[i]);
+	  io_queues[i] = NULL;
+	}
     }
 
   if (blocks != NULL)
@@ -1129,6 +1255,11 @@ dwb_finalize_block (DWB_BLOCK * block)
     {
       free_and_init (block->flush_volumes_info);
     }
+  if (block->io_queue != NULL)
+    {
+      fileio_async_queue_destroy (block->io_queue);
+      block->io_queue = NULL;
+    }
 
   dwb_destroy_wait_queue (&block->wait_queue, &block->mutex);
 
@@ -1975,6 +2106,53 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
   return flush_new_volume_info;
 }
 
+/*
+ * dwb_write_queued_pages () - Write the pages queued on block I/O queue.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * block(in): The block that is written.
+ * flush_volume_info(in): The volume of queued pages.
+ * count_writes(in/out): Incremented with the number of written pages.
+ *
+ *  Note: Queued pages are sorted and contiguous pages are coalesced in a single write. All writes are issued before
+ *        waiting for any of them.
+ */
+STATIC_INLINE int
+dwb_write_queued_pages (THREAD_ENTRY * thread_p, DWB_BLOCK * block, FLUSH_VOLUME_INFO * flush_volume_info,
+			int *count_writes)
+{
+  int num_pages;
+  int error_code;
+
+  assert (block != NULL && block->io_queue != NULL && flush_volume_info != NULL && count_writes != NULL);
+
+  num_pages = fileio_async_queue_count (block->io_queue);
+  if (num_pages == 0)
+    {
+      return NO_ERROR;
+    }
+
+  error_code = fileio_async_wait_all (thread_p, block->io_queue);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      dwb_log_error ("DWB write %d pages of volume %d with %d error: \n", num_pages, flush_volume_info->vdes,
+		     error_code);
+      assert (false);
+      return error_code;
+    }
+
+  dwb_log ("dwb_write_queued_pages: written %d pages of volume %d\n", num_pages, flush_volume_info->vdes);
+
+#if defined (SERVER_MODE)
+  ATOMIC_INC_32 (&flush_volume_info->num_pages, num_pages);
+#endif
+  *count_writes += num_pages;
+
+  return NO_ERROR;
+}
+
 /*
  * dwb_write_block () - Write block pages in specified order.
  *
@@ -1986,7 +2164,9 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
  * remove_from_hash(in): True, if needs to remove entries from hash.
  * file_sync_helper_can_flush(in): True, if helper can flush.
  *
- *  Note: This function fills to_flush_vdes array with the volumes that must be flushed.
+ *  Note: This function fills to_flush_vdes array with the volumes that must be flushed. The pages of a volume are
+ *        queued and written together, in batches of at most PRM_ID_PB_SYNC_ON_NFLUSH pages, so the file sync helper
+ *        can synchronize the volume while the next batch is written.
  */
 STATIC_INLINE int
 dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
@@ -2011,6 +2191,7 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 
   assert (block->count_wb_pages < ordered_slots_length);
   assert (block->count_flush_volumes_info == 0);
+  assert (fileio_async_queue_count (block->io_queue) == 0);
 
   num_pages_to_sync = prm_get_integer_value (PRM_ID_PB_SYNC_ON_NFLUSH);
 
@@ -2033,6 +2214,14 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 	  if (current_flush_volume_info != NULL)
 	    {
 	      assert_release (current_flush_volume_info->vdes == last_written_vol_fd);
+
+	      /* Finish the writes of previous volume before announcing it to file sync helper. */
+	      error_code = dwb_write_queued_pages (thread_p, block, current_flush_volume_info, &count_writes);
+	      if (error_code != NO_ERROR)
+		{
+		  return error_code;
+		}
+
 	      current_flush_volume_info->all_pages_written = true;
 	      can_flush_volume = true;
 
@@ -2060,29 +2249,32 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
       assert (p_dwb_ordered_slots[i].vpid.pageid == p_dwb_ordered_slots[i].io_page->prv.pageid
 	      && p_dwb_ordered_slots[i].vpid.volid == p_dwb_ordered_slots[i].io_page->prv.volid);
 
-      /* Write the data. */
-      if (fileio_write (thread_p, last_written_vol_fd, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
-			FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+      /* Queue the data. */
+      error_code = fileio_async_add (block->io_queue, FILEIO_ASYNC_WRITE, last_written_vol_fd,
+				     p_dwb_ordered_slots[i].io_page, vpid->pageid);
+      if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
-	  dwb_log_error ("DWB write page VPID=(%d, %d) LSA=(%lld,%d) with %d error: \n",
-			 vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
-			 (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset, er_errid ());
-	  assert (false);
-	  /* Something wrong happened. */
-	  return ER_FAILED;
+	  return error_code;
 	}
 
-      dwb_log ("dwb_write_block: written page = (%d,%d) LSA=(%lld,%d)\n",
+      dwb_log ("dwb_write_block: queued page = (%d,%d) LSA=(%lld,%d)\n",
 	       vpid->volid, vpid->pageid, p_dwb_ordered_slots[i].io_page->prv.lsa.pageid,
 	       (int) p_dwb_ordered_slots[i].io_page->prv.lsa.offset);
 
+      if (fileio_async_queue_count (block->io_queue) >= num_pages_to_sync)
+	{
+	  /* Write what we have, so the file sync helper may start synchronizing the volume. */
+	  error_code = dwb_write_queued_pages (thread_p, block, current_flush_volume_info, &count_writes);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
+
 #if defined (SERVER_MODE)
       assert (current_flush_volume_info != NULL);
 
-      ATOMIC_INC_32 (&current_flush_volume_info->num_pages, 1);
-      count_writes++;
-
       if (file_sync_helper_can_flush && (count_writes >= num_pages_to_sync || can_flush_volume == true)
 	  && dwb_is_file_sync_helper_daemon_available ())
 	{
@@ -2102,6 +2294,12 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   /* the last written volume */
   if (current_flush_volume_info != NULL)
     {
+      error_code = dwb_write_queued_pages (thread_p, block, current_flush_volume_info, &count_writes);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+
       current_flush_volume_info->all_pages_written = true;
     }
 
@@ -2184,6 +2382,9 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
 #if defined (SERVER_MODE)
   bool flush = false;
   PERF_UTIME_TRACKER time_track_file_sync_helper;
+  // *INDENT-OFF*
+  std::shared_ptr<dwb_volume_sync_job> sync_job;
+  // *INDENT-ON*
 #endif
 #if !defined (NDEBUG)
   DWB_BLOCK *saved_file_sync_helper_block = NULL;
@@ -2375,11 +2576,33 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
       num_pages = ATOMIC_TAS_32 (&block->flush_volumes_info[i].num_pages, 0);
       assert (num_pages != 0);
 
+#if defined (SERVER_MODE)
+      if (dwb_volume_sync_workers != NULL)
+	{
+	  /* Collect claimed volumes and synchronize them in parallel below. */
+	  if (sync_job == NULL)
+	    {
+	      // *INDENT-OFF*
+	      sync_job = std::make_shared<dwb_volume_sync_job> ();
+	      // *INDENT-ON*
+	    }
+	  sync_job->add_volume (block->flush_volumes_info[i].vdes);
+	  continue;
+	}
+#endif
+
       (void) fileio_synchronize (thread_p, block->flush_volumes_info[i].vdes, NULL, FILEIO_SYNC_ONLY);
 
       dwb_log ("dwb_flush_block: Synchronized volume %d\n", block->flush_volumes_info[i].vdes);
     }
 
+#if defined (SERVER_MODE)
+  if (sync_job != NULL)
+    {
+      dwb_synchronize_volumes (thread_p, sync_job);
+    }
+#endif
+
   /* Allow to file sync helper thread to finish. */
   block->all_pages_written = true;
 
@@ -3998,6 +4221,26 @@ dwb_file_sync_helper_daemon_init ()
   dwb_file_sync_helper_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task);
 }
 
+/*
+ * dwb_volume_sync_workers_init () - initialize DWB volume sync worker pool
+ */
+void
+dwb_volume_sync_workers_init ()
+{
+  int worker_count = prm_get_integer_value (PRM_ID_DWB_VOLUME_SYNC_WORKERS);
+
+  if (worker_count <= 0)
+    {
+      /* Volumes are synchronized by flush thread only. */
+      dwb_volume_sync_workers = NULL;
+      return;
+    }
+
+  dwb_volume_sync_workers =
+    cubthread::get_manager ()->create_worker_pool (worker_count, worker_count, "dwb volume sync workers", NULL, 1,
+						   false);
+}
+
 /*
  * dwb_daemons_init () - initialize DWB daemon threads
  */
@@ -4006,6 +4249,7 @@ dwb_daemons_init ()
 {
   dwb_flush_block_daemon_init ();
   dwb_file_sync_helper_daemon_init ();
+  dwb_volume_sync_workers_init ();
 }
 
 /*
@@ -4016,6 +4260,39 @@ dwb_daemons_destroy ()
 {
   cubthread::get_manager ()->destroy_daemon (dwb_flush_block_daemon);
   cubthread::get_manager ()->destroy_daemon (dwb_file_sync_helper_daemon);
+  cubthread::get_manager ()->destroy_worker_pool (dwb_volume_sync_workers);
+}
+
+/*
+ * dwb_synchronize_volumes () - synchronize volumes claimed by flush thread, in parallel with volume sync workers
+ *
+ * return   : Void.
+ * thread_p (in) : The thread entry.
+ * sync_job (in) : The volumes to synchronize.
+ *
+ *  Note: Volumes are synchronized when the function returns.
+ */
+static void
+dwb_synchronize_volumes (THREAD_ENTRY * thread_p, const std::shared_ptr<dwb_volume_sync_job> &sync_job)
+{
+  std::size_t i, helper_count;
+
+  assert (dwb_volume_sync_workers != NULL && sync_job->get_volume_count () > 0);
+
+  /* Push helpers only while worker pool has room; flush thread synchronizes any volume left by missing helpers. */
+  helper_count = sync_job->get_volume_count () - 1;
+  for (i = 0; i < helper_count && !cubthread::get_manager ()->is_pool_full (dwb_volume_sync_workers); i++)
+    {
+      cubthread::get_manager ()->push_task (dwb_volume_sync_workers, new dwb_volume_sync_helper_task (sync_job));
+    }
+
+  while (sync_job->sync_next_volume (*thread_p))
+    {
+      /* continue */
+    }
+
+  /* The block may be reused only after all its volumes are synchronized. */
+  sync_job->wait_finished ();
 }
 #endif /* SERVER_MODE */
 // *INDENT-ON*
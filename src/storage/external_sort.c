@@ -36,6 +36,7 @@
 #include "memory_alloc.h"
 #include "external_sort.h"
 #include "file_manager.h"
+#include "object_representation.h"
 #include "page_buffer.h"
 #include "log_manager.h"
 #include "disk_manager.h"
@@ -52,7 +53,12 @@
 #include "thread_entry_task.hpp"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info and thread_sleep
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 /* Estimate on number of pages in the multipage temporary file */
 #define SORT_MULTIPAGE_FILE_SIZE_ESTIMATE  20
@@ -299,6 +305,184 @@ static void sort_spage_dump (PAGE_PTR pgptr, int rec_p);
 
 static void sort_append (const void *pk0, const void *pk1);
 
+#if defined(SERVER_MODE)
+/* Parallel merging phase.
+ *
+ * Runs merged in the same stage of the merging phase into different output files are independent of each other; the
+ * stage is split in lanes (one lane for each output file) that are merged by the sorting thread and by helper workers
+ * at the same time, each with its own slice of the internal memory. Input sections are split in two halves: while
+ * records are merged from one half, the next pages of the run are read into the other half by a helper worker. The
+ * last stage produces a single ordered run and is done by the sorting thread only, but it still reads ahead.
+ */
+
+/* Maximum number of tasks queued in the merge worker pool for each worker */
+#define SORT_MERGE_MAX_TASKS_PER_WORKER 4
+
+/* Size of the area used to pass the error of a helper worker to the sorting thread */
+#define SORT_MERGE_ERROR_AREA_SIZE 1024
+
+// *INDENT-OFF*
+// sort_merge_worker_context - merge workers read and write temporary files on behalf of the sorting transaction
+class sort_merge_worker_context : public cubthread::entry_manager
+{
+  protected:
+    void on_create (context_type &context) override;
+    void on_retire (context_type &context) override;
+};
+
+// sort_read_request - read of the next pages of an input run into one half of an input section. it is claimed and
+//                     executed either by a helper worker ahead of time or by the merging thread when it needs the
+//                     pages, whichever comes first.
+class sort_read_request
+{
+  public:
+    sort_read_request ();
+
+    void prepare (VFID *vfid, int first_page, int num_pages, char *area);
+    void execute_if_queued (cubthread::entry &thread_ref);
+    int wait_done (cubthread::entry &thread_ref);
+
+  private:
+    enum
+    {
+      READ_IDLE,
+      READ_QUEUED,
+      READ_RUNNING,
+      READ_DONE
+    };
+
+    std::atomic<int> m_state;
+    VFID *m_vfid;
+    int m_first_page;
+    int m_num_pages;
+    char *m_area;
+    int m_error;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+};
+
+class sort_read_task : public cubthread::entry_task
+{
+  public:
+    sort_read_task (const std::shared_ptr<sort_read_request> &request);
+
+    void execute (cubthread::entry &thread_ref) override;
+
+  private:
+    std::shared_ptr<sort_read_request> m_request;
+};
+
+// sort_merge_run - run of an input file
+struct sort_merge_run
+{
+  VFID *vfid;
+  int first_page;
+  int num_pages;
+};
+
+// sort_run_merger - merges a group of runs using a given memory area. the merged run is written to a temporary file
+//                   or, if no output file is given, passed to the put function of the sort.
+class sort_run_merger
+{
+  public:
+    sort_run_merger (SORT_PARAM *sort_param, char *memory, int memory_pages);
+    ~sort_run_merger ();
+
+    int merge (cubthread::entry &thread_ref, const sort_merge_run *runs, int run_count, VFID *out_vfid,
+	       int *out_page, int *out_run_pages);
+
+  private:
+    struct input
+    {
+      VFID *vfid;
+      int next_page;		/* first page of the run not requested yet */
+      int left_pages;		/* pages of the run not requested yet */
+      char *area[2];		/* halves of the input section; second one is NULL if the section has a single page */
+      int area_pages;		/* size of each half */
+      int cur_area;		/* half that is merged */
+      int cur_pages;		/* pages loaded in the merged half */
+      int cur_bufno;		/* active page in the merged half */
+      char *cur_bufaddr;
+      int act_slot;
+      int last_slot;
+      bool is_prefetching;	/* the other half is being loaded */
+      int prefetch_pages;	/* pages loaded in the other half */
+      bool is_dup;		/* current record is equal to the record of another input */
+      RECDES rec;
+      RECDES long_rec;
+      std::shared_ptr<sort_read_request> prefetch;
+    };
+
+    int load_next_area (cubthread::entry &thread_ref, input &in, bool &is_loaded);
+    void start_prefetch (input &in);
+    int get_record (cubthread::entry &thread_ref, input &in);
+    int next_record (cubthread::entry &thread_ref, input &in, bool &has_record);
+    void insert_ordered (int index);
+    int output_to_file (VFID *out_vfid, cubthread::entry &thread_ref, const RECDES &rec, int *out_page,
+			int *out_run_pages);
+    void init_out_section ();
+    void wait_prefetches (cubthread::entry &thread_ref);
+
+    SORT_PARAM *m_sort_param;
+    char *m_memory;
+    int m_memory_pages;
+    input m_inputs[SORT_MAX_HALF_FILES];
+    int m_order[SORT_MAX_HALF_FILES];	/* inputs with records, ordered by their current record */
+    int m_order_count;
+    char *m_out_sectaddr;
+    int m_out_sectsize;
+    int m_out_bufno;
+};
+
+// sort_merge_stage_job - one stage of the merging phase that produces more than one run. lanes are claimed by the
+//                        sorting thread and by helper workers; executor i uses slice i of the internal memory.
+class sort_merge_stage_job
+{
+  public:
+    sort_merge_stage_job (SORT_PARAM *sort_param, int in_count, int out_half, int lane_count, int executor_count);
+
+    void execute_lanes (cubthread::entry &thread_ref, int executor);
+    int wait_finished (cubthread::entry &thread_ref);
+    const std::vector<int> &get_lane_runs (int lane) const;
+
+  private:
+    int merge_lane (cubthread::entry &thread_ref, sort_run_merger &merger, int lane);
+
+    SORT_PARAM *m_sort_param;
+    int m_in_count;
+    int m_out_half;
+    int m_lane_count;
+    int m_slice_pages;
+    std::vector<int> m_run_first_page[SORT_MAX_HALF_FILES];
+    std::vector<int> m_run_pages[SORT_MAX_HALF_FILES];
+    std::vector<int> m_lane_runs[SORT_MAX_HALF_FILES];
+    std::atomic<int> m_next_lane;
+    std::mutex m_mutex;
+    std::condition_variable m_cond_finished;
+    int m_finished_lanes;
+    std::atomic<int> m_error;
+    OR_ALIGNED_BUF (SORT_MERGE_ERROR_AREA_SIZE) m_error_area;	/* error of a helper worker */
+};
+
+class sort_merge_lane_task : public cubthread::entry_task
+{
+  public:
+    sort_merge_lane_task (const std::shared_ptr<sort_merge_stage_job> &job, int executor);
+
+    void execute (cubthread::entry &thread_ref) override;
+
+  private:
+    std::shared_ptr<sort_merge_stage_job> m_job;
+    int m_executor;
+};
+// *INDENT-ON*
+
+static sort_merge_worker_context *sort_Merge_worker_context = NULL;
+static cubthread::entry_workpool *sort_Merge_workers = NULL;
+
+static int sort_exphase_merge_parallel (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param);
+#endif /* SERVER_MODE */
+
 /*
  * sort_spage_initialize () - Initialize a slotted page
  *   return: void
@@ -1526,6 +1710,13 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 	    }
 	}
 
+#if defined(SERVER_MODE)
+      if (sort_Merge_workers != NULL)
+	{
+	  error = sort_exphase_merge_parallel (thread_p, sort_param);
+	}
+      else
+#endif /* SERVER_MODE */
       if (sort_param->option == SORT_ELIM_DUP)
 	{
 	  error = sort_exphase_merge_elim_dup (thread_p, sort_param);
@@ -4332,6 +4523,842 @@ bailout:
   return (error == SORT_PUT_STOP) ? NO_ERROR : error;
 }
 
+#if defined(SERVER_MODE)
+/*
+ * sort_exphase_merge_parallel () - Merge phase using merge workers
+ *   return: error code
+ *   sort_param(in): sort parameters
+ *
+ * Note: Produces the same runs on the same output files as sort_exphase_merge and sort_exphase_merge_elim_dup do;
+ *       the runs of each output file are merged by a different thread. See sort_merge_stage_job.
+ */
+static int
+sort_exphase_merge_parallel (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
+{
+  sort_merge_run runs[SORT_MAX_HALF_FILES];
+  int act_infiles;
+  int out_half;
+  int num_runs;
+  int lane_count;
+  int executor_count;
+  int len;
+  int temp;
+  int error = NO_ERROR;
+  int i, j;
+
+  assert (sort_Merge_workers != NULL);
+
+  out_half = (sort_param->in_half == 0) ? sort_param->half_files : 0;
+
+  /* While there are more than one input files with different runs to merge */
+  while ((act_infiles = sort_get_numpages_of_active_infiles (sort_param)) > 1)
+    {
+      /* Find how many runs will be produced in this stage */
+      num_runs = 0;
+      for (i = sort_param->in_half; i < sort_param->in_half + act_infiles; i++)
+	{
+	  len = sort_get_num_file_contents (&sort_param->file_contents[i]);
+	  if (len > num_runs)
+	    {
+	      num_runs = len;
+	    }
+	}
+
+      if (num_runs == 1)
+	{
+	  /* The very last run; merge it to the output of the sort using the whole internal memory */
+	  sort_run_merger merger (sort_param, sort_param->internal_memory, sort_param->tot_buffers);
+
+	  for (i = 0; i < act_infiles; i++)
+	    {
+	      j = sort_param->in_half + i;
+	      runs[i].vfid = &sort_param->temp[j];
+	      runs[i].first_page = 0;
+	      runs[i].num_pages = sort_param->file_contents[j].num_pages[sort_param->file_contents[j].first_run];
+	    }
+
+	  error = merger.merge (*thread_p, runs, act_infiles, NULL, NULL, NULL);
+	  break;
+	}
+
+      /* Check if output files has enough pages; if not allocate new pages */
+      error = sort_checkalloc_numpages_of_outfiles (thread_p, sort_param);
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  break;
+	}
+
+      /* One lane for each output file receiving runs; each executor needs at least one buffer for each input run and
+       * one for the output run */
+      lane_count = MIN (sort_param->half_files, num_runs);
+      executor_count = MIN (lane_count, prm_get_integer_value (PRM_ID_SORT_MERGE_WORKERS) + 1);
+      executor_count = MIN (executor_count, sort_param->tot_buffers / (act_infiles + 1));
+      executor_count = MAX (executor_count, 1);
+
+      // *INDENT-OFF*
+      std::shared_ptr<sort_merge_stage_job> job =
+        std::make_shared<sort_merge_stage_job> (sort_param, act_infiles, out_half, lane_count, executor_count);
+
+      for (i = 1; i < executor_count && !cubthread::get_manager ()->is_pool_full (sort_Merge_workers); i++)
+        {
+          cubthread::get_manager ()->push_task (sort_Merge_workers, new sort_merge_lane_task (job, i));
+        }
+      // *INDENT-ON*
+
+      job->execute_lanes (*thread_p, 0);
+      error = job->wait_finished (*thread_p);
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+
+      /* All input runs are consumed; register the produced runs to their output files */
+      for (i = sort_param->in_half; i < sort_param->in_half + sort_param->half_files; i++)
+	{
+	  sort_param->file_contents[i].first_run = -1;
+	}
+      for (i = 0; i < lane_count && error == NO_ERROR; i++)
+	{
+	  for (j = 0; j < (int) job->get_lane_runs (i).size (); j++)
+	    {
+	      error = sort_run_add_new (&sort_param->file_contents[out_half + i], job->get_lane_runs (i)[j]);
+	      if (error != NO_ERROR)
+		{
+		  break;
+		}
+	    }
+	}
+      if (error != NO_ERROR)
+	{
+	  break;
+	}
+
+      /* Exchange input and output file indices */
+      temp = sort_param->in_half;
+      sort_param->in_half = out_half;
+      out_half = temp;
+    }
+
+  return (error == SORT_PUT_STOP) ? NO_ERROR : error;
+}
+
+// *INDENT-OFF*
+void
+sort_merge_worker_context::on_create (context_type &context)
+{
+  context.claim_system_worker ();
+}
+
+void
+sort_merge_worker_context::on_retire (context_type &context)
+{
+  context.retire_system_worker ();
+}
+
+sort_read_request::sort_read_request ()
+  : m_state (READ_IDLE)
+  , m_vfid (NULL)
+  , m_first_page (0)
+  , m_num_pages (0)
+  , m_area (NULL)
+  , m_error (NO_ERROR)
+  , m_mutex ()
+  , m_cond ()
+{
+}
+
+void
+sort_read_request::prepare (VFID *vfid, int first_page, int num_pages, char *area)
+{
+  assert (m_state == READ_IDLE || m_state == READ_DONE);
+
+  m_vfid = vfid;
+  m_first_page = first_page;
+  m_num_pages = num_pages;
+  m_area = area;
+  m_error = NO_ERROR;
+  m_state = READ_QUEUED;
+}
+
+//
+// execute_if_queued () - read the pages unless the request was already claimed
+//
+void
+sort_read_request::execute_if_queued (cubthread::entry &thread_ref)
+{
+  int expected = READ_QUEUED;
+
+  if (!m_state.compare_exchange_strong (expected, READ_RUNNING))
+    {
+      // nothing to read or read by someone else
+      return;
+    }
+
+  m_error = sort_read_area (&thread_ref, m_vfid, m_first_page, m_num_pages, m_area);
+  if (m_error != NO_ERROR)
+    {
+      // the merging thread reads the pages again and gets the error itself
+      er_clear ();
+    }
+
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  m_state = READ_DONE;
+  m_cond.notify_all ();
+}
+
+//
+// wait_done () - wait until the pages are read; reads them if no helper claimed the request yet
+//
+int
+sort_read_request::wait_done (cubthread::entry &thread_ref)
+{
+  int expected = READ_QUEUED;
+
+  if (m_state.compare_exchange_strong (expected, READ_RUNNING))
+    {
+      m_error = sort_read_area (&thread_ref, m_vfid, m_first_page, m_num_pages, m_area);
+      m_state = READ_DONE;
+      return m_error;
+    }
+
+  std::unique_lock<std::mutex> ulock (m_mutex);
+  m_cond.wait (ulock, [this] { return m_state == READ_DONE; });
+  ulock.unlock ();
+
+  if (m_error != NO_ERROR)
+    {
+      // read failed in helper; retry to set the error in this thread
+      m_error = sort_read_area (&thread_ref, m_vfid, m_first_page, m_num_pages, m_area);
+    }
+  return m_error;
+}
+
+sort_read_task::sort_read_task (const std::shared_ptr<sort_read_request> &request)
+  : m_request (request)
+{
+}
+
+void
+sort_read_task::execute (cubthread::entry &thread_ref)
+{
+  m_request->execute_if_queued (thread_ref);
+}
+
+sort_run_merger::sort_run_merger (SORT_PARAM *sort_param, char *memory, int memory_pages)
+  : m_sort_param (sort_param)
+  , m_memory (memory)
+  , m_memory_pages (memory_pages)
+  , m_inputs ()
+  , m_order ()
+  , m_order_count (0)
+  , m_out_sectaddr (NULL)
+  , m_out_sectsize (0)
+  , m_out_bufno (0)
+{
+  for (input &in : m_inputs)
+    {
+      in.is_prefetching = false;
+      in.long_rec.data = NULL;
+      in.long_rec.area_size = 0;
+      in.prefetch = std::make_shared<sort_read_request> ();
+    }
+}
+
+sort_run_merger::~sort_run_merger ()
+{
+  for (input &in : m_inputs)
+    {
+      assert (!in.is_prefetching);
+      if (in.long_rec.data != NULL)
+	{
+	  free_and_init (in.long_rec.data);
+	}
+    }
+}
+
+//
+// merge () - merge runs
+//
+// return         : error code; SORT_PUT_STOP if the put function stopped the sort
+// thread_ref (in): thread entry
+// runs (in)      : runs to merge
+// run_count (in) : number of runs
+// out_vfid (in)  : file of merged run or NULL to output the records with the put function of the sort
+// out_page (io)  : page of output file where merged run starts; next free page on exit
+// out_run_pages (out) : size of merged run
+//
+int
+sort_run_merger::merge (cubthread::entry &thread_ref, const sort_merge_run *runs, int run_count, VFID *out_vfid,
+			int *out_page, int *out_run_pages)
+{
+  int in_sectsize;
+  int min;
+  bool is_loaded;
+  bool has_record;
+  RECDES *out_rec;
+  int error = NO_ERROR;
+  int i;
+
+  assert (run_count > 0 && run_count <= SORT_MAX_HALF_FILES);
+
+  /* Distribute the memory to the input and output sections; the output section is needed only by intermediate runs */
+  if (out_vfid != NULL)
+    {
+      in_sectsize = sort_find_inbuf_size (m_memory_pages, run_count);
+      m_out_sectsize = m_memory_pages - in_sectsize * run_count;
+      m_out_sectaddr = m_memory + (run_count * in_sectsize * DB_PAGESIZE);
+      assert (m_out_sectsize > 0);
+
+      *out_run_pages = 0;
+      init_out_section ();
+    }
+  else
+    {
+      in_sectsize = m_memory_pages / run_count;
+      m_out_sectsize = 0;
+      m_out_sectaddr = NULL;
+    }
+  assert (in_sectsize > 0);
+
+  /* Load the first records of the runs */
+  m_order_count = 0;
+  for (i = 0; i < run_count; i++)
+    {
+      input &in = m_inputs[i];
+
+      in.vfid = runs[i].vfid;
+      in.next_page = runs[i].first_page;
+      in.left_pages = runs[i].num_pages;
+      in.area[0] = m_memory + (i * in_sectsize * DB_PAGESIZE);
+      if (in_sectsize > 1)
+	{
+	  /* double buffered */
+	  in.area_pages = in_sectsize / 2;
+	  in.area[1] = in.area[0] + (in.area_pages * DB_PAGESIZE);
+	}
+      else
+	{
+	  in.area_pages = 1;
+	  in.area[1] = NULL;
+	}
+      in.cur_area = 1;
+
+      error = load_next_area (thread_ref, in, is_loaded);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+      assert (is_loaded);
+
+      error = get_record (thread_ref, in);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+      insert_ordered (i);
+    }
+
+  while (m_order_count > 0)
+    {
+      /* OUTPUT THE MINIMUM RECORD */
+      min = m_order[0];
+      input &in = m_inputs[min];
+
+      if (!(m_sort_param->option == SORT_ELIM_DUP && in.is_dup))
+	{
+	  if (out_vfid != NULL)
+	    {
+	      error = output_to_file (out_vfid, thread_ref, in.rec, out_page, out_run_pages);
+	    }
+	  else
+	    {
+	      if (in.rec.type == REC_BIGONE)
+		{
+		  out_rec = &in.long_rec;
+		}
+	      else
+		{
+		  /* cut-off link used in Internal Sort */
+		  ((SORT_REC *) in.rec.data)->next = NULL;
+		  out_rec = &in.rec;
+		}
+	      error = (*m_sort_param->put_fn) (&thread_ref, out_rec, m_sort_param->put_arg);
+	    }
+	  if (error != NO_ERROR)
+	    {
+	      goto end;
+	    }
+	}
+
+      /* PROCEED TO THE NEXT RECORD OF THIS INPUT */
+      m_order_count--;
+      memmove (&m_order[0], &m_order[1], m_order_count * sizeof (m_order[0]));
+
+      error = next_record (thread_ref, in, has_record);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+      if (has_record)
+	{
+	  insert_ordered (min);
+	}
+    }
+
+  if (out_vfid != NULL)
+    {
+      /* Flush whatever is left on the output section */
+      m_out_bufno++;
+      error = sort_write_area (&thread_ref, out_vfid, *out_page, m_out_bufno, m_out_sectaddr);
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+      *out_page += m_out_bufno;
+      *out_run_pages += m_out_bufno;
+    }
+
+end:
+  /* memory areas cannot be reused while helpers may still write them */
+  wait_prefetches (thread_ref);
+
+  return error;
+}
+
+//
+// load_next_area () - switch input to the next pages of its run and start reading the ones after them
+//
+int
+sort_run_merger::load_next_area (cubthread::entry &thread_ref, input &in, bool &is_loaded)
+{
+  int error;
+
+  is_loaded = true;
+
+  if (in.is_prefetching)
+    {
+      in.is_prefetching = false;
+      error = in.prefetch->wait_done (thread_ref);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      in.cur_area ^= 1;
+      in.cur_pages = in.prefetch_pages;
+    }
+  else if (in.left_pages > 0)
+    {
+      /* not double buffered or first pages of the run */
+      if (in.area[1] != NULL)
+	{
+	  in.cur_area ^= 1;
+	}
+      else
+	{
+	  in.cur_area = 0;
+	}
+      in.cur_pages = MIN (in.area_pages, in.left_pages);
+      error = sort_read_area (&thread_ref, in.vfid, in.next_page, in.cur_pages, in.area[in.cur_area]);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      in.next_page += in.cur_pages;
+      in.left_pages -= in.cur_pages;
+    }
+  else
+    {
+      /* the run is finished */
+      is_loaded = false;
+      return NO_ERROR;
+    }
+
+  in.cur_bufno = 0;
+  in.cur_bufaddr = in.area[in.cur_area];
+  in.act_slot = 0;
+  in.last_slot = sort_spage_get_numrecs (in.cur_bufaddr);
+
+  start_prefetch (in);
+
+  return NO_ERROR;
+}
+
+//
+// start_prefetch () - request reading the next pages of the run into the half of input section that is not merged
+//
+void
+sort_run_merger::start_prefetch (input &in)
+{
+  if (in.area[1] == NULL || in.left_pages <= 0)
+    {
+      return;
+    }
+
+  in.prefetch_pages = MIN (in.area_pages, in.left_pages);
+  in.prefetch->prepare (in.vfid, in.next_page, in.prefetch_pages, in.area[in.cur_area ^ 1]);
+  in.next_page += in.prefetch_pages;
+  in.left_pages -= in.prefetch_pages;
+  in.is_prefetching = true;
+
+  if (!cubthread::get_manager ()->is_pool_full (sort_Merge_workers))
+    {
+      cubthread::get_manager ()->push_task (sort_Merge_workers, new sort_read_task (in.prefetch));
+    }
+  // else the merging thread reads the pages when it needs them
+}
+
+//
+// get_record () - peek current record of input; long records are retrieved from overflow file
+//
+int
+sort_run_merger::get_record (cubthread::entry &thread_ref, input &in)
+{
+  int error;
+
+  if (sort_spage_get_record (in.cur_bufaddr, in.act_slot, &in.rec, PEEK) != S_SUCCESS)
+    {
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_SORT_TEMP_PAGE_CORRUPTED, 0);
+      return ER_SORT_TEMP_PAGE_CORRUPTED;
+    }
+
+  if (in.rec.type == REC_BIGONE)
+    {
+      if (sort_retrieve_longrec (&thread_ref, &in.rec, &in.long_rec) == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  return error;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+//
+// next_record () - advance input to its next record
+//
+int
+sort_run_merger::next_record (cubthread::entry &thread_ref, input &in, bool &has_record)
+{
+  int error;
+
+  has_record = true;
+
+  if (++in.act_slot >= in.last_slot)
+    {
+      /* The current input page is finished */
+      if (++in.cur_bufno < in.cur_pages)
+	{
+	  in.cur_bufaddr += DB_PAGESIZE;
+	  in.act_slot = 0;
+	  in.last_slot = sort_spage_get_numrecs (in.cur_bufaddr);
+	}
+      else
+	{
+	  error = load_next_area (thread_ref, in, has_record);
+	  if (error != NO_ERROR || !has_record)
+	    {
+	      return error;
+	    }
+	}
+    }
+
+  return get_record (thread_ref, in);
+}
+
+//
+// insert_ordered () - insert input among ordered inputs, after the inputs with smaller records and before the ones
+//                     with equal or bigger records. if an equal record is found, the input record is a duplicate.
+//
+void
+sort_run_merger::insert_ordered (int index)
+{
+  input &in = m_inputs[index];
+  char **data1, **data2;
+  int pos;
+  int cmp;
+
+  in.is_dup = false;
+  data1 = (in.rec.type == REC_BIGONE) ? &in.long_rec.data : &in.rec.data;
+
+  for (pos = 0; pos < m_order_count; pos++)
+    {
+      input &other = m_inputs[m_order[pos]];
+
+      data2 = (other.rec.type == REC_BIGONE) ? &other.long_rec.data : &other.rec.data;
+      cmp = (*m_sort_param->cmp_fn) (data1, data2, m_sort_param->cmp_arg);
+      if (cmp <= 0)
+	{
+	  in.is_dup = (cmp == 0);
+	  break;
+	}
+    }
+
+  memmove (&m_order[pos + 1], &m_order[pos], (m_order_count - pos) * sizeof (m_order[0]));
+  m_order[pos] = index;
+  m_order_count++;
+}
+
+//
+// output_to_file () - add record to output section; output section is flushed when full
+//
+int
+sort_run_merger::output_to_file (VFID *out_vfid, cubthread::entry &thread_ref, const RECDES &rec, int *out_page,
+				 int *out_run_pages)
+{
+  char *out_bufaddr = m_out_sectaddr + (m_out_bufno * DB_PAGESIZE);
+  int error;
+
+  if (sort_spage_insert (out_bufaddr, (RECDES *) &rec) != NULL_SLOTID)
+    {
+      return NO_ERROR;
+    }
+
+  /* Current output buffer is full */
+  if (++m_out_bufno >= m_out_sectsize)
+    {
+      /* Output section is full; flush it */
+      error = sort_write_area (&thread_ref, out_vfid, *out_page, m_out_sectsize, m_out_sectaddr);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      *out_page += m_out_sectsize;
+      *out_run_pages += m_out_sectsize;
+
+      init_out_section ();
+    }
+
+  out_bufaddr = m_out_sectaddr + (m_out_bufno * DB_PAGESIZE);
+  if (sort_spage_insert (out_bufaddr, (RECDES *) &rec) == NULL_SLOTID)
+    {
+      /* Slotted page module refuses to insert a short size record to an empty page. This should never happen. */
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+      return ER_GENERIC_ERROR;
+    }
+
+  return NO_ERROR;
+}
+
+void
+sort_run_merger::init_out_section ()
+{
+  int i;
+
+  m_out_bufno = 0;
+  for (i = 0; i < m_out_sectsize; i++)
+    {
+      /* Initialize each buffer to contain a slotted page */
+      sort_spage_initialize (m_out_sectaddr + (i * DB_PAGESIZE), UNANCHORED_KEEP_SEQUENCE, MAX_ALIGNMENT);
+    }
+}
+
+//
+// wait_prefetches () - wait for all pending reads into input sections
+//
+void
+sort_run_merger::wait_prefetches (cubthread::entry &thread_ref)
+{
+  for (input &in : m_inputs)
+    {
+      if (in.is_prefetching)
+	{
+	  in.is_prefetching = false;
+	  er_stack_push ();
+	  (void) in.prefetch->wait_done (thread_ref);
+	  er_stack_pop ();
+	}
+    }
+}
+
+sort_merge_stage_job::sort_merge_stage_job (SORT_PARAM *sort_param, int in_count, int out_half, int lane_count,
+					    int executor_count)
+  : m_sort_param (sort_param)
+  , m_in_count (in_count)
+  , m_out_half (out_half)
+  , m_lane_count (lane_count)
+  , m_slice_pages (sort_param->tot_buffers / executor_count)
+  , m_run_first_page ()
+  , m_run_pages ()
+  , m_lane_runs ()
+  , m_next_lane { 0 }
+  , m_mutex ()
+  , m_cond_finished ()
+  , m_finished_lanes (0)
+  , m_error { NO_ERROR }
+  , m_error_area ()
+{
+  FILE_CONTENTS *file_contents;
+  int first_page;
+  int i, j;
+
+  /* Runs of each input file are stored one after the other, starting with the first page of the file */
+  for (i = 0; i < in_count; i++)
+    {
+      file_contents = &sort_param->file_contents[sort_param->in_half + i];
+      first_page = 0;
+      for (j = file_contents->first_run; j != -1 && j <= file_contents->last_run; j++)
+	{
+	  m_run_first_page[i].push_back (first_page);
+	  m_run_pages[i].push_back (file_contents->num_pages[j]);
+	  first_page += file_contents->num_pages[j];
+	}
+    }
+}
+
+//
+// execute_lanes () - merge lanes until all are claimed
+//
+void
+sort_merge_stage_job::execute_lanes (cubthread::entry &thread_ref, int executor)
+{
+  int lane;
+  int error;
+  int length;
+
+  for (lane = m_next_lane++; lane < m_lane_count; lane = m_next_lane++)
+    {
+      error = NO_ERROR;
+      if (m_error == NO_ERROR)
+	{
+	  sort_run_merger merger (m_sort_param, m_sort_param->internal_memory + (executor * m_slice_pages * DB_PAGESIZE),
+				  m_slice_pages);
+
+	  error = merge_lane (thread_ref, merger, lane);
+	}
+
+      std::unique_lock<std::mutex> ulock (m_mutex);
+      if (error != NO_ERROR && m_error == NO_ERROR)
+	{
+	  m_error = error;
+	  length = SORT_MERGE_ERROR_AREA_SIZE;
+	  (void) er_get_area_error (OR_ALIGNED_BUF_START (m_error_area), &length);
+	}
+      if (++m_finished_lanes == m_lane_count)
+	{
+	  m_cond_finished.notify_all ();
+	}
+    }
+}
+
+//
+// merge_lane () - merge the runs of lane; lane produces the runs of one output file
+//
+int
+sort_merge_stage_job::merge_lane (cubthread::entry &thread_ref, sort_run_merger &merger, int lane)
+{
+  sort_merge_run runs[SORT_MAX_HALF_FILES];
+  VFID *out_vfid = &m_sort_param->temp[m_out_half + lane];
+  int out_page = 0;
+  int out_run_pages;
+  int run_count;
+  int group;
+  int error;
+  int i;
+
+  /* Group g of runs (the g-th run of each input file) is merged to output file g % half_files */
+  for (group = lane; ; group += m_sort_param->half_files)
+    {
+      run_count = 0;
+      for (i = 0; i < m_in_count; i++)
+	{
+	  if (group < (int) m_run_pages[i].size ())
+	    {
+	      runs[run_count].vfid = &m_sort_param->temp[m_sort_param->in_half + i];
+	      runs[run_count].first_page = m_run_first_page[i][group];
+	      runs[run_count].num_pages = m_run_pages[i][group];
+	      run_count++;
+	    }
+	}
+      if (run_count == 0)
+	{
+	  break;
+	}
+
+      error = merger.merge (thread_ref, runs, run_count, out_vfid, &out_page, &out_run_pages);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+      m_lane_runs[lane].push_back (out_run_pages);
+    }
+
+  return NO_ERROR;
+}
+
+//
+// wait_finished () - wait for all lanes; the error of a helper is set in the waiting thread
+//
+int
+sort_merge_stage_job::wait_finished (cubthread::entry &thread_ref)
+{
+  std::unique_lock<std::mutex> ulock (m_mutex);
+
+  m_cond_finished.wait (ulock, [this] { return m_finished_lanes == m_lane_count; });
+
+  if (m_error != NO_ERROR)
+    {
+      (void) er_set_area_error (OR_ALIGNED_BUF_START (m_error_area));
+    }
+  return m_error;
+}
+
+const std::vector<int> &
+sort_merge_stage_job::get_lane_runs (int lane) const
+{
+  return m_lane_runs[lane];
+}
+
+sort_merge_lane_task::sort_merge_lane_task (const std::shared_ptr<sort_merge_stage_job> &job, int executor)
+  : m_job (job)
+  , m_executor (executor)
+{
+}
+
+void
+sort_merge_lane_task::execute (cubthread::entry &thread_ref)
+{
+  m_job->execute_lanes (thread_ref, m_executor);
+  er_clear ();
+}
+// *INDENT-ON*
+
+/*
+ * sort_merge_workers_init () - initialize the workers helping the merging phase of sorts
+ */
+void
+sort_merge_workers_init (void)
+{
+  int worker_count = prm_get_integer_value (PRM_ID_SORT_MERGE_WORKERS);
+
+  if (worker_count <= 0)
+    {
+      /* Runs are merged by the sorting threads only. */
+      sort_Merge_workers = NULL;
+      return;
+    }
+
+  sort_Merge_worker_context = new sort_merge_worker_context ();
+  sort_Merge_workers =
+    cubthread::get_manager ()->create_worker_pool (worker_count, worker_count * SORT_MERGE_MAX_TASKS_PER_WORKER,
+						   "sort merge workers", sort_Merge_worker_context, 1, false);
+}
+
+/*
+ * sort_merge_workers_destroy () - destroy the workers helping the merging phase of sorts
+ */
+void
+sort_merge_workers_destroy (void)
+{
+  cubthread::get_manager ()->destroy_worker_pool (sort_Merge_workers);
+  if (sort_Merge_worker_context != NULL)
+    {
+      delete sort_Merge_worker_context;
+      sort_Merge_worker_context = NULL;
+    }
+}
+#endif /* SERVER_MODE */
+
 /* AUXILIARY FUNCTIONS */
 
 /*
@@ -147,4 +147,9 @@ extern int sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_c
 			  void *get_arg, SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn, void *cmp_arg,
 			  SORT_DUP_OPTION option, int limit);
 
+#if defined (SERVER_MODE)
+extern void sort_merge_workers_init (void);
+extern void sort_merge_workers_destroy (void);
+#endif /* SERVER_MODE */
+
 #endif /* _EXTERNAL_SORT_H_ */
@@ -49,6 +49,13 @@
 #include <sys/vfs.h>
 #endif /* WINDOWS */
 
+#if defined (HAVE_LINUX_IO_URING_H) && defined (SERVER_MODE)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#define FILEIO_USE_IO_URING
+#endif /* HAVE_LINUX_IO_URING_H && SERVER_MODE */
+
 #ifdef _AIX
 #include <sys/statfs.h>
 #endif /* _AIX */
@@ -447,6 +454,83 @@ static TOKEN_BUCKET fc_Token_bucket_s;
 static TOKEN_BUCKET *fc_Token_bucket = NULL;
 static FLUSH_STATS fc_Stats;
 
+/* Asynchronous page I/O */
+#define FILEIO_ASYNC_MAX_RUN_PAGES        64	/* maximum pages coalesced in a single vectored request */
+#define FILEIO_ASYNC_MAX_RING_ENTRIES     128	/* maximum vectored requests in flight for a queue */
+
+typedef struct fileio_async_request FILEIO_ASYNC_REQUEST;
+struct fileio_async_request
+{
+  int vol_fd;			/* volume descriptor */
+  FILEIO_ASYNC_OP op;		/* read or write */
+  PAGEID page_id;		/* page identifier */
+  void *io_page_p;		/* page buffer, page_size long */
+};
+
+/* A run of requests on contiguous pages of the same volume, served by a single vectored request. */
+typedef struct fileio_async_run FILEIO_ASYNC_RUN;
+struct fileio_async_run
+{
+  int vol_fd;			/* volume descriptor */
+  FILEIO_ASYNC_OP op;		/* read or write */
+  PAGEID start_page_id;		/* first page of the run */
+  int first_request;		/* index of first request (in sorted request array) */
+  int npages;			/* number of contiguous pages */
+  bool is_completed;		/* true if run was completed */
+};
+
+#if defined (FILEIO_USE_IO_URING)
+/* Submission and completion rings shared with the kernel. */
+typedef struct fileio_uring FILEIO_URING;
+struct fileio_uring
+{
+  int ring_fd;
+
+  void *sq_ring_p;
+  size_t sq_ring_size;
+  unsigned int *sq_head;
+  unsigned int *sq_tail;
+  unsigned int *sq_ring_mask;
+  unsigned int *sq_array;
+  unsigned int sq_entries;
+  struct io_uring_sqe *sqes;
+  size_t sqes_size;
+
+  void *cq_ring_p;
+  size_t cq_ring_size;
+  unsigned int *cq_head;
+  unsigned int *cq_tail;
+  unsigned int *cq_ring_mask;
+  struct io_uring_cqe *cqes;
+};
+#endif /* FILEIO_USE_IO_URING */
+
+struct fileio_async_queue
+{
+  size_t page_size;		/* size of each page */
+  FILEIO_WRITE_MODE write_mode;	/* write mode for all writes of the queue */
+
+  FILEIO_ASYNC_REQUEST *requests;	/* requests added since last wait */
+  int num_requests;
+  int max_requests;
+
+  FILEIO_ASYNC_RUN *runs;	/* coalesced runs, built on submit */
+  int num_runs;
+  int num_submitted_runs;	/* runs handed to the kernel */
+  int num_completed_runs;	/* runs completed */
+#if !defined (WINDOWS)
+  struct iovec *iov;		/* io vectors of all runs, one per request */
+#endif /* !WINDOWS */
+
+  int error_code;		/* first error of current batch */
+
+#if defined (FILEIO_USE_IO_URING)
+  bool use_uring;		/* false if io_uring is disabled or could not be set up */
+  int num_inflight;		/* runs submitted and not yet reaped */
+  FILEIO_URING uring;
+#endif				/* FILEIO_USE_IO_URING */
+};
+
 #if defined(CUBRID_DEBUG)
 /* Set this to get various levels of io information regarding
  * backup and restore activity.
@@ -577,6 +661,22 @@ static int fileio_flush_control_get_token (THREAD_ENTRY * thread_p, int ntoken);
 static int fileio_flush_control_get_desired_rate (TOKEN_BUCKET * tb);
 static int fileio_synchronize_bg_archive_volume (THREAD_ENTRY * thread_p);
 
+static int fileio_async_compare_requests (const void *first, const void *second);
+static void fileio_async_build_runs (FILEIO_ASYNC_QUEUE * queue_p);
+static int fileio_async_execute_run (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p, FILEIO_ASYNC_RUN * run_p);
+static void fileio_async_complete_run (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p, FILEIO_ASYNC_RUN * run_p,
+				       int error_code);
+static void fileio_async_set_error (FILEIO_ASYNC_QUEUE * queue_p, FILEIO_ASYNC_RUN * run_p, int os_errno,
+				    bool is_eof);
+#if defined (FILEIO_USE_IO_URING)
+static int fileio_uring_setup (FILEIO_URING * uring_p, unsigned int entries);
+static void fileio_uring_teardown (FILEIO_URING * uring_p);
+static int fileio_uring_enter (FILEIO_URING * uring_p, unsigned int to_submit, unsigned int min_complete,
+			       unsigned int *submitted_p);
+static int fileio_uring_push_runs (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p);
+static void fileio_uring_reap (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p);
+#endif /* FILEIO_USE_IO_URING */
+
 static void fileio_page_bitmap_set (FILEIO_RESTORE_PAGE_BITMAP * page_bitmap, int page_id);
 static bool fileio_page_bitmap_is_set (FILEIO_RESTORE_PAGE_BITMAP * page_bitmap, int page_id);
 static void fileio_page_bitmap_dump (FILE * out_fp, const FILEIO_RESTORE_PAGE_BITMAP * page_bitmap);
@@ -4421,6 +4521,868 @@ fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID
   return io_page_array[0];
 }
 
+/*
+ * fileio_async_queue_create () - create a queue for asynchronous batched page I/O
+ *   return: the queue or NULL on error
+ *   max_requests(in): maximum number of page requests the queue can hold between two waits
+ *   page_size(in): page size of all requests
+ *   write_mode(in): write mode applied to all page writes of the queue
+ *
+ * Note: Page requests are collected with fileio_async_add, sorted and coalesced into runs of contiguous pages on
+ *       fileio_async_submit and kept in flight together until fileio_async_wait_all. When the kernel supports io_uring
+ *       (and enable_async_page_io is on), the runs are handed to a submission queue and their completions reaped from
+ *       the completion queue; otherwise each run is executed synchronously with a single vectored system call.
+ *
+ *       A queue must be used by one thread at a time.
+ */
+FILEIO_ASYNC_QUEUE *
+fileio_async_queue_create (int max_requests, size_t page_size, FILEIO_WRITE_MODE write_mode)
+{
+  FILEIO_ASYNC_QUEUE *queue_p;
+  size_t alloc_size;
+
+  assert (max_requests > 0 && page_size > 0);
+
+  queue_p = (FILEIO_ASYNC_QUEUE *) malloc (sizeof (FILEIO_ASYNC_QUEUE));
+  if (queue_p == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (FILEIO_ASYNC_QUEUE));
+      return NULL;
+    }
+  memset (queue_p, 0, sizeof (FILEIO_ASYNC_QUEUE));
+
+  queue_p->page_size = page_size;
+  queue_p->write_mode = write_mode;
+  queue_p->max_requests = max_requests;
+  queue_p->error_code = NO_ERROR;
+
+  alloc_size = max_requests * sizeof (FILEIO_ASYNC_REQUEST);
+  queue_p->requests = (FILEIO_ASYNC_REQUEST *) malloc (alloc_size);
+  if (queue_p->requests == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+      goto error;
+    }
+
+  /* at most one run per request */
+  alloc_size = max_requests * sizeof (FILEIO_ASYNC_RUN);
+  queue_p->runs = (FILEIO_ASYNC_RUN *) malloc (alloc_size);
+  if (queue_p->runs == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+      goto error;
+    }
+
+#if !defined (WINDOWS)
+  alloc_size = max_requests * sizeof (struct iovec);
+  queue_p->iov = (struct iovec *) malloc (alloc_size);
+  if (queue_p->iov == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+      goto error;
+    }
+#endif /* !WINDOWS */
+
+#if defined (FILEIO_USE_IO_URING)
+  queue_p->use_uring = false;
+  queue_p->uring.ring_fd = -1;
+  if (prm_get_bool_value (PRM_ID_ENABLE_ASYNC_PAGE_IO))
+    {
+      if (fileio_uring_setup (&queue_p->uring, (unsigned int) MIN (max_requests, FILEIO_ASYNC_MAX_RING_ENTRIES))
+	  == NO_ERROR)
+	{
+	  queue_p->use_uring = true;
+	}
+      else
+	{
+	  /* not supported by the kernel or not allowed; fall back to synchronous vectored I/O */
+	  er_log_debug (ARG_FILE_LINE, "fileio_async_queue_create: io_uring setup failed with errno %d, "
+			"using synchronous vectored I/O\n", errno);
+	}
+    }
+#endif /* FILEIO_USE_IO_URING */
+
+  return queue_p;
+
+error:
+  fileio_async_queue_destroy (queue_p);
+  return NULL;
+}
+
+/*
+ * fileio_async_queue_destroy () - destroy an asynchronous I/O queue
+ *   return: void
+ *   queue_p(in): the queue; it must not have requests in flight
+ */
+void
+fileio_async_queue_destroy (FILEIO_ASYNC_QUEUE * queue_p)
+{
+  if (queue_p == NULL)
+    {
+      return;
+    }
+
+#if defined (FILEIO_USE_IO_URING)
+  assert (queue_p->num_inflight == 0);
+  if (queue_p->use_uring)
+    {
+      fileio_uring_teardown (&queue_p->uring);
+    }
+#endif /* FILEIO_USE_IO_URING */
+
+#if !defined (WINDOWS)
+  if (queue_p->iov != NULL)
+    {
+      free_and_init (queue_p->iov);
+    }
+#endif /* !WINDOWS */
+  if (queue_p->runs != NULL)
+    {
+      free_and_init (queue_p->runs);
+    }
+  if (queue_p->requests != NULL)
+    {
+      free_and_init (queue_p->requests);
+    }
+  free_and_init (queue_p);
+}
+
+/*
+ * fileio_async_queue_count () - get the number of page requests added since last wait
+ *   return: request count
+ *   queue_p(in): the queue
+ */
+int
+fileio_async_queue_count (const FILEIO_ASYNC_QUEUE * queue_p)
+{
+  return queue_p->num_requests;
+}
+
+/*
+ * fileio_async_queue_is_full () - true if no more page requests can be added before waiting
+ *   return: bool
+ *   queue_p(in): the queue
+ */
+bool
+fileio_async_queue_is_full (const FILEIO_ASYNC_QUEUE * queue_p)
+{
+  return queue_p->num_requests >= queue_p->max_requests;
+}
+
+/*
+ * fileio_async_add () - add a page read or write to the queue
+ *   return: error code
+ *   queue_p(in): the queue
+ *   op(in): FILEIO_ASYNC_READ or FILEIO_ASYNC_WRITE
+ *   vol_fd(in): volume descriptor
+ *   io_page_p(in/out): page buffer, page_size long. It must stay valid and untouched until fileio_async_wait_all
+ *   page_id(in): page identifier
+ *
+ * Note: the same page must not be added twice before waiting, since the order of the two requests is not defined.
+ */
+int
+fileio_async_add (FILEIO_ASYNC_QUEUE * queue_p, FILEIO_ASYNC_OP op, int vol_fd, void *io_page_p, PAGEID page_id)
+{
+  FILEIO_ASYNC_REQUEST *request_p;
+
+  assert (queue_p != NULL && vol_fd != NULL_VOLDES && io_page_p != NULL && page_id >= 0);
+  /* can't add requests while a batch is submitted */
+  assert (queue_p->num_runs == 0);
+
+  if (queue_p->num_requests >= queue_p->max_requests)
+    {
+      assert_release (false);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+      return ER_GENERIC_ERROR;
+    }
+
+  request_p = &queue_p->requests[queue_p->num_requests++];
+  request_p->vol_fd = vol_fd;
+  request_p->op = op;
+  request_p->page_id = page_id;
+  request_p->io_page_p = io_page_p;
+
+  return NO_ERROR;
+}
+
+/*
+ * fileio_async_compare_requests () - order requests by volume, operation and page
+ *   return: comparison result
+ *   first(in): first request
+ *   second(in): second request
+ */
+static int
+fileio_async_compare_requests (const void *first, const void *second)
+{
+  const FILEIO_ASYNC_REQUEST *first_p = (const FILEIO_ASYNC_REQUEST *) first;
+  const FILEIO_ASYNC_REQUEST *second_p = (const FILEIO_ASYNC_REQUEST *) second;
+
+  if (first_p->vol_fd != second_p->vol_fd)
+    {
+      return first_p->vol_fd < second_p->vol_fd ? -1 : 1;
+    }
+  if (first_p->op != second_p->op)
+    {
+      return first_p->op < second_p->op ? -1 : 1;
+    }
+  if (first_p->page_id != second_p->page_id)
+    {
+      return first_p->page_id < second_p->page_id ? -1 : 1;
+    }
+  return 0;
+}
+
+/*
+ * fileio_async_build_runs () - sort the requests and coalesce contiguous pages into runs
+ *   return: void
+ *   queue_p(in): the queue
+ */
+static void
+fileio_async_build_runs (FILEIO_ASYNC_QUEUE * queue_p)
+{
+  FILEIO_ASYNC_REQUEST *request_p;
+  FILEIO_ASYNC_RUN *run_p = NULL;
+  int i;
+
+  qsort (queue_p->requests, queue_p->num_requests, sizeof (FILEIO_ASYNC_REQUEST), fileio_async_compare_requests);
+
+  queue_p->num_runs = 0;
+  queue_p->num_submitted_runs = 0;
+  queue_p->num_completed_runs = 0;
+
+  for (i = 0; i < queue_p->num_requests; i++)
+    {
+      request_p = &queue_p->requests[i];
+
+      assert (i == 0 || fileio_async_compare_requests (request_p - 1, request_p) < 0);
+
+#if !defined (WINDOWS)
+      queue_p->iov[i].iov_base = request_p->io_page_p;
+      queue_p->iov[i].iov_len = queue_p->page_size;
+#endif /* !WINDOWS */
+
+      if (run_p != NULL && run_p->vol_fd == request_p->vol_fd && run_p->op == request_p->op
+	  && run_p->start_page_id + run_p->npages == request_p->page_id && run_p->npages < FILEIO_ASYNC_MAX_RUN_PAGES)
+	{
+	  /* contiguous with current run */
+	  run_p->npages++;
+	  continue;
+	}
+
+      /* start a new run */
+      run_p = &queue_p->runs[queue_p->num_runs++];
+      run_p->vol_fd = request_p->vol_fd;
+      run_p->op = request_p->op;
+      run_p->start_page_id = request_p->page_id;
+      run_p->first_request = i;
+      run_p->npages = 1;
+      run_p->is_completed = false;
+    }
+}
+
+/*
+ * fileio_async_set_error () - set I/O error of a run
+ *   return: void
+ *   queue_p(in): the queue
+ *   run_p(in): failed run
+ *   os_errno(in): error number of the failure
+ *   is_eof(in): true if a read reached the end of volume
+ */
+static void
+fileio_async_set_error (FILEIO_ASYNC_QUEUE * queue_p, FILEIO_ASYNC_RUN * run_p, int os_errno, bool is_eof)
+{
+  int error_code;
+
+  errno = os_errno;
+  if (run_p->op == FILEIO_ASYNC_READ)
+    {
+      if (is_eof)
+	{
+	  /* trying to read beyond the allocated disk space */
+	  error_code = ER_PB_BAD_PAGEID;
+	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 2, run_p->start_page_id,
+		  fileio_get_volume_label_by_fd (run_p->vol_fd, PEEK));
+	}
+      else
+	{
+	  error_code = ER_IO_READ;
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 2, run_p->start_page_id,
+			       fileio_get_volume_label_by_fd (run_p->vol_fd, PEEK));
+	}
+    }
+  else if (os_errno == ENOSPC)
+    {
+      error_code = ER_IO_WRITE_OUT_OF_SPACE;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 2, run_p->start_page_id,
+	      fileio_get_volume_label_by_fd (run_p->vol_fd, PEEK));
+    }
+  else
+    {
+      error_code = ER_IO_WRITE;
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 2, run_p->start_page_id,
+			   fileio_get_volume_label_by_fd (run_p->vol_fd, PEEK));
+    }
+
+  if (queue_p->error_code == NO_ERROR)
+    {
+      queue_p->error_code = error_code;
+    }
+}
+
+/*
+ * fileio_async_complete_run () - account a completed run
+ *   return: void
+ *   thread_p(in): thread entry
+ *   queue_p(in): the queue
+ *   run_p(in): completed run
+ *   error_code(in): run result
+ */
+static void
+fileio_async_complete_run (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p, FILEIO_ASYNC_RUN * run_p,
+			   int error_code)
+{
+  assert (!run_p->is_completed);
+
+  run_p->is_completed = true;
+  queue_p->num_completed_runs++;
+
+  if (error_code != NO_ERROR)
+    {
+      return;
+    }
+
+  if (run_p->op == FILEIO_ASYNC_READ)
+    {
+      perfmon_add_stat (thread_p, PSTAT_FILE_NUM_IOREADS, run_p->npages);
+    }
+  else
+    {
+      if (queue_p->write_mode == FILEIO_WRITE_DEFAULT_WRITE)
+	{
+	  fileio_compensate_flush (thread_p, run_p->vol_fd, run_p->npages);
+	}
+      perfmon_add_stat (thread_p, PSTAT_FILE_NUM_IOWRITES, run_p->npages);
+    }
+}
+
+/*
+ * fileio_async_execute_run () - execute a run synchronously
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   queue_p(in): the queue
+ *   run_p(in): the run
+ *
+ * Note: used when io_uring is not available and to finish runs the kernel completed partially.
+ */
+static int
+fileio_async_execute_run (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p, FILEIO_ASYNC_RUN * run_p)
+{
+#if defined (WINDOWS)
+  FILEIO_ASYNC_REQUEST *request_p;
+  void *result_p;
+  int i;
+
+  for (i = 0; i < run_p->npages; i++)
+    {
+      request_p = &queue_p->requests[run_p->first_request + i];
+      if (run_p->op == FILEIO_ASYNC_READ)
+	{
+	  result_p = fileio_read (thread_p, request_p->vol_fd, request_p->io_page_p, request_p->page_id,
+				  queue_p->page_size);
+	}
+      else
+	{
+	  result_p = fileio_write (thread_p, request_p->vol_fd, request_p->io_page_p, request_p->page_id,
+				   queue_p->page_size, queue_p->write_mode);
+	}
+      if (result_p == NULL)
+	{
+	  ASSERT_ERROR ();
+	  if (queue_p->error_code == NO_ERROR)
+	    {
+	      queue_p->error_code = er_errid ();
+	    }
+	  return queue_p->error_code;
+	}
+    }
+
+  /* statistics were already collected by fileio_read/fileio_write */
+  run_p->is_completed = true;
+  queue_p->num_completed_runs++;
+  return NO_ERROR;
+#else /* WINDOWS */
+  struct iovec iov_copy[FILEIO_ASYNC_MAX_RUN_PAGES];
+  struct iovec *iov_p = iov_copy;
+  int iov_count = run_p->npages;
+  off_t offset = FILEIO_GET_FILE_SIZE (queue_p->page_size, run_p->start_page_id);
+  ssize_t nbytes;
+  size_t remaining = queue_p->page_size * run_p->npages;
+
+  /* partial transfers advance the io vectors, so work on a copy */
+  memcpy (iov_copy, &queue_p->iov[run_p->first_request], run_p->npages * sizeof (struct iovec));
+
+  while (remaining > 0)
+    {
+      if (run_p->op == FILEIO_ASYNC_READ)
+	{
+	  nbytes = preadv (run_p->vol_fd, iov_p, iov_count, offset);
+	}
+      else
+	{
+	  nbytes = pwritev (run_p->vol_fd, iov_p, iov_count, offset);
+	}
+
+      if (nbytes <= 0)
+	{
+	  if (nbytes < 0 && (errno == EINTR || errno == EAGAIN))
+	    {
+	      continue;
+	    }
+	  fileio_async_set_error (queue_p, run_p, nbytes == 0 ? 0 : errno, nbytes == 0);
+	  fileio_async_complete_run (thread_p, queue_p, run_p, queue_p->error_code);
+	  return queue_p->error_code;
+	}
+
+      offset += nbytes;
+      remaining -= nbytes;
+
+      /* skip fully transferred vectors and adjust the partially transferred one */
+      while (nbytes > 0 && (size_t) nbytes >= iov_p->iov_len)
+	{
+	  nbytes -= iov_p->iov_len;
+	  iov_p++;
+	  iov_count--;
+	}
+      if (nbytes > 0)
+	{
+	  iov_p->iov_base = (char *) iov_p->iov_base + nbytes;
+	  iov_p->iov_len -= nbytes;
+	}
+    }
+
+  fileio_async_complete_run (thread_p, queue_p, run_p, NO_ERROR);
+  return NO_ERROR;
+#endif /* !WINDOWS */
+}
+
+/*
+ * fileio_async_submit () - start the I/O of all requests added to queue
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   queue_p(in): the queue
+ *
+ * Note: the requests are sorted and contiguous pages of same volume and operation are merged into runs. With io_uring,
+ *       the runs are submitted without waiting; otherwise, they are executed before returning. In both cases, the
+ *       caller must call fileio_async_wait_all before reusing the buffers or adding new requests.
+ */
+int
+fileio_async_submit (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p)
+{
+  int i;
+
+  assert (queue_p != NULL && queue_p->num_runs == 0);
+
+  queue_p->error_code = NO_ERROR;
+  if (queue_p->num_requests == 0)
+    {
+      return NO_ERROR;
+    }
+
+  fileio_async_build_runs (queue_p);
+
+#if defined (FILEIO_USE_IO_URING)
+  if (queue_p->use_uring)
+    {
+      return fileio_uring_push_runs (thread_p, queue_p);
+    }
+#endif /* FILEIO_USE_IO_URING */
+
+  for (i = 0; i < queue_p->num_runs; i++)
+    {
+      queue_p->num_submitted_runs++;
+      if (fileio_async_execute_run (thread_p, queue_p, &queue_p->runs[i]) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  /* the remaining runs are abandoned; report on wait */
+	  break;
+	}
+    }
+
+  return queue_p->error_code;
+}
+
+/*
+ * fileio_async_wait_all () - wait for all submitted requests of queue to complete
+ *   return: error code of the first failed request or NO_ERROR
+ *   thread_p(in): thread entry
+ *   queue_p(in): the queue
+ *
+ * Note: after return, the queue is empty and can be reused.
+ */
+int
+fileio_async_wait_all (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p)
+{
+  int error_code;
+
+  assert (queue_p != NULL);
+
+  if (queue_p->num_requests > 0 && queue_p->num_runs == 0)
+    {
+      /* not submitted yet */
+      error_code = fileio_async_submit (thread_p, queue_p);
+      if (error_code != NO_ERROR && queue_p->num_runs == 0)
+	{
+	  queue_p->num_requests = 0;
+	  return error_code;
+	}
+    }
+
+#if defined (FILEIO_USE_IO_URING)
+  if (queue_p->use_uring)
+    {
+      while (queue_p->num_inflight > 0 || queue_p->num_submitted_runs < queue_p->num_runs)
+	{
+	  if (queue_p->error_code == NO_ERROR && queue_p->num_submitted_runs < queue_p->num_runs)
+	    {
+	      /* more runs than ring entries; push the rest as entries are freed */
+	      (void) fileio_uring_push_runs (thread_p, queue_p);
+	    }
+	  if (queue_p->num_inflight == 0)
+	    {
+	      /* an error stopped submission and nothing is left in flight */
+	      break;
+	    }
+	  fileio_uring_reap (thread_p, queue_p);
+	}
+    }
+
+  /* the buffers may be reused only when the kernel is done with them */
+  assert (queue_p->num_inflight == 0);
+#endif /* FILEIO_USE_IO_URING */
+
+  error_code = queue_p->error_code;
+  if (error_code == NO_ERROR && queue_p->num_completed_runs != queue_p->num_runs)
+    {
+      assert_release (false);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+      error_code = ER_GENERIC_ERROR;
+    }
+
+  /* reset queue */
+  queue_p->num_requests = 0;
+  queue_p->num_runs = 0;
+  queue_p->num_submitted_runs = 0;
+  queue_p->num_completed_runs = 0;
+  queue_p->error_code = NO_ERROR;
+
+  return error_code;
+}
+
+#if defined (FILEIO_USE_IO_URING)
+/*
+ * fileio_uring_setup () - create an io_uring instance and map its rings
+ *   return: error code
+ *   uring_p(out): ring
+ *   entries(in): number of submission entries
+ */
+static int
+fileio_uring_setup (FILEIO_URING * uring_p, unsigned int entries)
+{
+  struct io_uring_params params;
+  char *ring_p;
+
+  memset (uring_p, 0, sizeof (FILEIO_URING));
+  memset (&params, 0, sizeof (params));
+
+  uring_p->ring_fd = (int) syscall (__NR_io_uring_setup, entries, &params);
+  if (uring_p->ring_fd < 0)
+    {
+      uring_p->ring_fd = -1;
+      return ER_FAILED;
+    }
+
+  uring_p->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof (unsigned int);
+  uring_p->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof (struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+      /* both rings are mapped with one call */
+      uring_p->sq_ring_size = MAX (uring_p->sq_ring_size, uring_p->cq_ring_size);
+      uring_p->cq_ring_size = uring_p->sq_ring_size;
+    }
+
+  uring_p->sq_ring_p = mmap (NULL, uring_p->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+			     uring_p->ring_fd, IORING_OFF_SQ_RING);
+  if (uring_p->sq_ring_p == MAP_FAILED)
+    {
+      uring_p->sq_ring_p = NULL;
+      goto error;
+    }
+
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+      uring_p->cq_ring_p = uring_p->sq_ring_p;
+    }
+  else
+    {
+      uring_p->cq_ring_p = mmap (NULL, uring_p->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+				 uring_p->ring_fd, IORING_OFF_CQ_RING);
+      if (uring_p->cq_ring_p == MAP_FAILED)
+	{
+	  uring_p->cq_ring_p = NULL;
+	  goto error;
+	}
+    }
+
+  uring_p->sqes_size = params.sq_entries * sizeof (struct io_uring_sqe);
+  uring_p->sqes = (struct io_uring_sqe *) mmap (NULL, uring_p->sqes_size, PROT_READ | PROT_WRITE,
+						MAP_SHARED | MAP_POPULATE, uring_p->ring_fd, IORING_OFF_SQES);
+  if (uring_p->sqes == MAP_FAILED)
+    {
+      uring_p->sqes = NULL;
+      goto error;
+    }
+
+  ring_p = (char *) uring_p->sq_ring_p;
+  uring_p->sq_head = (unsigned int *) (ring_p + params.sq_off.head);
+  uring_p->sq_tail = (unsigned int *) (ring_p + params.sq_off.tail);
+  uring_p->sq_ring_mask = (unsigned int *) (ring_p + params.sq_off.ring_mask);
+  uring_p->sq_array = (unsigned int *) (ring_p + params.sq_off.array);
+  uring_p->sq_entries = params.sq_entries;
+
+  ring_p = (char *) uring_p->cq_ring_p;
+  uring_p->cq_head = (unsigned int *) (ring_p + params.cq_off.head);
+  uring_p->cq_tail = (unsigned int *) (ring_p + params.cq_off.tail);
+  uring_p->cq_ring_mask = (unsigned int *) (ring_p + params.cq_off.ring_mask);
+  uring_p->cqes = (struct io_uring_cqe *) (ring_p + params.cq_off.cqes);
+
+  return NO_ERROR;
+
+error:
+  fileio_uring_teardown (uring_p);
+  return ER_FAILED;
+}
+
+/*
+ * fileio_uring_teardown () - unmap rings and close io_uring instance
+ *   return: void
+ *   uring_p(in): ring
+ */
+static void
+fileio_uring_teardown (FILEIO_URING * uring_p)
+{
+  if (uring_p->sqes != NULL)
+    {
+      munmap (uring_p->sqes, uring_p->sqes_size);
+      uring_p->sqes = NULL;
+    }
+  if (uring_p->cq_ring_p != NULL && uring_p->cq_ring_p != uring_p->sq_ring_p)
+    {
+      munmap (uring_p->cq_ring_p, uring_p->cq_ring_size);
+    }
+  uring_p->cq_ring_p = NULL;
+  if (uring_p->sq_ring_p != NULL)
+    {
+      munmap (uring_p->sq_ring_p, uring_p->sq_ring_size);
+      uring_p->sq_ring_p = NULL;
+    }
+  if (uring_p->ring_fd >= 0)
+    {
+      close (uring_p->ring_fd);
+      uring_p->ring_fd = -1;
+    }
+}
+
+/*
+ * fileio_uring_enter () - submit entries and/or wait for completions
+ *   return: NO_ERROR or ER_FAILED (errno is set)
+ *   uring_p(in): ring
+ *   to_submit(in): number of new submission entries
+ *   min_complete(in): number of completions to wait for
+ *   submitted_p(out): number of submission entries the kernel accepted; it may be less than to_submit (can be NULL)
+ */
+static int
+fileio_uring_enter (FILEIO_URING * uring_p, unsigned int to_submit, unsigned int min_complete,
+		    unsigned int *submitted_p)
+{
+  unsigned int flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+  int ret;
+
+  if (submitted_p != NULL)
+    {
+      *submitted_p = 0;
+    }
+
+  while (true)
+    {
+      ret = (int) syscall (__NR_io_uring_enter, uring_p->ring_fd, to_submit, min_complete, flags, NULL, 0);
+      if (ret >= 0)
+	{
+	  if (submitted_p != NULL)
+	    {
+	      *submitted_p = (unsigned int) ret;
+	    }
+	  return NO_ERROR;
+	}
+      if (errno != EINTR)
+	{
+	  return ER_FAILED;
+	}
+      /* interrupted; the entries were not consumed, try again */
+    }
+}
+
+/*
+ * fileio_uring_push_runs () - push runs not yet submitted into submission queue, as long as there is room
+ *   return: error code
+ *   thread_p(in): thread entry
+ *   queue_p(in): the queue
+ *
+ * Note: only the entries the kernel accepted are in flight. The others are taken back from the submission queue and
+ *       their runs are executed synchronously.
+ */
+static int
+fileio_uring_push_runs (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p)
+{
+  FILEIO_URING *uring_p = &queue_p->uring;
+  FILEIO_ASYNC_RUN *run_p;
+  struct io_uring_sqe *sqe_p;
+  unsigned int tail, index, to_submit = 0, submitted, head;
+  int i;
+
+  tail = *uring_p->sq_tail;
+  while (queue_p->num_submitted_runs < queue_p->num_runs
+	 && (unsigned int) queue_p->num_inflight + to_submit < uring_p->sq_entries)
+    {
+      run_p = &queue_p->runs[queue_p->num_submitted_runs];
+
+      index = tail & *uring_p->sq_ring_mask;
+      sqe_p = &uring_p->sqes[index];
+      memset (sqe_p, 0, sizeof (struct io_uring_sqe));
+      sqe_p->opcode = run_p->op == FILEIO_ASYNC_READ ? IORING_OP_READV : IORING_OP_WRITEV;
+      sqe_p->fd = run_p->vol_fd;
+      sqe_p->off = (UINT64) FILEIO_GET_FILE_SIZE (queue_p->page_size, run_p->start_page_id);
+      sqe_p->addr = (UINT64) (UINTPTR) & queue_p->iov[run_p->first_request];
+      sqe_p->len = run_p->npages;
+      sqe_p->user_data = (UINT64) queue_p->num_submitted_runs;
+      uring_p->sq_array[index] = index;
+
+      tail++;
+      to_submit++;
+      queue_p->num_submitted_runs++;
+    }
+
+  if (to_submit == 0)
+    {
+      return NO_ERROR;
+    }
+
+  /* publish the new entries before the kernel reads the tail */
+  __atomic_store_n (uring_p->sq_tail, tail, __ATOMIC_RELEASE);
+
+  if (fileio_uring_enter (uring_p, to_submit, 0, &submitted) != NO_ERROR)
+    {
+      er_log_debug (ARG_FILE_LINE, "fileio_uring_push_runs: io_uring_enter failed with errno %d\n", errno);
+    }
+  queue_p->num_inflight += submitted;
+
+  if (submitted == to_submit)
+    {
+      return NO_ERROR;
+    }
+
+  /* the kernel consumes entries in order from the head and reads the tail only on enter, so the entries it did not
+   * accept are the last ones and can be taken back */
+  head = __atomic_load_n (uring_p->sq_head, __ATOMIC_ACQUIRE);
+  assert (tail - head == to_submit - submitted);
+  __atomic_store_n (uring_p->sq_tail, head, __ATOMIC_RELEASE);
+
+  for (i = queue_p->num_submitted_runs - (int) (to_submit - submitted); i < queue_p->num_submitted_runs; i++)
+    {
+      if (fileio_async_execute_run (thread_p, queue_p, &queue_p->runs[i]) != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  /* the remaining runs are abandoned; report on wait */
+	  break;
+	}
+    }
+
+  return queue_p->error_code;
+}
+
+/*
+ * fileio_uring_reap () - wait for at least one completion and process all available completions
+ *   return: void
+ *   thread_p(in): thread entry
+ *   queue_p(in): the queue
+ *
+ * Note: there is no timeout and no way out before a completion arrives: until then the kernel may still read or
+ *       write the buffers of the run. If io_uring_enter cannot wait, the completion queue is polled instead; the
+ *       kernel posts completions to the mapped ring whether or not it is entered.
+ */
+static void
+fileio_uring_reap (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p)
+{
+  FILEIO_URING *uring_p = &queue_p->uring;
+  FILEIO_ASYNC_RUN *run_p;
+  struct io_uring_cqe *cqe_p;
+  unsigned int head, tail;
+  ssize_t expected;
+  bool is_polling = false;
+
+  head = *uring_p->cq_head;
+  tail = __atomic_load_n (uring_p->cq_tail, __ATOMIC_ACQUIRE);
+  while (head == tail)
+    {
+      if (is_polling || fileio_uring_enter (uring_p, 0, 1, NULL) != NO_ERROR)
+	{
+	  if (!is_polling && errno != EAGAIN && errno != EBUSY && errno != ENOMEM)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "fileio_uring_reap: io_uring_enter failed with errno %d, polling the "
+			    "completion queue\n", errno);
+	      is_polling = true;
+	    }
+	  /* the completions are still due, wait for them */
+	  thread_sleep (1);
+	}
+      tail = __atomic_load_n (uring_p->cq_tail, __ATOMIC_ACQUIRE);
+    }
+
+  while (head != tail)
+    {
+      cqe_p = &uring_p->cqes[head & *uring_p->cq_ring_mask];
+      assert (cqe_p->user_data < (UINT64) queue_p->num_runs);
+      run_p = &queue_p->runs[cqe_p->user_data];
+      expected = (ssize_t) (queue_p->page_size * run_p->npages);
+
+      if (cqe_p->res == expected)
+	{
+	  fileio_async_complete_run (thread_p, queue_p, run_p, NO_ERROR);
+	}
+      else if (cqe_p->res == 0 && run_p->op == FILEIO_ASYNC_READ)
+	{
+	  fileio_async_set_error (queue_p, run_p, 0, true);
+	  fileio_async_complete_run (thread_p, queue_p, run_p, queue_p->error_code);
+	}
+      else if (cqe_p->res >= 0 || cqe_p->res == -EINTR || cqe_p->res == -EAGAIN)
+	{
+	  /* partial or interrupted transfer; redo the whole run synchronously (page I/O is idempotent) */
+	  (void) fileio_async_execute_run (thread_p, queue_p, run_p);
+	}
+      else
+	{
+	  fileio_async_set_error (queue_p, run_p, -cqe_p->res, false);
+	  fileio_async_complete_run (thread_p, queue_p, run_p, queue_p->error_code);
+	}
+
+      queue_p->num_inflight--;
+      head++;
+    }
+
+  /* release the completion entries */
+  __atomic_store_n (uring_p->cq_head, head, __ATOMIC_RELEASE);
+}
+#endif /* FILEIO_USE_IO_URING */
+
 /*
  * fileio_synchronize () - Synchronize a database volume's state with that on disk
  *   return: vdes or NULL_VOLDES
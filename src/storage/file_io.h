@@ -170,6 +170,15 @@ typedef enum
   FILEIO_WRITE_NO_COMPENSATE_WRITE	/* skips */
 } FILEIO_WRITE_MODE;
 
+typedef enum
+{
+  FILEIO_ASYNC_READ,
+  FILEIO_ASYNC_WRITE
+} FILEIO_ASYNC_OP;
+
+/* Queue of page reads and writes issued together and kept in flight until waited for. */
+typedef struct fileio_async_queue FILEIO_ASYNC_QUEUE;
+
 /* Reserved area of FILEIO_PAGE */
 typedef struct fileio_page_reserved FILEIO_PAGE_RESERVED;
 struct fileio_page_reserved
@@ -487,6 +496,14 @@ extern void *fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_p
 				 size_t page_size, FILEIO_WRITE_MODE write_mode);
 extern void *fileio_writev (THREAD_ENTRY * thread_p, int vdes, void **arrayof_io_pgptr, PAGEID start_pageid,
 			    DKNPAGES npages, size_t page_size);
+extern FILEIO_ASYNC_QUEUE *fileio_async_queue_create (int max_requests, size_t page_size, FILEIO_WRITE_MODE write_mode);
+extern void fileio_async_queue_destroy (FILEIO_ASYNC_QUEUE * queue_p);
+extern int fileio_async_queue_count (const FILEIO_ASYNC_QUEUE * queue_p);
+extern bool fileio_async_queue_is_full (const FILEIO_ASYNC_QUEUE * queue_p);
+extern int fileio_async_add (FILEIO_ASYNC_QUEUE * queue_p, FILEIO_ASYNC_OP op, int vol_fd, void *io_page_p,
+			     PAGEID page_id);
+extern int fileio_async_submit (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p);
+extern int fileio_async_wait_all (THREAD_ENTRY * thread_p, FILEIO_ASYNC_QUEUE * queue_p);
 extern int fileio_synchronize (THREAD_ENTRY * thread_p, int vdes, const char *vlabel,
 			       FILEIO_SYNC_OPTION check_sync_dwb);
 extern int fileio_synchronize_all (THREAD_ENTRY * thread_p, bool include_log);
@@ -423,6 +423,18 @@ struct file_map_context
   void *args;
 };
 
+/* FILE_SAMPLE_CONTEXT - context variables for file_sample_pages function. */
+typedef struct file_sample_context FILE_SAMPLE_CONTEXT;
+struct file_sample_context
+{
+  bool is_partial;
+  FILE_FTAB_COLLECTOR ftab_collector;
+
+  int n_seen;			/* user pages seen so far */
+  int n_sample;			/* size of sample */
+  VPID *vpids;			/* sampled pages */
+};
+
 /************************************************************************/
 /* Numerable files section                                              */
 /************************************************************************/
@@ -711,6 +723,7 @@ static int file_rv_dealloc_internal (THREAD_ENTRY * thread_p, LOG_RCV * rcv, boo
 STATIC_INLINE int file_create_temp_internal (THREAD_ENTRY * thread_p, int npages, FILE_TYPE ftype, bool is_numerable,
 					     VFID * vfid_out) __attribute__ ((ALWAYS_INLINE));
 static int file_sector_map_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args);
+static int file_sector_sample_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args);
 static DISK_ISVALID file_table_check (THREAD_ENTRY * thread_p, const VFID * vfid, DISK_VOLMAP_CLONE * disk_map_clone);
 
 STATIC_INLINE int file_table_dump (THREAD_ENTRY * thread_p, const FILE_HEADER * fhead, FILE * fp)
@@ -6922,6 +6935,164 @@ exit:
   return error_code;
 }
 
+/*
+ * file_sector_sample_pages () - FILE_EXTDATA_ITEM_FUNC used for sampling user pages
+ *
+ * return        : NO_ERROR
+ * thread_p (in) : thread entry
+ * data (in)     : FILE_PARTIAL_SECTOR or VSID
+ * index (in)    : ignored
+ * stop (out)    : ignored
+ * args (in)     : sample context
+ */
+static int
+file_sector_sample_pages (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args)
+{
+  FILE_SAMPLE_CONTEXT *context = (FILE_SAMPLE_CONTEXT *) args;
+  FILE_PARTIAL_SECTOR partsect = FILE_PARTIAL_SECTOR_INITIALIZER;
+  int iter;
+  int pick;
+  VPID vpid;
+
+  /* hack to know this is partial table or full table */
+  if (context->is_partial)
+    {
+      partsect = *(FILE_PARTIAL_SECTOR *) data;
+    }
+  else
+    {
+      partsect.vsid = *(VSID *) data;
+    }
+
+  vpid.volid = partsect.vsid.volid;
+  for (iter = 0, vpid.pageid = SECTOR_FIRST_PAGEID (partsect.vsid.sectid); iter < FILE_ALLOC_BITMAP_NBITS;
+       iter++, vpid.pageid++)
+    {
+      if (context->is_partial && !file_partsect_is_bit_set (&partsect, iter))
+	{
+	  /* not allocated */
+	  continue;
+	}
+
+      if (file_table_collector_has_page (&context->ftab_collector, &vpid))
+	{
+	  /* skip table pages */
+	  continue;
+	}
+
+      /* reservoir sampling: every page seen so far has the same chance to be in the sample */
+      context->n_seen++;
+      if (context->n_seen <= context->n_sample)
+	{
+	  context->vpids[context->n_seen - 1] = vpid;
+	}
+      else
+	{
+	  pick = (int) (drand48 () * context->n_seen);
+	  if (pick < context->n_sample)
+	    {
+	      context->vpids[pick] = vpid;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * file_sample_pages () - pick a uniform random sample of user pages
+ *
+ * return             : error code
+ * thread_p (in)      : thread entry
+ * vfid (in)          : file identifier
+ * n_sample (in)      : size of sample
+ * vpids_out (out)    : sampled pages, sorted by page identifier; must have room for n_sample pages
+ * n_sampled_out (out): number of sampled pages; less than n_sample if the file does not have that many user pages
+ *
+ * Note: only the file header and table pages are read. The pages are neither fixed nor protected from being
+ *       deallocated afterwards; the caller must check them when it fixes them.
+ */
+int
+file_sample_pages (THREAD_ENTRY * thread_p, const VFID * vfid, int n_sample, VPID * vpids_out, int *n_sampled_out)
+{
+  VPID vpid_fhead;
+  PAGE_PTR page_fhead = NULL;
+  FILE_HEADER *fhead = NULL;
+  FILE_EXTENSIBLE_DATA *extdata_ftab;
+  FILE_SAMPLE_CONTEXT context;
+  int error_code = NO_ERROR;
+
+  assert (vfid != NULL && !VFID_ISNULL (vfid));
+  assert (n_sample > 0 && vpids_out != NULL);
+
+  *n_sampled_out = 0;
+
+  FILE_GET_HEADER_VPID (vfid, &vpid_fhead);
+  page_fhead = pgbuf_fix (thread_p, &vpid_fhead, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (page_fhead == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  fhead = (FILE_HEADER *) page_fhead;
+  file_header_sanity_check (thread_p, fhead);
+
+  context.n_seen = 0;
+  context.n_sample = n_sample;
+  context.vpids = vpids_out;
+  context.ftab_collector.partsect_ftab = NULL;
+
+  /* collect table pages */
+  error_code = file_table_collect_ftab_pages (thread_p, page_fhead, true, &context.ftab_collector);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  /* sample partial sectors table */
+  FILE_HEADER_GET_PART_FTAB (fhead, extdata_ftab);
+  context.is_partial = true;
+  error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_sample_pages, &context,
+					 false, NULL, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  if (!FILE_IS_TEMPORARY (fhead))
+    {
+      /* sample full table */
+      context.is_partial = false;
+      FILE_HEADER_GET_FULL_FTAB (fhead, extdata_ftab);
+      error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_sample_pages, &context,
+					     false, NULL, NULL);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit;
+	}
+    }
+
+  *n_sampled_out = MIN (context.n_seen, n_sample);
+
+  /* read the sample in disk order */
+  qsort (vpids_out, *n_sampled_out, sizeof (VPID), pgbuf_compare_vpid);
+
+exit:
+  if (page_fhead != NULL)
+    {
+      pgbuf_unfix (thread_p, page_fhead);
+    }
+  if (context.ftab_collector.partsect_ftab != NULL)
+    {
+      db_private_free (thread_p, context.ftab_collector.partsect_ftab);
+    }
+
+  return error_code;
+}
+
 /*
  * file_table_check () - check file table is valid
  *
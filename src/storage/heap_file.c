@@ -688,6 +688,7 @@ static int heap_attrinfo_start_refoids (THREAD_ENTRY * thread_p, OID * class_oid
 static int heap_attrinfo_get_disksize (HEAP_CACHE_ATTRINFO * attr_info, bool is_mvcc_class, int *offset_size_ptr);
 
 static int heap_attrvalue_read (RECDES * recdes, HEAP_ATTRVALUE * value, HEAP_CACHE_ATTRINFO * attr_info);
+static int heap_attrvalue_read_deferred (HEAP_ATTRVALUE * value);
 
 static int heap_midxkey_get_value (RECDES * recdes, OR_ATTRIBUTE * att, DB_VALUE * value,
 				   HEAP_CACHE_ATTRINFO * attr_info);
@@ -766,6 +767,8 @@ static SCAN_CODE heap_get_record_info (THREAD_ENTRY * thread_p, const OID oid, R
 static SCAN_CODE heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 				     RECDES * recdes, HEAP_SCANCACHE * scan_cache, bool ispeeking,
 				     bool reversed_direction, DB_VALUE ** cache_recordinfo);
+static int heap_page_fix_of_class (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const VPID * vpid,
+				   PAGE_PTR * pgptr, RECDES * recdes);
 
 static SCAN_CODE heap_get_page_info (THREAD_ENTRY * thread_p, const OID * cls_oid, const HFID * hfid, const VPID * vpid,
 				     const PAGE_PTR pgptr, DB_VALUE ** page_info);
@@ -6808,6 +6811,24 @@ heap_scancache_start (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, cons
 					mvcc_snapshot);
 }
 
+/*
+ * heap_scancache_start_helper () - Start caching information for a thread that helps the heap scan of another thread
+ *   return: NO_ERROR
+ *   scan_cache(in/out): Scan cache
+ *   hfid(in): Heap file identifier of the scan cache
+ *   class_oid(in): Class identifier of scan cache
+ *   mvcc_snapshot(in): Snapshot of the transaction of the helped scan
+ *
+ * Note: Unlike heap_scancache_start, no lock is acquired on the class; the helped scan already holds it. The last fixed
+ *       page is cached.
+ */
+int
+heap_scancache_start_helper (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const HFID * hfid,
+			     const OID * class_oid, MVCC_SNAPSHOT * mvcc_snapshot)
+{
+  return heap_scancache_start_internal (thread_p, scan_cache, hfid, class_oid, true, false, false, mvcc_snapshot);
+}
+
 /*
  * heap_scancache_start_modify () - Start caching information for heap
  *                                modifications
@@ -7863,6 +7884,12 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 		  assert (scan_cache->page_watcher.pgptr == NULL);
 		  return S_ERROR;
 		}
+
+	      if (!reversed_direction)
+		{
+		  /* heap pages are mostly allocated in file order; have the next ones read ahead */
+		  pgbuf_read_ahead (thread_p, &vpid);
+		}
 	    }
 
 	  if (get_rec_info)
@@ -9414,6 +9441,8 @@ heap_attrinfo_start (THREAD_ENTRY * thread_p, const OID * class_oid, int request
       return NO_ERROR;
     }
 
+  attr_info->defer_json = false;
+
   if (requested_num_attrs < 0)
     {
       getall = true;
@@ -10160,6 +10189,20 @@ heap_attrvalue_read (RECDES * recdes, HEAP_ATTRVALUE * value, HEAP_CACHE_ATTRINF
 	}
       value->state = HEAP_READ_ATTRVALUE;
     }
+  else if (attr_info->defer_json && attrepr == value->read_attrepr && attrepr->type == DB_TYPE_JSON)
+    {
+      /* Do not deserialize the document yet. JSON_EXTRACT may walk its path on the disk value and deserialize only the
+       * extracted value; otherwise it is read by heap_attrinfo_access. */
+      ret = db_value_domain_init (&value->dbvalue, attrepr->type, attrepr->domain->precision, attrepr->domain->scale);
+      if (ret != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+      OR_VAR_LENGTH (value->deferred_length, recdes->data, value->read_attrepr->location,
+		     attr_info->read_classrepr->n_variable);
+      value->deferred_data = disk_data;
+      value->state = HEAP_DEFERRED_ATTRVALUE;
+    }
   else
     {
       /*
@@ -10201,6 +10244,46 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * heap_attrvalue_read_deferred () - Read the dbvalue of an attribute value that was only located in the instance
+ *   return: NO_ERROR
+ *   value(in/out): Disk value attribute information
+ */
+static int
+heap_attrvalue_read_deferred (HEAP_ATTRVALUE * value)
+{
+  OR_BUF buf;
+  PR_TYPE *pr_type;
+  int ret = NO_ERROR;
+
+  assert (value->state == HEAP_DEFERRED_ATTRVALUE && value->read_attrepr != NULL);
+
+  OR_BUF_INIT2 (buf, value->deferred_data, value->deferred_length);
+  buf.error_abort = 1;
+
+  switch (_setjmp (buf.env))
+    {
+    case 0:
+      pr_type = pr_type_from_id (value->read_attrepr->type);
+      if (pr_type)
+	{
+	  ret = pr_type->data_readval (&buf, &value->dbvalue, value->read_attrepr->domain, value->deferred_length,
+				       false, NULL, 0);
+	}
+      value->state = (ret == NO_ERROR) ? HEAP_READ_ATTRVALUE : HEAP_UNINIT_ATTRVALUE;
+      break;
+    default:
+      /*
+       * An error was found during the reading of the attribute value
+       */
+      value->state = HEAP_UNINIT_ATTRVALUE;
+      ret = ER_FAILED;
+      break;
+    }
+
+  return ret;
+}
+
 /*
  * heap_midxkey_get_value () -
  *   return:
@@ -10422,6 +10505,59 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * heap_attrinfo_peek_fixed () - Locate the disk value of a fixed size attribute of an instance, without making a db_value
+ *   return: NO_ERROR
+ *   thread_p(in):
+ *   recdes(in): The instance Record descriptor
+ *   attrid(in): The desired attribute identifier
+ *   attr_info(in/out): The attribute information structure which describe the desired attributes
+ *   type(out): Type of the attribute in the representation of the instance or DB_TYPE_UNKNOWN if the value can not
+ *              be peeked (the attribute is not fixed size or it is not in the representation of the instance); the
+ *              value must be read with heap_attrinfo_read_dbvalues then
+ *   disk_data(out): The disk value or NULL if the attribute is null
+ */
+int
+heap_attrinfo_peek_fixed (THREAD_ENTRY * thread_p, RECDES * recdes, ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info,
+			  DB_TYPE * type, char **disk_data)
+{
+  REPR_ID reprid;
+  HEAP_ATTRVALUE *value;
+  int ret = NO_ERROR;
+
+  *type = DB_TYPE_UNKNOWN;
+  *disk_data = NULL;
+
+  reprid = or_rep_id (recdes);
+  if (attr_info->read_classrepr == NULL || attr_info->read_classrepr->id != reprid)
+    {
+      /* Get the needed representation */
+      ret = heap_attrinfo_recache (thread_p, reprid, attr_info);
+      if (ret != NO_ERROR)
+	{
+	  return ret;
+	}
+    }
+
+  value = heap_attrvalue_locate (attrid, attr_info);
+  if (value == NULL || value->read_attrepr == NULL || value->attr_type == HEAP_SHARED_ATTR
+      || value->attr_type == HEAP_CLASS_ATTR || !value->read_attrepr->is_fixed)
+    {
+      return NO_ERROR;
+    }
+
+  *type = value->read_attrepr->type;
+  if (!OR_FIXED_ATT_IS_UNBOUND (recdes->data, attr_info->read_classrepr->n_variable,
+				attr_info->read_classrepr->fixed_length, value->read_attrepr->position))
+    {
+      *disk_data = ((char *) recdes->data
+		    + OR_FIXED_ATTRIBUTES_OFFSET_BY_OBJ (recdes->data, attr_info->read_classrepr->n_variable)
+		    + value->read_attrepr->location);
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * heap_attrinfo_delete_lob ()
  *   return: NO_ERROR
@@ -10651,9 +10787,51 @@ heap_attrinfo_access (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info)
       return NULL;
     }
 
+  if (value->state == HEAP_DEFERRED_ATTRVALUE && heap_attrvalue_read_deferred (value) != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return NULL;
+    }
+
   return &value->dbvalue;
 }
 
+/*
+ * heap_attrinfo_peek_deferred () - Locate the disk value of an attribute that has not been read into its dbvalue
+ *   return: NO_ERROR
+ *   attrid(in): The desired attribute identifier
+ *   attr_info(in): The attribute information structure which describe the desired attributes
+ *   disk_data(out): The disk value or NULL if the value is not deferred; it is then accessed by heap_attrinfo_access
+ *   disk_length(out): The length of the disk value
+ *
+ * Note: The disk value points in the instance record and it is valid as long as the record read by
+ *       heap_attrinfo_read_dbvalues is.
+ */
+int
+heap_attrinfo_peek_deferred (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info, char **disk_data, int *disk_length)
+{
+  HEAP_ATTRVALUE *value;
+
+  *disk_data = NULL;
+  *disk_length = 0;
+
+  value = heap_attrvalue_locate (attrid, attr_info);
+  if (value == NULL)
+    {
+      er_log_debug (ARG_FILE_LINE, "heap_attrinfo_peek_deferred: Unknown attrid = %d", attrid);
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+      return ER_GENERIC_ERROR;
+    }
+
+  if (value->state == HEAP_DEFERRED_ATTRVALUE)
+    {
+      *disk_data = value->deferred_data;
+      *disk_length = value->deferred_length;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * heap_get_class_subclasses () - get OIDs of subclasses for a given class
  * return : error code or NO_ERROR
@@ -11857,6 +12035,7 @@ heap_attrinfo_start_refoids (THREAD_ENTRY * thread_p, OID * class_oid, HEAP_CACH
   int ret = NO_ERROR;
 
   attr_info->num_values = -1;
+  attr_info->defer_json = false;
 
   /*
    * Find the current representation of the class, then scan all its
@@ -11942,6 +12121,7 @@ heap_attrinfo_start_with_index (THREAD_ENTRY * thread_p, OID * class_oid, RECDES
 
   set_attrids = guess_attrids;
   attr_info->num_values = -1;	/* initialize attr_info */
+  attr_info->defer_json = false;
 
   classrepr = heap_classrepr_get (thread_p, class_oid, class_recdes, NULL_REPRID, &classrepr_cacheindex);
   if (classrepr == NULL)
@@ -12177,6 +12357,7 @@ heap_attrinfo_start_with_btid (THREAD_ENTRY * thread_p, OID * class_oid, BTID *
   set_attrids = guess_attrids;
 
   attr_info->num_values = -1;	/* initialize attr_info */
+  attr_info->defer_json = false;
 
   /*
    *  Get the class representation so that we can access the indexes.
@@ -18529,6 +18710,231 @@ heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * ne
   return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL);
 }
 
+/*
+ * heap_page_fix_of_class () - Fix a heap page that may have been deallocated or reused since its identifier was read
+ *   return: NO_ERROR or error code
+ *   scan_cache(in/out): Scan cache; its page is unfixed
+ *   vpid(in): Page to fix
+ *   pgptr(out): Fixed page, or NULL if the page is no longer a heap page of the class of the scan cache
+ *   recdes(out): Heap header or chain record of the fixed page
+ */
+static int
+heap_page_fix_of_class (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const VPID * vpid, PAGE_PTR * pgptr,
+			RECDES * recdes)
+{
+  int error_code = NO_ERROR;
+
+  *pgptr = NULL;
+
+  if (scan_cache->page_watcher.pgptr != NULL)
+    {
+      pgbuf_ordered_unfix (thread_p, &scan_cache->page_watcher);
+    }
+
+  error_code = pgbuf_fix_if_not_deallocated (thread_p, vpid, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH, pgptr);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  if (*pgptr == NULL)
+    {
+      /* deallocated */
+      return NO_ERROR;
+    }
+
+  if (pgbuf_get_page_ptype (thread_p, *pgptr) != PAGE_HEAP
+      || spage_get_record (thread_p, *pgptr, HEAP_HEADER_AND_CHAIN_SLOTID, recdes, PEEK) != S_SUCCESS)
+    {
+      /* reused by another file */
+      pgbuf_unfix_and_init (thread_p, *pgptr);
+      return NO_ERROR;
+    }
+
+  /* both the chain record and the heap header start with class OID */
+  if (!OID_EQ (&((HEAP_CHAIN *) recdes->data)->class_oid, &scan_cache->node.class_oid))
+    {
+      pgbuf_unfix_and_init (thread_p, *pgptr);
+      return NO_ERROR;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_page_fix_in_chain () - Fix a heap page reached through a link read earlier from the page chain
+ *   return: NO_ERROR or error code
+ *   scan_cache(in/out): Scan cache; the page is kept fixed in it
+ *   vpid(in): Page to fix
+ *   prev_vpid(in): Page the link to vpid was read from, or NULL if vpid is the heap header page
+ *   next_vpid(out): Next page in the chain
+ *   is_linked(out): false if the page was deallocated or no longer follows prev_vpid; the page is not kept fixed then
+ *
+ * Note: Unlike heap_next, the previous page is not kept fixed while moving to the next one, so the page may be removed
+ *       from the chain and even reused in between. The caller has to walk the chain again from a page it knows is
+ *       still linked when is_linked is false. The fixed page can be scanned with heap_page_next.
+ */
+int
+heap_page_fix_in_chain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const VPID * vpid,
+			const VPID * prev_vpid, VPID * next_vpid, bool * is_linked)
+{
+  PAGE_PTR pgptr = NULL;
+  RECDES recdes;
+  HEAP_CHAIN *chain;
+  int error_code = NO_ERROR;
+
+  assert (scan_cache != NULL && scan_cache->cache_last_fix_page);
+
+  *is_linked = false;
+  VPID_SET_NULL (next_vpid);
+
+  error_code = heap_page_fix_of_class (thread_p, scan_cache, vpid, &pgptr, &recdes);
+  if (error_code != NO_ERROR || pgptr == NULL)
+    {
+      return error_code;
+    }
+
+  chain = (HEAP_CHAIN *) recdes.data;
+  if (prev_vpid == NULL)
+    {
+      /* heap header page */
+      *next_vpid = ((HEAP_HDR_STATS *) recdes.data)->next_vpid;
+    }
+  else
+    {
+      if (!VPID_EQ (&chain->prev_vpid, prev_vpid))
+	{
+	  /* removed from the chain or moved elsewhere */
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	  return NO_ERROR;
+	}
+      *next_vpid = chain->next_vpid;
+    }
+
+  pgbuf_attach_watcher (thread_p, pgptr, PGBUF_LATCH_READ, &scan_cache->node.hfid, &scan_cache->page_watcher);
+  *is_linked = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_page_fix_sampled () - Fix a heap page picked by sampling the pages of the heap file
+ *   return: NO_ERROR or error code
+ *   scan_cache(in/out): Scan cache; the page is kept fixed in it
+ *   vpid(in): Page to fix
+ *   is_heap_page(out): false if the page was deallocated or reused; the page is not kept fixed then
+ *
+ * Note: The sampled pages are not protected while the sample is read (see file_sample_pages). The fixed page can be
+ *       scanned with heap_page_next.
+ */
+int
+heap_page_fix_sampled (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const VPID * vpid, bool * is_heap_page)
+{
+  PAGE_PTR pgptr = NULL;
+  RECDES recdes;
+  int error_code = NO_ERROR;
+
+  assert (scan_cache != NULL && scan_cache->cache_last_fix_page);
+
+  *is_heap_page = false;
+
+  error_code = heap_page_fix_of_class (thread_p, scan_cache, vpid, &pgptr, &recdes);
+  if (error_code != NO_ERROR || pgptr == NULL)
+    {
+      return error_code;
+    }
+
+  pgbuf_attach_watcher (thread_p, pgptr, PGBUF_LATCH_READ, &scan_cache->node.hfid, &scan_cache->page_watcher);
+  *is_heap_page = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_page_next () - Retrieve or peek next visible object of a heap page
+ *   return: SCAN_CODE (Either of S_SUCCESS, S_DOESNT_FIT, S_END, S_ERROR)
+ *   next_oid(in/out): Object identifier of current record; NULL_SLOTID to start with the first record of the page.
+ *                     Will be set to next visible record of the same page.
+ *   recdes(in/out): Pointer to a record descriptor. Will be modified to describe the new record.
+ *   scan_cache(in/out): Scan cache; it must cache the last fixed page
+ *   ispeeking(in): PEEK or COPY
+ *
+ * Note: Unlike heap_next, S_END is returned at the end of the page instead of moving on to the next page. The page is
+ *       unfixed then.
+ */
+SCAN_CODE
+heap_page_next (THREAD_ENTRY * thread_p, OID * next_oid, RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking)
+{
+  VPID vpid;
+  RECDES forward_recdes;
+  INT16 type;
+  SCAN_CODE scan;
+  bool is_null_recdata = (recdes->data == NULL);
+
+  assert (scan_cache != NULL && scan_cache->cache_last_fix_page);
+  assert (!OID_ISNULL (&scan_cache->node.class_oid));
+
+  vpid.volid = next_oid->volid;
+  vpid.pageid = next_oid->pageid;
+
+  while (true)
+    {
+      /* the page may have been unfixed or replaced while getting the visible version of previous record */
+      if (scan_cache->page_watcher.pgptr != NULL
+	  && !VPID_EQ (&vpid, pgbuf_get_vpid_ptr (scan_cache->page_watcher.pgptr)))
+	{
+	  pgbuf_ordered_unfix (thread_p, &scan_cache->page_watcher);
+	}
+      if (scan_cache->page_watcher.pgptr == NULL)
+	{
+	  if (heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, S_LOCK, scan_cache,
+					   &scan_cache->page_watcher) == NULL)
+	    {
+	      ASSERT_ERROR ();
+	      return S_ERROR;
+	    }
+	}
+
+      /* Find the next object. Skip relocated records (i.e., new_home records). */
+      while (true)
+	{
+	  scan = spage_next_record (scan_cache->page_watcher.pgptr, &next_oid->slotid, &forward_recdes, PEEK);
+	  if (scan != S_SUCCESS)
+	    {
+	      break;
+	    }
+	  if (next_oid->slotid == HEAP_HEADER_AND_CHAIN_SLOTID)
+	    {
+	      continue;
+	    }
+	  type = spage_get_record_type (scan_cache->page_watcher.pgptr, next_oid->slotid);
+	  if (type != REC_NEWHOME && type != REC_ASSIGN_ADDRESS && type != REC_UNKNOWN)
+	    {
+	      break;
+	    }
+	}
+      if (scan != S_SUCCESS)
+	{
+	  pgbuf_ordered_unfix (thread_p, &scan_cache->page_watcher);
+	  return scan;
+	}
+
+      scan =
+	heap_scan_get_visible_version (thread_p, next_oid, &scan_cache->node.class_oid, recdes, scan_cache, ispeeking,
+				       NULL_CHN);
+      if (scan != S_SNAPSHOT_NOT_SATISFIED && scan != S_DOESNT_EXIST)
+	{
+	  return scan;
+	}
+
+      /* the record does not satisfy the snapshot or was deleted - continue */
+      if (is_null_recdata)
+	{
+	  recdes->data = NULL;
+	}
+    }
+}
+
 /*
  * heap_next_record_info () - Retrieve or peek next object.
  *
@@ -407,6 +407,8 @@ extern int xheap_reclaim_addresses (THREAD_ENTRY * thread_p, const HFID * hfid);
 extern int heap_scancache_start (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const HFID * hfid,
 				 const OID * class_oid, int cache_last_fix_page, int is_indexscan,
 				 MVCC_SNAPSHOT * mvcc_snapshot);
+extern int heap_scancache_start_helper (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const HFID * hfid,
+					const OID * class_oid, MVCC_SNAPSHOT * mvcc_snapshot);
 extern int heap_scancache_start_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const HFID * hfid,
 					const OID * class_oid, int op_type, MVCC_SNAPSHOT * mvcc_snapshot);
 extern int heap_scancache_quick_start (HEAP_SCANCACHE * scan_cache);
@@ -417,6 +419,12 @@ extern void heap_scancache_end_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE *
 extern SCAN_CODE heap_get_class_oid (THREAD_ENTRY * thread_p, const OID * oid, OID * class_oid);
 extern SCAN_CODE heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 			    RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking);
+extern int heap_page_fix_in_chain (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const VPID * vpid,
+				   const VPID * prev_vpid, VPID * next_vpid, bool * is_linked);
+extern int heap_page_fix_sampled (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const VPID * vpid,
+				  bool * is_heap_page);
+extern SCAN_CODE heap_page_next (THREAD_ENTRY * thread_p, OID * next_oid, RECDES * recdes, HEAP_SCANCACHE * scan_cache,
+				 int ispeeking);
 extern SCAN_CODE heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 					RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking,
 					DB_VALUE ** cache_recordinfo);
@@ -473,8 +481,12 @@ extern int heap_attrinfo_read_dbvalues (THREAD_ENTRY * thread_p, const OID * ins
 					HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_read_dbvalues_without_oid (THREAD_ENTRY * thread_p, RECDES * recdes,
 						    HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_attrinfo_peek_fixed (THREAD_ENTRY * thread_p, RECDES * recdes, ATTR_ID attrid,
+				     HEAP_CACHE_ATTRINFO * attr_info, DB_TYPE * type, char **disk_data);
 extern int heap_attrinfo_delete_lob (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_CACHE_ATTRINFO * attr_info);
 extern DB_VALUE *heap_attrinfo_access (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_attrinfo_peek_deferred (ATTR_ID attrid, HEAP_CACHE_ATTRINFO * attr_info, char **disk_data,
+					int *disk_length);
 extern int heap_attrinfo_set (const OID * inst_oid, ATTR_ID attrid, DB_VALUE * attr_val,
 			      HEAP_CACHE_ATTRINFO * attr_info);
 extern SCAN_CODE heap_attrinfo_transform_to_disk (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info,
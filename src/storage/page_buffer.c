@@ -96,6 +96,11 @@ static int rv;
 #define PGBUF_TIMEOUT                      300	/* timeout seconds */
 #define PGBUF_FIX_COUNT_THRESHOLD           64	/* fix count threshold. used as indicator for hot pages. */
 
+/* read-ahead never crosses the sector of the page that triggers it; all pages of a sector belong to the same file. */
+#define PGBUF_READ_AHEAD_MAX_PAGES DISK_SECTOR_NPAGES
+/* read-ahead windows waiting for the read-ahead daemon; windows requested when it is full are dropped. */
+#define PGBUF_READ_AHEAD_QUEUE_SIZE 256
+
 /* size of io page */
 #if defined(CUBRID_DEBUG)
 #define SIZEOF_IOPAGE_PAGESIZE_AND_GUARD() (IO_PAGESIZE + sizeof (pgbuf_Guard))
@@ -221,6 +226,11 @@ typedef enum
 #define PGBUF_BCB_TO_VACUUM_FLAG            ((int) 0x04000000)
 /* flag for asynchronous flush request */
 #define PGBUF_BCB_ASYNC_FLUSH_REQ           ((int) 0x02000000)
+/* flag for pages read ahead and not fixed yet. it is cleared by first fix (a read-ahead hit) or when bcb is victimized
+ * or invalidated (a wasted read-ahead). */
+#define PGBUF_BCB_READ_AHEAD_FLAG           ((int) 0x01000000)
+/* flag for read latched bcb's that can be fixed for read without bcb mutex. see pgbuf_fix_lock_free_read. */
+#define PGBUF_BCB_LOCK_FREE_READ_FLAG       ((int) 0x00800000)
 
 /* add all flags here */
 #define PGBUF_BCB_FLAGS_MASK \
@@ -230,7 +240,9 @@ typedef enum
    | PGBUF_BCB_INVALIDATE_DIRECT_VICTIM_FLAG \
    | PGBUF_BCB_MOVE_TO_LRU_BOTTOM_FLAG \
    | PGBUF_BCB_TO_VACUUM_FLAG \
-   | PGBUF_BCB_ASYNC_FLUSH_REQ)
+   | PGBUF_BCB_ASYNC_FLUSH_REQ \
+   | PGBUF_BCB_READ_AHEAD_FLAG \
+   | PGBUF_BCB_LOCK_FREE_READ_FLAG)
 
 /* add flags that invalidate a victim candidate here */
 /* 1. dirty bcb's cannot be victimized.
@@ -340,6 +352,8 @@ typedef struct pgbuf_aout_buf PGBUF_AOUT_BUF;
 
 typedef struct pgbuf_buffer_lock PGBUF_BUFFER_LOCK;
 typedef struct pgbuf_buffer_hash PGBUF_BUFFER_HASH;
+typedef struct pgbuf_read_ahead_context PGBUF_READ_AHEAD_CONTEXT;
+typedef struct pgbuf_read_ahead_request PGBUF_READ_AHEAD_REQUEST;
 
 typedef struct pgbuf_lru_list PGBUF_LRU_LIST;
 typedef struct pgbuf_aout_list PGBUF_AOUT_LIST;
@@ -391,6 +405,7 @@ struct pgbuf_batch_flush_helper
 struct pgbuf_holder
 {
   int fix_count;		/* the count of fix by the holder */
+  int lock_free_fix_count;	/* the count of fix by the holder done without BCB mutex (included in fix_count) */
   PGBUF_BCB *bufptr;		/* pointer to BCB */
   PGBUF_HOLDER *thrd_link;	/* the next BCB holder entry in the BCB holder list of thread */
   PGBUF_HOLDER *next_holder;	/* free BCB holder list of thread */
@@ -434,6 +449,8 @@ struct pgbuf_bcb
   volatile int flags;
 #if defined(SERVER_MODE)
   THREAD_ENTRY *next_wait_thrd;	/* BCB waiting queue */
+  volatile int lock_free_fcnt;	/* Fix count of read fixes done without BCB mutex */
+  bool has_lock_free_fix;	/* fcnt includes one fix on behalf of lock_free_fcnt */
 #endif				/* SERVER_MODE */
   PGBUF_BCB *hash_next;		/* next hash chain */
   PGBUF_BCB *prev_BCB;		/* prev LRU chain */
@@ -493,6 +510,29 @@ struct pgbuf_buffer_hash
   PGBUF_BUFFER_LOCK *lock_next;	/* the anchor of buffer lock chain */
 };
 
+/* read-ahead context structure
+ *
+ * read-ahead table is the array of read-ahead contexts, one for each thread.
+ * the I/O queue, the BCB array and the buffer locks used to read ahead pages are allocated on first read-ahead.
+ * unlike buf_lock_table, a thread may hold several buffer locks from its read-ahead context, one for each page it
+ * reads ahead.
+ */
+struct pgbuf_read_ahead_context
+{
+  VPID last_read_vpid;		/* last page read from disk when fixed by thread */
+  VPID window_end_vpid;		/* first page after the last read-ahead window */
+  FILEIO_ASYNC_QUEUE *io_queue;	/* queue used to read ahead pages */
+  PGBUF_BCB **bcbs;		/* BCB's claimed by current read-ahead */
+  PGBUF_BUFFER_LOCK *buffer_locks;	/* buffer locks on pages being read ahead */
+};
+
+/* read-ahead window handed to the read-ahead daemon */
+struct pgbuf_read_ahead_request
+{
+  VPID first_vpid;		/* first page of the window */
+  PAGEID last_pageid;		/* last page of the window, in the same sector */
+};
+
 /* buffer LRU list structure : double linked list */
 struct pgbuf_lru_list
 {
@@ -673,6 +713,7 @@ struct pgbuf_buffer_pool
   PGBUF_BCB *BCB_table;		/* BCB table */
   PGBUF_BUFFER_HASH *buf_hash_table;	/* buffer hash table */
   PGBUF_BUFFER_LOCK *buf_lock_table;	/* buffer lock table */
+  PGBUF_READ_AHEAD_CONTEXT *read_ahead_table;	/* read-ahead context table */
   PGBUF_IOPAGE_BUFFER *iopage_table;	/* IO page table */
   int num_LRU_list;		/* number of shared LRU lists */
   float ratio_lru1;		/* ratio for lru 1 zone */
@@ -728,6 +769,7 @@ struct pgbuf_buffer_pool
 #if defined (SERVER_MODE)
   PGBUF_DIRECT_VICTIM direct_victims;	/* direct victim assignment */
   lockfree::circular_queue<PGBUF_BCB *> *flushed_bcbs;	/* post-flush processing */
+  lockfree::circular_queue<PGBUF_READ_AHEAD_REQUEST> *read_ahead_requests;	/* windows to read ahead */
 #endif				/* SERVER_MODE */
   lockfree::circular_queue<int> *private_lrus_with_victims;
   lockfree::circular_queue<int> *big_private_lrus_with_victims;
@@ -910,6 +952,7 @@ static INLINE bool pgbuf_is_temporary_volume (VOLID volid) __attribute__ ((ALWAY
 static int pgbuf_initialize_bcb_table (void);
 static int pgbuf_initialize_hash_table (void);
 static int pgbuf_initialize_lock_table (void);
+static int pgbuf_initialize_read_ahead_table (void);
 static int pgbuf_initialize_lru_list (void);
 static int pgbuf_initialize_aout_list (void);
 static int pgbuf_initialize_invalid_list (void);
@@ -923,7 +966,8 @@ STATIC_INLINE PGBUF_HOLDER *pgbuf_find_thrd_holder (THREAD_ENTRY * thread_p, PGB
 STATIC_INLINE int pgbuf_remove_thrd_holder (THREAD_ENTRY * thread_p, PGBUF_HOLDER * holder)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_unlatch_thrd_holder (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
-					     PGBUF_HOLDER_STAT * holder_perf_stat_p) __attribute__ ((ALWAYS_INLINE));
+					     PGBUF_HOLDER_STAT * holder_perf_stat_p, bool * is_lock_free_fix)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int holder_status)
   __attribute__ ((ALWAYS_INLINE));
 static void pgbuf_unlatch_void_zone_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int thread_private_lru_index);
@@ -935,6 +979,14 @@ STATIC_INLINE int pgbuf_latch_bcb_upon_fix (THREAD_ENTRY * thread_p, PGBUF_BCB *
 					    int buf_lock_acquired, PGBUF_LATCH_CONDITION condition,
 					    bool * is_latch_wait) __attribute__ ((ALWAYS_INLINE));
 static int pgbuf_latch_idle_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE request_mode);
+#if defined (SERVER_MODE)
+static PGBUF_BCB *pgbuf_fix_lock_free_read (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor,
+					    const VPID * vpid);
+static void pgbuf_unfix_lock_free_read (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
+STATIC_INLINE void pgbuf_bcb_allow_lock_free_read (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
+  __attribute__ ((ALWAYS_INLINE));
+static void pgbuf_bcb_stop_lock_free_read (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_HOLDER * holder);
+#endif /* SERVER_MODE */
 
 STATIC_INLINE PGBUF_BCB *pgbuf_search_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor,
 						  const VPID * vpid) __attribute__ ((ALWAYS_INLINE));
@@ -948,6 +1000,14 @@ static int pgbuf_unlock_page (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_
 static PGBUF_BCB *pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid);
 static PGBUF_BCB *pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE fetch_mode,
 					   PGBUF_BUFFER_HASH * hash_anchor, PGBUF_FIX_PERF * perf, bool * try_again);
+STATIC_INLINE void pgbuf_init_new_page (PGBUF_BCB * bufptr) __attribute__ ((ALWAYS_INLINE));
+static bool pgbuf_try_lock_page_for_read_ahead (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor,
+						const VPID * vpid, PGBUF_BUFFER_LOCK * buffer_lock);
+static PGBUF_BCB *pgbuf_allocate_bcb_for_read_ahead (THREAD_ENTRY * thread_p);
+static PGBUF_READ_AHEAD_CONTEXT *pgbuf_get_read_ahead_context (THREAD_ENTRY * thread_p);
+static void pgbuf_read_ahead_pages (THREAD_ENTRY * thread_p, const VPID * vpid);
+static void pgbuf_read_ahead_window (THREAD_ENTRY * thread_p, const VPID * first_vpid, PAGEID last_pageid);
+static void pgbuf_read_ahead_after_fix (THREAD_ENTRY * thread_p, const VPID * vpid, bool is_read_ahead_hit);
 static int pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
 static int pgbuf_bcb_safe_flush_internal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool synchronous, bool * locked);
 static int pgbuf_invalidate_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
@@ -1110,6 +1170,9 @@ STATIC_INLINE bool pgbuf_bcb_is_direct_victim (const PGBUF_BCB * bcb) __attribut
 STATIC_INLINE bool pgbuf_bcb_is_invalid_direct_victim (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_async_flush_request (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_is_to_vacuum (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE bool pgbuf_bcb_is_read_ahead (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE bool pgbuf_bcb_is_lock_free_read (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int pgbuf_bcb_get_fix_count (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_should_be_moved_to_bottom_lru (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_bcb_avoid_victim (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_set_dirty (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
@@ -1155,6 +1218,7 @@ static cubthread::daemon *pgbuf_Page_maintenance_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_post_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Flush_control_daemon = NULL;
+static cubthread::daemon *pgbuf_Read_ahead_daemon = NULL;
 // *INDENT-ON*
 #endif /* SERVER_MODE */
 
@@ -1298,6 +1362,11 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  if (pgbuf_initialize_read_ahead_table () != NO_ERROR)
+    {
+      goto error;
+    }
+
   if (pgbuf_initialize_lru_list () != NO_ERROR)
     {
       goto error;
@@ -1397,6 +1466,15 @@ pgbuf_initialize (void)
       ASSERT_ERROR ();
       goto error;
     }
+
+  /* *INDENT-OFF* */
+  pgbuf_Pool.read_ahead_requests = new lockfree::circular_queue<PGBUF_READ_AHEAD_REQUEST> (PGBUF_READ_AHEAD_QUEUE_SIZE);
+  /* *INDENT-ON* */
+  if (pgbuf_Pool.read_ahead_requests == NULL)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
 #endif /* SERVER_MODE */
 
   if (PGBUF_PAGE_QUOTA_IS_ENABLED)
@@ -1473,6 +1551,27 @@ pgbuf_finalize (void)
       free_and_init (pgbuf_Pool.buf_lock_table);
     }
 
+  /* final task for read-ahead table */
+  if (pgbuf_Pool.read_ahead_table != NULL)
+    {
+      for (j = 0; j < (size_t) thread_num_total_threads (); j++)
+	{
+	  if (pgbuf_Pool.read_ahead_table[j].io_queue != NULL)
+	    {
+	      fileio_async_queue_destroy (pgbuf_Pool.read_ahead_table[j].io_queue);
+	    }
+	  if (pgbuf_Pool.read_ahead_table[j].bcbs != NULL)
+	    {
+	      free_and_init (pgbuf_Pool.read_ahead_table[j].bcbs);
+	    }
+	  if (pgbuf_Pool.read_ahead_table[j].buffer_locks != NULL)
+	    {
+	      free_and_init (pgbuf_Pool.read_ahead_table[j].buffer_locks);
+	    }
+	}
+      free_and_init (pgbuf_Pool.read_ahead_table);
+    }
+
   /* final task for BCB table */
   if (pgbuf_Pool.BCB_table != NULL)
     {
@@ -1602,6 +1701,11 @@ pgbuf_finalize (void)
       delete pgbuf_Pool.flushed_bcbs;
       pgbuf_Pool.flushed_bcbs = NULL;
     }
+  if (pgbuf_Pool.read_ahead_requests != NULL)
+    {
+      delete pgbuf_Pool.read_ahead_requests;
+      pgbuf_Pool.read_ahead_requests = NULL;
+    }
 #endif /* SERVER_MODE */
 
   if (pgbuf_Pool.private_lrus_with_victims != NULL)
@@ -1721,6 +1825,7 @@ pgbuf_fix_release (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE f
 #endif /* !NDEBUG */
   PGBUF_FIX_PERF perf;
   bool maybe_deallocated, force_set_vpid;
+  bool is_read_ahead_hit = false;
 
   perf.perf_page_found = PERF_PAGE_MODE_OLD_IN_BUFFER;
 
@@ -1794,6 +1899,22 @@ try_again:
   hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
 
   buf_lock_acquired = false;
+
+#if defined (SERVER_MODE)
+  if (request_mode == PGBUF_LATCH_READ && fetch_mode == OLD_PAGE)
+    {
+      bufptr = pgbuf_fix_lock_free_read (thread_p, hash_anchor, vpid);
+      if (bufptr != NULL)
+	{
+#if !defined (NDEBUG)
+	  holder = pgbuf_find_thrd_holder (thread_p, bufptr);
+	  pgbuf_add_fixed_at (holder, caller_file, caller_line, holder->fix_count == 1);
+#endif /* NDEBUG */
+	  goto latch_granted;
+	}
+    }
+#endif /* SERVER_MODE */
+
   bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
   if (bufptr != NULL && pgbuf_bcb_is_direct_victim (bufptr))
     {
@@ -1807,6 +1928,24 @@ try_again:
       pgbuf_hit = true;
 #endif /* ENABLE_SYSTEMTAP */
 
+      if (pgbuf_bcb_is_read_ahead (bufptr))
+	{
+	  /* first fix of a page read ahead. */
+	  pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_READ_AHEAD_FLAG);
+	  if (fetch_mode == NEW_PAGE)
+	    {
+	      /* the page was not allocated when read ahead; its content is of no use. initialize it as if it was
+	       * claimed for this fix. */
+	      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_WASTED);
+	      pgbuf_init_new_page (bufptr);
+	    }
+	  else
+	    {
+	      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_HITS);
+	      is_read_ahead_hit = true;
+	    }
+	}
+
       if (fetch_mode == NEW_PAGE)
 	{
 	  /* Fix a page as NEW_PAGE, when oldest_unflush_lsa of the page is not NULL_LSA, it should be dirty. */
@@ -1927,11 +2066,15 @@ try_again:
   pgbuf_add_fixed_at (pgbuf_find_thrd_holder (thread_p, bufptr), caller_file, caller_line, !had_holder);
 #endif /* NDEBUG */
 
+#if defined (SERVER_MODE)
+latch_granted:
+#endif /* SERVER_MODE */
   if (perf.is_perf_tracking && is_latch_wait)
     {
       tsc_getticks (&perf.end_tick);
       tsc_elapsed_time_usec (&perf.tv_diff, perf.end_tick, perf.start_holder_tick);
       perf.holder_wait_time = perf.tv_diff.tv_sec * 1000000LL + perf.tv_diff.tv_usec;
+      perfmon_time_latency (PERF_LATENCY_PAGE_FIX_WAIT, perf.holder_wait_time);
     }
 
   assert (bufptr == bufptr->iopage_buffer->bcb);
@@ -2086,6 +2229,11 @@ try_again:
       pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_TO_VACUUM_FLAG);
     }
 
+  if (is_read_ahead_hit || (buf_lock_acquired && fetch_mode != NEW_PAGE))
+    {
+      pgbuf_read_ahead_after_fix (thread_p, vpid, is_read_ahead_hit);
+    }
+
   PGBUF_BCB_CHECK_MUTEX_LEAKS ();
 
   return pgptr;
@@ -2202,6 +2350,8 @@ pgbuf_promote_read_latch_release (THREAD_ENTRY * thread_p, PAGE_PTR * pgptr_p, P
   /* check if we're the single read latch holder */
   holder = pgbuf_find_thrd_holder (thread_p, bufptr);
   assert_release (holder != NULL);
+  /* count own lock-free fixes in fcnt before comparing it with the holder fix count */
+  pgbuf_bcb_stop_lock_free_read (thread_p, bufptr, holder);
   if (holder->fix_count == bufptr->fcnt)
     {
       assert (bufptr->latch_mode == PGBUF_LATCH_READ);
@@ -2359,6 +2509,7 @@ pgbuf_unfix (THREAD_ENTRY * thread_p, PAGE_PTR pgptr)
   PGBUF_HOLDER_STAT holder_perf_stat;
   PERF_PAGE_TYPE perf_page_type = PERF_PAGE_UNKNOWN;
   bool is_perf_tracking;
+  bool is_lock_free_fix = false;
 
 #if defined(CUBRID_DEBUG)
   LOG_LSA restart_lsa;
@@ -2441,7 +2592,7 @@ pgbuf_unfix (THREAD_ENTRY * thread_p, PAGE_PTR pgptr)
       perf_page_type = pgbuf_get_page_type_for_stat (thread_p, pgptr);
     }
   INIT_HOLDER_STAT (&holder_perf_stat);
-  holder_status = pgbuf_unlatch_thrd_holder (thread_p, bufptr, &holder_perf_stat);
+  holder_status = pgbuf_unlatch_thrd_holder (thread_p, bufptr, &holder_perf_stat, &is_lock_free_fix);
 
   assert (holder_perf_stat.hold_has_write_latch == 1 || holder_perf_stat.hold_has_read_latch == 1);
 
@@ -2464,13 +2615,22 @@ pgbuf_unfix (THREAD_ENTRY * thread_p, PAGE_PTR pgptr)
 			 holder_perf_stat.dirtied_by_holder, perf_holder_latch);
     }
 
-  PGBUF_BCB_LOCK (bufptr);
-
 #if !defined (NDEBUG)
   thread_p->get_pgbuf_tracker ().decrement (pgptr);
 #endif // !NDEBUG
-  (void) pgbuf_unlatch_bcb_upon_unfix (thread_p, bufptr, holder_status);
-  /* bufptr->mutex has been released in above function. */
+
+#if defined (SERVER_MODE)
+  if (is_lock_free_fix)
+    {
+      pgbuf_unfix_lock_free_read (thread_p, bufptr);
+    }
+  else
+#endif /* SERVER_MODE */
+    {
+      PGBUF_BCB_LOCK (bufptr);
+      (void) pgbuf_unlatch_bcb_upon_unfix (thread_p, bufptr, holder_status);
+      /* bufptr->mutex has been released in above function. */
+    }
 
   PGBUF_BCB_CHECK_MUTEX_LEAKS ();
 
@@ -2680,7 +2840,7 @@ pgbuf_invalidate (THREAD_ENTRY * thread_p, PAGE_PTR pgptr)
    */
   if (bufptr->fcnt > 1)
     {
-      holder_status = pgbuf_unlatch_thrd_holder (thread_p, bufptr, NULL);
+      holder_status = pgbuf_unlatch_thrd_holder (thread_p, bufptr, NULL, NULL);
 
 #if !defined (NDEBUG)
       thread_p->get_pgbuf_tracker ().decrement (pgptr);
@@ -2707,7 +2867,7 @@ pgbuf_invalidate (THREAD_ENTRY * thread_p, PAGE_PTR pgptr)
   /* save the pageid of the page temporarily. */
   temp_vpid = bufptr->vpid;
 
-  holder_status = pgbuf_unlatch_thrd_holder (thread_p, bufptr, NULL);
+  holder_status = pgbuf_unlatch_thrd_holder (thread_p, bufptr, NULL, NULL);
 
 #if !defined (NDEBUG)
   thread_p->get_pgbuf_tracker ().decrement (pgptr);
@@ -4775,6 +4935,8 @@ pgbuf_initialize_bcb_table (void)
 
 #if defined(SERVER_MODE)
       bufptr->next_wait_thrd = NULL;
+      bufptr->lock_free_fcnt = 0;
+      bufptr->has_lock_free_fix = false;
 #endif /* SERVER_MODE */
 
       bufptr->hash_next = NULL;
@@ -4894,6 +5056,39 @@ pgbuf_initialize_lock_table (void)
   return NO_ERROR;
 }
 
+/*
+ * pgbuf_initialize_read_ahead_table () - Initializes page buffer read-ahead table
+ *   return: NO_ERROR, or ER_code
+ */
+static int
+pgbuf_initialize_read_ahead_table (void)
+{
+  size_t i;
+  size_t thrd_num_total;
+  size_t alloc_size;
+
+  thrd_num_total = thread_num_total_threads ();
+
+  alloc_size = thrd_num_total * sizeof (PGBUF_READ_AHEAD_CONTEXT);
+  pgbuf_Pool.read_ahead_table = (PGBUF_READ_AHEAD_CONTEXT *) malloc (alloc_size);
+  if (pgbuf_Pool.read_ahead_table == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, alloc_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = 0; i < thrd_num_total; i++)
+    {
+      VPID_SET_NULL (&pgbuf_Pool.read_ahead_table[i].last_read_vpid);
+      VPID_SET_NULL (&pgbuf_Pool.read_ahead_table[i].window_end_vpid);
+      pgbuf_Pool.read_ahead_table[i].io_queue = NULL;
+      pgbuf_Pool.read_ahead_table[i].bcbs = NULL;
+      pgbuf_Pool.read_ahead_table[i].buffer_locks = NULL;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * pgbuf_initialize_lru_list () - Initializes the page buffer LRU list
  *   return: NO_ERROR, or ER_code
@@ -5130,6 +5325,7 @@ pgbuf_initialize_thrd_holder (void)
 	{
 	  idx = (i * PGBUF_DEFAULT_FIX_COUNT) + j;
 	  pgbuf_Pool.thrd_reserved_holder[idx].fix_count = 0;
+	  pgbuf_Pool.thrd_reserved_holder[idx].lock_free_fix_count = 0;
 	  pgbuf_Pool.thrd_reserved_holder[idx].bufptr = NULL;
 	  pgbuf_Pool.thrd_reserved_holder[idx].thrd_link = NULL;
 	  INIT_HOLDER_STAT (&(pgbuf_Pool.thrd_reserved_holder[idx].perf_stat));
@@ -5231,6 +5427,7 @@ pgbuf_allocate_thrd_holder_entry (THREAD_ENTRY * thread_p)
   thrd_holder_info->thrd_hold_list = holder;
   thrd_holder_info->num_hold_cnt += 1;
 
+  holder->lock_free_fix_count = 0;
   holder->first_watcher = NULL;
   holder->last_watcher = NULL;
   holder->watch_count = 0;
@@ -5276,9 +5473,13 @@ pgbuf_find_thrd_holder (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
  *                                list of given BCB
  *   return: pointer to holder entry or NULL
  *   bufptr(in):
+ *   holder_perf_stat_p(out):
+ *   is_lock_free_fix(out): true if the released fix was done without BCB mutex. if NULL, the holder must not have
+ *                          such fixes.
  */
 STATIC_INLINE int
-pgbuf_unlatch_thrd_holder (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_HOLDER_STAT * holder_perf_stat_p)
+pgbuf_unlatch_thrd_holder (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_HOLDER_STAT * holder_perf_stat_p,
+			   bool * is_lock_free_fix)
 {
   int err = NO_ERROR;
   PGBUF_HOLDER *holder;
@@ -5307,6 +5508,20 @@ pgbuf_unlatch_thrd_holder (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_HO
 
   holder->fix_count--;
 
+  if (is_lock_free_fix != NULL)
+    {
+      /* lock-free fixes are released first */
+      *is_lock_free_fix = holder->lock_free_fix_count > 0;
+      if (*is_lock_free_fix)
+	{
+	  holder->lock_free_fix_count--;
+	}
+    }
+  else
+    {
+      assert (holder->lock_free_fix_count == 0);
+    }
+
   if (holder->fix_count == 0)
     {
       /* remove its own BCB holder entry */
@@ -5423,6 +5638,13 @@ pgbuf_latch_idle_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_
   bufptr->latch_mode = request_mode;
   bufptr->fcnt = 1;
 
+#if defined (SERVER_MODE)
+  if (request_mode == PGBUF_LATCH_READ && pgbuf_is_exist_blocked_reader_writer (bufptr) == false)
+    {
+      pgbuf_bcb_allow_lock_free_read (thread_p, bufptr);
+    }
+#endif /* SERVER_MODE */
+
   PGBUF_BCB_UNLOCK (bufptr);
 
   /* allocate a BCB holder entry */
@@ -5455,6 +5677,176 @@ pgbuf_latch_idle_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_
   return NO_ERROR;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_fix_lock_free_read () - fix a resident page for read without hash or bcb mutex
+ *   return: fixed bcb or NULL if page cannot be fixed without mutex
+ *   hash_anchor(in): hash anchor of vpid
+ *   vpid(in): page identifier
+ *
+ * Note: A read latched bcb may allow read fixes without its mutex (PGBUF_BCB_LOCK_FREE_READ_FLAG). While allowed, fcnt
+ *       holds one fix on behalf of all lock-free readers, which are counted in lock_free_fcnt. The reader increments
+ *       lock_free_fcnt first and then checks the flag and the vpid again. Whoever stops lock-free fixes clears the
+ *       flag first and then checks lock_free_fcnt. Both use full barriers, so either the reader sees the flag cleared
+ *       and backs off, or the fix is seen and the bcb keeps its read latch until the reader unfixes the page.
+ *
+ *       The caller falls back to the regular fix on NULL.
+ */
+static PGBUF_BCB *
+pgbuf_fix_lock_free_read (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid)
+{
+  PGBUF_BCB *bufptr;
+  PGBUF_HOLDER *holder;
+  int flags;
+
+  /* hash chains are walked without mutex like in pgbuf_search_hash_chain */
+  for (bufptr = hash_anchor->hash_next; bufptr != NULL; bufptr = bufptr->hash_next)
+    {
+      if (VPID_EQ (&bufptr->vpid, vpid))
+	{
+	  break;
+	}
+    }
+  if (bufptr == NULL || !pgbuf_bcb_is_lock_free_read (bufptr))
+    {
+      return NULL;
+    }
+
+  ATOMIC_INC_32 (&bufptr->lock_free_fcnt, 1);
+
+  /* check the bcb was not changed before registering the fix */
+  flags = bufptr->flags;
+  if ((flags & PGBUF_BCB_LOCK_FREE_READ_FLAG) == 0 || !VPID_EQ (&bufptr->vpid, vpid))
+    {
+      pgbuf_unfix_lock_free_read (thread_p, bufptr);
+      return NULL;
+    }
+  assert (bufptr->latch_mode == PGBUF_LATCH_READ);
+
+  holder = pgbuf_find_thrd_holder (thread_p, bufptr);
+  if (holder == NULL)
+    {
+      holder = pgbuf_allocate_thrd_holder_entry (thread_p);
+      if (holder == NULL)
+	{
+	  /* This situation must not be occurred. */
+	  assert (false);
+	  pgbuf_unfix_lock_free_read (thread_p, bufptr);
+	  return NULL;
+	}
+
+      holder->fix_count = 0;
+      holder->bufptr = bufptr;
+      holder->perf_stat.hold_has_write_latch = 0;
+      holder->perf_stat.dirtied_by_holder = 0;
+      holder->perf_stat.dirty_before_hold = (flags & PGBUF_BCB_DIRTY_FLAG) != 0;
+    }
+
+  holder->fix_count++;
+  holder->lock_free_fix_count++;
+  holder->perf_stat.hold_has_read_latch = 1;
+
+  pgbuf_bcb_register_fix (bufptr);
+  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_LOCK_FREE_READ_FIX);
+
+  return bufptr;
+}
+
+/*
+ * pgbuf_unfix_lock_free_read () - release a fix done without bcb mutex
+ *   return: void
+ *   bufptr(in): bcb
+ *
+ * Note: If lock-free fixes were stopped meanwhile, the last lock-free reader also releases the fix held on their behalf.
+ */
+static void
+pgbuf_unfix_lock_free_read (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
+{
+  if (ATOMIC_INC_32 (&bufptr->lock_free_fcnt, -1) > 0 || pgbuf_bcb_is_lock_free_read (bufptr))
+    {
+      /* not the last lock-free reader, or lock-free fixes are still allowed */
+      return;
+    }
+
+  PGBUF_BCB_LOCK (bufptr);
+  /* the fix could have been already released by whoever stopped lock-free fixes or by another reader */
+  if (bufptr->has_lock_free_fix && bufptr->lock_free_fcnt == 0 && !pgbuf_bcb_is_lock_free_read (bufptr))
+    {
+      bufptr->has_lock_free_fix = false;
+      (void) pgbuf_unlatch_bcb_upon_unfix (thread_p, bufptr, NO_ERROR);
+      /* bufptr->mutex has been released in above function. */
+      return;
+    }
+  PGBUF_BCB_UNLOCK (bufptr);
+}
+
+/*
+ * pgbuf_bcb_allow_lock_free_read () - allow read fixes of bcb without its mutex
+ *   return: void
+ *   bufptr(in): read latched bcb
+ *
+ * Note: The caller holds bcb mutex and has just been granted a read latch with no blocked reader or writer.
+ */
+STATIC_INLINE void
+pgbuf_bcb_allow_lock_free_read (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
+{
+  assert (bufptr->latch_mode == PGBUF_LATCH_READ);
+  assert (bufptr->fcnt > 0);
+
+  if (pgbuf_bcb_is_lock_free_read (bufptr) || !prm_get_bool_value (PRM_ID_PB_LOCK_FREE_READ_FIX))
+    {
+      return;
+    }
+
+  if (!bufptr->has_lock_free_fix)
+    {
+      /* fix on behalf of lock-free readers */
+      bufptr->has_lock_free_fix = true;
+      bufptr->fcnt++;
+    }
+  pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_LOCK_FREE_READ_FLAG, 0);
+}
+
+/*
+ * pgbuf_bcb_stop_lock_free_read () - stop read fixes of bcb without its mutex
+ *   return: void
+ *   bufptr(in): bcb
+ *   holder(in): holder of current thread or NULL. its lock-free fixes are moved to fcnt.
+ *
+ * Note: The caller holds bcb mutex and is going to change the latch or to wait for it. The fix on behalf of lock-free
+ *       readers is released here if none is left; it is never the last fix, in which case the last lock-free reader
+ *       releases it.
+ */
+static void
+pgbuf_bcb_stop_lock_free_read (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_HOLDER * holder)
+{
+  PGBUF_BCB_CHECK_OWN (bufptr);
+
+  if (!bufptr->has_lock_free_fix)
+    {
+      assert (!pgbuf_bcb_is_lock_free_read (bufptr));
+      assert (holder == NULL || holder->lock_free_fix_count == 0);
+      return;
+    }
+
+  /* clear the flag before checking lock_free_fcnt. see pgbuf_fix_lock_free_read. */
+  pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_LOCK_FREE_READ_FLAG);
+
+  if (holder != NULL && holder->lock_free_fix_count > 0)
+    {
+      ATOMIC_INC_32 (&bufptr->lock_free_fcnt, -holder->lock_free_fix_count);
+      bufptr->fcnt += holder->lock_free_fix_count;
+      holder->lock_free_fix_count = 0;
+    }
+
+  if (bufptr->lock_free_fcnt == 0 && bufptr->fcnt > 1)
+    {
+      bufptr->has_lock_free_fix = false;
+      bufptr->fcnt--;
+    }
+}
+#endif /* SERVER_MODE */
+
 /*
  * pgbuf_latch_bcb_upon_fix () -
  *   return: NO_ERROR, or ER_code
@@ -5529,6 +5921,10 @@ pgbuf_latch_bcb_upon_fix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LAT
 	  bufptr->fcnt++;
 	  assert (0 < bufptr->fcnt);
 
+#if defined (SERVER_MODE)
+	  pgbuf_bcb_allow_lock_free_read (thread_p, bufptr);
+#endif /* SERVER_MODE */
+
 	  PGBUF_BCB_UNLOCK (bufptr);
 
 	  /* allocate a BCB holder entry */
@@ -5679,6 +6075,11 @@ pgbuf_latch_bcb_upon_fix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LAT
 
       assert (request_mode == PGBUF_LATCH_WRITE);
 
+#if defined (SERVER_MODE)
+      /* count own lock-free fixes in fcnt before comparing it with the holder fix count */
+      pgbuf_bcb_stop_lock_free_read (thread_p, bufptr, holder);
+#endif /* SERVER_MODE */
+
       if (bufptr->fcnt == holder->fix_count)
 	{
 	  bufptr->latch_mode = request_mode;	/* PGBUF_LATCH_WRITE */
@@ -5874,6 +6275,20 @@ pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int h
       return ER_FAILED;
     }
 
+#if defined (SERVER_MODE)
+  if (bufptr->has_lock_free_fix && bufptr->fcnt == 1)
+    {
+      /* the only fix left is the one on behalf of lock-free readers. stop lock-free fixes; the fix is released here
+       * if there is no lock-free reader, otherwise by the last of them. see pgbuf_unfix_lock_free_read. */
+      pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_LOCK_FREE_READ_FLAG);
+      if (bufptr->lock_free_fcnt == 0)
+	{
+	  bufptr->has_lock_free_fix = false;
+	  bufptr->fcnt = 0;
+	}
+    }
+#endif /* SERVER_MODE */
+
   if (bufptr->fcnt == 0)
     {
       /* When oldest_unflush_lsa of a page is set, its dirty mark should also be set */
@@ -6224,6 +6639,12 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
   cur_thrd_entry->request_latch_mode = request_mode;
   cur_thrd_entry->request_fix_count = request_fcnt;	/* SPECIAL_NOTE */
 
+  if (request_mode != PGBUF_LATCH_FLUSH)
+    {
+      /* readers that do not wait would starve the waiters */
+      pgbuf_bcb_stop_lock_free_read (thread_p, bufptr, NULL);
+    }
+
   if (as_promote)
     {
       /* place cur_thrd_entry as first in BCB waiting queue */
@@ -7481,126 +7902,568 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
   LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
 
-  if (fetch_mode != NEW_PAGE)
+  if (fetch_mode != NEW_PAGE)
+    {
+      /* Record number of reads in statistics */
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOREADS);
+
+#if defined(ENABLE_SYSTEMTAP)
+      query_id = qmgr_get_current_query_id (thread_p);
+      if (query_id != NULL_QUERY_ID)
+	{
+	  monitored = true;
+	  CUBRID_IO_READ_START (query_id);
+	}
+#endif /* ENABLE_SYSTEMTAP */
+
+      if (dwb_read_page (thread_p, vpid, &bufptr->iopage_buffer->iopage, &success) != NO_ERROR)
+	{
+	  /* Should not happen */
+	  assert (false);
+	  return NULL;
+	}
+      else if (success == true)
+	{
+	  /* Nothing to do, copied from DWB */
+	}
+      else if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), &bufptr->iopage_buffer->iopage,
+			    vpid->pageid, IO_PAGESIZE) == NULL)
+	{
+	  /* There was an error in reading the page. Clean the buffer... since it may have been corrupted */
+	  ASSERT_ERROR ();
+
+	  /* bufptr->mutex will be released in following function. */
+	  pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+
+	  /*
+	   * Now, caller is not holding any mutex.
+	   * the last argument of pgbuf_unlock_page () is true that
+	   * means hash_mutex must be held before unlocking page.
+	   */
+	  (void) pgbuf_unlock_page (thread_p, hash_anchor, vpid, true);
+
+#if defined(ENABLE_SYSTEMTAP)
+	  if (monitored == true)
+	    {
+	      CUBRID_IO_READ_END (query_id, IO_PAGESIZE, 1);
+	    }
+#endif /* ENABLE_SYSTEMTAP */
+
+	  PGBUF_BCB_CHECK_MUTEX_LEAKS ();
+	  return NULL;
+	}
+
+#if defined(ENABLE_SYSTEMTAP)
+      if (monitored == true)
+	{
+	  CUBRID_IO_READ_END (query_id, IO_PAGESIZE, 0);
+	}
+#endif /* ENABLE_SYSTEMTAP */
+      if (pgbuf_is_temporary_volume (vpid->volid) == true)
+	{
+	  /* Check if the first time to access */
+	  if (!pgbuf_is_temp_lsa (bufptr->iopage_buffer->iopage.prv.lsa))
+	    {
+	      pgbuf_init_temp_page_lsa (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+	      pgbuf_set_dirty_buffer_ptr (thread_p, bufptr);
+	    }
+	}
+
+#if !defined (NDEBUG)
+      /* perm volume */
+      if (bufptr->vpid.volid > NULL_VOLID)
+	{
+	  if (!log_is_in_crash_recovery ())
+	    {
+	      if (!LSA_ISNULL (&bufptr->iopage_buffer->iopage.prv.lsa))
+		{
+		  assert (bufptr->iopage_buffer->iopage.prv.pageid != -1);
+		  assert (bufptr->iopage_buffer->iopage.prv.volid != -1);
+		}
+	    }
+	}
+#endif /* NDEBUG */
+
+      if (thread_get_sort_stats_active (thread_p))
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_IO_PAGES);
+	}
+    }
+  else
+    {
+      /* the caller is holding bufptr->mutex */
+
+      /* Don't need to read page from disk since it is a new page. */
+      pgbuf_init_new_page (bufptr);
+
+      if (thread_get_sort_stats_active (thread_p))
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_DATA_PAGES);
+	}
+    }
+
+  return bufptr;
+}
+
+/*
+ * pgbuf_init_new_page () - initialize the page of a bcb claimed for NEW_PAGE fix
+ *
+ * return      : void
+ * bufptr (in) : bcb
+ *
+ * note: the caller is holding bufptr->mutex.
+ */
+STATIC_INLINE void
+pgbuf_init_new_page (PGBUF_BCB * bufptr)
+{
+#if defined(CUBRID_DEBUG)
+  pgbuf_scramble (&bufptr->iopage_buffer->iopage);
+#endif /* CUBRID_DEBUG */
+
+  if (pgbuf_is_temporary_volume (bufptr->vpid.volid) == true)
+    {
+      pgbuf_init_temp_page_lsa (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+    }
+  else
+    {
+      fileio_init_lsa_of_page (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+    }
+
+  /* perm volume */
+  if (bufptr->vpid.volid > NULL_VOLID)
+    {
+      /* Init Page identifier of NEW_PAGE */
+      bufptr->iopage_buffer->iopage.prv.pageid = -1;
+      bufptr->iopage_buffer->iopage.prv.volid = -1;
+    }
+}
+
+/*
+ * pgbuf_try_lock_page_for_read_ahead () - Puts a read-ahead buffer lock on the buffer lock chain without waiting
+ *   return: true if the buffer lock was put, false if the page is already locked by another thread
+ *   hash_anchor(in):
+ *   vpid(in):
+ *   buffer_lock(in): buffer lock record of thread read-ahead context
+ *
+ * Note: Like pgbuf_lock_page (), this function is invoked only when the page is not in the buffer hash chain and the
+ *       caller is holding hash_anchor->hash_mutex. Before return, the thread releases hash_anchor->hash_mutex.
+ *       If the page is locked, another thread is already reading it and there is no point to wait for it.
+ */
+static bool
+pgbuf_try_lock_page_for_read_ahead (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid,
+				    PGBUF_BUFFER_LOCK * buffer_lock)
+{
+#if defined(SERVER_MODE)
+  PGBUF_BUFFER_LOCK *cur_buffer_lock;
+
+  /* the caller is holding hash_anchor->hash_mutex */
+  for (cur_buffer_lock = hash_anchor->lock_next; cur_buffer_lock != NULL; cur_buffer_lock = cur_buffer_lock->lock_next)
+    {
+      if (VPID_EQ (&(cur_buffer_lock->vpid), vpid))
+	{
+	  pthread_mutex_unlock (&hash_anchor->hash_mutex);
+	  return false;
+	}
+    }
+
+  buffer_lock->vpid = *vpid;
+  buffer_lock->next_wait_thrd = NULL;
+  buffer_lock->lock_next = hash_anchor->lock_next;
+  hash_anchor->lock_next = buffer_lock;
+  pthread_mutex_unlock (&hash_anchor->hash_mutex);
+#endif /* SERVER_MODE */
+
+  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_ACQUIRED_ON_PAGES);	/* monitoring */
+  return true;
+}
+
+/*
+ * pgbuf_allocate_bcb_for_read_ahead () - Allocates a BCB for reading ahead a page
+ *   return: a newly allocated BCB or NULL if none is immediately available
+ *
+ * Note: Unlike pgbuf_allocate_bcb (), this never waits for a victim to be assigned. Reading ahead is not worth
+ *       delaying the thread; if the buffer is under victimization pressure, read-ahead stops.
+ *       If a BCB is returned, the caller is holding its mutex.
+ */
+static PGBUF_BCB *
+pgbuf_allocate_bcb_for_read_ahead (THREAD_ENTRY * thread_p)
+{
+  PGBUF_BCB *bufptr;
+
+  bufptr = pgbuf_get_bcb_from_invalid_list (thread_p);
+  if (bufptr != NULL)
+    {
+      return bufptr;
+    }
+
+  bufptr = pgbuf_get_victim (thread_p);
+  if (bufptr != NULL && pgbuf_victimize_bcb (thread_p, bufptr) != NO_ERROR)
+    {
+      assert (false);
+      bufptr = NULL;
+    }
+
+  return bufptr;
+}
+
+/*
+ * pgbuf_get_read_ahead_context () - get read-ahead context of thread
+ *
+ * return        : read-ahead context or NULL if its resources could not be allocated
+ * thread_p (in) : thread entry
+ */
+static PGBUF_READ_AHEAD_CONTEXT *
+pgbuf_get_read_ahead_context (THREAD_ENTRY * thread_p)
+{
+  PGBUF_READ_AHEAD_CONTEXT *ctx;
+
+  assert (thread_p != NULL && thread_p->index >= 0 && (size_t) thread_p->index < thread_num_total_threads ());
+  ctx = &pgbuf_Pool.read_ahead_table[thread_p->index];
+
+  if (ctx->io_queue != NULL)
+    {
+      return ctx;
+    }
+
+  /* first read-ahead of this thread */
+  ctx->bcbs = (PGBUF_BCB **) malloc (PGBUF_READ_AHEAD_MAX_PAGES * sizeof (PGBUF_BCB *));
+  ctx->buffer_locks = (PGBUF_BUFFER_LOCK *) malloc (PGBUF_READ_AHEAD_MAX_PAGES * PGBUF_BUFFER_LOCK_SIZEOF);
+  if (ctx->bcbs != NULL && ctx->buffer_locks != NULL)
+    {
+      ctx->io_queue = fileio_async_queue_create (PGBUF_READ_AHEAD_MAX_PAGES, IO_PAGESIZE,
+						 FILEIO_WRITE_NO_COMPENSATE_WRITE);
+    }
+  if (ctx->io_queue == NULL)
+    {
+      if (ctx->bcbs != NULL)
+	{
+	  free_and_init (ctx->bcbs);
+	}
+      if (ctx->buffer_locks != NULL)
+	{
+	  free_and_init (ctx->buffer_locks);
+	}
+      return NULL;
+    }
+
+  return ctx;
+}
+
+/*
+ * pgbuf_read_ahead_pages () - read ahead the pages following given page
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * vpid (in)     : page being accessed sequentially
+ *
+ * note: up to data_buffer_read_ahead_pages pages that follow vpid in its sector are read into the buffer, unless a
+ *       previous read-ahead window of the thread is still far enough ahead of vpid.
+ *
+ *       the caller may hold the latch of vpid, so on server the window is handed to the read-ahead daemon and read
+ *       while the caller goes on; if the daemon is behind, the window is dropped. stand-alone reads it right away.
+ */
+static void
+pgbuf_read_ahead_pages (THREAD_ENTRY * thread_p, const VPID * vpid)
+{
+  PGBUF_READ_AHEAD_CONTEXT *ctx;
+  VPID first_vpid;
+  PAGEID first_pageid, last_pageid;
+  int npages;
+
+  npages = MIN (prm_get_integer_value (PRM_ID_PB_READ_AHEAD_PAGES), PGBUF_READ_AHEAD_MAX_PAGES);
+  if (npages <= 0 || log_is_in_crash_recovery ())
+    {
+      return;
+    }
+
+  assert (thread_p != NULL && thread_p->index >= 0 && (size_t) thread_p->index < thread_num_total_threads ());
+  ctx = &pgbuf_Pool.read_ahead_table[thread_p->index];
+
+  first_pageid = vpid->pageid + 1;
+  last_pageid = MIN (vpid->pageid + npages, SECTOR_LAST_PAGEID (SECTOR_FROM_PAGEID (vpid->pageid)));
+  if (ctx->window_end_vpid.volid == vpid->volid && ctx->window_end_vpid.pageid > vpid->pageid
+      && ctx->window_end_vpid.pageid <= last_pageid + 1)
+    {
+      /* a previous window is still ahead. */
+      if (ctx->window_end_vpid.pageid - vpid->pageid > npages / 2)
+	{
+	  /* and far enough. */
+	  return;
+	}
+      /* read only what follows it. */
+      first_pageid = ctx->window_end_vpid.pageid;
+    }
+  if (first_pageid > last_pageid)
+    {
+      /* end of sector */
+      return;
+    }
+
+  /* pages of the window that cannot be read ahead are read by the fix that needs them */
+  ctx->window_end_vpid.volid = vpid->volid;
+  ctx->window_end_vpid.pageid = last_pageid + 1;
+
+  first_vpid.volid = vpid->volid;
+  first_vpid.pageid = first_pageid;
+
+#if defined (SERVER_MODE)
+  if (pgbuf_Read_ahead_daemon != NULL)
+    {
+      PGBUF_READ_AHEAD_REQUEST request;
+
+      request.first_vpid = first_vpid;
+      request.last_pageid = last_pageid;
+      if (pgbuf_Pool.read_ahead_requests->produce (request))
+	{
+	  pgbuf_Read_ahead_daemon->wakeup ();
+	}
+      return;
+    }
+#endif /* SERVER_MODE */
+
+  pgbuf_read_ahead_window (thread_p, &first_vpid, last_pageid);
+}
+
+/*
+ * pgbuf_read_ahead_window () - read a window of pages into the buffer
+ *
+ * return           : void
+ * thread_p (in)    : thread entry
+ * first_vpid (in)  : first page of the window
+ * last_pageid (in) : last page of the window, in the sector of first_vpid
+ *
+ * note: pages already in buffer or being read by other threads are skipped; the others are claimed free BCB's and
+ *       read with coalesced I/O. the pages read are added to the middle of lru list, unfixed and marked with
+ *       PGBUF_BCB_READ_AHEAD_FLAG.
+ *
+ *       read-ahead is best effort: it never waits for page locks or victims, and errors are not reported to caller.
+ */
+static void
+pgbuf_read_ahead_window (THREAD_ENTRY * thread_p, const VPID * first_vpid, PAGEID last_pageid)
+{
+  PGBUF_READ_AHEAD_CONTEXT *ctx;
+  PGBUF_BUFFER_HASH *hash_anchor;
+  PGBUF_BCB *bufptr;
+  VPID ra_vpid;
+  int count, count_ioreads, lru_idx, i;
+  int vol_fd;
+  int error_code = NO_ERROR;
+  bool success;
+
+  ctx = pgbuf_get_read_ahead_context (thread_p);
+  if (ctx == NULL)
     {
-      /* Record number of reads in statistics */
-      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOREADS);
+      er_clear ();
+      return;
+    }
 
-#if defined(ENABLE_SYSTEMTAP)
-      query_id = qmgr_get_current_query_id (thread_p);
-      if (query_id != NULL_QUERY_ID)
-	{
-	  monitored = true;
-	  CUBRID_IO_READ_START (query_id);
-	}
-#endif /* ENABLE_SYSTEMTAP */
+  vol_fd = fileio_get_volume_descriptor (first_vpid->volid);
+  if (vol_fd == NULL_VOLDES)
+    {
+      return;
+    }
 
-      if (dwb_read_page (thread_p, vpid, &bufptr->iopage_buffer->iopage, &success) != NO_ERROR)
+  /* claim bcb's for all pages not in buffer */
+  count = 0;
+  ra_vpid.volid = first_vpid->volid;
+  for (ra_vpid.pageid = first_vpid->pageid; ra_vpid.pageid <= last_pageid; ra_vpid.pageid++)
+    {
+      hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (&ra_vpid)];
+      bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, &ra_vpid);
+      if (bufptr != NULL)
 	{
-	  /* Should not happen */
-	  assert (false);
-	  return NULL;
+	  /* already in buffer */
+	  PGBUF_BCB_UNLOCK (bufptr);
+	  continue;
 	}
-      else if (success == true)
+      if (er_errid () == ER_CSS_PTHREAD_MUTEX_TRYLOCK)
 	{
-	  /* Nothing to do, copied from DWB */
+	  pthread_mutex_unlock (&hash_anchor->hash_mutex);
+	  er_clear ();
+	  break;
 	}
-      else if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), &bufptr->iopage_buffer->iopage,
-			    vpid->pageid, IO_PAGESIZE) == NULL)
-	{
-	  /* There was an error in reading the page. Clean the buffer... since it may have been corrupted */
-	  ASSERT_ERROR ();
-
-	  /* bufptr->mutex will be released in following function. */
-	  pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
-
-	  /*
-	   * Now, caller is not holding any mutex.
-	   * the last argument of pgbuf_unlock_page () is true that
-	   * means hash_mutex must be held before unlocking page.
-	   */
-	  (void) pgbuf_unlock_page (thread_p, hash_anchor, vpid, true);
 
-#if defined(ENABLE_SYSTEMTAP)
-	  if (monitored == true)
-	    {
-	      CUBRID_IO_READ_END (query_id, IO_PAGESIZE, 1);
-	    }
-#endif /* ENABLE_SYSTEMTAP */
-
-	  PGBUF_BCB_CHECK_MUTEX_LEAKS ();
-	  return NULL;
+      /* the hash_anchor->hash_mutex is to be released in pgbuf_try_lock_page_for_read_ahead (). */
+      if (!pgbuf_try_lock_page_for_read_ahead (thread_p, hash_anchor, &ra_vpid, &ctx->buffer_locks[count]))
+	{
+	  /* being read by someone else */
+	  continue;
 	}
 
-#if defined(ENABLE_SYSTEMTAP)
-      if (monitored == true)
+      bufptr = pgbuf_allocate_bcb_for_read_ahead (thread_p);
+      if (bufptr == NULL)
 	{
-	  CUBRID_IO_READ_END (query_id, IO_PAGESIZE, 0);
+	  (void) pgbuf_unlock_page (thread_p, hash_anchor, &ra_vpid, true);
+	  break;
 	}
-#endif /* ENABLE_SYSTEMTAP */
-      if (pgbuf_is_temporary_volume (vpid->volid) == true)
+
+      /* initialize the BCB */
+      bufptr->vpid = ra_vpid;
+      assert (!pgbuf_bcb_avoid_victim (bufptr));
+      bufptr->latch_mode = PGBUF_NO_LATCH;
+      pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_ASYNC_FLUSH_REQ);
+      pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
+      LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+
+      if (dwb_read_page (thread_p, &ra_vpid, &bufptr->iopage_buffer->iopage, &success) != NO_ERROR)
 	{
-	  /* Check if the first time to access */
-	  if (!pgbuf_is_temp_lsa (bufptr->iopage_buffer->iopage.prv.lsa))
-	    {
-	      pgbuf_init_temp_page_lsa (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
-	      pgbuf_set_dirty_buffer_ptr (thread_p, bufptr);
-	    }
+	  /* Should not happen */
+	  assert (false);
+	  pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+	  (void) pgbuf_unlock_page (thread_p, hash_anchor, &ra_vpid, true);
+	  er_clear ();
+	  break;
 	}
-
-#if !defined (NDEBUG)
-      /* perm volume */
-      if (bufptr->vpid.volid > NULL_VOLID)
+      if (!success
+	  && fileio_async_add (ctx->io_queue, FILEIO_ASYNC_READ, vol_fd, &bufptr->iopage_buffer->iopage,
+			       ra_vpid.pageid) != NO_ERROR)
 	{
-	  if (!log_is_in_crash_recovery ())
-	    {
-	      if (!LSA_ISNULL (&bufptr->iopage_buffer->iopage.prv.lsa))
-		{
-		  assert (bufptr->iopage_buffer->iopage.prv.pageid != -1);
-		  assert (bufptr->iopage_buffer->iopage.prv.volid != -1);
-		}
-	    }
+	  assert (false);
+	  pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+	  (void) pgbuf_unlock_page (thread_p, hash_anchor, &ra_vpid, true);
+	  er_clear ();
+	  break;
 	}
-#endif /* NDEBUG */
 
-      if (thread_get_sort_stats_active (thread_p))
+      /* the bcb is not reachable by other threads until it is added to hash chain; its mutex is released while
+       * waiting for I/O, because a thread can hold only one bcb mutex at a time. */
+      PGBUF_BCB_UNLOCK (bufptr);
+      ctx->bcbs[count++] = bufptr;
+    }
+
+  if (count == 0)
+    {
+      return;
+    }
+
+  count_ioreads = fileio_async_queue_count (ctx->io_queue);
+  if (count_ioreads > 0)
+    {
+      error_code = fileio_async_wait_all (thread_p, ctx->io_queue);
+      if (error_code != NO_ERROR)
 	{
-	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_IO_PAGES);
+	  /* forget about this window */
+	  er_clear ();
+	  count_ioreads = 0;
 	}
     }
+
+  if (PGBUF_THREAD_HAS_PRIVATE_LRU (thread_p))
+    {
+      lru_idx = PGBUF_LRU_INDEX_FROM_PRIVATE (PGBUF_PRIVATE_LRU_FROM_THREAD (thread_p));
+    }
   else
     {
-      /* the caller is holding bufptr->mutex */
+      lru_idx = pgbuf_get_shared_lru_index_for_add ();
+    }
 
-#if defined(CUBRID_DEBUG)
-      pgbuf_scramble (&bufptr->iopage_buffer->iopage);
-#endif /* CUBRID_DEBUG */
+  /* publish pages */
+  for (i = 0; i < count; i++)
+    {
+      bufptr = ctx->bcbs[i];
+      ra_vpid = bufptr->vpid;
+      hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (&ra_vpid)];
 
-      /* Don't need to read page from disk since it is a new page. */
-      if (pgbuf_is_temporary_volume (vpid->volid) == true)
-	{
-	  pgbuf_init_temp_page_lsa (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
-	}
-      else
+      PGBUF_BCB_LOCK (bufptr);
+      if (error_code != NO_ERROR)
 	{
-	  fileio_init_lsa_of_page (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+	  /* the buffer may be corrupted. bufptr->mutex will be released in following function. */
+	  pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
+	  (void) pgbuf_unlock_page (thread_p, hash_anchor, &ra_vpid, true);
+	  continue;
 	}
 
-      /* perm volume */
-      if (bufptr->vpid.volid > NULL_VOLID)
+      if (pgbuf_is_temporary_volume (ra_vpid.volid) && !pgbuf_is_temp_lsa (bufptr->iopage_buffer->iopage.prv.lsa))
 	{
-	  /* Init Page identifier of NEW_PAGE */
-	  bufptr->iopage_buffer->iopage.prv.pageid = -1;
-	  bufptr->iopage_buffer->iopage.prv.volid = -1;
+	  /* first access to temporary page */
+	  pgbuf_init_temp_page_lsa (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
+	  pgbuf_bcb_set_dirty (thread_p, bufptr);
 	}
+      pgbuf_bcb_update_flags (thread_p, bufptr, PGBUF_BCB_READ_AHEAD_FLAG, 0);
 
-      if (thread_get_sort_stats_active (thread_p))
+      pgbuf_insert_into_hash_chain (thread_p, hash_anchor, bufptr);
+      /* the caller is holding hash_anchor->hash_mutex; it is released and waiters are woken up. they will block on
+       * bufptr->mutex until the bcb is also added to lru list. */
+      (void) pgbuf_unlock_page (thread_p, hash_anchor, &ra_vpid, false);
+
+      pgbuf_lru_add_new_bcb_to_middle (thread_p, bufptr, lru_idx);
+      PGBUF_BCB_UNLOCK (bufptr);
+    }
+
+  if (error_code == NO_ERROR)
+    {
+      perfmon_add_stat (thread_p, PSTAT_PB_NUM_READ_AHEAD, count);
+      perfmon_add_stat (thread_p, PSTAT_PB_NUM_IOREADS, count_ioreads);
+    }
+  PGBUF_BCB_CHECK_MUTEX_LEAKS ();
+}
+
+/*
+ * pgbuf_read_ahead_after_fix () - detect sequential access after a page fix and read ahead
+ *
+ * return                 : void
+ * thread_p (in)          : thread entry
+ * vpid (in)              : fixed page
+ * is_read_ahead_hit (in) : true if page was found in buffer thanks to read-ahead, false if it was read from disk
+ *
+ * note: a thread that reads from disk the page that follows the last page it read from disk is considered to scan
+ *       sequentially. so is a thread that hits a page that was read ahead; the window is then moved forward before
+ *       the thread reaches its end.
+ */
+static void
+pgbuf_read_ahead_after_fix (THREAD_ENTRY * thread_p, const VPID * vpid, bool is_read_ahead_hit)
+{
+  PGBUF_READ_AHEAD_CONTEXT *ctx;
+  bool is_sequential;
+
+  if (prm_get_integer_value (PRM_ID_PB_READ_AHEAD_PAGES) <= 0)
+    {
+      return;
+    }
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  ctx = &pgbuf_Pool.read_ahead_table[thread_p->index];
+
+  if (!is_read_ahead_hit)
+    {
+      is_sequential = (ctx->last_read_vpid.volid == vpid->volid && ctx->last_read_vpid.pageid + 1 == vpid->pageid);
+      ctx->last_read_vpid = *vpid;
+      if (!is_sequential)
 	{
-	  perfmon_inc_stat (thread_p, PSTAT_SORT_NUM_DATA_PAGES);
+	  return;
 	}
     }
 
-  return bufptr;
+  pgbuf_read_ahead_pages (thread_p, vpid);
+}
+
+/*
+ * pgbuf_read_ahead () - hint page buffer that caller scans pages in file order and has just fixed given page
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * vpid (in)     : page just fixed by the scan
+ *
+ * note: scans that know they go through the pages of a file in order use this to have the pages that follow read
+ *       ahead without waiting for sequential access to be detected.
+ */
+void
+pgbuf_read_ahead (THREAD_ENTRY * thread_p, const VPID * vpid)
+{
+  if (prm_get_integer_value (PRM_ID_PB_READ_AHEAD_PAGES) <= 0 || VPID_ISNULL (vpid) || vpid->volid == NULL_VOLID)
+    {
+      return;
+    }
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  pgbuf_read_ahead_pages (thread_p, vpid);
 }
 
 /*
@@ -7633,6 +8496,12 @@ pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
     {
       pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_TO_VACUUM_FLAG);
     }
+  if (pgbuf_bcb_is_read_ahead (bufptr))
+    {
+      /* page was read ahead for nothing */
+      pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_READ_AHEAD_FLAG);
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_WASTED);
+    }
   assert (bufptr->latch_mode == PGBUF_NO_LATCH);
 
   /* a safe victim */
@@ -7676,6 +8545,11 @@ pgbuf_invalidate_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
     }
 
   pgbuf_bcb_clear_dirty (thread_p, bufptr);
+  if (pgbuf_bcb_is_read_ahead (bufptr))
+    {
+      pgbuf_bcb_update_flags (thread_p, bufptr, 0, PGBUF_BCB_READ_AHEAD_FLAG);
+      perfmon_inc_stat (thread_p, PSTAT_PB_READ_AHEAD_WASTED);
+    }
 
   LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
 
@@ -13265,6 +14139,20 @@ pgbuf_has_any_non_vacuum_waiters (PAGE_PTR pgptr)
 #endif
 }
 
+/*
+ * pgbuf_has_any_fixed_page () - Check if thread holds any page fixed.
+ *
+ * return        : True if thread has fixed pages, false otherwise.
+ * thread_p (in) : Thread entry.
+ */
+bool
+pgbuf_has_any_fixed_page (THREAD_ENTRY * thread_p)
+{
+  int thrd_index = thread_get_entry_index (thread_p);
+
+  return pgbuf_Pool.thrd_holder_info[thrd_index].num_hold_cnt > 0;
+}
+
 /*
  * pgbuf_has_prevent_dealloc () - Quick check if page has any scanners.
  *
@@ -13590,7 +14478,7 @@ pgbuf_get_fix_count (PAGE_PTR pgptr)
 
   CAST_PGPTR_TO_BFPTR (bufptr, pgptr);
 
-  return bufptr->fcnt;
+  return pgbuf_bcb_get_fix_count (bufptr);
 }
 
 /*
@@ -13748,7 +14636,7 @@ pgbuf_dealloc_page (THREAD_ENTRY * thread_p, PAGE_PTR page_dealloc)
   /* set dirty and mark to move to the bottom of lru */
   pgbuf_bcb_update_flags (thread_p, bcb, PGBUF_BCB_DIRTY_FLAG | PGBUF_BCB_MOVE_TO_LRU_BOTTOM_FLAG, 0);
 
-  holder_status = pgbuf_unlatch_thrd_holder (thread_p, bcb, NULL);
+  holder_status = pgbuf_unlatch_thrd_holder (thread_p, bcb, NULL, NULL);
 
 #if !defined (NDEBUG)
   thread_p->get_pgbuf_tracker ().decrement (page_dealloc);
@@ -14678,6 +15566,49 @@ pgbuf_bcb_is_to_vacuum (const PGBUF_BCB * bcb)
   return (bcb->flags & PGBUF_BCB_TO_VACUUM_FLAG) != 0;
 }
 
+/*
+ * pgbuf_bcb_is_read_ahead () - was page read ahead and not fixed since?
+ *
+ * return   : true/false
+ * bcb (in) : bcb
+ */
+STATIC_INLINE bool
+pgbuf_bcb_is_read_ahead (const PGBUF_BCB * bcb)
+{
+  return (bcb->flags & PGBUF_BCB_READ_AHEAD_FLAG) != 0;
+}
+
+/*
+ * pgbuf_bcb_is_lock_free_read () - can page be fixed for read without bcb mutex?
+ *
+ * return   : true/false
+ * bcb (in) : bcb
+ */
+STATIC_INLINE bool
+pgbuf_bcb_is_lock_free_read (const PGBUF_BCB * bcb)
+{
+  return (bcb->flags & PGBUF_BCB_LOCK_FREE_READ_FLAG) != 0;
+}
+
+/*
+ * pgbuf_bcb_get_fix_count () - get the number of fixes of bcb, including the fixes done without bcb mutex
+ *
+ * return   : fix count
+ * bcb (in) : bcb
+ */
+STATIC_INLINE int
+pgbuf_bcb_get_fix_count (const PGBUF_BCB * bcb)
+{
+#if defined (SERVER_MODE)
+  if (bcb->has_lock_free_fix)
+    {
+      /* replace the fix held on behalf of lock-free readers with their actual count */
+      return bcb->fcnt - 1 + bcb->lock_free_fcnt;
+    }
+#endif /* SERVER_MODE */
+  return bcb->fcnt;
+}
+
 /*
  * pgbuf_bcb_avoid_victim () - should bcb be avoid for victimization?
  *
@@ -15690,6 +16621,42 @@ pgbuf_flush_control_daemon_init ()
 }
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_read_ahead_execute () - read ahead the windows requested by page fixes
+ */
+static void
+pgbuf_read_ahead_execute (cubthread::entry & thread_ref)
+{
+  PGBUF_READ_AHEAD_REQUEST request;
+
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      // wait for boot to finish
+      return;
+    }
+
+  while (pgbuf_Pool.read_ahead_requests->consume (request))
+    {
+      pgbuf_read_ahead_window (&thread_ref, &request.first_vpid, request.last_pageid);
+    }
+}
+
+/*
+ * pgbuf_read_ahead_daemon_init () - initialize read-ahead daemon thread
+ */
+void
+pgbuf_read_ahead_daemon_init ()
+{
+  assert (pgbuf_Read_ahead_daemon == NULL);
+
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (100));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (pgbuf_read_ahead_execute);
+
+  pgbuf_Read_ahead_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "pgbuf_read_ahead");
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * pgbuf_daemons_init () - initialize page buffer daemon threads
@@ -15701,6 +16668,7 @@ pgbuf_daemons_init ()
   pgbuf_page_flush_daemon_init ();
   pgbuf_page_post_flush_daemon_init ();
   pgbuf_flush_control_daemon_init ();
+  pgbuf_read_ahead_daemon_init ();
 }
 #endif /* SERVER_MODE */
 
@@ -15715,6 +16683,7 @@ pgbuf_daemons_destroy ()
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_post_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Flush_control_daemon);
+  cubthread::get_manager ()->destroy_daemon (pgbuf_Read_ahead_daemon);
 }
 #endif /* SERVER_MODE */
 
@@ -37,6 +37,14 @@
 
 #define STATS_SAMPLING_THRESHOLD 50	/* sampling trial count */
 #define STATS_SAMPLING_LEAFS_MAX   8	/* sampling leaf pages */
+#define STATS_SAMPLING_HEAP_PAGES 128	/* sampling heap pages for column statistics */
+
+/* column statistics */
+#define STATS_HISTOGRAM_BUCKETS      32	/* buckets of equi-depth histograms */
+#define STATS_HISTOGRAM_SAMPLE_SIZE  10000	/* maximum sampled values a histogram is built from */
+#define STATS_HISTOGRAM_SAMPLE_TOTAL 100000	/* sampled values shared by all the attributes of a class */
+#define STATS_HISTOGRAM_VALUE_SIZE_MAX  64	/* no histogram for attributes having larger values */
+#define STATS_HLL_PRECISION          10	/* HyperLogLog sketches use 2^STATS_HLL_PRECISION registers */
 
 /* disk-resident elements of pkeys[] field */
 #define BTREE_STATS_PKEYS_NUM      8
@@ -80,6 +88,10 @@ struct attr_stats
   DB_TYPE type;
   int n_btstats;		/* number of B+tree statistics information */
   BTREE_STATS *bt_stats;	/* pointer to array of BTREE_STATS[n_btstats] */
+  int ndv;			/* estimated number of distinct values; 0 if not gathered */
+  int n_hist_bounds;		/* number of histogram bounds; 0 if there is no histogram */
+  DB_VALUE *hist_bounds;	/* equi-depth histogram: hist_bounds[0] is the minimum, the last one the maximum and
+				 * every bucket in between holds the same number of values */
 };
 
 /* Statistical Information about the class */
@@ -36,6 +36,7 @@
 #include "network_interface_cl.h"
 #include "tz_support.h"
 #include "db_date.h"
+#include "dbtype.h"
 
 static CLASS_STATS *stats_client_unpack_statistics (char *buffer);
 
@@ -86,8 +87,9 @@ stats_client_unpack_statistics (char *buf_p)
   CLASS_STATS *class_stats_p;
   ATTR_STATS *attr_stats_p;
   BTREE_STATS *btree_stats_p;
-  int max_unique_keys;
-  int i, j, k;
+  OR_BUF hist_buf;
+  int max_unique_keys, hist_length;
+  int i, j, k, rc;
 
   if (buf_p == NULL)
     {
@@ -139,6 +141,7 @@ stats_client_unpack_statistics (char *buf_p)
       db_ws_free (class_stats_p);
       return NULL;
     }
+  memset (class_stats_p->attr_stats, 0, class_stats_p->n_attrs * sizeof (ATTR_STATS));
 
   for (i = 0, attr_stats_p = class_stats_p->attr_stats; i < class_stats_p->n_attrs; i++, attr_stats_p++)
     {
@@ -151,6 +154,42 @@ stats_client_unpack_statistics (char *buf_p)
       attr_stats_p->n_btstats = OR_GET_INT (buf_p);
       buf_p += OR_INT_SIZE;
 
+      attr_stats_p->ndv = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      hist_length = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      if (hist_length > 0)
+	{
+	  or_init (&hist_buf, buf_p, hist_length);
+	  attr_stats_p->n_hist_bounds = or_get_int (&hist_buf, &rc);
+	  assert (rc == NO_ERROR && attr_stats_p->n_hist_bounds > 1);
+
+	  attr_stats_p->hist_bounds = (DB_VALUE *) db_ws_alloc (attr_stats_p->n_hist_bounds * sizeof (DB_VALUE));
+	  if (attr_stats_p->hist_bounds == NULL)
+	    {
+	      attr_stats_p->n_hist_bounds = 0;
+	      stats_free_statistics (class_stats_p);
+	      return NULL;
+	    }
+
+	  for (k = 0; k < attr_stats_p->n_hist_bounds; k++)
+	    {
+	      db_make_null (&attr_stats_p->hist_bounds[k]);
+	    }
+	  for (k = 0; k < attr_stats_p->n_hist_bounds; k++)
+	    {
+	      if (or_get_value (&hist_buf, &attr_stats_p->hist_bounds[k], NULL, -1, true) != NO_ERROR)
+		{
+		  stats_free_statistics (class_stats_p);
+		  return NULL;
+		}
+	    }
+
+	  buf_p += DB_ALIGN (hist_length, INT_ALIGNMENT);
+	}
+
       if (attr_stats_p->n_btstats <= 0)
 	{
 	  attr_stats_p->bt_stats = NULL;
@@ -230,6 +269,9 @@ stats_client_unpack_statistics (char *buf_p)
   assert (class_stats_p->heap_num_objects >= 0);
   for (i = 0, attr_stats_p = class_stats_p->attr_stats; i < class_stats_p->n_attrs; i++, attr_stats_p++)
     {
+      assert (attr_stats_p->ndv >= 0);
+      attr_stats_p->ndv = MIN (attr_stats_p->ndv, class_stats_p->heap_num_objects);
+
       for (j = 0, btree_stats_p = attr_stats_p->bt_stats; j < attr_stats_p->n_btstats; j++, btree_stats_p++)
 	{
 	  assert (btree_stats_p->keys >= 0);
@@ -276,6 +318,17 @@ stats_free_statistics (CLASS_STATS * class_statsp)
 		  db_ws_free (attr_statsp->bt_stats);
 		  attr_statsp->bt_stats = NULL;
 		}
+
+	      if (attr_statsp->hist_bounds)
+		{
+		  for (j = 0; j < attr_statsp->n_hist_bounds; j++)
+		    {
+		      pr_clear_value (&attr_statsp->hist_bounds[j]);
+		    }
+
+		  db_ws_free (attr_statsp->hist_bounds);
+		  attr_statsp->hist_bounds = NULL;
+		}
 	    }
 	  db_ws_free (class_statsp->attr_stats);
 	  class_statsp->attr_stats = NULL;
@@ -480,6 +533,25 @@ stats_dump (const char *class_name_p, FILE * file_p)
 	  break;
 	}
 
+      if (attr_stats_p->ndv > 0)
+	{
+	  fprintf (file_p, "    Distinct values: %d\n", attr_stats_p->ndv);
+	}
+
+      if (attr_stats_p->n_hist_bounds > 0)
+	{
+	  fprintf (file_p, "    Histogram: %d buckets (", attr_stats_p->n_hist_bounds - 1);
+
+	  prefix_p = "";
+	  for (k = 0; k < attr_stats_p->n_hist_bounds; k++)
+	    {
+	      fprintf (file_p, "%s", prefix_p);
+	      db_value_fprint (file_p, &attr_stats_p->hist_bounds[k]);
+	      prefix_p = ", ";
+	    }
+	  fprintf (file_p, ")\n");
+	}
+
       if (attr_stats_p->n_btstats > 0)
 	{
 	  fprintf (file_p, "    B+tree statistics:\n");
@@ -33,14 +33,21 @@
 
 #include "btree.h"
 #include "heap_file.h"
+#include "file_manager.h"
+#include "memory_hash.h"
 #include "boot_sr.h"
 #include "partition_sr.h"
 #include "object_primitive.h"
 #include "object_representation.h"
+#include "dbtype.h"
+#include "query_manager.h"
 #include "thread_entry.hpp"
 
 #define SQUARE(n) ((n)*(n))
 
+/* initial number of slots of the sampled values of an attribute; doubled as needed up to its sample size */
+#define STATS_COLUMN_SAMPLE_INIT_SLOTS 256
+
 /* Used by the "stats_update_all_statistics" routine to create the list of all
    classes from the extensible hashing directory used by the catalog manager. */
 typedef struct class_id_list CLASS_ID_LIST;
@@ -62,6 +69,21 @@ struct partition_stats_acumulator
 				 * # of {a, b} ... pkeys[pkeys_size-1] -> # of {a, b, ..., x} */
 };
 
+/* Used by "stats_update_column_statistics" to gather the column statistics of an attribute. */
+typedef struct stats_column_collector STATS_COLUMN_COLLECTOR;
+struct stats_column_collector
+{
+  DISK_ATTR *disk_attr;		/* the attribute */
+  unsigned char hll_registers[1 << STATS_HLL_PRECISION];	/* HyperLogLog sketch of the distinct values */
+  int n_values;			/* number of not null values seen */
+  bool has_histogram;		/* false if no histogram is built for the attribute */
+  unsigned int *sample_hash;	/* hash values of the sampled values */
+  DB_VALUE *sample;		/* the sampled values if has_histogram */
+  int n_sample;			/* number of sampled values */
+  int n_slots;			/* number of allocated slots of sample_hash and sample */
+  int sample_size;		/* maximum number of sampled values */
+};
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 static int stats_compare_data (DB_DATA * data1, DB_DATA * data2, DB_TYPE type);
 static int stats_compare_date (DB_DATE * date1, DB_DATE * date2);
@@ -72,6 +94,19 @@ static int stats_compare_money (DB_MONETARY * mn1, DB_MONETARY * mn2);
 #endif
 static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_oid, OID * partitions, int count,
 						bool with_fullscan);
+static int stats_update_column_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p,
+					   DISK_REPR * disk_repr_p, int npages, int nobjs, bool with_fullscan);
+static bool stats_is_column_stats_type (DB_TYPE type);
+static bool stats_is_histogram_type (DB_TYPE type);
+static unsigned int stats_hash_value (const DB_VALUE * value);
+static void stats_hll_add (unsigned char *registers, unsigned int hash);
+static double stats_hll_estimate (const unsigned char *registers);
+static int stats_collect_column_value (THREAD_ENTRY * thread_p, STATS_COLUMN_COLLECTOR * collector, DB_VALUE * value);
+static int stats_grow_column_sample (THREAD_ENTRY * thread_p, STATS_COLUMN_COLLECTOR * collector);
+static int stats_build_column_statistics (THREAD_ENTRY * thread_p, STATS_COLUMN_COLLECTOR * collector, double scale);
+static int stats_compare_sample_values (const void *a, const void *b);
+static int stats_compare_sample_hashes (const void *a, const void *b);
+static void stats_free_column_sample (THREAD_ENTRY * thread_p, STATS_COLUMN_COLLECTOR * collector);
 
 /*
  * xstats_update_statistics () -  Updates the statistics for the objects
@@ -278,6 +313,14 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
 	}			/* for (j = 0; ...) */
     }				/* for (i = 0; ...) */
 
+  /* update the distinct values and the histogram of each attribute */
+  error_code = stats_update_column_statistics (thread_p, class_id_p, &(cls_info_p->ci_hfid), disk_repr_p, npages,
+					       cls_info_p->ci_tot_objects, with_fullscan);
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+
   error_code = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, X_LOCK);
   if (error_code != NO_ERROR)
     {
@@ -449,7 +492,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
   BTREE_STATS *btree_stats_p;
   OID dir_oid;
   int npages, estimated_nobjs, max_unique_keys;
-  int i, j, k, size, n_attrs, tot_n_btstats, tot_key_info_size;
+  int i, j, k, size, n_attrs, tot_n_btstats, tot_key_info_size, tot_hist_size;
   char *buf_p, *start_p;
   int key_size;
   int lk_grant_code;
@@ -526,7 +569,7 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 
   n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
 
-  tot_n_btstats = tot_key_info_size = 0;
+  tot_n_btstats = tot_key_info_size = tot_hist_size = 0;
   for (i = 0; i < n_attrs; i++)
     {
       if (i < disk_repr_p->n_fixed)
@@ -545,6 +588,11 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  assert (btree_stats_p->pkeys_size <= BTREE_STATS_PKEYS_NUM);
 	  tot_key_info_size += (btree_stats_p->pkeys_size * OR_INT_SIZE);	/* pkeys[] */
 	}
+
+      if (disk_attr_p->histogram != NULL)
+	{
+	  tot_hist_size += DB_ALIGN (disk_attr_p->hist_length, INT_ALIGNMENT);
+	}
     }
 
   size = (OR_INT_SIZE		/* time_stamp of CLS_INFO */
@@ -554,8 +602,12 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  + (OR_INT_SIZE	/* id of DISK_ATTR */
 	     + OR_INT_SIZE	/* type of DISK_ATTR */
 	     + OR_INT_SIZE	/* n_btstats of DISK_ATTR */
+	     + OR_INT_SIZE	/* ndv of DISK_ATTR */
+	     + OR_INT_SIZE	/* hist_length of DISK_ATTR */
 	  ) * n_attrs);		/* number of attributes */
 
+  size += tot_hist_size;	/* histogram of DISK_ATTR */
+
   size += ((OR_BTID_ALIGNED_SIZE	/* btid of BTREE_STATS */
 	    + OR_INT_SIZE	/* leafs of BTREE_STATS */
 	    + OR_INT_SIZE	/* pages of BTREE_STATS */
@@ -654,6 +706,23 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
       OR_PUT_INT (buf_p, disk_attr_p->n_btstats);
       buf_p += OR_INT_SIZE;
 
+      OR_PUT_INT (buf_p, disk_attr_p->ndv);
+      buf_p += OR_INT_SIZE;
+
+      if (disk_attr_p->histogram != NULL)
+	{
+	  OR_PUT_INT (buf_p, disk_attr_p->hist_length);
+	  buf_p += OR_INT_SIZE;
+
+	  memcpy (buf_p, disk_attr_p->histogram, disk_attr_p->hist_length);
+	  buf_p += DB_ALIGN (disk_attr_p->hist_length, INT_ALIGNMENT);
+	}
+      else
+	{
+	  OR_PUT_INT (buf_p, 0);
+	  buf_p += OR_INT_SIZE;
+	}
+
       for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
 	{
 	  /* collect maximum unique keys info */
@@ -1467,6 +1536,19 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 	  assert_release (subcls_attr_p->id == disk_attr_p->id);
 	  assert_release (subcls_attr_p->n_btstats == disk_attr_p->n_btstats);
 
+	  /* the values of a partition are not found in the other partitions only if it is partitioned by this
+	   * attribute; use the largest number of distinct values of a partition */
+	  if (i == 0)
+	    {
+	      disk_attr_p->ndv = 0;
+	      if (disk_attr_p->histogram != NULL)
+		{
+		  db_private_free_and_init (thread_p, disk_attr_p->histogram);
+		}
+	      disk_attr_p->hist_length = 0;
+	    }
+	  disk_attr_p->ndv = MAX (disk_attr_p->ndv, subcls_attr_p->ndv);
+
 	  for (k = 0, btree_stats_p = disk_attr_p->bt_stats; k < disk_attr_p->n_btstats; k++, btree_stats_p++)
 	    {
 	      const BTREE_STATS *subcls_stats;
@@ -1827,3 +1909,645 @@ stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_re
   er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
   return NULL;
 }
+
+/*
+ * stats_update_column_statistics () - gather the number of distinct values and the histogram of the attributes
+ *   return: error code
+ *   class_id_p(in): class identifier
+ *   hfid_p(in): heap file of the class
+ *   disk_repr_p(in/out): disk representation; ndv and histogram of its attributes are replaced
+ *   npages(in): number of pages of the heap file
+ *   nobjs(in): estimated number of objects of the class
+ *   with_fullscan(in): true iff WITH FULLSCAN
+ *
+ * Note: Unless WITH FULLSCAN is given, only STATS_SAMPLING_HEAP_PAGES random pages of the heap file are read. The
+ *       distinct values of each attribute are counted with a HyperLogLog sketch and a reservoir of values is sampled
+ *       from the read objects; the reservoirs of all attributes hold about STATS_HISTOGRAM_SAMPLE_TOTAL values. When
+ *       the pages are sampled, the number of distinct values of the whole class is estimated from the singletons of
+ *       the reservoir (the GEE estimator). The equi-depth histogram is built from the sorted reservoir.
+ */
+static int
+stats_update_column_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p, DISK_REPR * disk_repr_p,
+				int npages, int nobjs, bool with_fullscan)
+{
+  STATS_COLUMN_COLLECTOR *collectors = NULL, *collector;
+  DISK_ATTR *disk_attr_p;
+  HEAP_SCANCACHE scan_cache;
+  HEAP_CACHE_ATTRINFO attr_info;
+  MVCC_SNAPSHOT *mvcc_snapshot;
+  VPID *vpids = NULL;
+  RECDES recdes;
+  OID oid;
+  SCAN_CODE scan;
+  DB_VALUE *value;
+  bool is_heap_page;
+  bool scan_cache_inited = false, attr_info_inited = false;
+  int n_attrs, n_collectors = 0, n_sample_pages, n_sampled = 0, n_rows = 0, sample_size;
+  double scale;
+  int i;
+  int error_code = NO_ERROR;
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+  if (n_attrs == 0 || npages <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  collectors = (STATS_COLUMN_COLLECTOR *) db_private_alloc (thread_p, n_attrs * sizeof (STATS_COLUMN_COLLECTOR));
+  if (collectors == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  memset (collectors, 0, n_attrs * sizeof (STATS_COLUMN_COLLECTOR));
+
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+
+      /* forget the statistics of previous update */
+      disk_attr_p->ndv = 0;
+      if (disk_attr_p->histogram != NULL)
+	{
+	  db_private_free_and_init (thread_p, disk_attr_p->histogram);
+	}
+      disk_attr_p->hist_length = 0;
+
+      if (!stats_is_column_stats_type (disk_attr_p->type))
+	{
+	  continue;
+	}
+
+      collector = &collectors[n_collectors++];
+      collector->disk_attr = disk_attr_p;
+      collector->has_histogram = stats_is_histogram_type (disk_attr_p->type);
+    }
+
+  if (n_collectors == 0)
+    {
+      goto end;
+    }
+
+  /* the attributes share STATS_HISTOGRAM_SAMPLE_TOTAL sampled values, but each one keeps enough of them to fill the
+   * histogram buckets; the slots are allocated as the values are sampled */
+  sample_size = MIN (STATS_HISTOGRAM_SAMPLE_SIZE, STATS_HISTOGRAM_SAMPLE_TOTAL / n_collectors);
+  sample_size = MAX (sample_size, 2 * STATS_HISTOGRAM_BUCKETS);
+  for (collector = collectors; collector < collectors + n_collectors; collector++)
+    {
+      collector->sample_size = sample_size;
+    }
+
+  n_sample_pages = with_fullscan ? npages : MIN (npages, STATS_SAMPLING_HEAP_PAGES);
+  vpids = (VPID *) db_private_alloc (thread_p, n_sample_pages * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  error_code = file_sample_pages (thread_p, &hfid_p->vfid, n_sample_pages, vpids, &n_sampled);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+  if (mvcc_snapshot == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  error_code = heap_scancache_start (thread_p, &scan_cache, hfid_p, class_id_p, true, false, mvcc_snapshot);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  scan_cache_inited = true;
+
+  error_code = heap_attrinfo_start (thread_p, class_id_p, -1, NULL, &attr_info);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  attr_info_inited = true;
+
+  for (i = 0; i < n_sampled; i++)
+    {
+      error_code = heap_page_fix_sampled (thread_p, &scan_cache, &vpids[i], &is_heap_page);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+      if (!is_heap_page)
+	{
+	  continue;
+	}
+
+      oid.volid = vpids[i].volid;
+      oid.pageid = vpids[i].pageid;
+      oid.slotid = NULL_SLOTID;
+      recdes.data = NULL;
+
+      while ((scan = heap_page_next (thread_p, &oid, &recdes, &scan_cache, PEEK)) == S_SUCCESS)
+	{
+	  n_rows++;
+
+	  error_code = heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, NULL, &attr_info);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+
+	  for (collector = collectors; collector < collectors + n_collectors; collector++)
+	    {
+	      value = heap_attrinfo_access (collector->disk_attr->id, &attr_info);
+	      if (value == NULL || DB_IS_NULL (value))
+		{
+		  continue;
+		}
+
+	      error_code = stats_collect_column_value (thread_p, collector, value);
+	      if (error_code != NO_ERROR)
+		{
+		  goto end;
+		}
+	    }
+	}
+
+      if (scan != S_END)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  goto end;
+	}
+    }
+
+  /* the values seen represent this part of the class */
+  scale = 1.0;
+  if (n_sampled < npages && n_rows > 0 && nobjs > n_rows)
+    {
+      scale = (double) nobjs / n_rows;
+    }
+
+  for (collector = collectors; collector < collectors + n_collectors; collector++)
+    {
+      error_code = stats_build_column_statistics (thread_p, collector, scale);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+    }
+
+end:
+  if (attr_info_inited)
+    {
+      heap_attrinfo_end (thread_p, &attr_info);
+    }
+  if (scan_cache_inited)
+    {
+      (void) heap_scancache_end (thread_p, &scan_cache);
+    }
+  if (vpids != NULL)
+    {
+      db_private_free_and_init (thread_p, vpids);
+    }
+  for (collector = collectors; collector < collectors + n_collectors; collector++)
+    {
+      stats_free_column_sample (thread_p, collector);
+      if (collector->sample_hash != NULL)
+	{
+	  db_private_free_and_init (thread_p, collector->sample_hash);
+	}
+    }
+  db_private_free_and_init (thread_p, collectors);
+
+  return error_code;
+}
+
+/*
+ * stats_is_column_stats_type () - can the distinct values of an attribute of this type be counted
+ *   return: true if the type is supported
+ *   type(in): attribute type
+ */
+static bool
+stats_is_column_stats_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_BIT:
+    case DB_TYPE_VARBIT:
+    case DB_TYPE_OID:
+    case DB_TYPE_ENUMERATION:
+      return true;
+
+    default:
+      return stats_is_histogram_type (type);
+    }
+}
+
+/*
+ * stats_is_histogram_type () - can a histogram be built for an attribute of this type
+ *   return: true if the type is supported
+ *   type(in): attribute type
+ */
+static bool
+stats_is_histogram_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_NUMERIC:
+    case DB_TYPE_MONETARY:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_TIMESTAMPLTZ:
+    case DB_TYPE_TIMESTAMPTZ:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_DATETIMELTZ:
+    case DB_TYPE_DATETIMETZ:
+    case DB_TYPE_CHAR:
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_VARNCHAR:
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/*
+ * stats_hash_value () - hash a value for the distinct values sketch
+ *   return: 32 bits hash value
+ *   value(in): value
+ *
+ * Note: mht_get_hash_number is not well distributed in its high bits, the result is mixed with the finalizer of
+ *       MurmurHash3.
+ */
+static unsigned int
+stats_hash_value (const DB_VALUE * value)
+{
+  unsigned int hash = mht_get_hash_number (INT_MAX, value);
+
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6b;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35;
+  hash ^= hash >> 16;
+
+  return hash;
+}
+
+/*
+ * stats_hll_add () - add a hash value to a HyperLogLog sketch
+ *   return: void
+ *   registers(in/out): sketch of 1 << STATS_HLL_PRECISION registers
+ *   hash(in): hash value
+ */
+static void
+stats_hll_add (unsigned char *registers, unsigned int hash)
+{
+  unsigned int index = hash >> (32 - STATS_HLL_PRECISION);
+  unsigned int rest = hash << STATS_HLL_PRECISION;
+  unsigned char rank = 1;
+
+  /* position of the first 1 bit in the remaining bits */
+  while (rank <= 32 - STATS_HLL_PRECISION && (rest & 0x80000000) == 0)
+    {
+      rank++;
+      rest <<= 1;
+    }
+
+  if (registers[index] < rank)
+    {
+      registers[index] = rank;
+    }
+}
+
+/*
+ * stats_hll_estimate () - estimate the number of distinct values added to a HyperLogLog sketch
+ *   return: estimated number of distinct values
+ *   registers(in): sketch of 1 << STATS_HLL_PRECISION registers
+ */
+static double
+stats_hll_estimate (const unsigned char *registers)
+{
+  const int m = 1 << STATS_HLL_PRECISION;
+  const double two_32 = 4294967296.0;
+  double alpha = 0.7213 / (1.0 + 1.079 / m);
+  double sum = 0, estimate;
+  int zeros = 0;
+  int i;
+
+  for (i = 0; i < m; i++)
+    {
+      sum += ldexp (1.0, -registers[i]);
+      if (registers[i] == 0)
+	{
+	  zeros++;
+	}
+    }
+
+  estimate = alpha * m * m / sum;
+  if (estimate <= 2.5 * m)
+    {
+      if (zeros > 0)
+	{
+	  /* small range correction: linear counting */
+	  estimate = m * log ((double) m / zeros);
+	}
+    }
+  else if (estimate > two_32 / 30)
+    {
+      /* large range correction */
+      estimate = -two_32 * log (1.0 - estimate / two_32);
+    }
+
+  return estimate;
+}
+
+/*
+ * stats_collect_column_value () - add a not null value of an attribute to its column statistics
+ *   return: error code
+ *   collector(in/out): column statistics of the attribute
+ *   value(in): value
+ */
+static int
+stats_collect_column_value (THREAD_ENTRY * thread_p, STATS_COLUMN_COLLECTOR * collector, DB_VALUE * value)
+{
+  unsigned int hash = stats_hash_value (value);
+  bool is_replaced = false;
+  double r;
+  int pick;
+  int error_code = NO_ERROR;
+
+  stats_hll_add (collector->hll_registers, hash);
+  collector->n_values++;
+
+  if (collector->has_histogram && TP_IS_CHAR_TYPE (DB_VALUE_DOMAIN_TYPE (value))
+      && db_get_string_size (value) > STATS_HISTOGRAM_VALUE_SIZE_MAX)
+    {
+      /* too long to be kept in the histogram */
+      stats_free_column_sample (thread_p, collector);
+    }
+
+  /* reservoir sampling */
+  if (collector->n_sample < collector->sample_size)
+    {
+      if (collector->n_sample == collector->n_slots)
+	{
+	  error_code = stats_grow_column_sample (thread_p, collector);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
+      pick = collector->n_sample++;
+    }
+  else
+    {
+      /* the generator of the thread; drand48 () would be shared by all the threads of the server */
+      drand48_r (qmgr_get_rand_buf (thread_p), &r);
+      pick = (int) (r * collector->n_values);
+      if (pick >= collector->sample_size)
+	{
+	  return NO_ERROR;
+	}
+      is_replaced = true;
+    }
+
+  collector->sample_hash[pick] = hash;
+  if (collector->has_histogram)
+    {
+      if (is_replaced)
+	{
+	  pr_clear_value (&collector->sample[pick]);
+	}
+      if (pr_clone_value (value, &collector->sample[pick]) != NO_ERROR)
+	{
+	  db_make_null (&collector->sample[pick]);
+	  return ER_FAILED;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_build_column_statistics () - compute the number of distinct values and the histogram of an attribute from
+ *                                    its collected values
+ *   return: error code
+ *   collector(in/out): column statistics of the attribute
+ *   scale(in): ratio between the objects of the class and the objects read
+ */
+static int
+stats_build_column_statistics (THREAD_ENTRY * thread_p, STATS_COLUMN_COLLECTOR * collector, double scale)
+{
+  DISK_ATTR *disk_attr_p = collector->disk_attr;
+  OR_BUF buf;
+  char *histogram;
+  double d, ndv, f1, max_ndv;
+  int n_singletons, n_bounds, n_buckets, size;
+  int i, j;
+  int error_code = NO_ERROR;
+
+  if (collector->n_values == 0)
+    {
+      /* null values only */
+      return NO_ERROR;
+    }
+
+  d = MIN (stats_hll_estimate (collector->hll_registers), (double) collector->n_values);
+  d = MAX (d, 1);
+
+  if (scale <= 1.0)
+    {
+      ndv = d;
+    }
+  else
+    {
+      /* count the values that occur only once in the sample */
+      qsort (collector->sample_hash, collector->n_sample, sizeof (unsigned int), stats_compare_sample_hashes);
+      n_singletons = 0;
+      for (i = 0; i < collector->n_sample; i = j)
+	{
+	  for (j = i + 1; j < collector->n_sample && collector->sample_hash[j] == collector->sample_hash[i]; j++)
+	    {
+	      ;
+	    }
+	  if (j == i + 1)
+	    {
+	      n_singletons++;
+	    }
+	}
+
+      /* GEE estimator: the singletons represent sqrt (scale) distinct values each, the other values were all seen */
+      f1 = (double) n_singletons * collector->n_values / collector->n_sample;
+      f1 = MIN (f1, d);
+      ndv = sqrt (scale) * f1 + (d - f1);
+
+      max_ndv = collector->n_values * scale;
+      ndv = MIN (ndv, max_ndv);
+      ndv = MAX (ndv, d);
+    }
+  disk_attr_p->ndv = (ndv >= INT_MAX) ? INT_MAX : (int) (ndv + 0.5);
+
+  if (!collector->has_histogram || collector->n_sample < 2)
+    {
+      return NO_ERROR;
+    }
+
+  /* equi-depth histogram: the bounds split the sorted sample into buckets of the same number of values */
+  qsort (collector->sample, collector->n_sample, sizeof (DB_VALUE), stats_compare_sample_values);
+
+  n_buckets = MIN (STATS_HISTOGRAM_BUCKETS, collector->n_sample - 1);
+  n_bounds = n_buckets + 1;
+
+  size = OR_INT_SIZE;
+  for (i = 0; i < n_bounds; i++)
+    {
+      size += or_packed_value_size (&collector->sample[(INT64) i * (collector->n_sample - 1) / n_buckets], 0, 1, 0);
+    }
+
+  histogram = (char *) db_private_alloc (thread_p, size);
+  if (histogram == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  or_init (&buf, histogram, size);
+  if (or_put_int (&buf, n_bounds) != NO_ERROR)
+    {
+      db_private_free_and_init (thread_p, histogram);
+      return ER_FAILED;
+    }
+  for (i = 0; i < n_bounds; i++)
+    {
+      if (or_put_value (&buf, &collector->sample[(INT64) i * (collector->n_sample - 1) / n_buckets], 0, 1, 0)
+	  != NO_ERROR)
+	{
+	  db_private_free_and_init (thread_p, histogram);
+	  return ER_FAILED;
+	}
+    }
+
+  disk_attr_p->histogram = histogram;
+  disk_attr_p->hist_length = size;
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_compare_sample_values () - qsort compare function for the sampled values of an attribute
+ *   return: -1, 0 or 1
+ *   a(in): DB_VALUE
+ *   b(in): DB_VALUE
+ */
+static int
+stats_compare_sample_values (const void *a, const void *b)
+{
+  DB_VALUE_COMPARE_RESULT c;
+
+  c = tp_value_compare ((const DB_VALUE *) a, (const DB_VALUE *) b, 1, 1);
+  if (c == DB_LT)
+    {
+      return -1;
+    }
+  else if (c == DB_GT)
+    {
+      return 1;
+    }
+
+  return 0;
+}
+
+/*
+ * stats_compare_sample_hashes () - qsort compare function for the hash values of the sampled values
+ *   return: -1, 0 or 1
+ *   a(in): unsigned int
+ *   b(in): unsigned int
+ */
+static int
+stats_compare_sample_hashes (const void *a, const void *b)
+{
+  unsigned int h1 = *(const unsigned int *) a;
+  unsigned int h2 = *(const unsigned int *) b;
+
+  return (h1 < h2) ? -1 : ((h1 > h2) ? 1 : 0);
+}
+
+/*
+ * stats_free_column_sample () - free the sampled values of an attribute; no histogram is built for it after
+ *   return: void
+ *   collector(in/out): column statistics of the attribute
+ */
+static void
+stats_free_column_sample (THREAD_ENTRY * thread_p, STATS_COLUMN_COLLECTOR * collector)
+{
+  int i;
+
+  collector->has_histogram = false;
+  if (collector->sample == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < collector->n_sample; i++)
+    {
+      pr_clear_value (&collector->sample[i]);
+    }
+  db_private_free_and_init (thread_p, collector->sample);
+}
+
+/*
+ * stats_grow_column_sample () - double the slots of the sampled values of an attribute, up to its sample size
+ *   return: error code
+ *   collector(in/out): column statistics of the attribute
+ */
+static int
+stats_grow_column_sample (THREAD_ENTRY * thread_p, STATS_COLUMN_COLLECTOR * collector)
+{
+  unsigned int *sample_hash;
+  DB_VALUE *sample;
+  int n_slots;
+
+  n_slots = (collector->n_slots == 0) ? STATS_COLUMN_SAMPLE_INIT_SLOTS : collector->n_slots * 2;
+  n_slots = MIN (n_slots, collector->sample_size);
+  assert (n_slots > collector->n_slots);
+
+  sample_hash = (unsigned int *) db_private_realloc (thread_p, collector->sample_hash, n_slots * sizeof (unsigned int));
+  if (sample_hash == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, n_slots * sizeof (unsigned int));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  collector->sample_hash = sample_hash;
+
+  if (collector->has_histogram)
+    {
+      /* the sampled values do not point into themselves and can be moved */
+      sample = (DB_VALUE *) db_private_realloc (thread_p, collector->sample, n_slots * sizeof (DB_VALUE));
+      if (sample == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, n_slots * sizeof (DB_VALUE));
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      collector->sample = sample;
+    }
+
+  collector->n_slots = n_slots;
+  return NO_ERROR;
+}
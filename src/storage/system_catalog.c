@@ -112,8 +112,15 @@ static int rv;
 #define CATALOG_DISK_ATTR_POSITION_OFF   16
 #define CATALOG_DISK_ATTR_CLASSOID_OFF   20
 #define CATALOG_DISK_ATTR_N_BTSTATS_OFF  28
+#define CATALOG_DISK_ATTR_STATS_TAG_OFF  32
+#define CATALOG_DISK_ATTR_NDV_OFF        36
+#define CATALOG_DISK_ATTR_HIST_LENGTH_OFF 40
 #define CATALOG_DISK_ATTR_SIZE           80
 
+/* Column statistics are kept in space that was reserved in older catalogs. The tag tells them apart from whatever
+   was left there. A non-empty histogram follows the default value of the attribute. */
+#define CATALOG_DISK_ATTR_STATS_TAG      0x48535443	/* "CTSH" */
+
 #define CATALOG_BT_STATS_BTID_OFF        0
 #define CATALOG_BT_STATS_LEAFS_OFF       OR_BTID_ALIGNED_SIZE
 #define CATALOG_BT_STATS_PAGES_OFF       16
@@ -432,6 +439,17 @@ catalog_get_disk_attribute (DISK_ATTR * attr_p, char *rec_p)
   OR_GET_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   attr_p->n_btstats = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF);
   attr_p->bt_stats = NULL;
+  if (OR_GET_INT (rec_p + CATALOG_DISK_ATTR_STATS_TAG_OFF) == CATALOG_DISK_ATTR_STATS_TAG)
+    {
+      attr_p->ndv = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_NDV_OFF);
+      attr_p->hist_length = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_HIST_LENGTH_OFF);
+    }
+  else
+    {
+      attr_p->ndv = 0;
+      attr_p->hist_length = 0;
+    }
+  attr_p->histogram = NULL;
 }
 
 static void
@@ -469,6 +487,9 @@ catalog_put_disk_attribute (char *rec_p, DISK_ATTR * attr_p)
 
   OR_PUT_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF, attr_p->n_btstats);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_STATS_TAG_OFF, CATALOG_DISK_ATTR_STATS_TAG);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_NDV_OFF, attr_p->ndv);
+  OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_HIST_LENGTH_OFF, attr_p->histogram != NULL ? attr_p->hist_length : 0);
 }
 
 static void
@@ -846,6 +867,11 @@ catalog_free_representation (DISK_REPR * repr_p)
 	      db_private_free_and_init (NULL, attr_p->value);
 	    }
 
+	  if (attr_p->histogram != NULL)
+	    {
+	      db_private_free_and_init (NULL, attr_p->histogram);
+	    }
+
 	  if (attr_p->bt_stats != NULL)
 	    {
 	      for (j = 0; j < attr_p->n_btstats; j++)
@@ -2747,6 +2773,10 @@ catalog_sum_disk_attribute_size (DISK_ATTR * attrs_p, int count)
     {
       size += CATALOG_DISK_ATTR_SIZE;
       size += disk_attrp->val_length + (MAX_ALIGNMENT * 2);
+      if (disk_attrp->histogram != NULL)
+	{
+	  size += disk_attrp->hist_length;
+	}
       for (j = 0; j < disk_attrp->n_btstats; j++)
 	{
 	  size += CATALOG_BT_STATS_SIZE;
@@ -2911,6 +2941,20 @@ catalog_add_representation (THREAD_ENTRY * thread_p, OID * class_id_p, REPR_ID r
 	  return error_code;
 	}
 
+      if (disk_attr_p->histogram != NULL
+	  && catalog_store_attribute_value (thread_p, disk_attr_p->histogram, disk_attr_p->hist_length,
+					    &catalog_record, &remembered_slot_id) != NO_ERROR)
+	{
+	  db_private_free_and_init (thread_p, data);
+
+	  ASSERT_ERROR_AND_SET (error_code);
+	  if (do_end_access)
+	    {
+	      catalog_end_access_with_dir_oid (thread_p, catalog_access_info_p, ER_FAILED);
+	    }
+	  return error_code;
+	}
+
       for (j = 0; j < disk_attr_p->n_btstats; j++)
 	{
 	  btree_stats_p = &disk_attr_p->bt_stats[j];
@@ -3781,6 +3825,21 @@ catalog_assign_attribute (THREAD_ENTRY * thread_p, DISK_ATTR * disk_attr_p, CATA
       return ER_FAILED;
     }
 
+  if (disk_attr_p->hist_length > 0)
+    {
+      disk_attr_p->histogram = (char *) db_private_alloc (thread_p, disk_attr_p->hist_length);
+      if (disk_attr_p->histogram == NULL)
+	{
+	  return ER_FAILED;
+	}
+
+      if (catalog_fetch_attribute_value (thread_p, disk_attr_p->histogram, disk_attr_p->hist_length,
+					 catalog_record_p) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
   n_btstats = disk_attr_p->n_btstats;
   if (n_btstats > 0)
     {
@@ -4844,6 +4903,8 @@ catalog_dump_disk_attribute (DISK_ATTR * attr_p)
       fprintf (stdout, " \n");
     }
 
+  fprintf (stdout, " Distinct values: %d \n", attr_p->ndv);
+  fprintf (stdout, " Histogram Length: %d \n", attr_p->hist_length);
   fprintf (stdout, " BTree statistics:\n");
 
   for (k = 0; k < attr_p->n_btstats; k++)
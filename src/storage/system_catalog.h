@@ -92,6 +92,9 @@ struct disk_attribute
   OID classoid;			/* source class object id */
   int n_btstats;		/* number of B+tree statistics information */
   BTREE_STATS *bt_stats;	/* pointer to array of BTREE_STATS; BTREE_STATS[n_btstats] */
+  int ndv;			/* estimated number of distinct values; 0 if not gathered */
+  int hist_length;		/* length of the packed histogram */
+  char *histogram;		/* packed equi-depth histogram bounds; NULL if there is no histogram */
 };				/* disk attribute structure */
 
 typedef struct cls_info CLS_INFO;
@@ -24,6 +24,7 @@
 #include "thread_entry.hpp"
 
 #include "adjustable_array.h"
+#include "btree.h"
 #include "critical_section.h"  // for INF_WAIT
 #include "critical_section_tracker.hpp"
 #include "error_manager.h"
@@ -116,6 +117,7 @@ namespace cubthread
     , log_zip_redo (NULL)
     , log_data_ptr (NULL)
     , log_data_length (0)
+    , btree_key_prefix_cache (NULL)
     , net_request_index (-1)
     , vacuum_worker (NULL)
     , sort_stats_active (false)
@@ -253,6 +255,11 @@ namespace cubthread
       {
 	free (log_data_ptr);
       }
+    if (btree_key_prefix_cache != NULL)
+      {
+	btree_key_prefix_cache_free (btree_key_prefix_cache);
+	btree_key_prefix_cache = NULL;
+      }
 
     end_resource_tracks ();
 
@@ -797,6 +804,10 @@ thread_resume_status_to_string (thread_resume_suspend_status resume_status)
       return "DWB_BLOCK_QUEUE_SUSPENDED";
     case THREAD_DWB_QUEUE_RESUMED:
       return "DWB_BLOCK_QUEUE_RESUMED";
+    case THREAD_LOG_GROUP_COMMIT_SUSPENDED:
+      return "LOG_GROUP_COMMIT_SUSPENDED";
+    case THREAD_LOG_GROUP_COMMIT_RESUMED:
+      return "LOG_GROUP_COMMIT_RESUMED";
     }
   return "UNKNOWN";
 }
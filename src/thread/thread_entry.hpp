@@ -41,6 +41,8 @@
 // forward definitions
 // from adjustable_array.h
 struct adj_array;
+// from btree.h
+struct btree_key_prefix_cache;
 // from connection_defs.h
 struct css_conn_entry;
 // from fault_injection.h
@@ -157,7 +159,9 @@ enum thread_resume_suspend_status
   THREAD_ALLOC_BCB_SUSPENDED = 21,
   THREAD_ALLOC_BCB_RESUMED = 22,
   THREAD_DWB_QUEUE_SUSPENDED = 23,
-  THREAD_DWB_QUEUE_RESUMED = 24
+  THREAD_DWB_QUEUE_RESUMED = 24,
+  THREAD_LOG_GROUP_COMMIT_SUSPENDED = 25,
+  THREAD_LOG_GROUP_COMMIT_RESUMED = 26
 };
 
 namespace cubthread
@@ -257,6 +261,8 @@ namespace cubthread
       char *log_data_ptr;
       int log_data_length;
 
+      struct btree_key_prefix_cache *btree_key_prefix_cache;	/* normalized key prefixes of searched pages */
+
       int net_request_index;	/* request index of net server functions */
 
       struct vacuum_worker *vacuum_worker;	/* Vacuum worker info */
@@ -156,7 +156,7 @@ namespace cubthread
   entry_workpool *
   manager::create_worker_pool (size_t pool_size, size_t task_max_count, const char *name,
 			       entry_manager *context_manager, std::size_t core_count, bool debug_logging,
-			       bool pool_threads, wait_seconds wait_for_task_time)
+			       bool pool_threads, wait_seconds wait_for_task_time, bool work_stealing)
   {
 #if defined (SERVER_MODE)
     if (is_single_thread ())
@@ -171,7 +171,7 @@ namespace cubthread
 	  }
 	// reserve pool_size entries and add to m_worker_pools
 	return create_and_track_resource (m_worker_pools, pool_size, pool_size, task_max_count, *context_manager,
-					  name, core_count, debug_logging, pool_threads, wait_for_task_time);
+					  name, core_count, debug_logging, pool_threads, wait_for_task_time, work_stealing);
       }
 #else // not SERVER_MODE = SA_MODE
     return NULL;
@@ -415,6 +415,8 @@ namespace cubthread
     std::size_t max_active_workers = NUM_NON_SYSTEM_TRANS;  // one per each connection
     std::size_t max_conn_workers = NUM_NON_SYSTEM_TRANS;    // one per each connection
     std::size_t max_vacuum_workers = prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT);
+    std::size_t max_dwb_volume_sync_workers = prm_get_integer_value (PRM_ID_DWB_VOLUME_SYNC_WORKERS);
+    std::size_t max_sort_merge_workers = prm_get_integer_value (PRM_ID_SORT_MERGE_WORKERS);
     std::size_t max_daemons = 128;  // magic number to cover predictable requirements; not cool
 
     // note: thread entry initialization is slow, that is why we keep a static pool initialized from the beginning to
@@ -422,7 +424,8 @@ namespace cubthread
     //       generated at "runtime" (after thread starts its task). however, with current thread entry design, that is
     //       rather unlikely.
 
-    m_max_threads = max_active_workers + max_conn_workers + max_vacuum_workers + max_daemons;
+    m_max_threads = max_active_workers + max_conn_workers + max_vacuum_workers + max_dwb_volume_sync_workers
+		    + max_sort_merge_workers + max_daemons;
   }
 
   void
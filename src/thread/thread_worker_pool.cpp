@@ -67,7 +67,11 @@ namespace cubthread
     cubperf::stat_definition (Wpstat_recycle_context, cubperf::stat_definition::COUNTER_AND_TIMER,
 			      "Counter_recycle_context", "Timer_recycle_context"),
     cubperf::stat_definition (Wpstat_retire_context, cubperf::stat_definition::COUNTER_AND_TIMER,
-			      "Counter_retire_context", "Timer_retire_context")
+			      "Counter_retire_context", "Timer_retire_context"),
+    cubperf::stat_definition (Wpstat_steal_task, cubperf::stat_definition::COUNTER_AND_TIMER,
+			      "Counter_steal_task", "Timer_steal_task"),
+    cubperf::stat_definition (Wpstat_queue_wait, cubperf::stat_definition::COUNTER_AND_TIMER,
+			      "Counter_queue_wait", "Timer_queue_wait")
   };
 
   cubperf::statset &
@@ -88,6 +92,12 @@ namespace cubthread
     Worker_pool_statdef.time_and_increment (stats, id);
   }
 
+  void
+  wp_worker_statset_time_and_increment (cubperf::statset &stats, cubperf::stat_id id, cubperf::duration d)
+  {
+    Worker_pool_statdef.time_and_increment (stats, id, d);
+  }
+
   void
   wp_worker_statset_accumulate (const cubperf::statset &what, cubperf::stat_value *where)
   {
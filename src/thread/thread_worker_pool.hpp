@@ -125,6 +125,17 @@ namespace cubthread
   //          note: 3.2. and 3.3. together is an atomic operation (protected by mutex)
   //          Worker stops if waiting for new task times out (and becomes inactive).
   //
+  //    Work stealing (optional, see work_stealing constructor argument):
+  //
+  //      Round robin or hashed core assignment can leave tasks waiting in the queue of a busy core while workers of
+  //      other cores are idle. With work stealing:
+  //          - when a core has no available worker, it first tries to hand the task to an available worker of another
+  //            core; only if none is found, the task is queued.
+  //          - a worker that finds its core queue empty tries to steal the oldest queued task of another core before
+  //            becoming available.
+  //      Other cores are only probed with try_lock, so a thief never blocks on a busy core. If stealing fails, the
+  //      worker falls back to 3.2./3.3. under its own core mutex, so no task is left behind in the queue.
+  //
   //    NOTE: core class is private nested to worker pool and cannot be instantiated outside it.
   //          worker class is private nested to core class.
   //
@@ -144,7 +155,7 @@ namespace cubthread
 
       worker_pool (std::size_t pool_size, std::size_t task_max_count, context_manager_type &context_mgr,
 		   const char *name, std::size_t core_count = 1, bool debug_logging = false, bool pool_threads = false,
-		   wait_seconds wait_for_task_time = std::chrono::seconds (5));
+		   wait_seconds wait_for_task_time = std::chrono::seconds (5), bool work_stealing = false);
       ~worker_pool ();
 
       // try to execute task; executes only if the maximum number of tasks is not reached.
@@ -193,6 +204,10 @@ namespace cubthread
       {
 	return m_wait_for_task_time;
       }
+      inline bool is_work_stealing () const
+      {
+	return m_work_stealing;
+      }
 
       //////////////////////////////////////////////////////////////////////////
       // context management
@@ -233,6 +248,12 @@ namespace cubthread
       // get next core by round robin scheduling
       std::size_t get_round_robin_core_hash (void);
 
+      // work stealing; other cores than given core are probed without waiting for their locks
+      // assign task to an available worker of another core; returns false if no worker was found
+      bool try_assign_on_other_core (const core &from_core, task_type *task_p, cubperf::time_point push_time);
+      // steal a queued task from another core; returns NULL if no task was found
+      task_type *try_steal_from_other_core (const core &thief_core, cubperf::time_point &push_time_out);
+
       // maximum number of concurrent workers
       std::size_t m_max_workers;
 
@@ -260,6 +281,9 @@ namespace cubthread
       // transition time period between active and inactive
       wait_seconds m_wait_for_task_time;
 
+      // true to let cores share tasks (read work stealing in class comment)
+      bool m_work_stealing;
+
       std::string m_name;
   };
 
@@ -306,7 +330,9 @@ namespace cubthread
       void finished_task_notification (void);
       // worker management
       // get a task or add worker to free active list (still running, but ready to execute another task)
-      task_type *get_task_or_become_available (worker &worker_arg);
+      // push_time_out is the time the task was queued; is_stolen_out is true if task was queued on another core
+      task_type *get_task_or_become_available (worker &worker_arg, cubperf::time_point &push_time_out,
+	  bool &is_stolen_out);
       void become_available (worker &worker_arg);
       // is worker available?
       void check_worker_not_available (const worker &worker_arg);
@@ -324,16 +350,27 @@ namespace cubthread
 
       friend worker_pool;
 
+      // a task waiting in queue and the time it was pushed
+      struct queued_task
+      {
+	task_type *m_task_p;
+	cubperf::time_point m_push_time;
+      };
+
       // ctor/dtor
       core ();
       ~core (void);
 
+      // work stealing interface for other cores; both give up if core mutex is already locked
+      bool try_assign_task (task_type *task_p, cubperf::time_point push_time);
+      task_type *try_steal_task (cubperf::time_point &push_time_out);
+
       worker_pool_type *m_parent_pool;                // pointer to parent pool
       std::size_t m_max_workers;                      // maximum number of workers running at once
       worker *m_worker_array;                         // all core workers
       worker **m_available_workers;
       std::size_t m_available_count;
-      std::queue<task_type *> m_task_queue;           // list of tasks pushed while all workers were occupied
+      std::queue<queued_task> m_task_queue;           // list of tasks pushed while all workers were occupied
       std::mutex m_workers_mutex;                     // mutex to synchronize activity on worker lists
   };
 
@@ -496,10 +533,13 @@ namespace cubthread
   static const cubperf::stat_id Wpstat_wakeup_with_task = 5;
   static const cubperf::stat_id Wpstat_recycle_context = 6;
   static const cubperf::stat_id Wpstat_retire_context = 7;
+  static const cubperf::stat_id Wpstat_steal_task = 8;
+  static const cubperf::stat_id Wpstat_queue_wait = 9;
 
   cubperf::statset &wp_worker_statset_create (void);
   void wp_worker_statset_destroy (cubperf::statset &stats);
   void wp_worker_statset_time_and_increment (cubperf::statset &stats, cubperf::stat_id id);
+  void wp_worker_statset_time_and_increment (cubperf::statset &stats, cubperf::stat_id id, cubperf::duration d);
   void wp_worker_statset_accumulate (const cubperf::statset &what, cubperf::stat_value *where);
   std::size_t wp_worker_statset_get_count (void);
   const char *wp_worker_statset_get_name (std::size_t stat_index);
@@ -536,7 +576,8 @@ namespace cubthread
   template <typename Context>
   worker_pool<Context>::worker_pool (std::size_t pool_size, std::size_t task_max_count,
 				     context_manager_type &context_mgr, const char *name, std::size_t core_count,
-				     bool debug_log, bool pool_threads, wait_seconds wait_for_task_time)
+				     bool debug_log, bool pool_threads, wait_seconds wait_for_task_time,
+				     bool work_stealing)
     : m_max_workers (pool_size)
     , m_task_max_count (task_max_count)
     , m_task_count (0)
@@ -548,6 +589,7 @@ namespace cubthread
     , m_log (debug_log)
     , m_pool_threads (pool_threads)
     , m_wait_for_task_time (wait_for_task_time)
+    , m_work_stealing (work_stealing)
     , m_name (name == NULL ? "" : name)
   {
     // initialize cores; we'll try to distribute pool evenly to all cores. if core count is not fully contained in
@@ -825,6 +867,42 @@ namespace cubthread
     return index;
   }
 
+  template <typename Context>
+  bool
+  worker_pool<Context>::try_assign_on_other_core (const core &from_core, task_type *task_p,
+      cubperf::time_point push_time)
+  {
+    std::size_t from_index = &from_core - m_core_array;
+
+    // start with the next core, so neighbours do not all probe the same core first
+    for (std::size_t it = 1; it < m_core_count; it++)
+      {
+	if (m_core_array[(from_index + it) % m_core_count].try_assign_task (task_p, push_time))
+	  {
+	    return true;
+	  }
+      }
+    return false;
+  }
+
+  template <typename Context>
+  typename worker_pool<Context>::task_type *
+  worker_pool<Context>::try_steal_from_other_core (const core &thief_core, cubperf::time_point &push_time_out)
+  {
+    std::size_t thief_index = &thief_core - m_core_array;
+    task_type *task_p;
+
+    for (std::size_t it = 1; it < m_core_count; it++)
+      {
+	task_p = m_core_array[(thief_index + it) % m_core_count].try_steal_task (push_time_out);
+	if (task_p != NULL)
+	  {
+	    return task_p;
+	  }
+      }
+    return NULL;
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // worker_pool::core
   //////////////////////////////////////////////////////////////////////////
@@ -913,6 +991,25 @@ namespace cubthread
 	return;
       }
 
+    if (m_available_count == 0 && m_parent_pool->m_work_stealing)
+      {
+	// try an idle worker of another core before queueing the task
+	ulock.unlock ();
+	if (m_parent_pool->try_assign_on_other_core (*this, task_p, push_time))
+	  {
+	    return;
+	  }
+
+	// workers may have become available meanwhile; check again
+	ulock.lock ();
+	if (m_parent_pool->m_stopped)
+	  {
+	    // reject task
+	    task_p->retire ();
+	    return;
+	  }
+      }
+
     if (m_available_count > 0)
       {
 	refp = m_available_workers[--m_available_count];
@@ -924,19 +1021,77 @@ namespace cubthread
     else
       {
 	// save to queue
-	m_task_queue.push (task_p);
+	m_task_queue.push ({ task_p, push_time });
+      }
+  }
+
+  template <typename Context>
+  bool
+  worker_pool<Context>::core::try_assign_task (task_type *task_p, cubperf::time_point push_time)
+  {
+    std::unique_lock<std::mutex> ulock (m_workers_mutex, std::try_to_lock);
+
+    if (!ulock.owns_lock () || m_available_count == 0 || m_parent_pool->m_stopped)
+      {
+	return false;
+      }
+
+    worker *refp = m_available_workers[--m_available_count];
+    ulock.unlock ();
+
+    assert (refp != NULL);
+    refp->assign_task (task_p, push_time);
+    return true;
+  }
+
+  template <typename Context>
+  typename worker_pool<Context>::core::task_type *
+  worker_pool<Context>::core::try_steal_task (cubperf::time_point &push_time_out)
+  {
+    std::unique_lock<std::mutex> ulock (m_workers_mutex, std::try_to_lock);
+
+    if (!ulock.owns_lock () || m_task_queue.empty ())
+      {
+	return NULL;
       }
+
+    // take the oldest task; it waited the longest
+    task_type *task_p = m_task_queue.front ().m_task_p;
+    push_time_out = m_task_queue.front ().m_push_time;
+    assert (task_p != NULL);
+    m_task_queue.pop ();
+    return task_p;
   }
 
   template <typename Context>
   typename worker_pool<Context>::core::task_type *
-  worker_pool<Context>::core::get_task_or_become_available (worker &worker_arg)
+  worker_pool<Context>::core::get_task_or_become_available (worker &worker_arg, cubperf::time_point &push_time_out,
+      bool &is_stolen_out)
   {
     std::unique_lock<std::mutex> ulock (m_workers_mutex);
+    task_type *task_p;
+
+    is_stolen_out = false;
+
+    if (m_task_queue.empty () && m_parent_pool->m_work_stealing)
+      {
+	// own queue is empty; look for tasks waiting on other cores
+	ulock.unlock ();
+	task_p = m_parent_pool->try_steal_from_other_core (*this, push_time_out);
+	if (task_p != NULL)
+	  {
+	    is_stolen_out = true;
+	    return task_p;
+	  }
+
+	// tasks may have been queued meanwhile; check again
+	ulock.lock ();
+      }
 
     if (!m_task_queue.empty ())
       {
-	task_type *task_p = m_task_queue.front ();
+	task_p = m_task_queue.front ().m_task_p;
+	push_time_out = m_task_queue.front ().m_push_time;
 	assert (task_p != NULL);
 	m_task_queue.pop ();
 	return task_p;
@@ -1092,7 +1247,7 @@ namespace cubthread
 
     while (!m_task_queue.empty ())
       {
-	m_task_queue.front ()->retire ();
+	m_task_queue.front ().m_task_p->retire ();
 	m_task_queue.pop ();
       }
   }
@@ -1325,10 +1480,13 @@ namespace cubthread
 	// note: returned task cannot be saved directly to m_task_p. if worker is added to wait queue and NULL is returned,
 	//       current thread may be preempted. worker is then claimed from free active list and worker is assigned
 	//       a task. this changes expected behavior and can have unwanted consequences.
-	task_type *task_p = m_parent_core->get_task_or_become_available (*this);
+	cubperf::time_point push_time;
+	bool is_stolen;
+	task_type *task_p = m_parent_core->get_task_or_become_available (*this, push_time, is_stolen);
 	if (task_p != NULL)
 	  {
-	    wp_worker_statset_time_and_increment (m_statistics, Wpstat_found_in_queue);
+	    wp_worker_statset_time_and_increment (m_statistics, is_stolen ? Wpstat_steal_task : Wpstat_found_in_queue);
+	    wp_worker_statset_time_and_increment (m_statistics, Wpstat_queue_wait, m_statistics.m_timept - push_time);
 
 	    // it is safe to set here
 	    m_task_p = task_p;
@@ -77,6 +77,7 @@
 #include "slotted_page.h"
 #include "thread_manager.hpp"
 #include "double_write_buffer.h"
+#include "external_sort.h"
 #include "xasl_cache.h"
 #include "log_volids.hpp"
 #include "vacuum.h"
@@ -2473,6 +2474,8 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 #if defined(SERVER_MODE)
   pgbuf_daemons_init ();
   dwb_daemons_init ();
+  sort_merge_workers_init ();
+  scan_parallel_heap_workers_init ();
 #endif /* SERVER_MODE */
 
   // after recovery we can boot vacuum
@@ -2782,6 +2785,8 @@ error:
 #if defined(SERVER_MODE)
   pgbuf_daemons_destroy ();
   dwb_daemons_destroy ();
+  sort_merge_workers_destroy ();
+  scan_parallel_heap_workers_destroy ();
 #endif
 
   log_final (thread_p);
@@ -2936,6 +2941,8 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
 
 #if defined(SERVER_MODE)
   pgbuf_daemons_destroy ();
+  sort_merge_workers_destroy ();
+  scan_parallel_heap_workers_destroy ();
 #endif
 
 #if defined (SA_MODE)
@@ -308,6 +308,26 @@ struct lk_res_block
   int count;			/* # of entries in lock res block */
 };
 
+/*
+ * Fast Path Object Lock Slot Structure
+ *
+ * Uncontended S/X instance locks are kept in per-transaction slots instead of the shared lock table. A slot is moved
+ * into a regular lock entry as soon as another request creates a lock resource for the same object.
+ */
+#define LK_FASTPATH_SLOTS 16	/* # of fast path slots per transaction */
+#define LK_FASTPATH_BUCKET_COUNT 16384	/* # of fast path conflict markers */
+
+typedef struct lk_fastpath_slot LK_FASTPATH_SLOT;
+struct lk_fastpath_slot
+{
+  OID oid;			/* instance identifier */
+  OID class_oid;		/* class identifier of the instance */
+  LK_ENTRY *class_entry;	/* class lock entry, to manage granules */
+  LOCK lock;			/* granted lock mode */
+  int count;			/* # of requests; 0 if the slot is free */
+  unsigned int bucket;		/* fast path bucket of oid */
+};
+
 /*
  * Transaction Lock Entry Structure
  */
@@ -336,10 +356,20 @@ struct lk_tran_lock
 
   /* locking on manual duration */
   bool is_instant_duration;
+
+  /* fast path instance locks; protected by hold_mutex */
+  LK_FASTPATH_SLOT fastpath_slots[LK_FASTPATH_SLOTS];
+  int fastpath_count;		/* # of used fast path slots */
 };
 /* Max size of transaction local pool of lock entries. */
 #define LOCK_TRAN_LOCAL_POOL_MAX_SIZE 10
 
+/* Fast path bucket word: the low half keeps the owner transaction index + 1 (0 if no transaction has fast path locks
+ * in the bucket), the high half counts the instance lock resources of the bucket in the lock table. */
+#define LK_FASTPATH_OWNER(word) ((int) ((word) & 0xFFFFFFFF))
+#define LK_FASTPATH_RES_COUNT(word) ((word) >> 32)
+#define LK_FASTPATH_RES_ONE ((UINT64) 1 << 32)
+
 /*
  * Lock Manager Global Data Structure
  */
@@ -375,6 +405,9 @@ struct lk_global_data
   bool verbose_mode;
   // *INDENT-OFF*
   std::atomic_int deadlock_and_timeout_detector;
+
+  /* fast path conflict markers per object hash bucket */
+  std::atomic<UINT64> fastpath_buckets[LK_FASTPATH_BUCKET_COUNT];
   // *INDENT-ON*
 #if defined(LK_DUMP)
   bool dump_level;
@@ -397,6 +430,7 @@ struct lk_global_data
     , no_victim_case_count (0)
     , verbose_mode (false)
     , deadlock_and_timeout_detector { 0 }
+    , fastpath_buckets {}
 #if defined(LK_DUMP)
     , dump_level (0)
 #endif
@@ -514,6 +548,16 @@ static int lock_internal_perform_lock_object (THREAD_ENTRY * thread_p, int tran_
 					      LK_ENTRY ** entry_addr_ptr, LK_ENTRY * class_entry);
 static void lock_internal_perform_unlock_object (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, bool release_flag,
 						 bool move_to_non2pl);
+static int lock_fastpath_lock_object (THREAD_ENTRY * thread_p, int tran_index, const OID * oid, const OID * class_oid,
+				      LOCK lock, LK_ENTRY * class_entry);
+static LK_FASTPATH_SLOT *lock_fastpath_find_slot (LK_TRAN_LOCK * tran_lock, const OID * oid);
+static void lock_fastpath_free_slot (LK_TRAN_LOCK * tran_lock, int tran_index, LK_FASTPATH_SLOT * slot);
+static int lock_fastpath_move_to_resource (THREAD_ENTRY * thread_p, int tran_index, LK_RES * res_ptr);
+static void lock_fastpath_transfer_object_lock (THREAD_ENTRY * thread_p, int tran_index, const OID * oid);
+static void lock_fastpath_transfer_tran_locks (THREAD_ENTRY * thread_p, int tran_index);
+static void lock_fastpath_unlock_inst_locks (int tran_index, const OID * class_oid, LOCK lock);
+static LOCK lock_fastpath_get_object_lock (int tran_index, const OID * oid);
+static bool lock_fastpath_is_compatible (int tran_index, const OID * oid, LOCK lock);
 static void lock_unlock_object_by_isolation (THREAD_ENTRY * thread_p, int tran_index, TRAN_ISOLATION isolation,
 					     const OID * class_oid, const OID * oid);
 static void lock_unlock_inst_locks_of_class_by_isolation (THREAD_ENTRY * thread_p, int tran_index,
@@ -1104,6 +1148,12 @@ lock_initialize_object_hash_table (void)
   /* initialize object hash table */
   lk_Gl.m_obj_hash_table.init (obj_lock_res_Ts, THREAD_TS_OBJ_LOCK_RES, obj_hash_size, block_size, block_count,
 			       lk_Obj_lock_res_desc);
+
+  /* the table is empty; no fast path locks either */
+  for (int i = 0; i < LK_FASTPATH_BUCKET_COUNT; i++)
+    {
+      lk_Gl.fastpath_buckets[i] = 0;
+    }
 }
 #endif /* SERVER_MODE */
 
@@ -1192,8 +1242,15 @@ lock_initialize_deadlock_detection (void)
 static int
 lock_remove_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr)
 {
+  bool is_instance;
+  unsigned int bucket;
+
   assert (res_ptr != NULL);
 
+  /* the key is no longer valid after the erase */
+  is_instance = (res_ptr->key.type == LOCK_RESOURCE_INSTANCE);
+  bucket = lock_get_hash_value (&res_ptr->key.oid, LK_FASTPATH_BUCKET_COUNT);
+
   if (!lk_Gl.m_obj_hash_table.erase_locked (thread_p, res_ptr->key, res_ptr))
     {
       /* this should not happen, as the hash entry is mutex protected and no clear operations are performed on the hash
@@ -1204,6 +1261,11 @@ lock_remove_resource (THREAD_ENTRY * thread_p, LK_RES * res_ptr)
     }
   else
     {
+      if (is_instance)
+	{
+	  /* instance resources are counted in their fast path bucket; see lock_fastpath_move_to_resource */
+	  lk_Gl.fastpath_buckets[bucket].fetch_sub (LK_FASTPATH_RES_ONE);
+	}
       return NO_ERROR;
     }
 }
@@ -3110,6 +3172,11 @@ lock_internal_hold_lock_object_instant (THREAD_ENTRY * thread_p, int tran_index,
   if (res_ptr == NULL)
     {
       /* the lockable object is NOT in the hash chain */
+      if (class_oid != NULL && !OID_IS_ROOTOID (class_oid) && !lock_fastpath_is_compatible (tran_index, oid, lock))
+	{
+	  /* another transaction holds an incompatible fast path lock */
+	  return LK_NOTGRANTED;
+	}
       /* the request can be granted */
       return LK_GRANTED;
     }
@@ -3236,6 +3303,7 @@ lock_internal_perform_lock_object (THREAD_ENTRY * thread_p, int tran_index, cons
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
   UINT64 lock_wait_time;
+  bool is_wait_timed;
 
 #if defined(ENABLE_SYSTEMTAP)
   const OID *class_oid_for_marker_p;
@@ -3351,16 +3419,29 @@ start:
   if (res_ptr->holder == NULL && res_ptr->waiter == NULL && res_ptr->non2pl == NULL)
     {
       /* the lockable object was NOT in the hash chain */
-      /* the lock request can be granted. */
 
       /* initialize the lock resource entry */
       lock_initialize_resource_as_allocated (res_ptr, NULL_LOCK);
 
+      /* a fast path lock on the object becomes a holder of the new resource */
+      if (res_ptr->key.type == LOCK_RESOURCE_INSTANCE
+	  && lock_fastpath_move_to_resource (thread_p, tran_index, res_ptr) != NO_ERROR)
+	{
+	  (void) lock_remove_resource (thread_p, res_ptr);
+	  ret_val = LK_NOTGRANTED_DUE_ERROR;
+	  goto end;
+	}
+    }
+
+  if (res_ptr->holder == NULL && res_ptr->waiter == NULL && res_ptr->non2pl == NULL)
+    {
+      /* the lock request can be granted. */
       entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list);
       if (entry_ptr == NULL)
 	{
 	  assert (is_res_mutex_locked);
-	  pthread_mutex_unlock (&res_ptr->res_mutex);
+	  /* remove the empty resource */
+	  (void) lock_remove_resource (thread_p, res_ptr);
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_ALLOC_RESOURCE, 1, "lock heap entry");
 	  ret_val = LK_NOTGRANTED_DUE_ERROR;
 	  goto end;
@@ -3817,7 +3898,9 @@ lock_tran_lk_entry:
 
 blocked:
 
-  if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
+  is_wait_timed = (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT)
+		   || perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM));
+  if (is_wait_timed)
     {
       tsc_getticks (&start_tick);
     }
@@ -3835,12 +3918,16 @@ blocked:
     }
   ret_val = lock_suspend (thread_p, entry_ptr, wait_msecs);
 
-  if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
+  if (is_wait_timed)
     {
       tsc_getticks (&end_tick);
       tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
       lock_wait_time = tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec;
-      perfmon_lk_waited_time_on_objects (thread_p, lock, lock_wait_time);
+      if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
+	{
+	  perfmon_lk_waited_time_on_objects (thread_p, lock, lock_wait_time);
+	}
+      perfmon_time_latency (PERF_LATENCY_LOCK_WAIT, lock_wait_time);
     }
 
   if (ret_val != LOCK_RESUMED)
@@ -3926,6 +4013,471 @@ end:
 }
 #endif /* SERVER_MODE */
 
+/*
+ *  Private Functions Group: fast path object locks
+ *
+ *   - lock_fastpath_lock_object()
+ *   - lock_fastpath_move_to_resource()
+ *   - lock_fastpath_transfer_object_lock()
+ *   - lock_fastpath_unlock_inst_locks()
+ *
+ * Uncontended S/X instance locks acquired under a class intention lock are kept in slots of the transaction lock
+ * table entry (protected by its hold_mutex, which only the transaction itself normally takes). Every object hash
+ * bucket has an atomic word that keeps the transaction owning fast path locks in the bucket and the number of
+ * instance lock resources of the bucket. A fast path lock is granted only if the bucket has no lock resources and no
+ * other owner; a new lock resource in the bucket moves the owner's lock on the same object into the resource before
+ * any other transaction can look at it.
+ */
+
+#if defined(SERVER_MODE)
+/*
+ * lock_fastpath_lock_object - Try to grant an instance lock without the lock table
+ *
+ * return: LK_GRANTED if the lock is kept in a fast path slot, LK_NOTGRANTED if the regular path must be used
+ *
+ *   tran_index(in):
+ *   oid(in): instance identifier
+ *   class_oid(in): class identifier of the instance
+ *   lock(in): requested lock mode
+ *   class_entry(in): class lock entry of the transaction
+ *
+ * Note: Fast path locks never wait. Conflicting requests, lock escalation and instant duration locks use the
+ *     regular path.
+ */
+static int
+lock_fastpath_lock_object (THREAD_ENTRY * thread_p, int tran_index, const OID * oid, const OID * class_oid, LOCK lock,
+			   LK_ENTRY * class_entry)
+{
+  LK_TRAN_LOCK *tran_lock;
+  LK_FASTPATH_SLOT *slot;
+  UINT64 word;
+  unsigned int bucket;
+  int i, rv;
+
+  if (!prm_get_bool_value (PRM_ID_LK_FAST_PATH) || class_entry == NULL || (lock != S_LOCK && lock != X_LOCK))
+    {
+      return LK_NOTGRANTED;
+    }
+  /* S lock under IS or IX class lock, X lock under IX class lock */
+  if (class_entry->granted_mode != IX_LOCK && (lock != S_LOCK || class_entry->granted_mode != IS_LOCK))
+    {
+      return LK_NOTGRANTED;
+    }
+
+  tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  if (tran_lock->is_instant_duration)
+    {
+      return LK_NOTGRANTED;
+    }
+
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+
+  slot = lock_fastpath_find_slot (tran_lock, oid);
+  if (slot != NULL)
+    {
+      /* No lock resource exists for the object and no other transaction has fast path locks in the bucket. Other
+       * holders could only have implicit locks through class locks, which are incompatible with ours. */
+      slot->lock = lock_Conv[lock][slot->lock];
+      assert (slot->lock == S_LOCK || slot->lock == X_LOCK);
+      slot->count++;
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+      perfmon_inc_stat (thread_p, PSTAT_LK_NUM_RE_REQUESTED_ON_OBJECTS);	/* monitoring */
+      return LK_GRANTED;
+    }
+
+  if (tran_lock->fastpath_count >= LK_FASTPATH_SLOTS || lock_check_escalate (thread_p, class_entry, tran_lock))
+    {
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+      return LK_NOTGRANTED;
+    }
+
+  /* own the bucket; the bucket must have no lock resources and no other owner */
+  bucket = lock_get_hash_value (oid, LK_FASTPATH_BUCKET_COUNT);
+  word = lk_Gl.fastpath_buckets[bucket].load ();
+  do
+    {
+      if (LK_FASTPATH_RES_COUNT (word) != 0
+	  || (LK_FASTPATH_OWNER (word) != 0 && LK_FASTPATH_OWNER (word) != tran_index + 1))
+	{
+	  pthread_mutex_unlock (&tran_lock->hold_mutex);
+	  return LK_NOTGRANTED;
+	}
+    }
+  while (!lk_Gl.fastpath_buckets[bucket].compare_exchange_weak (word, (UINT64) (tran_index + 1)));
+
+  for (i = 0; i < LK_FASTPATH_SLOTS; i++)
+    {
+      if (tran_lock->fastpath_slots[i].count == 0)
+	{
+	  break;
+	}
+    }
+  assert (i < LK_FASTPATH_SLOTS);
+
+  slot = &tran_lock->fastpath_slots[i];
+  COPY_OID (&slot->oid, oid);
+  COPY_OID (&slot->class_oid, class_oid);
+  slot->class_entry = class_entry;
+  slot->lock = lock;
+  slot->count = 1;
+  slot->bucket = bucket;
+  tran_lock->fastpath_count++;
+
+  /* to manage granules */
+  lock_increment_class_granules (class_entry);
+
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  /* Record number of acquired locks */
+  perfmon_inc_stat (thread_p, PSTAT_LK_NUM_ACQUIRED_ON_OBJECTS);
+
+  return LK_GRANTED;
+}
+
+/*
+ * lock_fastpath_find_slot - Find the fast path slot of a transaction for the given object
+ *
+ * return: slot or NULL
+ *
+ *   tran_lock(in): transaction lock entry; the caller holds its hold_mutex
+ *   oid(in):
+ */
+static LK_FASTPATH_SLOT *
+lock_fastpath_find_slot (LK_TRAN_LOCK * tran_lock, const OID * oid)
+{
+  int i, used;
+
+  for (i = 0, used = 0; i < LK_FASTPATH_SLOTS && used < tran_lock->fastpath_count; i++)
+    {
+      if (tran_lock->fastpath_slots[i].count == 0)
+	{
+	  continue;
+	}
+      if (OID_EQ (&tran_lock->fastpath_slots[i].oid, oid))
+	{
+	  return &tran_lock->fastpath_slots[i];
+	}
+      used++;
+    }
+
+  return NULL;
+}
+
+/*
+ * lock_fastpath_free_slot - Free a fast path slot and give up the ownership of its bucket if it was the last slot
+ *                           of the transaction in the bucket
+ *
+ * return: nothing
+ *
+ *   tran_lock(in): transaction lock entry; the caller holds its hold_mutex
+ *   tran_index(in):
+ *   slot(in):
+ */
+static void
+lock_fastpath_free_slot (LK_TRAN_LOCK * tran_lock, int tran_index, LK_FASTPATH_SLOT * slot)
+{
+  unsigned int bucket = slot->bucket;
+  UINT64 word;
+  int i;
+
+  assert (slot->count > 0 && tran_lock->fastpath_count > 0);
+
+  slot->count = 0;
+  slot->class_entry = NULL;
+  tran_lock->fastpath_count--;
+
+  for (i = 0; i < LK_FASTPATH_SLOTS; i++)
+    {
+      if (tran_lock->fastpath_slots[i].count > 0 && tran_lock->fastpath_slots[i].bucket == bucket)
+	{
+	  /* still owned */
+	  return;
+	}
+    }
+
+  /* clear the owner and keep the resource count */
+  word = lk_Gl.fastpath_buckets[bucket].load ();
+  while (LK_FASTPATH_OWNER (word) == tran_index + 1
+	 && !lk_Gl.fastpath_buckets[bucket].compare_exchange_weak (word, word & ~(LK_FASTPATH_RES_ONE - 1)))
+    {
+      ;
+    }
+}
+
+/*
+ * lock_fastpath_move_to_resource - Move the fast path lock on the object of a new lock resource into the resource
+ *
+ * return: error code
+ *
+ *   tran_index(in): transaction index of the requester
+ *   res_ptr(in): new and empty instance lock resource; the caller holds its res_mutex
+ *
+ * Note: The resource is counted in its bucket, which stops new fast path locks in the bucket. If the bucket has an
+ *     owner, its slot for the object, if any, becomes a granted lock entry of the owner. Granules of the class were
+ *     already counted when the fast path lock was granted.
+ *     Every resource counted here must be removed with lock_remove_resource.
+ */
+static int
+lock_fastpath_move_to_resource (THREAD_ENTRY * thread_p, int tran_index, LK_RES * res_ptr)
+{
+  LF_TRAN_ENTRY *t_entry = thread_get_tran_entry (thread_p, THREAD_TS_OBJ_LOCK_ENT);
+  LK_TRAN_LOCK *owner_lock;
+  LK_FASTPATH_SLOT *slot;
+  LK_ENTRY *entry_ptr;
+  UINT64 word;
+  int owner_tran_index;
+  int rv;
+
+  assert (res_ptr->key.type == LOCK_RESOURCE_INSTANCE);
+  assert (res_ptr->holder == NULL && res_ptr->waiter == NULL && res_ptr->non2pl == NULL);
+
+  word = lk_Gl.fastpath_buckets[lock_get_hash_value (&res_ptr->key.oid, LK_FASTPATH_BUCKET_COUNT)].fetch_add
+    (LK_FASTPATH_RES_ONE);
+  if (LK_FASTPATH_OWNER (word) == 0)
+    {
+      return NO_ERROR;
+    }
+
+  owner_tran_index = LK_FASTPATH_OWNER (word) - 1;
+  owner_lock = &lk_Gl.tran_lock_table[owner_tran_index];
+  rv = pthread_mutex_lock (&owner_lock->hold_mutex);
+
+  slot = lock_fastpath_find_slot (owner_lock, &res_ptr->key.oid);
+  if (slot == NULL)
+    {
+      pthread_mutex_unlock (&owner_lock->hold_mutex);
+      return NO_ERROR;
+    }
+
+  entry_ptr = lock_get_new_entry (tran_index, t_entry, &lk_Gl.obj_free_entry_list);
+  if (entry_ptr == NULL)
+    {
+      pthread_mutex_unlock (&owner_lock->hold_mutex);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_ALLOC_RESOURCE, 1, "lock heap entry");
+      return ER_LK_ALLOC_RESOURCE;
+    }
+
+  lock_initialize_entry_as_granted (entry_ptr, owner_tran_index, res_ptr, slot->lock);
+  entry_ptr->count = slot->count;
+  entry_ptr->class_entry = slot->class_entry;
+
+  /* add the lock entry into the holder list */
+  res_ptr->holder = entry_ptr;
+  res_ptr->total_holders_mode = slot->lock;
+
+  /* add the lock entry into the owner's hold list; its hold_mutex is already held */
+  if (owner_lock->inst_hold_list != NULL)
+    {
+      owner_lock->inst_hold_list->tran_prev = entry_ptr;
+    }
+  entry_ptr->tran_next = owner_lock->inst_hold_list;
+  owner_lock->inst_hold_list = entry_ptr;
+  owner_lock->inst_hold_count++;
+
+  lock_fastpath_free_slot (owner_lock, owner_tran_index, slot);
+
+  pthread_mutex_unlock (&owner_lock->hold_mutex);
+  return NO_ERROR;
+}
+
+/*
+ * lock_fastpath_transfer_object_lock - Move the fast path lock of a transaction on an object into the lock table
+ *
+ * return: nothing
+ *
+ *   tran_index(in):
+ *   oid(in):
+ *
+ * Note: Used before accessing the lock entry of the object. If the move fails, the lock is kept in the fast path.
+ */
+static void
+lock_fastpath_transfer_object_lock (THREAD_ENTRY * thread_p, int tran_index, const OID * oid)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_FASTPATH_SLOT *slot;
+  LK_RES_KEY search_key;
+  LK_RES *res_ptr;
+  OID class_oid;
+  int rv;
+
+  if (tran_lock->fastpath_count == 0)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+  slot = lock_fastpath_find_slot (tran_lock, oid);
+  if (slot == NULL)
+    {
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+      return;
+    }
+  COPY_OID (&class_oid, &slot->class_oid);
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  /* creating the resource moves the lock; if the resource already exists, it has been moved already */
+  search_key = lock_create_search_key ((OID *) oid, &class_oid);
+  (void) lk_Gl.m_obj_hash_table.find_or_insert (thread_p, search_key, res_ptr);
+  if (res_ptr == NULL)
+    {
+      assert (false);
+      return;
+    }
+
+  if (res_ptr->holder == NULL && res_ptr->waiter == NULL && res_ptr->non2pl == NULL)
+    {
+      lock_initialize_resource_as_allocated (res_ptr, NULL_LOCK);
+      if (lock_fastpath_move_to_resource (thread_p, LOG_FIND_THREAD_TRAN_INDEX (thread_p), res_ptr) != NO_ERROR
+	  || res_ptr->holder == NULL)
+	{
+	  (void) lock_remove_resource (thread_p, res_ptr);
+	  return;
+	}
+    }
+
+  pthread_mutex_unlock (&res_ptr->res_mutex);
+}
+
+/*
+ * lock_fastpath_transfer_tran_locks - Move all fast path locks of a transaction into the lock table
+ *
+ * return: nothing
+ *
+ *   tran_index(in):
+ */
+static void
+lock_fastpath_transfer_tran_locks (THREAD_ENTRY * thread_p, int tran_index)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  OID oid;
+  int i, rv;
+
+  for (i = 0; i < LK_FASTPATH_SLOTS && tran_lock->fastpath_count > 0; i++)
+    {
+      rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+      if (tran_lock->fastpath_slots[i].count == 0)
+	{
+	  pthread_mutex_unlock (&tran_lock->hold_mutex);
+	  continue;
+	}
+      COPY_OID (&oid, &tran_lock->fastpath_slots[i].oid);
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+      lock_fastpath_transfer_object_lock (thread_p, tran_index, &oid);
+    }
+}
+
+/*
+ * lock_fastpath_unlock_inst_locks - Release fast path instance locks of a transaction
+ *
+ * return: nothing
+ *
+ *   tran_index(in):
+ *   class_oid(in): release only locks on instances of this class; all classes if NULL
+ *   lock(in): release locks whose mode is lower than or equal to this mode; all locks if X_LOCK
+ */
+static void
+lock_fastpath_unlock_inst_locks (int tran_index, const OID * class_oid, LOCK lock)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_FASTPATH_SLOT *slot;
+  int i, rv;
+
+  if (tran_lock->fastpath_count == 0)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+  for (i = 0; i < LK_FASTPATH_SLOTS; i++)
+    {
+      slot = &tran_lock->fastpath_slots[i];
+      if (slot->count == 0)
+	{
+	  continue;
+	}
+      if (class_oid == NULL || OID_ISNULL (class_oid) || OID_EQ (&slot->class_oid, class_oid))
+	{
+	  if (slot->lock <= lock || lock == X_LOCK)
+	    {
+	      lock_decrement_class_granules (slot->class_entry);
+	      lock_fastpath_free_slot (tran_lock, tran_index, slot);
+	    }
+	}
+    }
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+}
+
+/*
+ * lock_fastpath_get_object_lock - Get the fast path lock mode of a transaction on an object
+ *
+ * return: lock mode; NULL_LOCK if the object has no fast path lock
+ *
+ *   tran_index(in):
+ *   oid(in):
+ */
+static LOCK
+lock_fastpath_get_object_lock (int tran_index, const OID * oid)
+{
+  LK_TRAN_LOCK *tran_lock = &lk_Gl.tran_lock_table[tran_index];
+  LK_FASTPATH_SLOT *slot;
+  LOCK lock_mode = NULL_LOCK;
+  int rv;
+
+  if (tran_lock->fastpath_count == 0)
+    {
+      return NULL_LOCK;
+    }
+
+  rv = pthread_mutex_lock (&tran_lock->hold_mutex);
+  slot = lock_fastpath_find_slot (tran_lock, oid);
+  if (slot != NULL)
+    {
+      lock_mode = slot->lock;
+    }
+  pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+  return lock_mode;
+}
+
+/*
+ * lock_fastpath_is_compatible - Check a lock request against the fast path lock of another transaction
+ *
+ * return: false if another transaction holds an incompatible fast path lock on the object
+ *
+ *   tran_index(in): transaction index of the requester
+ *   oid(in):
+ *   lock(in):
+ */
+static bool
+lock_fastpath_is_compatible (int tran_index, const OID * oid, LOCK lock)
+{
+  LK_TRAN_LOCK *owner_lock;
+  LK_FASTPATH_SLOT *slot;
+  UINT64 word;
+  bool is_compatible = true;
+  int rv;
+
+  word = lk_Gl.fastpath_buckets[lock_get_hash_value (oid, LK_FASTPATH_BUCKET_COUNT)].load ();
+  if (LK_FASTPATH_OWNER (word) == 0 || LK_FASTPATH_OWNER (word) == tran_index + 1)
+    {
+      return true;
+    }
+
+  owner_lock = &lk_Gl.tran_lock_table[LK_FASTPATH_OWNER (word) - 1];
+  rv = pthread_mutex_lock (&owner_lock->hold_mutex);
+  slot = lock_fastpath_find_slot (owner_lock, oid);
+  if (slot != NULL && lock_Comp[lock][slot->lock] != LOCK_COMPAT_YES)
+    {
+      is_compatible = false;
+    }
+  pthread_mutex_unlock (&owner_lock->hold_mutex);
+
+  return is_compatible;
+}
+#endif /* SERVER_MODE */
+
 #if defined(SERVER_MODE)
 /*
  * lock_internal_perform_unlock_object - Performs actual object unlock operation
@@ -4488,6 +5040,9 @@ lock_remove_all_inst_locks (THREAD_ENTRY * thread_p, int tran_index, const OID *
 
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
 
+  /* fast path locks are released with the same condition */
+  lock_fastpath_unlock_inst_locks (tran_index, class_oid, lock);
+
   /* remove instance locks if given condition is satisfied */
   curr = tran_lock->inst_hold_list;
   while (curr != NULL)
@@ -6073,6 +6628,13 @@ lock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LO
 	}
       /* acquire a lock on the given instance oid */
 
+      /* try the fast path first; it grants uncontended S/X locks without the lock table */
+      granted = lock_fastpath_lock_object (thread_p, tran_index, oid, class_oid, lock, class_entry);
+      if (granted == LK_GRANTED)
+	{
+	  goto end;
+	}
+
       /* NOTE that in case of acquiring a lock on an instance object, the class oid of the instance object must be
        * given. */
       granted = lock_internal_perform_lock_object (thread_p, tran_index, oid, class_oid, lock, wait_msecs, &inst_entry,
@@ -6850,6 +7412,9 @@ lock_unlock_all (THREAD_ENTRY * thread_p)
   tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   tran_lock = &lk_Gl.tran_lock_table[tran_index];
 
+  /* remove all fast path instance locks */
+  lock_fastpath_unlock_inst_locks (tran_index, NULL, X_LOCK);
+
   /* remove all instance locks */
   entry_ptr = tran_lock->inst_hold_list;
   while (entry_ptr != NULL)
@@ -6917,6 +7482,9 @@ lock_find_tran_hold_entry (THREAD_ENTRY * thread_p, int tran_index, const OID *
       return lock_find_class_entry (tran_index, oid);
     }
 
+  /* the caller needs the lock entry; a fast path lock must be moved into the lock table */
+  lock_fastpath_transfer_object_lock (thread_p, tran_index, oid);
+
   /* search hash */
   search_key = lock_create_search_key ((OID *) oid, NULL);
   if (search_key.type != LOCK_RESOURCE_ROOT_CLASS)
@@ -6963,6 +7531,7 @@ lock_get_object_lock (const OID * oid, const OID * class_oid)
   return X_LOCK;
 #else /* !SERVER_MODE */
   LOCK lock_mode = NULL_LOCK;	/* return value */
+  LOCK fastpath_lock;
   LK_TRAN_LOCK *tran_lock;
   LK_ENTRY *entry_ptr;
   THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
@@ -7047,6 +7616,12 @@ lock_get_object_lock (const OID * oid, const OID * class_oid)
 	  lock_mode = NULL_LOCK;
 	}
 
+      fastpath_lock = lock_fastpath_get_object_lock (tran_index, oid);
+      if (fastpath_lock != NULL_LOCK)
+	{
+	  return fastpath_lock;
+	}
+
       entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, oid, false);
       if (entry_ptr != NULL)
 	{
@@ -7159,6 +7734,11 @@ lock_has_lock_on_object (const OID * oid, const OID * class_oid, LOCK lock)
    * case 3: object lock
    */
   /* get the granted lock mode acquired on the given instance/pseudo oid */
+  if (lock_fastpath_get_object_lock (tran_index, oid) != NULL_LOCK)
+    {
+      return 1;
+    }
+
   entry_ptr = lock_find_tran_hold_entry (thread_p, tran_index, oid, false);
   if (entry_ptr != NULL)
     {
@@ -8315,6 +8895,9 @@ lock_unlock_all_shared_get_all_exclusive (THREAD_ENTRY * thread_p, LK_ACQUIRED_L
   /************************************/
   if (acqlocks != NULL)
     {
+      /* the exclusive fast path locks are collected from the hold lists */
+      lock_fastpath_transfer_tran_locks (thread_p, tran_index);
+
       /* get a pointer to transaction lock info entry */
       tran_lock = &lk_Gl.tran_lock_table[tran_index];
 
@@ -8502,6 +9085,12 @@ xlock_dump (THREAD_ENTRY * thread_p, FILE * outfp)
       fprintf (outfp, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOCK, MSGCAT_LK_NEWLINE));
     }
 
+  /* move fast path locks into the lock table, so that they are dumped */
+  for (tran_index = 0; tran_index < lk_Gl.num_trans; tran_index++)
+    {
+      lock_fastpath_transfer_tran_locks (thread_p, tran_index);
+    }
+
   /* compute number of lock res entries */
   num_locked = (int) lk_Gl.m_obj_hash_table.get_element_count ();
 
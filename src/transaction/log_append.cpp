@@ -33,6 +33,11 @@
 
 static bool log_Zip_support = false;
 static int log_Zip_min_size_to_compress = 255;
+static LOG_ZIP_METHOD log_Zip_method = LOG_ZIP_METHOD_LZO1X_1;
+/* compress redo data of undoredo records using undo data as dictionary */
+static bool log_Zip_dictionary = false;
+/* dictionary compression pays off on much smaller records */
+#define LOG_ZIP_DICT_MIN_SIZE_TO_COMPRESS 64
 #if !defined(SERVER_MODE)
 static LOG_ZIP *log_zip_undo = NULL;
 static LOG_ZIP *log_zip_redo = NULL;
@@ -72,6 +77,7 @@ static void prior_lsa_append_data (int length);
 static LOG_LSA prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes,
     int with_lock);
 static void prior_update_header_mvcc_info (const LOG_LSA &record_lsa, MVCCID mvccid);
+static LOG_ZIP *log_append_alloc_zip ();
 static LOG_ZIP *log_append_get_zip_undo (THREAD_ENTRY *thread_p);
 static LOG_ZIP *log_append_get_zip_redo (THREAD_ENTRY *thread_p);
 static char *log_append_get_data_ptr (THREAD_ENTRY *thread_p);
@@ -196,11 +202,14 @@ log_append_init_zip ()
       return;
     }
 
+  log_Zip_method = (LOG_ZIP_METHOD) prm_get_integer_value (PRM_ID_LOG_COMPRESS_METHOD);
+  log_Zip_dictionary = prm_get_bool_value (PRM_ID_LOG_COMPRESS_DICTIONARY);
+
 #if defined(SERVER_MODE)
   log_Zip_support = true;
 #else
-  log_zip_undo = log_zip_alloc (IO_PAGESIZE, true);
-  log_zip_redo = log_zip_alloc (IO_PAGESIZE, true);
+  log_zip_undo = log_append_alloc_zip ();
+  log_zip_redo = log_append_alloc_zip ();
   log_data_length = IO_PAGESIZE * 2;
   log_data_ptr = (char *) malloc (log_data_length);
   if (log_data_ptr == NULL)
@@ -674,6 +683,7 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
   bool has_redo = false;
   bool is_undo_zip = false, is_redo_zip = false, is_diff = false;
   bool can_zip = false;
+  int zip_min_size = log_Zip_min_size_to_compress;
 
   assert (node->log_header.type != LOG_DIFF_UNDOREDO_DATA && node->log_header.type != LOG_MVCC_DIFF_UNDOREDO_DATA);
   assert (num_ucrumbs == 0 || ucrumbs != NULL);
@@ -702,6 +712,10 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
       has_undo = true;
       has_redo = true;
       can_zip = log_Zip_support && (zip_undo != NULL || ulength == 0) && (zip_redo != NULL || rlength == 0);
+      if (log_Zip_dictionary && ulength > 0 && rlength > 0)
+	{
+	  zip_min_size = LOG_ZIP_DICT_MIN_SIZE_TO_COMPRESS;
+	}
     }
   else if (LOG_IS_REDO_RECORD_TYPE (node->log_header.type))
     {
@@ -716,7 +730,7 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
       can_zip = log_Zip_support && zip_undo;
     }
 
-  if (can_zip == true && (ulength >= log_Zip_min_size_to_compress || rlength >= log_Zip_min_size_to_compress))
+  if (can_zip == true && (ulength >= zip_min_size || rlength >= zip_min_size))
     {
       /* Try to zip undo and/or redo data */
       total_length = 0;
@@ -738,7 +752,7 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
 	{
 	  tmp_ptr = data_ptr;
 
-	  if (ulength >= log_Zip_min_size_to_compress)
+	  if (ulength >= zip_min_size)
 	    {
 	      assert (has_undo == true);
 
@@ -753,7 +767,7 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
 	      assert (CAST_BUFLEN (tmp_ptr - undo_data) == ulength);
 	    }
 
-	  if (rlength >= log_Zip_min_size_to_compress)
+	  if (rlength >= zip_min_size)
 	    {
 	      assert (has_redo == true);
 
@@ -769,14 +783,21 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
 	    }
 
 	  assert (CAST_BUFLEN (tmp_ptr - data_ptr) == total_length
-		  || ulength < log_Zip_min_size_to_compress || rlength < log_Zip_min_size_to_compress);
+		  || ulength < zip_min_size || rlength < zip_min_size);
 
-	  if (ulength >= log_Zip_min_size_to_compress && rlength >= log_Zip_min_size_to_compress)
+	  if (ulength >= zip_min_size && rlength >= zip_min_size)
 	    {
-	      (void) log_diff (ulength, undo_data, rlength, redo_data);
-
+	      if (log_Zip_dictionary)
+		{
+		  /* undo data is the best dictionary for its redo data; redo is restored using the unzipped undo. */
+		  is_redo_zip = log_zip_with_dict (zip_redo, rlength, redo_data, ulength, undo_data);
+		}
+	      if (!is_redo_zip)
+		{
+		  (void) log_diff (ulength, undo_data, rlength, redo_data);
+		  is_redo_zip = log_zip (zip_redo, rlength, redo_data);
+		}
 	      is_undo_zip = log_zip (zip_undo, ulength, undo_data);
-	      is_redo_zip = log_zip (zip_redo, rlength, redo_data);
 
 	      if (is_redo_zip)
 		{
@@ -785,11 +806,11 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
 	    }
 	  else
 	    {
-	      if (ulength >= log_Zip_min_size_to_compress)
+	      if (ulength >= zip_min_size)
 		{
 		  is_undo_zip = log_zip (zip_undo, ulength, undo_data);
 		}
-	      if (rlength >= log_Zip_min_size_to_compress)
+	      if (rlength >= zip_min_size)
 		{
 		  is_redo_zip = log_zip (zip_redo, rlength, redo_data);
 		}
@@ -1685,6 +1706,24 @@ prior_lsa_append_data (int length)
   log_prior_lsa_append_align ();
 }
 
+/*
+ * log_append_alloc_zip - allocate LOG_ZIP for compression using configured method
+ *
+ * return: LOG_ZIP or NULL
+ */
+static LOG_ZIP *
+log_append_alloc_zip ()
+{
+  LOG_ZIP *log_zip = log_zip_alloc (IO_PAGESIZE, true);
+
+  if (log_zip != NULL && !log_zip_set_method (log_zip, log_Zip_method))
+    {
+      /* keep the default method */
+      er_clear ();
+    }
+  return log_zip;
+}
+
 static LOG_ZIP *
 log_append_get_zip_undo (THREAD_ENTRY *thread_p)
 {
@@ -1702,7 +1741,7 @@ log_append_get_zip_undo (THREAD_ENTRY *thread_p)
     {
       if (thread_p->log_zip_undo == NULL)
 	{
-	  thread_p->log_zip_undo = log_zip_alloc (IO_PAGESIZE, true);
+	  thread_p->log_zip_undo = log_append_alloc_zip ();
 	}
       return (LOG_ZIP *) thread_p->log_zip_undo;
     }
@@ -1728,7 +1767,7 @@ log_append_get_zip_redo (THREAD_ENTRY *thread_p)
     {
       if (thread_p->log_zip_redo == NULL)
 	{
-	  thread_p->log_zip_redo = log_zip_alloc (IO_PAGESIZE, true);
+	  thread_p->log_zip_redo = log_append_alloc_zip ();
 	}
       return (LOG_ZIP *) thread_p->log_zip_redo;
     }
@@ -31,6 +31,7 @@
 #include <fcntl.h>
 #if !defined (WINDOWS)
 #include <sys/time.h>
+#include <poll.h>
 #endif
 #include <signal.h>
 
@@ -58,6 +59,7 @@
 #include "memory_hash.h"
 #include "schema_manager.h"
 #include "log_applier_sql_log.h"
+#include "log_applier_dispatch.h"
 #include "util_func.h"
 #include "dbtype.h"
 #if !defined(WINDOWS)
@@ -103,6 +105,12 @@
 
 #define LA_NUM_REPL_FILTER			50
 
+#define LA_APPLY_STATS_INTERVAL                 60	/* seconds */
+
+#define LA_WORKER_MAX_BATCH_TRANS               100
+#define LA_WORKER_DEFAULT_REQUEST_SIZE          (64 * ONE_K)
+#define LA_WORKER_POLL_TIMEOUT                  1000	/* msecs */
+
 #define LA_LOG_IS_IN_ARCHIVE(pageid) \
   ((pageid) < la_Info.act_log.log_hdr->nxarv_pageid)
 
@@ -331,6 +339,12 @@ struct la_info
 
   int num_unflushed;
 
+  /* apply statistics of the current interval */
+  time_t stats_start_time;
+  int stats_start_total_rows;
+  unsigned long stats_start_commit_counter;
+  unsigned long stats_flush_counter;	/* # of bulk flushes to the server */
+
   /* file lock */
   int log_path_lockf_vdes;
   int db_lockf_vdes;
@@ -401,9 +415,73 @@ struct la_ha_apply_info
   DB_DATETIME start_time;
 };
 
+/* a transaction sent to an apply worker; it is kept until the checkpoint passes it */
+/* request to an apply worker; followed by num_objects LA_WORKER_OBJECTs */
+typedef struct la_worker_request LA_WORKER_REQUEST;
+struct la_worker_request
+{
+  INT64 seq;
+  int num_objects;
+  int length;			/* total length including this header */
+};
+
+/* followed by the packed key and the record data, each aligned */
+typedef struct la_worker_object LA_WORKER_OBJECT;
+struct la_worker_object
+{
+  OID class_oid;
+  int operation;
+  bool has_index;
+  bool has_recdes;
+  int packed_key_value_length;
+  RECDES recdes;		/* data is set by the worker */
+};
+
+/* cumulative since the start of the worker */
+typedef struct la_worker_reply LA_WORKER_REPLY;
+struct la_worker_reply
+{
+  INT64 committed_seq;		/* the requests up to this one are committed */
+  unsigned long insert_failed;
+  unsigned long update_failed;
+  unsigned long delete_failed;
+  unsigned long fail_counter;
+};
+
+typedef struct la_apply_worker LA_APPLY_WORKER;
+struct la_apply_worker
+{
+  pid_t pid;
+  int request_fd;
+  int reply_fd;
+  LA_WORKER_REPLY last_reply;
+};
+
+typedef struct la_apply_workers LA_APPLY_WORKERS;
+struct la_apply_workers
+{
+  LA_APPLY_WORKER *workers;
+  int count;
+  pid_t applier_pid;
+  LA_DISPATCH dispatch;
+
+  int *tran_slots;		/* slots of the transaction being dispatched */
+  int num_tran_slots;
+  int tran_slots_size;
+
+  /* the request being built */
+  bool is_dispatching;
+  char *request;
+  int request_size;
+  LA_DISPATCHED_TRAN dispatched;
+  bool need_commit;		/* the applier applied a transaction by itself */
+};
+
 /* Global variable for LA */
 LA_INFO la_Info;
 
+LA_APPLY_WORKERS la_Workers;
+
 LA_RECDES_POOL la_recdes_pool;
 
 static bool la_applier_need_shutdown = false;
@@ -488,8 +566,9 @@ static int la_get_current (OR_BUF * buf, SM_CLASS * sm_class, int bound_bit_flag
 			   int offset_size);
 static void la_make_room_for_mvcc_insid (RECDES * recdes);
 static int la_disk_to_obj (MOBJ classobj, RECDES * record, DB_OTMPL * def, DB_VALUE * key);
-static char *la_get_zipped_data (char *undo_data, int undo_length, bool is_diff, bool is_undo_zip, bool is_overflow,
-				 char **rec_type, char **data, int *length);
+static bool la_unzip_redo_data (int zip_len, char *data, bool is_diff, bool is_undo_zip, char *undo_data,
+				int undo_length);
+static char *la_get_zipped_data (bool is_overflow, char **rec_type, char **data, int *length);
 static int la_get_undoredo_diff (LOG_PAGE ** pgptr, LOG_PAGEID * pageid, PGLENGTH * offset, bool * is_undo_zip,
 				 char **undo_data, int *undo_length);
 static int la_get_log_data (LOG_RECORD_HEADER * lrec, LOG_LSA * lsa, LOG_PAGE * pgptr, unsigned int match_rcvindex,
@@ -516,6 +595,7 @@ static int la_log_commit (bool update_commit_time);
 static unsigned long la_get_mem_size (void);
 static int la_check_mem_size (void);
 static int la_check_time_commit (struct timeval *time, unsigned int threshold);
+static void la_log_apply_stats (void);
 
 static void la_init (const char *log_path, const int max_mem_size);
 
@@ -546,6 +626,34 @@ static void la_get_adaptive_time_commit_interval (int *time_commit_interval, int
 static int la_flush_repl_items (bool immediate);
 
 static bool la_need_filter_out (LA_ITEM * item);
+
+static int la_read_apply_worker_pipe (int fd, void *buf, int length);
+static int la_write_apply_worker_pipe (int fd, const void *buf, int length);
+static bool la_has_apply_worker_request (int fd);
+static void la_connect_apply_worker (const char *program_name, const char *database_name);
+static int la_read_apply_worker_request (int fd, char **request);
+static int la_add_apply_worker_objects (char *request, unsigned long *num_applied);
+static int la_apply_worker_requests (char **requests, int num_requests, unsigned long *num_failed,
+				     const char *program_name, const char *database_name);
+static void la_apply_worker_batch (char **requests, int num_requests, LA_WORKER_REPLY * reply,
+				   const char *program_name, const char *database_name);
+static void la_apply_worker_main (const char *program_name, const char *database_name, int request_fd,
+				  int reply_fd);
+static int la_apply_worker_failed (int worker);
+static void la_init_worker_request (void);
+static void la_clear_dispatched_tran (void);
+static int la_add_object_to_worker_request (OID * class_oid, LA_ITEM * item, RECDES * recdes, int operation,
+					    bool has_index);
+static int la_read_apply_worker_replies (int worker);
+static int la_receive_apply_worker_replies (bool wait);
+static int la_send_worker_request (int worker);
+static void la_advance_apply_checkpoint (void);
+static int la_get_repl_item_slot (LA_ITEM * item, const char **class_name, LA_DISPATCH_ORDER * class_order);
+static int la_choose_apply_worker (LA_APPLY * apply, LOG_LSA * commit_lsa, int *worker, bool * need_barrier);
+static int la_wait_apply_workers (void);
+static int la_add_dispatched_tran (LOG_LSA * commit_lsa, time_t log_record_time);
+static void la_drain_apply_workers (void);
+static void la_reset_apply_workers (void);
 static int la_create_repl_filter (void);
 static void la_destroy_repl_filter (void);
 static void la_print_repl_filter_info (void);
@@ -1425,6 +1533,7 @@ la_find_required_lsa (LOG_LSA * required_lsa)
   int error = NO_ERROR;
   int i;
   LOG_LSA lowest_lsa;
+  LA_DISPATCHED_TRAN *tran;
 
   LSA_SET_NULL (&lowest_lsa);
 
@@ -1440,6 +1549,20 @@ la_find_required_lsa (LOG_LSA * required_lsa)
 	}
     }
 
+  /* transactions not yet committed by the apply workers are read again after a restart */
+  for (i = 0; i < la_Workers.dispatch.num_pending; i++)
+    {
+      tran = &la_Workers.dispatch.pending[(la_Workers.dispatch.pending_head + i) % LA_WORKER_MAX_PENDING_TRANS];
+      if (LSA_ISNULL (&tran->start_lsa))
+	{
+	  continue;
+	}
+      if (LSA_ISNULL (&lowest_lsa) || LSA_GT (&lowest_lsa, &tran->start_lsa))
+	{
+	  LSA_COPY (&lowest_lsa, &tran->start_lsa);
+	}
+    }
+
   if (LSA_ISNULL (&lowest_lsa))
     {
       LSA_COPY (required_lsa, &la_Info.final_lsa);
@@ -3734,43 +3857,46 @@ la_disk_to_obj (MOBJ classobj, RECDES * record, DB_OTMPL * def, DB_VALUE * key)
 }
 
 /*
- * la_get_zipped_data () - get zipped data
- *   return: error code
+ * la_unzip_redo_data () - unzip redo data into la_Info.redo_unzip_ptr
+ *   return: true on success
+ *   zip_len(in): length of zipped redo data
+ *   data(in): zipped redo data
+ *   is_diff(in): true if redo data belongs to a diff undoredo record
+ *   is_undo_zip(in): true if undo data was unzipped into la_Info.undo_unzip_ptr
+ *   undo_data(in): undo data if not zipped
+ *   undo_length(in): length of undo data if not zipped
  */
-char *
-la_get_zipped_data (char *undo_data, int undo_length, bool is_diff, bool is_undo_zip, bool is_overflow, char **rec_type,
-		    char **data, int *length)
+static bool
+la_unzip_redo_data (int zip_len, char *data, bool is_diff, bool is_undo_zip, char *undo_data, int undo_length)
 {
-  int redo_length = 0;
-  int rec_len = 0;
-
-  LOG_ZIP *undo_unzip_data = NULL;
-  LOG_ZIP *redo_unzip_data = NULL;
-
-  undo_unzip_data = la_Info.undo_unzip_ptr;
-  redo_unzip_data = la_Info.redo_unzip_ptr;
+  LOG_ZIP *undo_unzip_data = la_Info.undo_unzip_ptr;
 
-  if (is_diff)
+  if (!is_diff)
     {
-      if (is_undo_zip)
-	{
-	  undo_length = undo_unzip_data->data_length;
-	  redo_length = redo_unzip_data->data_length;
-
-	  (void) log_diff (undo_length, undo_unzip_data->log_data, redo_length, redo_unzip_data->log_data);
-	}
-      else
-	{
-
-	  redo_length = redo_unzip_data->data_length;
-	  (void) log_diff (undo_length, undo_data, redo_length, redo_unzip_data->log_data);
-	}
+      return log_unzip (la_Info.redo_unzip_ptr, zip_len, data);
     }
-  else
+
+  if (is_undo_zip)
     {
-      redo_length = redo_unzip_data->data_length;
+      undo_length = undo_unzip_data->data_length;
+      undo_data = (char *) undo_unzip_data->log_data;
     }
 
+  return log_unzip_diff (la_Info.redo_unzip_ptr, zip_len, data, undo_length, undo_data);
+}
+
+/*
+ * la_get_zipped_data () - get unzipped redo data
+ *   return: redo data
+ */
+char *
+la_get_zipped_data (bool is_overflow, char **rec_type, char **data, int *length)
+{
+  int redo_length = 0;
+  int rec_len = 0;
+
+  redo_length = la_Info.redo_unzip_ptr->data_length;
+
   if (rec_type)
     {
       rec_len = DB_SIZEOF (INT16);
@@ -4144,7 +4270,7 @@ la_get_log_data (LOG_RECORD_HEADER * lrec, LOG_LSA * lsa, LOG_PAGE * pgptr, unsi
 
       if (zip_len != 0)
 	{
-	  if (!log_unzip (la_Info.redo_unzip_ptr, zip_len, *data))
+	  if (!la_unzip_redo_data (zip_len, *data, is_diff, is_undo_zip, undo_data, undo_length))
 	    {
 	      if (undo_data != NULL)
 		{
@@ -4155,7 +4281,7 @@ la_get_log_data (LOG_RECORD_HEADER * lrec, LOG_LSA * lsa, LOG_PAGE * pgptr, unsi
 	    }
 	}
 
-      *data = la_get_zipped_data (undo_data, undo_length, is_diff, is_undo_zip, is_overflow, rec_type, data, &length);
+      *data = la_get_zipped_data (is_overflow, rec_type, data, &length);
       if (*data == NULL)
 	{
 	  assert (er_errid () != NO_ERROR);
@@ -4353,7 +4479,6 @@ la_get_next_update_log (LOG_RECORD_HEADER * prev_lrec, LOG_PAGE * pgptr, void **
   bool is_mvcc_log = false;
 
   char *undo_data = NULL;
-  LOG_ZIP *redo_unzip_data = NULL;
 
   bool is_diff = false;
 
@@ -4361,8 +4486,6 @@ la_get_next_update_log (LOG_RECORD_HEADER * prev_lrec, LOG_PAGE * pgptr, void **
   LSA_COPY (&lsa, &prev_lrec->forw_lsa);
   prev_log = *(LOG_REC_UNDOREDO **) logs;
 
-  redo_unzip_data = la_Info.redo_unzip_ptr;
-
   while (true)
     {
       while (pg && pg->hdr.logical_pageid == lsa.pageid)
@@ -4440,7 +4563,7 @@ la_get_next_update_log (LOG_RECORD_HEADER * prev_lrec, LOG_PAGE * pgptr, void **
 
 			  if (zip_len != 0)
 			    {
-			      if (!log_unzip (redo_unzip_data, zip_len, *data))
+			      if (!la_unzip_redo_data (zip_len, *data, is_diff, is_undo_zip, undo_data, undo_length))
 				{
 				  if (undo_data != NULL)
 				    {
@@ -4451,9 +4574,7 @@ la_get_next_update_log (LOG_RECORD_HEADER * prev_lrec, LOG_PAGE * pgptr, void **
 				}
 			    }
 
-			  *data =
-			    la_get_zipped_data (undo_data, undo_length, is_diff, is_undo_zip, false, rec_type, data,
-						&length);
+			  *data = la_get_zipped_data (false, rec_type, data, &length);
 			  if (*data == NULL)
 			    {
 			      assert (er_errid () != NO_ERROR);
@@ -4661,9 +4782,17 @@ la_flush_repl_items (bool immediate)
       return NO_ERROR;
     }
 
+  if (la_Workers.is_dispatching)
+    {
+      /* the objects are copied into the request of the apply worker, which flushes them */
+      la_Info.num_unflushed = 0;
+      return NO_ERROR;
+    }
+
   if (la_Info.num_unflushed >= LA_MAX_UNFLUSHED_REPL_ITEMS || immediate == true)
     {
       error = locator_repl_flush_all ();
+      la_Info.stats_flush_counter++;
       if (error == ER_LC_PARTIALLY_FAILED_TO_FLUSH)
 	{
 	  while (true)
@@ -4830,6 +4959,11 @@ la_repl_add_object (MOP classop, LA_ITEM * item, RECDES * recdes)
 
   has_index = classobj_class_has_indexes (class_);
 
+  if (la_Workers.is_dispatching)
+    {
+      return la_add_object_to_worker_request (class_oid, item, recdes, operation, has_index);
+    }
+
   error = ws_add_to_repl_obj_list (class_oid, item->packed_key_value, item->packed_key_value_length, recdes,
 				   operation, has_index);
   return error;
@@ -5608,6 +5742,8 @@ la_apply_repl_log (int tranid, int rectype, LOG_LSA * commit_lsa, int *total_row
   static unsigned int total_repl_items = 0;
   bool release_pb = false;
   bool has_more_commit_items = false;
+  int worker = -1;
+  bool need_barrier = false;
 
   apply = la_find_apply_list (tranid);
   if (apply == NULL)
@@ -5640,6 +5776,26 @@ la_apply_repl_log (int tranid, int rectype, LOG_LSA * commit_lsa, int *total_row
 
   string_buffer sb;
 
+  if (la_Workers.count > 0)
+    {
+      error = la_choose_apply_worker (apply, commit_lsa, &worker, &need_barrier);
+      if (error == NO_ERROR && need_barrier)
+	{
+	  /* statements and long transactions are applied here after everything before them */
+	  error = la_wait_apply_workers ();
+	}
+      if (error != NO_ERROR)
+	{
+	  goto end;
+	}
+
+      if (worker >= 0)
+	{
+	  la_init_worker_request ();
+	  la_Workers.is_dispatching = true;
+	}
+    }
+
   item = apply->head;
   while (item)
     {
@@ -5695,7 +5851,14 @@ la_apply_repl_log (int tranid, int rectype, LOG_LSA * commit_lsa, int *total_row
 
 	  if (error == NO_ERROR)
 	    {
-	      LSA_COPY (&la_Info.committed_rep_lsa, &item->lsa);
+	      if (la_Workers.is_dispatching)
+		{
+		  LSA_COPY (&la_Workers.dispatched.rep_lsa, &item->lsa);
+		}
+	      else
+		{
+		  LSA_COPY (&la_Info.committed_rep_lsa, &item->lsa);
+		}
 	    }
 	  else
 	    {
@@ -5746,6 +5909,20 @@ la_apply_repl_log (int tranid, int rectype, LOG_LSA * commit_lsa, int *total_row
 end:
   *total_rows += apply_repl_log_cnt;
 
+  if (la_Workers.is_dispatching)
+    {
+      la_Workers.is_dispatching = false;
+      if (error != ER_NET_CANT_CONNECT_SERVER && ((LA_WORKER_REQUEST *) la_Workers.request)->num_objects > 0)
+	{
+	  LSA_COPY (&la_Workers.dispatched.start_lsa, &apply->start_lsa);
+	  error = la_send_worker_request (worker);
+	}
+    }
+  else if (la_Workers.count > 0 && apply_repl_log_cnt > 0)
+    {
+      la_Workers.need_commit = true;
+    }
+
   if (rectype == LOG_SYSOP_END)
     {
       if (has_more_commit_items)
@@ -5794,7 +5971,23 @@ la_apply_commit_list (LOG_LSA * lsa, LOG_PAGEID final_pageid)
 
       LSA_COPY (lsa, &commit->log_lsa);
 
-      if (commit->type == LOG_COMMIT)
+      if (la_Workers.count > 0)
+	{
+	  /* the checkpoint passes the transaction once the worker and all the ones before it commit */
+	  if (la_applier_need_shutdown == false && error != ER_NET_CANT_CONNECT_SERVER
+	      && error != ER_LC_PARTIALLY_FAILED_TO_FLUSH && error != ER_LC_FAILED_TO_FLUSH_REPL_ITEMS)
+	    {
+	      error = la_add_dispatched_tran (&commit->log_lsa,
+					      (commit->type == LOG_COMMIT) ? commit->log_record_time : 0);
+	      if (error == NO_ERROR && la_Workers.need_commit)
+		{
+		  /* release the rows before the workers change them */
+		  error = la_log_commit (false);
+		}
+	    }
+	  la_Workers.need_commit = false;
+	}
+      else if (commit->type == LOG_COMMIT)
 	{
 	  la_Info.log_record_time = commit->log_record_time;
 	}
@@ -6106,7 +6299,11 @@ la_log_record_process (LOG_RECORD_HEADER * lrec, LOG_LSA * final, LOG_PAGE * pg_
 
 	      if (!LSA_ISNULL (&lsa_apply))
 		{
-		  LSA_COPY (&(la_Info.committed_lsa), &lsa_apply);
+		  if (la_Workers.count == 0)
+		    {
+		      /* with apply workers it follows the replies, see la_advance_apply_checkpoint () */
+		      LSA_COPY (&(la_Info.committed_lsa), &lsa_apply);
+		    }
 
 		  if (lrec->type == LOG_COMMIT)
 		    {
@@ -6387,6 +6584,15 @@ la_log_commit (bool update_commit_time)
   int res;
   int error = NO_ERROR;
 
+  if (la_Workers.count > 0)
+    {
+      error = la_receive_apply_worker_replies (false);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
   (void) la_find_required_lsa (&la_Info.required_lsa);
 
   LSA_COPY (&la_Info.append_lsa, &la_Info.act_log.log_hdr->append_lsa);
@@ -6407,6 +6613,10 @@ la_log_commit (bool update_commit_time)
   if (res > 0)
     {
       error = la_commit_transaction ();
+      if (error == NO_ERROR)
+	{
+	  la_log_apply_stats ();
+	}
     }
   else
     {
@@ -6558,6 +6768,54 @@ la_commit_transaction (void)
   return error;
 }
 
+/*
+ * la_log_apply_stats () - log the replication delay and the apply throughput
+ *   return: none
+ *
+ * Note:
+ *    Called after each commit; logs at most once every LA_APPLY_STATS_INTERVAL seconds.
+ */
+static void
+la_log_apply_stats (void)
+{
+  char buffer[LINE_MAX];
+  time_t now;
+  int elapsed;
+  long delay = 0;
+
+  now = time (NULL);
+  if (la_Info.stats_start_time == 0 || now < la_Info.stats_start_time)
+    {
+      /* first commit or clock moved backward; start a new interval */
+      goto reset;
+    }
+
+  elapsed = (int) (now - la_Info.stats_start_time);
+  if (elapsed < LA_APPLY_STATS_INTERVAL)
+    {
+      return;
+    }
+
+  /* the time of the last applied commit tells the delay only while there are logs to apply */
+  if (la_Info.status == LA_STATUS_BUSY && la_Info.log_record_time != 0 && now > la_Info.log_record_time)
+    {
+      delay = (long) (now - la_Info.log_record_time);
+    }
+
+  snprintf (buffer, sizeof (buffer),
+	    "apply statistics of last %d second(s): delay %ld second(s), %.1f rows/sec, %.1f transactions/sec, "
+	    "%.1f flushes/sec", elapsed, delay, (double) (la_Info.total_rows - la_Info.stats_start_total_rows) / elapsed,
+	    (double) (la_Info.commit_counter - la_Info.stats_start_commit_counter) / elapsed,
+	    (double) la_Info.stats_flush_counter / elapsed);
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buffer);
+
+reset:
+  la_Info.stats_start_time = now;
+  la_Info.stats_start_total_rows = la_Info.total_rows;
+  la_Info.stats_start_commit_counter = la_Info.commit_counter;
+  la_Info.stats_flush_counter = 0;
+}
+
 static int
 la_check_time_commit (struct timeval *time_commit, unsigned int threshold)
 {
@@ -6587,6 +6845,16 @@ la_check_time_commit (struct timeval *time_commit, unsigned int threshold)
 	  return ER_NET_CANT_CONNECT_SERVER;
 	}
 
+      if (la_Workers.count > 0)
+	{
+	  /* the checkpoint may have been advanced by the apply workers */
+	  error = la_receive_apply_worker_replies (false);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	}
+
       /* check for # of rows to commit */
       if (la_Info.prev_total_rows != la_Info.total_rows)
 	{
@@ -6798,6 +7066,8 @@ la_shutdown (void)
 {
   int i;
 
+  la_drain_apply_workers ();
+
   /* clean up */
   if (la_Info.arv_log.log_vdes != NULL_VOLDES)
     {
@@ -7731,6 +8001,1069 @@ check_reinit_copylog (void)
   return error;
 }
 
+/*
+ * la_read_apply_worker_pipe() - read from a pipe between the applier and an apply worker
+ *   return: the number of bytes read, less than length at the end of file, -1 on error
+ *   fd(in): the pipe
+ *   buf(out): buffer
+ *   length(in): the number of bytes to read
+ */
+static int
+la_read_apply_worker_pipe (int fd, void *buf, int length)
+{
+  char *ptr = (char *) buf;
+  int remain = length;
+  ssize_t n;
+
+  while (remain > 0)
+    {
+      n = read (fd, ptr, remain);
+      if (n > 0)
+	{
+	  ptr += n;
+	  remain -= (int) n;
+	}
+      else if (n == 0)
+	{
+	  break;
+	}
+      else if (errno != EINTR)
+	{
+	  return -1;
+	}
+    }
+
+  return length - remain;
+}
+
+/*
+ * la_write_apply_worker_pipe() - write to a pipe between the applier and an apply worker
+ *   return: NO_ERROR or ER_FAILED
+ *   fd(in): the pipe
+ *   buf(in): buffer
+ *   length(in): the number of bytes to write
+ */
+static int
+la_write_apply_worker_pipe (int fd, const void *buf, int length)
+{
+  const char *ptr = (const char *) buf;
+  int remain = length;
+  ssize_t n;
+
+  while (remain > 0)
+    {
+      n = write (fd, ptr, remain);
+      if (n > 0)
+	{
+	  ptr += n;
+	  remain -= (int) n;
+	}
+      else if (n < 0 && errno != EINTR)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_has_apply_worker_request() - check whether a request or the end of file can be read without waiting
+ *   return: true or false
+ *   fd(in): the request pipe
+ */
+static bool
+la_has_apply_worker_request (int fd)
+{
+  struct pollfd pfd;
+
+  pfd.fd = fd;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+
+  return (poll (&pfd, 1, 0) > 0) ? true : false;
+}
+
+/*
+ * la_connect_apply_worker() - connect an apply worker to the server
+ *   return: none
+ *   program_name(in):
+ *   database_name(in):
+ *
+ * Note:
+ *    Retries until connected, like applylogdb does; exits when the applier is gone.
+ */
+static void
+la_connect_apply_worker (const char *program_name, const char *database_name)
+{
+  int sleep_nsecs = 1;
+
+  while (db_restart (program_name, TRUE, database_name) != NO_ERROR)
+    {
+      if (getppid () != la_Workers.applier_pid)
+	{
+	  _exit (EXIT_FAILURE);
+	}
+
+      (void) sleep (sleep_nsecs);
+      /* sleep 1, 2, 4, 8, etc; don't wait for more than 10 sec */
+      if ((sleep_nsecs *= 2) > 10)
+	{
+	  sleep_nsecs = 1;
+	}
+    }
+
+  /* as applylogdb, do not fire trigger actions and wait for locks */
+  db_disable_trigger ();
+  db_set_lock_timeout (-1);
+}
+
+/*
+ * la_read_apply_worker_request() - read the next request from the applier
+ *   return: NO_ERROR or error code
+ *   fd(in): the request pipe
+ *   request(out): the request, NULL if the applier has exited
+ */
+static int
+la_read_apply_worker_request (int fd, char **request)
+{
+  LA_WORKER_REQUEST header;
+  int length;
+
+  *request = NULL;
+
+  length = la_read_apply_worker_pipe (fd, &header, sizeof (header));
+  if (length == 0)
+    {
+      return NO_ERROR;
+    }
+  if (length != (int) sizeof (header) || header.length < (int) sizeof (header))
+    {
+      return ER_FAILED;
+    }
+
+  *request = (char *) malloc (header.length);
+  if (*request == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) header.length);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memcpy (*request, &header, sizeof (header));
+
+  length = header.length - (int) sizeof (header);
+  if (la_read_apply_worker_pipe (fd, *request + sizeof (header), length) != length)
+    {
+      free_and_init (*request);
+      return ER_FAILED;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_add_apply_worker_objects() - add the objects of a request to the link for bulk flushing
+ *   return: NO_ERROR or error code
+ *   request(in): request; the record descriptors point into it until flushed
+ *   num_added(in/out): the # of inserts, updates and deletes added
+ */
+static int
+la_add_apply_worker_objects (char *request, unsigned long *num_added)
+{
+  LA_WORKER_REQUEST *header = (LA_WORKER_REQUEST *) request;
+  LA_WORKER_OBJECT *object;
+  char *ptr, *key;
+  int error = NO_ERROR;
+  int i;
+
+  ptr = request + sizeof (LA_WORKER_REQUEST);
+  for (i = 0; i < header->num_objects; i++)
+    {
+      object = (LA_WORKER_OBJECT *) ptr;
+      key = ptr + sizeof (LA_WORKER_OBJECT);
+      ptr = key + DB_ALIGN (object->packed_key_value_length, MAX_ALIGNMENT);
+      if (object->has_recdes)
+	{
+	  object->recdes.data = ptr;
+	  ptr += DB_ALIGN (object->recdes.length, MAX_ALIGNMENT);
+	}
+
+      error = ws_add_to_repl_obj_list (&object->class_oid, key, object->packed_key_value_length,
+				       object->has_recdes ? &object->recdes : NULL, object->operation,
+				       object->has_index);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+
+      if (LC_IS_FLUSH_INSERT (object->operation) == true)
+	{
+	  la_Info.insert_counter++;
+	  num_added[0]++;
+	}
+      else if (LC_IS_FLUSH_UPDATE (object->operation) == true)
+	{
+	  la_Info.update_counter++;
+	  num_added[1]++;
+	}
+      else
+	{
+	  la_Info.delete_counter++;
+	  num_added[2]++;
+	}
+      la_Info.num_unflushed++;
+
+      error = la_flush_repl_items (false);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_apply_worker_requests() - apply and commit requests of an apply worker in one transaction
+ *   return: NO_ERROR or error code
+ *   requests(in): requests, in the order they were sent
+ *   num_requests(in): the # of requests
+ *   num_failed(out): the # of inserts, updates and deletes not applied
+ *   program_name(in):
+ *   database_name(in):
+ *
+ * Note:
+ *    The failures are handled as applylogdb does: the requests are applied again after reconnecting or after a
+ *    retryable error. Any other error is returned after aborting the transaction.
+ */
+static int
+la_apply_worker_requests (char **requests, int num_requests, unsigned long *num_failed, const char *program_name,
+			  const char *database_name)
+{
+  unsigned long insert_counter = la_Info.insert_counter;
+  unsigned long update_counter = la_Info.update_counter;
+  unsigned long delete_counter = la_Info.delete_counter;
+  unsigned long num_added[3];
+  char buf[LINE_MAX];
+  int error = NO_ERROR;
+  int i;
+
+  while (true)
+    {
+      num_added[0] = num_added[1] = num_added[2] = 0;
+
+      error = NO_ERROR;
+      for (i = 0; i < num_requests && error == NO_ERROR; i++)
+	{
+	  error = la_add_apply_worker_objects (requests[i], num_added);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = la_flush_repl_items (true);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = la_commit_transaction ();
+	}
+      if (error == NO_ERROR)
+	{
+	  break;
+	}
+
+      ws_clear_all_repl_objs ();
+      la_Info.num_unflushed = 0;
+      la_Info.insert_counter = insert_counter;
+      la_Info.update_counter = update_counter;
+      la_Info.delete_counter = delete_counter;
+      (void) db_abort_transaction ();
+
+      if (error == ER_NET_CANT_CONNECT_SERVER || error == ER_OBJ_NO_CONNECT
+	  || error == ER_LC_PARTIALLY_FAILED_TO_FLUSH || error == ER_LC_FAILED_TO_FLUSH_REPL_ITEMS)
+	{
+	  snprintf (buf, sizeof (buf),
+		    "apply worker will reconnect to server and apply %d transaction(s) again. (error:%d)",
+		    num_requests, error);
+	  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buf);
+
+	  (void) db_shutdown ();
+	  la_connect_apply_worker (program_name, database_name);
+	}
+      else if (la_ignore_on_error (error) == false && la_retry_on_error (error) == true)
+	{
+	  snprintf (buf, sizeof (buf), "apply worker attempts to try applying %d transaction(s) again. (error:%d)",
+		    num_requests, error);
+	  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buf);
+
+	  LA_SLEEP (10, 0);
+	}
+      else
+	{
+	  break;
+	}
+    }
+
+  num_failed[0] = insert_counter + num_added[0] - la_Info.insert_counter;
+  num_failed[1] = update_counter + num_added[1] - la_Info.update_counter;
+  num_failed[2] = delete_counter + num_added[2] - la_Info.delete_counter;
+
+  return error;
+}
+
+/*
+ * la_apply_worker_batch() - apply and commit the requests of an apply worker
+ *   return: none
+ *   requests(in): requests, in the order they were sent
+ *   num_requests(in): the # of requests
+ *   reply(in/out): reply to the applier
+ *   program_name(in):
+ *   database_name(in):
+ *
+ * Note:
+ *    The requests are committed together. If that fails, they are applied again one transaction at a time, so
+ *    only the failing transactions are logged, counted and skipped.
+ */
+static void
+la_apply_worker_batch (char **requests, int num_requests, LA_WORKER_REPLY * reply, const char *program_name,
+		       const char *database_name)
+{
+  unsigned long num_failed[3];
+  char buf[LINE_MAX];
+  int error = NO_ERROR;
+  int i;
+
+  error = la_apply_worker_requests (requests, num_requests, num_failed, program_name, database_name);
+  if (error != NO_ERROR && num_requests > 1)
+    {
+      snprintf (buf, sizeof (buf), "apply worker will apply %d transaction(s) one by one. (error:%d)", num_requests,
+		error);
+      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buf);
+
+      for (i = 0; i < num_requests; i++)
+	{
+	  error = la_apply_worker_requests (&requests[i], 1, num_failed, program_name, database_name);
+	  if (error != NO_ERROR)
+	    {
+	      snprintf (buf, sizeof (buf), "apply worker failed to apply a transaction. (error:%d)", error);
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buf);
+
+	      la_Info.fail_counter++;
+	    }
+	  reply->insert_failed += num_failed[0];
+	  reply->update_failed += num_failed[1];
+	  reply->delete_failed += num_failed[2];
+	}
+    }
+  else
+    {
+      if (error != NO_ERROR)
+	{
+	  snprintf (buf, sizeof (buf), "apply worker failed to apply a transaction. (error:%d)", error);
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buf);
+
+	  la_Info.fail_counter++;
+	}
+      reply->insert_failed += num_failed[0];
+      reply->update_failed += num_failed[1];
+      reply->delete_failed += num_failed[2];
+    }
+
+  reply->committed_seq = ((LA_WORKER_REQUEST *) requests[num_requests - 1])->seq;
+  reply->fail_counter = la_Info.fail_counter;
+}
+
+/*
+ * la_apply_worker_main() - main routine of an apply worker process
+ *   return: does not return
+ *   program_name(in):
+ *   database_name(in):
+ *   request_fd(in): pipe of the requests from the applier
+ *   reply_fd(in): pipe of the replies to the applier
+ *
+ * Note:
+ *    The requests are applied in the order they are received through its own connection. The requests already
+ *    in the pipe are committed together, then the applier is told the last committed one.
+ */
+static void
+la_apply_worker_main (const char *program_name, const char *database_name, int request_fd, int reply_fd)
+{
+  char *requests[LA_WORKER_MAX_BATCH_TRANS];
+  LA_WORKER_REPLY reply;
+  int num_requests = 0;
+  int error = NO_ERROR;
+  int i;
+
+  (void) os_set_signal_handler (SIGPIPE, SIG_IGN);
+
+  memset (&la_Info, 0, sizeof (la_Info));
+  memset (&reply, 0, sizeof (reply));
+
+  la_connect_apply_worker (program_name, database_name);
+
+  while (true)
+    {
+      error = la_read_apply_worker_request (request_fd, &requests[num_requests]);
+      if (error != NO_ERROR || requests[num_requests] == NULL)
+	{
+	  break;
+	}
+      num_requests++;
+
+      if (num_requests < LA_WORKER_MAX_BATCH_TRANS && la_has_apply_worker_request (request_fd))
+	{
+	  continue;
+	}
+
+      la_apply_worker_batch (requests, num_requests, &reply, program_name, database_name);
+      for (i = 0; i < num_requests; i++)
+	{
+	  free_and_init (requests[i]);
+	}
+      num_requests = 0;
+
+      if (la_write_apply_worker_pipe (reply_fd, &reply, sizeof (reply)) != NO_ERROR)
+	{
+	  error = ER_FAILED;
+	  break;
+	}
+    }
+
+  /* the applier has exited; finish what it has sent */
+  if (num_requests > 0)
+    {
+      la_apply_worker_batch (requests, num_requests, &reply, program_name, database_name);
+      for (i = 0; i < num_requests; i++)
+	{
+	  free_and_init (requests[i]);
+	}
+    }
+
+  (void) db_shutdown ();
+  _exit ((error == NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/*
+ * la_start_apply_workers() - start the apply worker processes
+ *   return: NO_ERROR or error code
+ *   program_name(in):
+ *   database_name(in):
+ *
+ * Note:
+ *    ha_applylogdb_parallel_workers processes are forked, each one with its own connection to the server.
+ *    It should be called before applylogdb connects to the server or to cub_master.
+ */
+int
+la_start_apply_workers (const char *program_name, const char *database_name)
+{
+  int num_workers;
+  int request_pipe[2], reply_pipe[2];
+  LA_APPLY_WORKER *worker;
+  char buf[LINE_MAX];
+  pid_t pid;
+  int error = NO_ERROR;
+  int i, j;
+
+  num_workers = prm_get_integer_value (PRM_ID_HA_APPLYLOGDB_PARALLEL_WORKERS);
+  if (num_workers <= 0)
+    {
+      return NO_ERROR;
+    }
+  num_workers = MIN (num_workers, LA_MAX_APPLY_WORKERS);
+
+  memset (&la_Workers, 0, sizeof (la_Workers));
+
+  error = la_dispatch_init (&la_Workers.dispatch, num_workers);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  la_Workers.workers = (LA_APPLY_WORKER *) calloc (num_workers, sizeof (LA_APPLY_WORKER));
+  la_Workers.tran_slots_size = LA_MAX_UNFLUSHED_REPL_ITEMS;
+  la_Workers.tran_slots = (int *) malloc (la_Workers.tran_slots_size * sizeof (int));
+  la_Workers.request_size = LA_WORKER_DEFAULT_REQUEST_SIZE;
+  la_Workers.request = (char *) malloc (la_Workers.request_size);
+  if (la_Workers.workers == NULL || la_Workers.tran_slots == NULL || la_Workers.request == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) la_Workers.request_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  la_Workers.applier_pid = getpid ();
+  la_reset_apply_workers ();
+
+  for (i = 0; i < num_workers; i++)
+    {
+      if (pipe (request_pipe) != 0)
+	{
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1,
+			       "failed to create a pipe to an apply worker");
+	  return ER_HA_GENERIC_ERROR;
+	}
+      if (pipe (reply_pipe) != 0)
+	{
+	  close (request_pipe[0]);
+	  close (request_pipe[1]);
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1,
+			       "failed to create a pipe to an apply worker");
+	  return ER_HA_GENERIC_ERROR;
+	}
+
+      pid = fork ();
+      if (pid < 0)
+	{
+	  close (request_pipe[0]);
+	  close (request_pipe[1]);
+	  close (reply_pipe[0]);
+	  close (reply_pipe[1]);
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1,
+			       "failed to start an apply worker");
+	  return ER_HA_GENERIC_ERROR;
+	}
+      else if (pid == 0)
+	{
+	  /* the workers see the end of file only when the applier has exited */
+	  for (j = 0; j < la_Workers.count; j++)
+	    {
+	      close (la_Workers.workers[j].request_fd);
+	      close (la_Workers.workers[j].reply_fd);
+	    }
+	  la_Workers.count = 0;
+	  close (request_pipe[1]);
+	  close (reply_pipe[0]);
+
+	  la_apply_worker_main (program_name, database_name, request_pipe[0], reply_pipe[1]);
+	}
+
+      close (request_pipe[0]);
+      close (reply_pipe[1]);
+
+      /* the applier reads the replies while it waits to send a request */
+      (void) fcntl (request_pipe[1], F_SETFL, O_NONBLOCK);
+      (void) fcntl (reply_pipe[0], F_SETFL, O_NONBLOCK);
+
+      worker = &la_Workers.workers[la_Workers.count++];
+      worker->pid = pid;
+      worker->request_fd = request_pipe[1];
+      worker->reply_fd = reply_pipe[0];
+    }
+
+  snprintf (buf, sizeof (buf), "%d apply workers started", la_Workers.count);
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buf);
+
+  return NO_ERROR;
+}
+
+/*
+ * la_apply_worker_failed() - handle an apply worker that stopped
+ *   return: error code
+ *   worker(in): index of the worker
+ */
+static int
+la_apply_worker_failed (int worker)
+{
+  char buf[LINE_MAX];
+
+  snprintf (buf, sizeof (buf), "apply worker %d (pid %d) stopped. applylogdb will shut itself down", worker,
+	    (int) la_Workers.workers[worker].pid);
+  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1, buf);
+
+  la_applier_need_shutdown = true;
+
+  return ER_HA_GENERIC_ERROR;
+}
+
+static void
+la_init_worker_request (void)
+{
+  LA_WORKER_REQUEST *request = (LA_WORKER_REQUEST *) la_Workers.request;
+
+  request->seq = 0;
+  request->num_objects = 0;
+  request->length = sizeof (LA_WORKER_REQUEST);
+}
+
+static void
+la_clear_dispatched_tran (void)
+{
+  la_Workers.dispatched.seq = 0;
+  la_Workers.dispatched.worker = -1;
+  LSA_SET_NULL (&la_Workers.dispatched.start_lsa);
+  LSA_SET_NULL (&la_Workers.dispatched.commit_lsa);
+  LSA_SET_NULL (&la_Workers.dispatched.rep_lsa);
+  la_Workers.dispatched.log_record_time = 0;
+}
+
+/*
+ * la_add_object_to_worker_request() - copy a replication object into the request being built
+ *   return: NO_ERROR or error code
+ *   class_oid(in):
+ *   item(in): replication item
+ *   recdes(in): record to be inserted or updated, NULL for delete
+ *   operation(in):
+ *   has_index(in):
+ */
+static int
+la_add_object_to_worker_request (OID * class_oid, LA_ITEM * item, RECDES * recdes, int operation, bool has_index)
+{
+  LA_WORKER_REQUEST *request = (LA_WORKER_REQUEST *) la_Workers.request;
+  LA_WORKER_OBJECT *object;
+  char *ptr;
+  int key_length, data_length, length, size;
+
+  key_length = DB_ALIGN (item->packed_key_value_length, MAX_ALIGNMENT);
+  data_length = (recdes != NULL) ? DB_ALIGN (recdes->length, MAX_ALIGNMENT) : 0;
+  length = request->length + (int) sizeof (LA_WORKER_OBJECT) + key_length + data_length;
+
+  if (length > la_Workers.request_size)
+    {
+      for (size = la_Workers.request_size * 2; size < length; size *= 2)
+	{
+	  ;
+	}
+
+      ptr = (char *) realloc (la_Workers.request, size);
+      if (ptr == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) size);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+      la_Workers.request = ptr;
+      la_Workers.request_size = size;
+      request = (LA_WORKER_REQUEST *) la_Workers.request;
+    }
+
+  object = (LA_WORKER_OBJECT *) (la_Workers.request + request->length);
+  COPY_OID (&object->class_oid, class_oid);
+  object->operation = operation;
+  object->has_index = has_index;
+  object->has_recdes = (recdes != NULL);
+  object->packed_key_value_length = item->packed_key_value_length;
+
+  ptr = (char *) (object + 1);
+  memcpy (ptr, item->packed_key_value, item->packed_key_value_length);
+
+  if (recdes != NULL)
+    {
+      object->recdes = *recdes;
+      object->recdes.area_size = recdes->length;
+      object->recdes.data = NULL;
+      memcpy (ptr + key_length, recdes->data, recdes->length);
+    }
+
+  request->num_objects++;
+  request->length = length;
+
+  return NO_ERROR;
+}
+
+/*
+ * la_read_apply_worker_replies() - read the replies of an apply worker
+ *   return: NO_ERROR or error code
+ *   worker(in): index of the worker
+ */
+static int
+la_read_apply_worker_replies (int worker)
+{
+  LA_APPLY_WORKER *w = &la_Workers.workers[worker];
+  LA_WORKER_REPLY reply;
+  ssize_t n;
+
+  while (true)
+    {
+      n = read (w->reply_fd, &reply, sizeof (reply));
+      if (n == (ssize_t) sizeof (reply))
+	{
+	  /* the rows that failed were counted when the transaction was sent */
+	  la_Info.insert_counter -= MIN (la_Info.insert_counter, reply.insert_failed - w->last_reply.insert_failed);
+	  la_Info.update_counter -= MIN (la_Info.update_counter, reply.update_failed - w->last_reply.update_failed);
+	  la_Info.delete_counter -= MIN (la_Info.delete_counter, reply.delete_failed - w->last_reply.delete_failed);
+	  la_Info.fail_counter += reply.fail_counter - w->last_reply.fail_counter;
+
+	  w->last_reply = reply;
+	  la_dispatch_set_committed (&la_Workers.dispatch, worker, reply.committed_seq);
+	}
+      else if (n < 0 && errno == EINTR)
+	{
+	  continue;
+	}
+      else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+	{
+	  return NO_ERROR;
+	}
+      else
+	{
+	  /* end of file or a partial reply */
+	  return la_apply_worker_failed (worker);
+	}
+    }
+}
+
+/*
+ * la_receive_apply_worker_replies() - receive the replies of the apply workers and advance the checkpoint
+ *   return: NO_ERROR or error code
+ *   wait(in): whether to wait for a reply (at most LA_WORKER_POLL_TIMEOUT)
+ */
+static int
+la_receive_apply_worker_replies (bool wait)
+{
+  struct pollfd fds[LA_MAX_APPLY_WORKERS];
+  int error = NO_ERROR;
+  int i, n;
+
+  for (i = 0; i < la_Workers.count; i++)
+    {
+      fds[i].fd = la_Workers.workers[i].reply_fd;
+      fds[i].events = POLLIN;
+      fds[i].revents = 0;
+    }
+
+  n = poll (fds, la_Workers.count, wait ? LA_WORKER_POLL_TIMEOUT : 0);
+  if (n < 0 && errno != EINTR)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_HA_GENERIC_ERROR, 1,
+			   "failed to wait for the apply workers");
+      la_applier_need_shutdown = true;
+      return ER_HA_GENERIC_ERROR;
+    }
+  if (n <= 0)
+    {
+      return (wait && la_applier_shutdown_by_signal) ? ER_INTERRUPTED : NO_ERROR;
+    }
+
+  for (i = 0; i < la_Workers.count; i++)
+    {
+      if (fds[i].revents != 0)
+	{
+	  error = la_read_apply_worker_replies (i);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	}
+    }
+
+  la_advance_apply_checkpoint ();
+
+  return NO_ERROR;
+}
+
+/*
+ * la_send_worker_request() - send the request being built to an apply worker
+ *   return: NO_ERROR or error code
+ *   worker(in): index of the worker
+ */
+static int
+la_send_worker_request (int worker)
+{
+  LA_APPLY_WORKER *w = &la_Workers.workers[worker];
+  LA_WORKER_REQUEST *request = (LA_WORKER_REQUEST *) la_Workers.request;
+  struct pollfd fds[LA_MAX_APPLY_WORKERS + 1];
+  char *ptr;
+  int remain;
+  ssize_t n;
+  int error = NO_ERROR;
+  int i;
+
+  request->seq = ++la_Workers.dispatch.next_seq;
+
+  ptr = la_Workers.request;
+  remain = request->length;
+  while (remain > 0)
+    {
+      n = write (w->request_fd, ptr, remain);
+      if (n > 0)
+	{
+	  ptr += n;
+	  remain -= (int) n;
+	  continue;
+	}
+      if (n < 0 && errno == EINTR)
+	{
+	  continue;
+	}
+      if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+	{
+	  return la_apply_worker_failed (worker);
+	}
+
+      /* the pipe is full; the worker may be waiting for its replies to be read */
+      fds[0].fd = w->request_fd;
+      fds[0].events = POLLOUT;
+      fds[0].revents = 0;
+      for (i = 0; i < la_Workers.count; i++)
+	{
+	  fds[i + 1].fd = la_Workers.workers[i].reply_fd;
+	  fds[i + 1].events = POLLIN;
+	  fds[i + 1].revents = 0;
+	}
+      (void) poll (fds, la_Workers.count + 1, LA_WORKER_POLL_TIMEOUT);
+
+      error = la_receive_apply_worker_replies (false);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  la_dispatch_set_sent (&la_Workers.dispatch, worker, request->seq, la_Workers.tran_slots, la_Workers.num_tran_slots);
+  la_Workers.dispatched.seq = request->seq;
+  la_Workers.dispatched.worker = worker;
+
+  return NO_ERROR;
+}
+
+/*
+ * la_advance_apply_checkpoint() - advance the applied info over the transactions committed by the workers
+ *   return: none
+ *
+ * Note:
+ *    The checkpoint moves in the commit order of the master: it stops at the first transaction whose worker has
+ *    not committed it yet.
+ */
+static void
+la_advance_apply_checkpoint (void)
+{
+  LA_DISPATCHED_TRAN tran;
+
+  while (la_dispatch_next_committed_tran (&la_Workers.dispatch, &tran))
+    {
+      LSA_COPY (&la_Info.committed_lsa, &tran.commit_lsa);
+      if (!LSA_ISNULL (&tran.rep_lsa))
+	{
+	  LSA_COPY (&la_Info.committed_rep_lsa, &tran.rep_lsa);
+	}
+      if (tran.log_record_time != 0)
+	{
+	  la_Info.log_record_time = tran.log_record_time;
+	}
+      la_Info.is_apply_info_updated = true;
+    }
+}
+
+/*
+ * la_get_repl_item_slot() - get the slot that orders the changes of a row
+ *   return: slot index
+ *   item(in): replication item
+ *   class_name(in/out): class of the previous item
+ *   class_order(in/out): how the rows of the class are ordered
+ *
+ * Note:
+ *    Rows of a class with another unique key are ordered by class, since two transactions may swap a unique
+ *    value. Classes with foreign keys, partitions or a hierarchy are ordered together.
+ */
+static int
+la_get_repl_item_slot (LA_ITEM * item, const char **class_name, LA_DISPATCH_ORDER * class_order)
+{
+  DB_OBJECT *class_obj;
+  SM_CLASS *class_;
+  SM_CLASS_CONSTRAINT *cons;
+
+  if (*class_name == NULL || strcmp (*class_name, item->class_name) != 0)
+    {
+      *class_name = item->class_name;
+      *class_order = LA_DISPATCH_ORDER_BY_KEY;
+
+      class_obj = db_find_class (item->class_name);
+      if (class_obj == NULL || au_fetch_class (class_obj, &class_, AU_FETCH_READ, AU_SELECT) != NO_ERROR)
+	{
+	  /* applying the item reports the error */
+	  er_clear ();
+	  *class_order = LA_DISPATCH_ORDER_GLOBAL;
+	}
+      else if (class_->inheritance != NULL || class_->users != NULL || class_->partition != NULL)
+	{
+	  *class_order = LA_DISPATCH_ORDER_GLOBAL;
+	}
+      else
+	{
+	  for (cons = sm_class_constraints (class_obj); cons != NULL; cons = cons->next)
+	    {
+	      if (cons->type == SM_CONSTRAINT_FOREIGN_KEY
+		  || (cons->type == SM_CONSTRAINT_PRIMARY_KEY && cons->fk_info != NULL))
+		{
+		  *class_order = LA_DISPATCH_ORDER_GLOBAL;
+		  break;
+		}
+	      if (cons->type == SM_CONSTRAINT_UNIQUE || cons->type == SM_CONSTRAINT_REVERSE_UNIQUE)
+		{
+		  *class_order = LA_DISPATCH_ORDER_BY_CLASS;
+		}
+	    }
+	}
+    }
+
+  return la_dispatch_get_slot (item->class_name, *class_order,
+			       (*class_order == LA_DISPATCH_ORDER_BY_KEY) ? la_get_item_pk_value (item) : NULL);
+}
+
+/*
+ * la_choose_apply_worker() - choose the apply worker of a transaction
+ *   return: NO_ERROR or error code
+ *   apply(in): the transaction
+ *   commit_lsa(in): LSA of the commit
+ *   worker(out): index of the worker, -1 if the applier applies it
+ *   need_barrier(out): whether the transactions sent before must be committed first
+ *
+ * Note:
+ *    A transaction goes to the worker that may still be applying one of its rows, so the changes of a row are
+ *    applied in order. When more than one worker may be, it waits for them to commit. Otherwise it goes to the
+ *    least busy worker.
+ */
+static int
+la_choose_apply_worker (LA_APPLY * apply, LOG_LSA * commit_lsa, int *worker, bool * need_barrier)
+{
+  LA_ITEM *item;
+  const char *class_name = NULL;
+  LA_DISPATCH_ORDER class_order = LA_DISPATCH_ORDER_BY_KEY;
+  int *tran_slots;
+  int error = NO_ERROR;
+
+  *worker = -1;
+  *need_barrier = false;
+  la_Workers.num_tran_slots = 0;
+
+  if (apply->is_long_trans)
+    {
+      /* its items are read from the log while applying */
+      *need_barrier = true;
+      return NO_ERROR;
+    }
+
+  for (item = apply->head; item != NULL && LSA_LE (&item->lsa, commit_lsa); item = item->next)
+    {
+      if (!LSA_GT (&item->lsa, &la_Info.last_committed_rep_lsa) || la_need_filter_out (item) == true)
+	{
+	  continue;
+	}
+
+      if (item->log_type != LOG_REPLICATION_DATA)
+	{
+	  *need_barrier = true;
+	  return NO_ERROR;
+	}
+
+      if (la_Workers.num_tran_slots >= la_Workers.tran_slots_size)
+	{
+	  tran_slots = (int *) realloc (la_Workers.tran_slots, la_Workers.tran_slots_size * 2 * sizeof (int));
+	  if (tran_slots == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		      (size_t) la_Workers.tran_slots_size * 2 * sizeof (int));
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  la_Workers.tran_slots = tran_slots;
+	  la_Workers.tran_slots_size *= 2;
+	}
+
+      la_Workers.tran_slots[la_Workers.num_tran_slots++] = la_get_repl_item_slot (item, &class_name, &class_order);
+    }
+
+  if (la_Workers.num_tran_slots == 0)
+    {
+      /* nothing to apply */
+      return NO_ERROR;
+    }
+
+  while (!la_dispatch_choose_worker (&la_Workers.dispatch, la_Workers.tran_slots, la_Workers.num_tran_slots, worker))
+    {
+      error = la_receive_apply_worker_replies (true);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_wait_apply_workers() - wait until the checkpoint passes all the transactions sent to the apply workers
+ *   return: NO_ERROR or error code
+ */
+static int
+la_wait_apply_workers (void)
+{
+  int error = NO_ERROR;
+
+  while (la_Workers.dispatch.num_pending > 0)
+    {
+      error = la_receive_apply_worker_replies (true);
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_add_dispatched_tran() - add a transaction to the ones the checkpoint waits for
+ *   return: NO_ERROR or error code
+ *   commit_lsa(in): LSA of the commit
+ *   log_record_time(in): commit time at the server site, 0 if unknown
+ *
+ * Note:
+ *    Every transaction of the commit list is added, even when nothing was sent to a worker, so the checkpoint
+ *    passes it in the commit order.
+ */
+static int
+la_add_dispatched_tran (LOG_LSA * commit_lsa, time_t log_record_time)
+{
+  LA_DISPATCHED_TRAN *tran = &la_Workers.dispatched;
+  int error = NO_ERROR;
+
+  while (la_Workers.dispatch.num_pending >= LA_WORKER_MAX_PENDING_TRANS)
+    {
+      error = la_receive_apply_worker_replies (true);
+      if (error != NO_ERROR)
+	{
+	  la_clear_dispatched_tran ();
+	  return error;
+	}
+    }
+
+  LSA_COPY (&tran->commit_lsa, commit_lsa);
+  tran->log_record_time = log_record_time;
+  la_dispatch_add_tran (&la_Workers.dispatch, tran);
+
+  la_clear_dispatched_tran ();
+  la_advance_apply_checkpoint ();
+
+  return NO_ERROR;
+}
+
+/*
+ * la_drain_apply_workers() - wait for the apply workers to commit what was sent to them
+ *   return: none
+ *
+ * Note:
+ *    After a reconnection the logs are read again from the checkpoint; they must not be applied while a worker
+ *    still applies them.
+ */
+static void
+la_drain_apply_workers (void)
+{
+  while (la_Workers.dispatch.num_pending > 0 && la_applier_shutdown_by_signal == false)
+    {
+      if (la_receive_apply_worker_replies (true) != NO_ERROR)
+	{
+	  break;
+	}
+    }
+}
+
+static void
+la_reset_apply_workers (void)
+{
+  la_Workers.num_tran_slots = 0;
+  la_Workers.is_dispatching = false;
+  la_Workers.need_commit = false;
+
+  la_dispatch_clear (&la_Workers.dispatch);
+
+  la_clear_dispatched_tran ();
+}
+
 /*
  * la_apply_log_file() - apply the transaction log to the slave
  *   return: int
@@ -7814,6 +9147,7 @@ la_apply_log_file (const char *database_name, const char *log_path, const int ma
 
   /* init la_Info */
   la_init (log_path, max_mem_size);
+  la_reset_apply_workers ();
 
   if (prm_get_bool_value (PRM_ID_HA_SQL_LOGGING))
     {
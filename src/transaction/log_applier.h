@@ -57,6 +57,7 @@ int la_log_page_check (const char *database_name, const char *log_path, INT64 pa
 		       bool check_copied_info, bool check_replica_info, bool verbose, LOG_LSA * copied_eof_lsa,
 		       LOG_LSA * copied_append_lsa, LOG_LSA * applied_final_lsa);
 int la_apply_log_file (const char *database_name, const char *log_path, const int max_mem_size);
+int la_start_apply_workers (const char *program_name, const char *database_name);
 void la_print_log_header (const char *database_name, LOG_HEADER * hdr, bool verbose);
 void la_print_log_arv_header (const char *database_name, LOG_ARV_HEADER * hdr, bool verbose);
 void la_print_delay_info (LOG_LSA working_lsa, LOG_LSA target_lsa, float process_rate);
@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/*
+ *  log_applier_dispatch.c : ordering of the transactions applied by the apply workers
+ */
+
+#ident "$Id$"
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log_applier_dispatch.h"
+#include "error_manager.h"
+#include "memory_alloc.h"
+#include "memory_hash.h"
+
+/*
+ * la_dispatch_init() - initialize the ordering state of the apply workers
+ *   return: NO_ERROR or error code
+ *   dispatch(out):
+ *   num_workers(in): the # of apply workers
+ */
+int
+la_dispatch_init (LA_DISPATCH * dispatch, int num_workers)
+{
+  assert (num_workers > 0 && num_workers <= LA_MAX_APPLY_WORKERS);
+
+  memset (dispatch, 0, sizeof (*dispatch));
+  dispatch->num_workers = num_workers;
+
+  dispatch->slots = (LA_WORKER_SLOT *) calloc (LA_WORKER_KEY_SLOTS + 1, sizeof (LA_WORKER_SLOT));
+  if (dispatch->slots == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) (LA_WORKER_KEY_SLOTS + 1) * sizeof (LA_WORKER_SLOT));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  dispatch->pending = (LA_DISPATCHED_TRAN *) calloc (LA_WORKER_MAX_PENDING_TRANS, sizeof (LA_DISPATCHED_TRAN));
+  if (dispatch->pending == NULL)
+    {
+      free_and_init (dispatch->slots);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) LA_WORKER_MAX_PENDING_TRANS * sizeof (LA_DISPATCHED_TRAN));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * la_dispatch_final() - free the ordering state of the apply workers
+ *   return: none
+ *   dispatch(in/out):
+ */
+void
+la_dispatch_final (LA_DISPATCH * dispatch)
+{
+  if (dispatch->slots != NULL)
+    {
+      free_and_init (dispatch->slots);
+    }
+  if (dispatch->pending != NULL)
+    {
+      free_and_init (dispatch->pending);
+    }
+  dispatch->num_workers = 0;
+  dispatch->num_pending = 0;
+}
+
+/*
+ * la_dispatch_clear() - forget the dispatched transactions
+ *   return: none
+ *   dispatch(in/out):
+ *
+ * Note:
+ *    The workers must have committed everything sent to them.
+ */
+void
+la_dispatch_clear (LA_DISPATCH * dispatch)
+{
+  dispatch->pending_head = 0;
+  dispatch->num_pending = 0;
+
+  if (dispatch->slots != NULL)
+    {
+      memset (dispatch->slots, 0, (LA_WORKER_KEY_SLOTS + 1) * sizeof (LA_WORKER_SLOT));
+    }
+}
+
+/*
+ * la_dispatch_get_slot() - get the slot that orders the changes of a row
+ *   return: slot index
+ *   class_name(in):
+ *   order(in): how the rows of the class are ordered
+ *   pk(in): primary key of the row
+ */
+int
+la_dispatch_get_slot (const char *class_name, LA_DISPATCH_ORDER order, const DB_VALUE * pk)
+{
+  unsigned int hash;
+
+  switch (order)
+    {
+    case LA_DISPATCH_ORDER_GLOBAL:
+      return LA_WORKER_GLOBAL_SLOT;
+
+    case LA_DISPATCH_ORDER_BY_CLASS:
+      return (int) mht_5strhash (class_name, LA_WORKER_KEY_SLOTS);
+
+    case LA_DISPATCH_ORDER_BY_KEY:
+    default:
+      hash = mht_5strhash (class_name, LA_WORKER_KEY_SLOTS);
+      hash = (hash * 31 + mht_valhash (pk, LA_WORKER_KEY_SLOTS)) % LA_WORKER_KEY_SLOTS;
+      return (int) hash;
+    }
+}
+
+/*
+ * la_dispatch_choose_worker() - choose the apply worker of a transaction
+ *   return: false if the transaction must wait for more than one worker to commit
+ *   dispatch(in):
+ *   tran_slots(in): slots of the rows changed by the transaction
+ *   num_tran_slots(in): the # of slots
+ *   worker(out): index of the worker
+ *
+ * Note:
+ *    A transaction goes to the worker that may still be applying one of its rows, so the changes of a row are
+ *    applied in order. Otherwise it goes to the least busy worker.
+ */
+bool
+la_dispatch_choose_worker (const LA_DISPATCH * dispatch, const int *tran_slots, int num_tran_slots, int *worker)
+{
+  const LA_WORKER_SLOT *slot;
+  unsigned int busy_mask = 0;
+  INT64 load, min_load = -1;
+  int i, j;
+
+  *worker = -1;
+
+  for (i = 0; i < num_tran_slots; i++)
+    {
+      slot = &dispatch->slots[tran_slots[i]];
+      if (slot->seq > dispatch->committed_seq[slot->worker])
+	{
+	  busy_mask |= (1U << slot->worker);
+	}
+    }
+
+  if ((busy_mask & (busy_mask - 1)) != 0)
+    {
+      return false;
+    }
+
+  if (busy_mask != 0)
+    {
+      for (i = 0; (busy_mask & (1U << i)) == 0; i++)
+	{
+	  ;
+	}
+      *worker = i;
+      return true;
+    }
+
+  /* start from a different worker each time to spread the transactions when all are idle */
+  for (j = 0; j < dispatch->num_workers; j++)
+    {
+      i = (int) ((dispatch->next_seq + j) % dispatch->num_workers);
+
+      load = dispatch->last_sent_seq[i] - dispatch->committed_seq[i];
+      if (min_load < 0 || load < min_load)
+	{
+	  min_load = load;
+	  *worker = i;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * la_dispatch_set_sent() - record a request sent to an apply worker
+ *   return: none
+ *   dispatch(in/out):
+ *   worker(in): index of the worker
+ *   seq(in): sequence number of the request
+ *   tran_slots(in): slots of the rows changed by the transaction
+ *   num_tran_slots(in): the # of slots
+ */
+void
+la_dispatch_set_sent (LA_DISPATCH * dispatch, int worker, INT64 seq, const int *tran_slots, int num_tran_slots)
+{
+  LA_WORKER_SLOT *slot;
+  int i;
+
+  dispatch->last_sent_seq[worker] = seq;
+
+  for (i = 0; i < num_tran_slots; i++)
+    {
+      slot = &dispatch->slots[tran_slots[i]];
+      slot->seq = seq;
+      slot->worker = worker;
+    }
+}
+
+/*
+ * la_dispatch_set_committed() - record the requests an apply worker has committed
+ *   return: none
+ *   dispatch(in/out):
+ *   worker(in): index of the worker
+ *   seq(in): the requests up to this one are committed
+ */
+void
+la_dispatch_set_committed (LA_DISPATCH * dispatch, int worker, INT64 seq)
+{
+  if (seq > dispatch->committed_seq[worker])
+    {
+      dispatch->committed_seq[worker] = seq;
+    }
+}
+
+/*
+ * la_dispatch_add_tran() - add a transaction in the commit order of the master
+ *   return: none
+ *   dispatch(in/out):
+ *   tran(in):
+ */
+void
+la_dispatch_add_tran (LA_DISPATCH * dispatch, const LA_DISPATCHED_TRAN * tran)
+{
+  assert (dispatch->num_pending < LA_WORKER_MAX_PENDING_TRANS);
+
+  dispatch->pending[(dispatch->pending_head + dispatch->num_pending) % LA_WORKER_MAX_PENDING_TRANS] = *tran;
+  dispatch->num_pending++;
+}
+
+/*
+ * la_dispatch_next_committed_tran() - remove the oldest transaction if it is committed
+ *   return: true if tran is set
+ *   dispatch(in/out):
+ *   tran(out):
+ *
+ * Note:
+ *    The transactions are removed in the commit order of the master, so a transaction committed by one worker
+ *    waits for the transactions committed before it at the master.
+ */
+bool
+la_dispatch_next_committed_tran (LA_DISPATCH * dispatch, LA_DISPATCHED_TRAN * tran)
+{
+  LA_DISPATCHED_TRAN *head;
+
+  if (dispatch->num_pending == 0)
+    {
+      return false;
+    }
+
+  head = &dispatch->pending[dispatch->pending_head];
+  if (head->worker >= 0 && dispatch->committed_seq[head->worker] < head->seq)
+    {
+      return false;
+    }
+
+  *tran = *head;
+  dispatch->pending_head = (dispatch->pending_head + 1) % LA_WORKER_MAX_PENDING_TRANS;
+  dispatch->num_pending--;
+
+  return true;
+}
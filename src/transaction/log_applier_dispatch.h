@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/*
+ * log_applier_dispatch.h - Definitions for ordering the transactions applied by the apply workers
+ */
+
+#ifndef LOG_APPLIER_DISPATCH_H_
+#define LOG_APPLIER_DISPATCH_H_
+
+#ident "$Id$"
+
+#include <time.h>
+
+#include "dbtype_def.h"
+#include "log_lsa.hpp"
+#include "system.h"
+
+#define LA_MAX_APPLY_WORKERS            16
+#define LA_WORKER_MAX_PENDING_TRANS     10000
+#define LA_WORKER_KEY_SLOTS             65536
+#define LA_WORKER_GLOBAL_SLOT           LA_WORKER_KEY_SLOTS
+
+/* how the rows of a class are ordered among the apply workers */
+typedef enum
+{
+  LA_DISPATCH_ORDER_BY_KEY,	/* rows with the same primary key */
+  LA_DISPATCH_ORDER_BY_CLASS,	/* all the rows of the class */
+  LA_DISPATCH_ORDER_GLOBAL	/* all the rows of all such classes */
+} LA_DISPATCH_ORDER;
+
+typedef struct la_dispatched_tran LA_DISPATCHED_TRAN;
+struct la_dispatched_tran
+{
+  INT64 seq;			/* sequence number of the request */
+  int worker;			/* index of the worker, -1 if the applier has nothing to wait for */
+  LOG_LSA start_lsa;		/* start lsa of the transaction */
+  LOG_LSA commit_lsa;		/* LSA of LOG_COMMIT */
+  LOG_LSA rep_lsa;		/* LSA of the last replication log sent */
+  time_t log_record_time;	/* commit time at the server site */
+};
+
+typedef struct la_worker_slot LA_WORKER_SLOT;
+struct la_worker_slot
+{
+  INT64 seq;			/* the last request that changed a row of the slot */
+  int worker;
+};
+
+typedef struct la_dispatch LA_DISPATCH;
+struct la_dispatch
+{
+  int num_workers;
+  INT64 next_seq;
+  INT64 last_sent_seq[LA_MAX_APPLY_WORKERS];
+  INT64 committed_seq[LA_MAX_APPLY_WORKERS];	/* the requests up to this one are committed */
+
+  /* class and primary key hash slots */
+  LA_WORKER_SLOT *slots;
+
+  /* dispatched transactions in commit order */
+  LA_DISPATCHED_TRAN *pending;
+  int pending_head;
+  int num_pending;
+};
+
+extern int la_dispatch_init (LA_DISPATCH * dispatch, int num_workers);
+extern void la_dispatch_final (LA_DISPATCH * dispatch);
+extern void la_dispatch_clear (LA_DISPATCH * dispatch);
+extern int la_dispatch_get_slot (const char *class_name, LA_DISPATCH_ORDER order, const DB_VALUE * pk);
+extern bool la_dispatch_choose_worker (const LA_DISPATCH * dispatch, const int *tran_slots, int num_tran_slots,
+				       int *worker);
+extern void la_dispatch_set_sent (LA_DISPATCH * dispatch, int worker, INT64 seq, const int *tran_slots,
+				  int num_tran_slots);
+extern void la_dispatch_set_committed (LA_DISPATCH * dispatch, int worker, INT64 seq);
+extern void la_dispatch_add_tran (LA_DISPATCH * dispatch, const LA_DISPATCHED_TRAN * tran);
+extern bool la_dispatch_next_committed_tran (LA_DISPATCH * dispatch, LA_DISPATCHED_TRAN * tran);
+
+#endif /* LOG_APPLIER_DISPATCH_H_ */
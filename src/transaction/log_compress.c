@@ -32,26 +32,21 @@
 #include "error_manager.h"
 #include "memory_alloc.h"
 
+static bool log_zip_realloc_data (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T buf_size);
+static bool log_zip_reserve_wrkmem (LOG_ZIP * log_zip, size_t size);
+static size_t log_zip_method_wrkmem_size (LOG_ZIP_METHOD method);
+static bool log_zip_internal (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data, LOG_ZIP_SIZE_T dict_length,
+			      const void *dict);
+
 /*
- * log_zip - compress(zip) log data into LOG_ZIP
+ * log_zip_realloc_data - make sure log_zip data buffer is large enough
  *   return: true on success, false on failure
- *   log_zip(in/out): LOG_ZIP structure allocated by log_zip_alloc
- *   length(in): length of given data
- *   data(in): log data to be compressed
+ *   log_zip(in/out): LOG_ZIP structure
+ *   buf_size(in): needed buffer size
  */
-bool
-log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
+static bool
+log_zip_realloc_data (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T buf_size)
 {
-  lzo_uint zip_len = 0;
-  LOG_ZIP_SIZE_T buf_size;
-  int rc;
-
-  assert (length > 0 && data != NULL);
-  assert (log_zip != NULL);
-
-  log_zip->data_length = 0;
-
-  buf_size = LOG_ZIP_BUF_SIZE (length);
   if (buf_size > log_zip->buf_size)
     {
       if (log_zip->log_data)
@@ -74,12 +69,177 @@ log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
       return false;
     }
 
+  return true;
+}
+
+/*
+ * log_zip_reserve_wrkmem - make sure log_zip working memory is large enough
+ *   return: true on success, false on failure
+ *   log_zip(in/out): LOG_ZIP structure
+ *   size(in): needed working memory size
+ */
+static bool
+log_zip_reserve_wrkmem (LOG_ZIP * log_zip, size_t size)
+{
+  if (log_zip->wrkmem != NULL && log_zip->wrkmem_size >= size)
+    {
+      return true;
+    }
+
+  if (log_zip->wrkmem != NULL)
+    {
+      free_and_init (log_zip->wrkmem);
+    }
+  log_zip->wrkmem_size = 0;
+
+  log_zip->wrkmem = (lzo_bytep) malloc (size);
+  if (log_zip->wrkmem == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return false;
+    }
+  log_zip->wrkmem_size = size;
+
+  return true;
+}
+
+/*
+ * log_zip_method_wrkmem_size - get working memory size needed by compression method
+ *   return: working memory size
+ *   method(in): compression method
+ */
+static size_t
+log_zip_method_wrkmem_size (LOG_ZIP_METHOD method)
+{
+  switch (method)
+    {
+    case LOG_ZIP_METHOD_LZO1X_1_15:
+      return LZO1X_1_15_MEM_COMPRESS;
+    case LOG_ZIP_METHOD_LZO1X_999:
+      return LZO1X_999_MEM_COMPRESS;
+    case LOG_ZIP_METHOD_LZO1X_1:
+    default:
+      return LZO1X_1_MEM_COMPRESS;
+    }
+}
+
+/*
+ * log_zip_method_name - get the name of compression method
+ *   return: method name
+ *   method(in): compression method
+ */
+const char *
+log_zip_method_name (LOG_ZIP_METHOD method)
+{
+  switch (method)
+    {
+    case LOG_ZIP_METHOD_LZO1X_1:
+      return "lzo1x_1";
+    case LOG_ZIP_METHOD_LZO1X_1_15:
+      return "lzo1x_1_15";
+    case LOG_ZIP_METHOD_LZO1X_999:
+      return "lzo1x_999";
+    default:
+      assert (false);
+      return "unknown";
+    }
+}
+
+/*
+ * log_zip_set_method - set compression method of LOG_ZIP
+ *   return: true on success, false on failure
+ *   log_zip(in/out): LOG_ZIP structure allocated by log_zip_alloc
+ *   method(in): compression method
+ */
+bool
+log_zip_set_method (LOG_ZIP * log_zip, LOG_ZIP_METHOD method)
+{
+  assert (log_zip != NULL);
+  assert (method >= LOG_ZIP_METHOD_LZO1X_1 && method <= LOG_ZIP_METHOD_LAST);
+
+  if (!log_zip_reserve_wrkmem (log_zip, log_zip_method_wrkmem_size (method)))
+    {
+      return false;
+    }
+  log_zip->method = method;
+
+  return true;
+}
+
+/*
+ * log_zip_internal - compress(zip) log data into LOG_ZIP, optionally with a dictionary
+ *   return: true on success, false on failure
+ *   log_zip(in/out): LOG_ZIP structure allocated by log_zip_alloc
+ *   length(in): length of given data
+ *   data(in): log data to be compressed
+ *   dict_length(in): length of dictionary
+ *   dict(in): dictionary or NULL
+ */
+static bool
+log_zip_internal (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data, LOG_ZIP_SIZE_T dict_length,
+		  const void *dict)
+{
+  lzo_uint zip_len = 0;
+  LOG_ZIP_SIZE_T org_len;
+  lzo_bytep zip_data;
+  int rc;
+
+  assert (length > 0 && data != NULL);
+  assert (log_zip != NULL);
+
+  log_zip->data_length = 0;
+
+  if (!log_zip_realloc_data (log_zip, LOG_ZIP_BUF_SIZE (length)))
+    {
+      return false;
+    }
+
   /* save original data length */
-  memcpy (log_zip->log_data, &length, sizeof (LOG_ZIP_SIZE_T));
+  org_len = length;
+  if (dict != NULL)
+    {
+      org_len |= LOG_ZIP_DICT_FLAG;
+    }
+  memcpy (log_zip->log_data, &org_len, sizeof (LOG_ZIP_SIZE_T));
+  zip_data = log_zip->log_data + sizeof (LOG_ZIP_SIZE_T);
+
+  if (dict != NULL)
+    {
+      assert (dict_length > 0);
+
+      /* only lzo1x_999 can compress with a dictionary */
+      if (!log_zip_reserve_wrkmem (log_zip, LZO1X_999_MEM_COMPRESS))
+	{
+	  return false;
+	}
+      if (dict_length > LOG_ZIP_DICT_MAX_SIZE)
+	{
+	  dict = (const char *) dict + (dict_length - LOG_ZIP_DICT_MAX_SIZE);
+	  dict_length = LOG_ZIP_DICT_MAX_SIZE;
+	}
+      /* use the fastest level unless best ratio is requested */
+      rc =
+	lzo1x_999_compress_level ((lzo_bytep) data, (lzo_uint) length, zip_data, &zip_len, log_zip->wrkmem,
+				  (lzo_bytep) dict, (lzo_uint) dict_length, NULL,
+				  log_zip->method == LOG_ZIP_METHOD_LZO1X_999 ? 8 : 1);
+    }
+  else
+    {
+      switch (log_zip->method)
+	{
+	case LOG_ZIP_METHOD_LZO1X_1_15:
+	  rc = lzo1x_1_15_compress ((lzo_bytep) data, (lzo_uint) length, zip_data, &zip_len, log_zip->wrkmem);
+	  break;
+	case LOG_ZIP_METHOD_LZO1X_999:
+	  rc = lzo1x_999_compress ((lzo_bytep) data, (lzo_uint) length, zip_data, &zip_len, log_zip->wrkmem);
+	  break;
+	case LOG_ZIP_METHOD_LZO1X_1:
+	default:
+	  rc = lzo1x_1_compress ((lzo_bytep) data, (lzo_uint) length, zip_data, &zip_len, log_zip->wrkmem);
+	  break;
+	}
+    }
 
-  rc =
-    lzo1x_1_compress ((lzo_bytep) data, (lzo_uint) length, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T), &zip_len,
-		      log_zip->wrkmem);
   if (rc == LZO_E_OK)
     {
       log_zip->data_length = (LOG_ZIP_SIZE_T) zip_len + sizeof (LOG_ZIP_SIZE_T);
@@ -92,6 +252,40 @@ log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
   return false;
 }
 
+/*
+ * log_zip - compress(zip) log data into LOG_ZIP
+ *   return: true on success, false on failure
+ *   log_zip(in/out): LOG_ZIP structure allocated by log_zip_alloc
+ *   length(in): length of given data
+ *   data(in): log data to be compressed
+ */
+bool
+log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
+{
+  return log_zip_internal (log_zip, length, data, 0, NULL);
+}
+
+/*
+ * log_zip_with_dict - compress(zip) log data into LOG_ZIP using a dictionary
+ *   return: true on success, false on failure
+ *   log_zip(in/out): LOG_ZIP structure allocated by log_zip_alloc
+ *   length(in): length of given data
+ *   data(in): log data to be compressed
+ *   dict_length(in): length of dictionary
+ *   dict(in): dictionary; the same dictionary is required by log_unzip_with_dict
+ *
+ * Note: Small data that does not compress on its own may compress well with a dictionary of similar content, e.g. redo
+ *       data using undo data of the same record.
+ */
+bool
+log_zip_with_dict (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data, LOG_ZIP_SIZE_T dict_length,
+		   const void *dict)
+{
+  assert (dict_length > 0 && dict != NULL);
+
+  return log_zip_internal (log_zip, length, data, dict_length, dict);
+}
+
 /*
  * log_unzip - decompress(unzip) log data into LOG_ZIP
  *   return: true on success, false on failure
@@ -101,10 +295,26 @@ log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
  */
 bool
 log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data)
+{
+  return log_unzip_with_dict (log_unzip, length, data, 0, NULL);
+}
+
+/*
+ * log_unzip_with_dict - decompress(unzip) log data into LOG_ZIP
+ *   return: true on success, false on failure
+ *   log_unzip(out): LOG_ZIP structure allocated by log_zip_alloc
+ *   length(in): length of given data
+ *   data(out): compressed log data
+ *   dict_length(in): length of dictionary
+ *   dict(in): dictionary used for compression or NULL. data compressed with a dictionary fails without one.
+ */
+bool
+log_unzip_with_dict (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data, LOG_ZIP_SIZE_T dict_length,
+		     const void *dict)
 {
   lzo_uint unzip_len;
   LOG_ZIP_SIZE_T org_len;
-  LOG_ZIP_SIZE_T buf_size;
+  bool is_dict;
   int rc;
 
   assert (length > 0 && data != NULL);
@@ -112,39 +322,41 @@ log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data)
 
   /* get original legnth from the compressed data */
   memcpy (&org_len, data, sizeof (LOG_ZIP_SIZE_T));
+  is_dict = (org_len & LOG_ZIP_DICT_FLAG) != 0;
+  org_len &= ~LOG_ZIP_DICT_FLAG;
 
   if (org_len <= 0)
     return false;
+  if (is_dict && (dict == NULL || dict_length <= 0))
+    {
+      return false;
+    }
   unzip_len = (lzo_uint) org_len;
-  buf_size = LOG_ZIP_BUF_SIZE (org_len);
   length -= sizeof (LOG_ZIP_SIZE_T);
 
-  if (buf_size > log_unzip->buf_size)
+  if (!log_zip_realloc_data (log_unzip, LOG_ZIP_BUF_SIZE (org_len)))
     {
-      if (log_unzip->log_data)
-	{
-	  free_and_init (log_unzip->log_data);
-	}
+      return false;
+    }
 
-      log_unzip->log_data = (unsigned char *) malloc (buf_size);
-      if (log_unzip->log_data == NULL)
+  if (is_dict)
+    {
+      if (dict_length > LOG_ZIP_DICT_MAX_SIZE)
 	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) buf_size);
+	  dict = (const char *) dict + (dict_length - LOG_ZIP_DICT_MAX_SIZE);
+	  dict_length = LOG_ZIP_DICT_MAX_SIZE;
 	}
-      log_unzip->buf_size = buf_size;
+      rc =
+	lzo1x_decompress_dict_safe ((lzo_bytep) data + sizeof (LOG_ZIP_SIZE_T), (lzo_uint) length,
+				    log_unzip->log_data, &unzip_len, NULL, (lzo_bytep) dict, (lzo_uint) dict_length);
     }
-
-  if (log_unzip->log_data == NULL)
+  else
     {
-      log_unzip->data_length = 0;
-      log_unzip->buf_size = 0;
-      return false;
+      rc =
+	lzo1x_decompress_safe ((lzo_bytep) data + sizeof (LOG_ZIP_SIZE_T), (lzo_uint) length, log_unzip->log_data,
+			       &unzip_len, NULL);
     }
 
-  rc =
-    lzo1x_decompress_safe ((lzo_bytep) data + sizeof (LOG_ZIP_SIZE_T), (lzo_uint) length, log_unzip->log_data,
-			   &unzip_len, NULL);
-
   if (rc == LZO_E_OK)
     {
       log_unzip->data_length = (LOG_ZIP_SIZE_T) unzip_len;
@@ -157,6 +369,41 @@ log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data)
   return false;
 }
 
+/*
+ * log_unzip_diff - decompress(unzip) redo data of a diff undoredo log record into LOG_ZIP
+ *   return: true on success, false on failure
+ *   redo_unzip(out): LOG_ZIP structure allocated by log_zip_alloc
+ *   length(in): length of given data
+ *   data(in): compressed redo data
+ *   undo_length(in): length of undo data
+ *   undo_data(in): uncompressed undo data of the same log record
+ *
+ * Note: Redo data was either XORed with undo data before compression (see log_diff) or compressed using undo data as
+ *       dictionary.
+ */
+bool
+log_unzip_diff (LOG_ZIP * redo_unzip, LOG_ZIP_SIZE_T length, void *data, LOG_ZIP_SIZE_T undo_length,
+		const void *undo_data)
+{
+  LOG_ZIP_SIZE_T org_len;
+
+  assert (length > 0 && data != NULL);
+
+  memcpy (&org_len, data, sizeof (LOG_ZIP_SIZE_T));
+  if (org_len & LOG_ZIP_DICT_FLAG)
+    {
+      return log_unzip_with_dict (redo_unzip, length, data, undo_length, undo_data);
+    }
+
+  if (!log_unzip (redo_unzip, length, data))
+    {
+      return false;
+    }
+  (void) log_diff (undo_length, undo_data, redo_unzip->data_length, redo_unzip->log_data);
+
+  return true;
+}
+
 /*
  * log_diff - make log diff - redo data XORed with undo data
  *   return: true
@@ -220,22 +467,20 @@ log_zip_alloc (LOG_ZIP_SIZE_T size, bool is_zip)
     }
   log_zip->buf_size = buf_size;
 
+  log_zip->method = LOG_ZIP_METHOD_LZO1X_1;
+  log_zip->wrkmem = NULL;
+  log_zip->wrkmem_size = 0;
+
   if (is_zip)
     {
-      /* lzo method is best speed : LZO1X_1_MEM_COMPRESS */
-      log_zip->wrkmem = (lzo_bytep) malloc (LZO1X_1_MEM_COMPRESS);
-      if (log_zip->wrkmem == NULL)
+      /* lzo method is best speed : LZO1X_1_MEM_COMPRESS. see log_zip_set_method for others. */
+      if (!log_zip_reserve_wrkmem (log_zip, LZO1X_1_MEM_COMPRESS))
 	{
 	  free_and_init (log_zip->log_data);
 	  free_and_init (log_zip);
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) LZO1X_1_MEM_COMPRESS);
 	  return NULL;
 	}
     }
-  else
-    {
-      log_zip->wrkmem = NULL;
-    }
 
   return log_zip;
 }
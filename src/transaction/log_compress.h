@@ -47,6 +47,25 @@
 
 #define LOG_ZIP_SIZE_T int
 
+/* flag in the original length saved ahead of compressed data; set if data was compressed with a dictionary */
+#define LOG_ZIP_DICT_FLAG ((LOG_ZIP_SIZE_T) 0x40000000)
+
+/* the longest dictionary lzo1x can use; longer dictionaries are cut to their tail */
+#define LOG_ZIP_DICT_MAX_SIZE 0xbfff
+
+/*
+ * Compression methods. All produce lzo1x data, so any of them is decompressed the same way and the method can be
+ * changed between restarts.
+ */
+typedef enum
+{
+  LOG_ZIP_METHOD_LZO1X_1 = 0,	/* fast */
+  LOG_ZIP_METHOD_LZO1X_1_15,	/* fastest, uses more working memory */
+  LOG_ZIP_METHOD_LZO1X_999,	/* best ratio, slow compression */
+
+  LOG_ZIP_METHOD_LAST = LOG_ZIP_METHOD_LZO1X_999
+} LOG_ZIP_METHOD;
+
 /*
  * Compressed(zipped) log structure
  */
@@ -58,13 +77,23 @@ struct log_zip
   LOG_ZIP_SIZE_T buf_size;	/* size of log_zip data buffer */
   lzo_bytep log_data;		/* compressed/uncompressed log_zip data (used as data buffer) */
   lzo_bytep wrkmem;		/* wokring memory for lzo function */
+  size_t wrkmem_size;		/* size of working memory */
+  LOG_ZIP_METHOD method;	/* compression method */
 };
 
 extern LOG_ZIP *log_zip_alloc (LOG_ZIP_SIZE_T size, bool is_zip);
 extern void log_zip_free (LOG_ZIP * log_zip);
+extern bool log_zip_set_method (LOG_ZIP * log_zip, LOG_ZIP_METHOD method);
+extern const char *log_zip_method_name (LOG_ZIP_METHOD method);
 
 extern bool log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data);
+extern bool log_zip_with_dict (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data, LOG_ZIP_SIZE_T dict_length,
+			       const void *dict);
 extern bool log_unzip (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data);
+extern bool log_unzip_with_dict (LOG_ZIP * log_unzip, LOG_ZIP_SIZE_T length, void *data, LOG_ZIP_SIZE_T dict_length,
+				 const void *dict);
+extern bool log_unzip_diff (LOG_ZIP * redo_unzip, LOG_ZIP_SIZE_T length, void *data, LOG_ZIP_SIZE_T undo_length,
+			    const void *undo_data);
 extern bool log_diff (LOG_ZIP_SIZE_T undo_length, const void *undo_data, LOG_ZIP_SIZE_T redo_length, void *redo_data);
 
 #endif /* _LOG_COMPRESS_H_ */
@@ -312,16 +312,28 @@ struct log_flush_info
 #endif				/* SERVER_MODE */
 };
 
+typedef struct log_group_commit_waiter LOG_GROUP_COMMIT_WAITER;
+struct log_group_commit_waiter
+{
+  THREAD_ENTRY *thread_p;	/* Suspended committing thread. */
+  LOG_LSA flush_lsa;		/* The thread is woken up when log is flushed up to this LSA. */
+  LOG_GROUP_COMMIT_WAITER *next;
+};
+
 typedef struct log_group_commit_info LOG_GROUP_COMMIT_INFO;
 struct log_group_commit_info
 {
   /* group commit waiters count */
   pthread_mutex_t gc_mutex;
   pthread_cond_t gc_cond;
+
+  /* leader/follower group commit; protected by gc_mutex */
+  bool has_leader;		/* True if a committing thread flushes log for the group. */
+  LOG_GROUP_COMMIT_WAITER *followers;	/* Committing threads waiting for the leader to flush their LSA. */
 };
 
 #define LOG_GROUP_COMMIT_INFO_INITIALIZER \
-  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER }
+  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, false, NULL }
 
 
 
@@ -755,6 +767,9 @@ typedef struct log_logging_stat
   /* flush count in group commit mode by LFT */
   unsigned long gc_flush_count;
 
+  /* flush count by group commit leaders */
+  unsigned long gc_leader_flush_count;
+
   /* async commit request count */
   unsigned long async_commit_request_count;
 } LOG_LOGGING_STAT;
@@ -830,6 +845,9 @@ extern int logpb_fetch_start_append_page (THREAD_ENTRY * thread_p);
 extern LOG_PAGE *logpb_fetch_start_append_page_new (THREAD_ENTRY * thread_p);
 extern void logpb_flush_pages_direct (THREAD_ENTRY * thread_p);
 extern void logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa);
+#if defined (SERVER_MODE)
+extern int logpb_wakeup_group_commit_followers (void);
+#endif /* SERVER_MODE */
 extern void logpb_force_flush_pages (THREAD_ENTRY * thread_p);
 extern void logpb_force_flush_header_and_pages (THREAD_ENTRY * thread_p);
 extern void logpb_invalid_all_append_pages (THREAD_ENTRY * thread_p);
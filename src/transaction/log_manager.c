@@ -9859,6 +9859,7 @@ log_flush_execute (cubthread::entry & thread_ref)
 
   pthread_mutex_lock (&log_Gl.group_commit_info.gc_mutex);
   pthread_cond_broadcast (&log_Gl.group_commit_info.gc_cond);
+  (void) logpb_wakeup_group_commit_followers ();
   log_Flush_has_been_requested = false;
   pthread_mutex_unlock (&log_Gl.group_commit_info.gc_mutex);
 }
@@ -334,6 +334,7 @@ static int logpb_add_archive_page_info (THREAD_ENTRY * thread_p, int arv_num, LO
 static int logpb_get_archive_num_from_info_table (THREAD_ENTRY * thread_p, LOG_PAGEID page_id);
 
 static int logpb_flush_all_append_pages (THREAD_ENTRY * thread_p);
+static int logpb_flush_all_append_pages_low (THREAD_ENTRY * thread_p);
 static int logpb_append_next_record (THREAD_ENTRY * thread_p, LOG_PRIOR_NODE * ndoe);
 
 static void logpb_start_append (THREAD_ENTRY * thread_p, LOG_RECORD_HEADER * header);
@@ -362,6 +363,12 @@ static bool logpb_is_log_active_from_backup_useful (THREAD_ENTRY * thread_p, con
 						    const char *db_full_name);
 static int logpb_peek_header_of_active_log_from_backup (THREAD_ENTRY * thread_p, const char *active_log_path,
 							LOG_HEADER * hdr);
+#if defined (SERVER_MODE)
+static void logpb_group_commit_wait (THREAD_ENTRY * thread_p, const LOG_LSA * flush_lsa, bool group_commit);
+static void logpb_group_commit_lead (THREAD_ENTRY * thread_p, bool group_commit);
+static void logpb_group_commit_remove_follower (LOG_GROUP_COMMIT_WAITER * waiter);
+static void logpb_group_commit_handover (void);
+#endif /* SERVER_MODE */
 
 /*
  * FUNCTIONS RELATED TO LOG BUFFERING
@@ -632,6 +639,8 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
 
   pthread_cond_init (&group_commit_info->gc_cond, NULL);
   pthread_mutex_init (&group_commit_info->gc_mutex, NULL);
+  group_commit_info->has_leader = false;
+  group_commit_info->followers = NULL;
 
   pthread_mutex_init (&writer_info->wr_list_mutex, NULL);
 
@@ -3014,13 +3023,42 @@ logpb_page_get_first_null_block_lsa (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgp
 }
 
 /*
- * logpb_flush_all_append_pages - Flush log append pages
+ * logpb_flush_all_append_pages - Flush log append pages and time the flush
  *
  * return: 1 : log flushed, 0 : do not need log flush, < 0 : error code
  *
  */
 static int
 logpb_flush_all_append_pages (THREAD_ENTRY * thread_p)
+{
+  TSC_TICKS start_tick, end_tick;
+  bool is_timed;
+  int ret;
+
+  is_timed = perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LATENCY_HISTOGRAM);
+  if (is_timed)
+    {
+      tsc_getticks (&start_tick);
+    }
+
+  ret = logpb_flush_all_append_pages_low (thread_p);
+
+  if (is_timed && ret == 1)
+    {
+      tsc_getticks (&end_tick);
+      perfmon_time_latency (PERF_LATENCY_LOG_FLUSH, tsc_elapsed_utime (end_tick, start_tick));
+    }
+  return ret;
+}
+
+/*
+ * logpb_flush_all_append_pages_low - Flush log append pages
+ *
+ * return: 1 : log flushed, 0 : do not need log flush, < 0 : error code
+ *
+ */
+static int
+logpb_flush_all_append_pages_low (THREAD_ENTRY * thread_p)
 {
   LOG_BUFFER *bufptr = NULL;	/* The current buffer log append page scanned */
   LOG_BUFFER *prv_bufptr = NULL;	/* The previous buffer log append page scanned */
@@ -3781,6 +3819,9 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
   bool async_commit, group_commit;
   LOG_LSA nxio_lsa;
   LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  struct timeval wait_start_time = { 0, 0 };
+  struct timeval wait_end_time = { 0, 0 };
+  UINT64 wait_usec;
 
   assert (flush_lsa != NULL && !LSA_ISNULL (flush_lsa));
 
@@ -3843,6 +3884,21 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
     {
       log_wakeup_log_flush_daemon ();
     }
+  else if (need_wait == true && prm_get_bool_value (PRM_ID_LOG_GROUP_COMMIT_LEADER_FLUSH))
+    {
+      gettimeofday (&wait_start_time, NULL);
+
+      logpb_group_commit_wait (thread_p, flush_lsa, group_commit);
+
+      gettimeofday (&wait_end_time, NULL);
+      wait_usec = ((UINT64) (wait_end_time.tv_sec - wait_start_time.tv_sec) * 1000000
+		   + wait_end_time.tv_usec - wait_start_time.tv_usec);
+      if (group_commit)
+	{
+	  log_Stat.gc_total_wait_time += (double) wait_usec / 1000000;
+	}
+      perfmon_time_latency (PERF_LATENCY_LOG_GROUP_COMMIT, wait_usec);
+    }
   else if (need_wait == true)
     {
       nxio_lsa = log_Gl.append.get_nxio_lsa ();
@@ -3880,6 +3936,205 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 #endif /* SERVER_MODE */
 }
 
+#if defined (SERVER_MODE)
+/*
+ * logpb_group_commit_wait - wait until log is flushed up to the commit LSA, as leader or follower of a commit group
+ *
+ * return: nothing
+ *
+ *   flush_lsa(in): LSA of the commit log record
+ *   group_commit(in): true if group commit is active
+ *
+ * NOTE: Only one committing thread flushes log at a time (the leader). Committing threads arriving while a leader
+ *       flushes are linked as followers and suspended until log is flushed up to their own LSA; they are not woken up
+ *       by flushes that do not cover them. When the leader finishes, it wakes up covered followers and hands over
+ *       leadership to a follower that is not covered yet. If another flush covers that follower before it runs, it
+ *       passes leadership on to the next follower when it leaves.
+ */
+static void
+logpb_group_commit_wait (THREAD_ENTRY * thread_p, const LOG_LSA * flush_lsa, bool group_commit)
+{
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  LOG_GROUP_COMMIT_WAITER waiter;
+  LOG_LSA nxio_lsa;
+  struct timeval start_time = { 0, 0 };
+  struct timeval tmp_timeval = { 0, 0 };
+  struct timespec to = { 0, 0 };
+  int max_wait_time_in_msec = 1000;
+
+  waiter.thread_p = thread_p;
+  LSA_COPY (&waiter.flush_lsa, flush_lsa);
+  waiter.next = NULL;
+
+  while (true)
+    {
+      pthread_mutex_lock (&group_commit_info->gc_mutex);
+      nxio_lsa = log_Gl.append.get_nxio_lsa ();
+      if (LSA_GE (&nxio_lsa, flush_lsa))
+	{
+	  /* Leadership may have been handed over to this thread; do not leave the others without a leader. */
+	  logpb_group_commit_handover ();
+	  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+	  return;
+	}
+
+      if (!group_commit_info->has_leader)
+	{
+	  /* Lead the group. */
+	  group_commit_info->has_leader = true;
+	  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+
+	  logpb_group_commit_lead (thread_p, group_commit);
+	  continue;
+	}
+
+      /* Follow current leader. Lock own entry before releasing gc_mutex, so the wakeup cannot be missed. */
+      thread_lock_entry (thread_p);
+      waiter.next = group_commit_info->followers;
+      group_commit_info->followers = &waiter;
+      pthread_mutex_unlock (&group_commit_info->gc_mutex);
+
+      gettimeofday (&start_time, NULL);
+      (void) timeval_add_msec (&tmp_timeval, &start_time, max_wait_time_in_msec);
+      (void) timeval_to_timespec (&to, &tmp_timeval);
+
+      (void) thread_suspend_timeout_wakeup_and_unlock_entry (thread_p, &to, THREAD_LOG_GROUP_COMMIT_SUSPENDED);
+      if (thread_p->resume_status != THREAD_LOG_GROUP_COMMIT_RESUMED)
+	{
+	  /* Timed out; the leader may still see the waiter. */
+	  pthread_mutex_lock (&group_commit_info->gc_mutex);
+	  logpb_group_commit_remove_follower (&waiter);
+	  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+	}
+    }
+}
+
+/*
+ * logpb_group_commit_lead - flush log for the commit group and wake up the followers
+ *
+ * return: nothing
+ *
+ *   group_commit(in): true if group commit is active; the leader waits group commit interval for more followers
+ *                     before flushing
+ */
+static void
+logpb_group_commit_lead (THREAD_ENTRY * thread_p, bool group_commit)
+{
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  int batch_size;
+
+  assert (group_commit_info->has_leader);
+
+  if (group_commit && !pgbuf_has_perm_pages_fixed (thread_p))
+    {
+      /* Let more committing threads join the group. */
+      thread_sleep (prm_get_integer_value (PRM_ID_LOG_GROUP_COMMIT_INTERVAL_MSECS));
+    }
+
+  LOG_CS_ENTER (thread_p);
+  logpb_flush_pages_direct (thread_p);
+  LOG_CS_EXIT (thread_p);
+
+  log_Stat.gc_leader_flush_count++;
+
+  pthread_mutex_lock (&group_commit_info->gc_mutex);
+  group_commit_info->has_leader = false;
+  batch_size = 1 + logpb_wakeup_group_commit_followers ();
+  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+
+  perfmon_count_histogram (PERF_LATENCY_LOG_GROUP_COMMIT_BATCH, batch_size);
+}
+
+/*
+ * logpb_group_commit_remove_follower - unlink a follower that stopped waiting
+ *
+ * return: nothing
+ *
+ *   waiter(in): follower to unlink; nothing happens if it was already unlinked
+ *
+ * NOTE: gc_mutex must be held.
+ */
+static void
+logpb_group_commit_remove_follower (LOG_GROUP_COMMIT_WAITER * waiter)
+{
+  LOG_GROUP_COMMIT_WAITER **prev_p;
+
+  for (prev_p = &log_Gl.group_commit_info.followers; *prev_p != NULL; prev_p = &(*prev_p)->next)
+    {
+      if (*prev_p == waiter)
+	{
+	  *prev_p = waiter->next;
+	  waiter->next = NULL;
+	  return;
+	}
+    }
+}
+
+/*
+ * logpb_group_commit_handover - hand over leadership to the first follower when the group has no leader
+ *
+ * return: nothing
+ *
+ * NOTE: gc_mutex must be held. The follower is unlinked and woken up; it leads unless it finds itself covered by then,
+ *       in which case it calls this again.
+ */
+static void
+logpb_group_commit_handover (void)
+{
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  LOG_GROUP_COMMIT_WAITER *next_leader;
+
+  next_leader = group_commit_info->followers;
+  if (group_commit_info->has_leader || next_leader == NULL)
+    {
+      return;
+    }
+
+  group_commit_info->followers = next_leader->next;
+  next_leader->next = NULL;
+  thread_wakeup (next_leader->thread_p, THREAD_LOG_GROUP_COMMIT_RESUMED);
+}
+
+/*
+ * logpb_wakeup_group_commit_followers - wake up group commit followers whose commit LSA is flushed
+ *
+ * return: number of woken up followers whose commit LSA is flushed
+ *
+ * NOTE: gc_mutex must be held. If no thread leads the group, leadership is handed over to a follower that is not
+ *       covered yet, so it does not wait for the timeout.
+ */
+int
+logpb_wakeup_group_commit_followers (void)
+{
+  LOG_GROUP_COMMIT_WAITER **prev_p;
+  LOG_GROUP_COMMIT_WAITER *waiter;
+  LOG_LSA nxio_lsa;
+  int count = 0;
+
+  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+
+  prev_p = &log_Gl.group_commit_info.followers;
+  while (*prev_p != NULL)
+    {
+      waiter = *prev_p;
+      if (LSA_LT (&nxio_lsa, &waiter->flush_lsa))
+	{
+	  prev_p = &waiter->next;
+	  continue;
+	}
+
+      *prev_p = waiter->next;
+      waiter->next = NULL;
+      thread_wakeup (waiter->thread_p, THREAD_LOG_GROUP_COMMIT_RESUMED);
+      count++;
+    }
+
+  logpb_group_commit_handover ();
+
+  return count;
+}
+#endif /* SERVER_MODE */
+
 void
 logpb_force_flush_pages (THREAD_ENTRY * thread_p)
 {
@@ -10616,6 +10871,8 @@ logpb_dump_runtime (FILE * outfp)
 
   fprintf (outfp, "\tgroup commit flush count= %ld\n", log_Stat.gc_flush_count);
 
+  fprintf (outfp, "\tgroup commit leader flush count= %ld\n", log_Stat.gc_leader_flush_count);
+
   fprintf (outfp, "\tdirect flush count= %ld\n", log_Stat.direct_flush_count);
 
   fprintf (outfp, "\tgroup commit request count = %ld\n", log_Stat.gc_commit_request_count);
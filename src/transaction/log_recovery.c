@@ -32,6 +32,12 @@
 #include <time.h>
 #include <assert.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
 #include "log_2pc.h"
 #include "log_append.hpp"
 #include "log_impl.h"
@@ -52,8 +58,78 @@
 #include "page_buffer.h"
 #include "porting_inline.hpp"
 #include "log_compress.h"
+#include "perf_monitor.h"
 #include "thread_entry.hpp"
+#include "thread_entry_task.hpp"
 #include "thread_manager.hpp"
+#include "thread_worker_pool.hpp"
+
+/* disk manager records change the sector tables consulted by log_rv_redo_fix_page; they are never redone in
+ * parallel. */
+#define LOG_RV_REDO_IS_DISK_RCVINDEX(idx) ((idx) >= RVDK_NEWVOL && (idx) <= RVDK_VOLHEAD_EXPAND)
+
+/* maximum number of redo records packed in one parallel redo task */
+#define LOG_RV_REDO_TASK_MAX_JOBS 64
+/* maximum number of parallel redo tasks pushed but not yet executed, per worker */
+#define LOG_RV_REDO_MAX_PENDING_TASKS_PER_WORKER 16
+
+// *INDENT-OFF*
+/* one page redo record handed over to a parallel redo worker. undo data (for diff records) and redo data are
+ * copied in the buffer of the owning task, starting at data_offset. */
+struct log_rv_redo_job
+{
+  LOG_LSA rcv_lsa;
+  VPID vpid;
+  LOG_RCVINDEX rcvindex;
+  bool is_compensate;
+  MVCCID mvccid;
+  PGLENGTH offset;
+  int length;			/* length of redo data; may have the zip flag set */
+  int undo_length;		/* length of undo data for diff records, 0 otherwise */
+  std::size_t data_offset;
+};
+
+class log_rv_redo_task;
+
+/* parallel redo: records of a page are always dispatched to the same worker and each worker executes its tasks in the
+ * order they were pushed, which preserves the LSA order of the redo records for every page. */
+class log_rv_redo_context : public cubthread::entry_manager
+{
+  public:
+    cubthread::entry_workpool *m_workpool;
+    std::size_t m_worker_count;
+    std::vector<log_rv_redo_task *> m_open_tasks;	// task being filled for each worker
+    std::uint64_t m_tasks_pushed;			// changed only by the dispatcher
+    std::uint64_t m_tasks_executed;			// protected by m_mutex
+    std::mutex m_mutex;
+    std::condition_variable m_task_executed_cond;
+    std::atomic<std::uint64_t> m_records_applied;
+
+    log_rv_redo_context ();
+
+  protected:
+    void on_create (context_type &context) override;
+    void on_retire (context_type &context) override;
+    void on_recycle (context_type &context) override;
+};
+
+class log_rv_redo_task : public cubthread::entry_task
+{
+  public:
+    log_rv_redo_task () = delete;
+    log_rv_redo_task (log_rv_redo_context &context);
+
+    char *add_job (const log_rv_redo_job &job, std::size_t data_size);
+    bool is_full () const;
+
+    void execute (cubthread::entry &thread_ref) override;
+
+  private:
+    log_rv_redo_context &m_context;
+    std::vector<log_rv_redo_job> m_jobs;
+    std::vector<char> m_data;
+};
+// *INDENT-ON*
 
 static void log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				LOG_RCVINDEX rcvindex, const VPID * rcv_vpid, LOG_RCV * rcv,
@@ -61,6 +137,9 @@ static void log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_
 static void log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
 				LOG_LSA * rcv_lsa_ptr, int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
+static void log_rv_redo_record_apply (THREAD_ENTRY * thread_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *),
+				      LOG_RCV * rcv, const LOG_LSA * rcv_lsa_ptr, bool is_zip, int undo_length,
+				      char *undo_data, LOG_ZIP * redo_unzip_ptr);
 static bool log_rv_find_checkpoint (THREAD_ENTRY * thread_p, VOLID volid, LOG_LSA * rcv_lsa);
 static bool log_rv_get_unzip_log_data (THREAD_ENTRY * thread_p, int length, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				       LOG_ZIP * undo_unzip_ptr);
@@ -133,6 +212,21 @@ STATIC_INLINE PAGE_PTR log_rv_redo_fix_page (THREAD_ENTRY * thread_p, const VPID
 static void log_rv_simulate_runtime_worker (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
 static void log_rv_end_simulation (THREAD_ENTRY * thread_p);
 
+static log_rv_redo_context *log_rv_redo_parallel_start (THREAD_ENTRY * thread_p);
+static void log_rv_redo_parallel_push_task (log_rv_redo_context * context, std::size_t worker_index);
+static void log_rv_redo_parallel_wait (log_rv_redo_context * context);
+static UINT64 log_rv_redo_parallel_finish (log_rv_redo_context * context);
+static bool log_rv_redo_parallel_prepare (log_rv_redo_context * context, const VPID * rcv_vpid,
+					  LOG_RCVINDEX rcvindex);
+static void log_rv_redo_parallel_dispatch (THREAD_ENTRY * thread_p, log_rv_redo_context * context,
+					   const LOG_RCV * rcv, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex,
+					   bool is_compensate, const LOG_LSA * rcv_lsa, LOG_LSA * log_lsa,
+					   LOG_PAGE * log_page_p, const LOG_ZIP * undo_diff_ptr);
+// *INDENT-OFF*
+static void log_rv_redo_update_stats (THREAD_ENTRY * thread_p, UINT64 num_redo_records,
+                                      std::chrono::steady_clock::time_point start_time);
+// *INDENT-ON*
+
 /*
  * CRASH RECOVERY PROCESS
  */
@@ -435,7 +529,6 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
 {
   char *area = NULL;
   bool is_zip = false;
-  int error_code;
 
   /* Note the the data page rcv->pgptr has been fetched by the caller */
 
@@ -469,21 +562,54 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
       rcv->data = area;
     }
 
+  log_rv_redo_record_apply (thread_p, redofun, rcv, rcv_lsa_ptr, is_zip, undo_length, undo_data, redo_unzip_ptr);
+
+  if (area != NULL)
+    {
+      free_and_init (area);
+    }
+}
+
+/*
+ * log_rv_redo_record_apply - apply redo data that is already contiguous in memory
+ *
+ * return: nothing
+ *
+ *   redofun(in): Function to invoke to redo the data
+ *   rcv(in/out): Recovery structure; rcv->data and rcv->length describe the (zipped) redo data
+ *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
+ *   is_zip(in): true if redo data is compressed
+ *   undo_length(in): length of undo data for diff records
+ *   undo_data(in): undo data for diff records
+ *   redo_unzip_ptr(in): buffer used to unzip redo data
+ *
+ * NOTE: Shared by log_rv_redo_record and the parallel redo workers.
+ */
+static void
+log_rv_redo_record_apply (THREAD_ENTRY * thread_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
+			  const LOG_LSA * rcv_lsa_ptr, bool is_zip, int undo_length, char *undo_data,
+			  LOG_ZIP * redo_unzip_ptr)
+{
+  int error_code;
+
   if (is_zip)
     {
-      if (log_unzip (redo_unzip_ptr, rcv->length, (char *) rcv->data))
+      bool is_unzipped;
+
+      if ((undo_length > 0) && (undo_data != NULL))
 	{
-	  if ((undo_length > 0) && (undo_data != NULL))
-	    {
-	      (void) log_diff (undo_length, undo_data, redo_unzip_ptr->data_length, redo_unzip_ptr->log_data);
-	      rcv->length = (int) redo_unzip_ptr->data_length;
-	      rcv->data = (char *) redo_unzip_ptr->log_data;
-	    }
-	  else
-	    {
-	      rcv->length = (int) redo_unzip_ptr->data_length;
-	      rcv->data = (char *) redo_unzip_ptr->log_data;
-	    }
+	  /* redo data of diff record was XORed with or compressed against undo data */
+	  is_unzipped = log_unzip_diff (redo_unzip_ptr, rcv->length, (char *) rcv->data, undo_length, undo_data);
+	}
+      else
+	{
+	  is_unzipped = log_unzip (redo_unzip_ptr, rcv->length, (char *) rcv->data);
+	}
+
+      if (is_unzipped)
+	{
+	  rcv->length = (int) redo_unzip_ptr->data_length;
+	  rcv->data = (char *) redo_unzip_ptr->log_data;
 	}
       else
 	{
@@ -525,11 +651,6 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     {
       (void) pgbuf_set_lsa (thread_p, rcv->pgptr, rcv_lsa_ptr);
     }
-
-  if (area != NULL)
-    {
-      free_and_init (area);
-    }
 }
 
 /*
@@ -3002,6 +3123,362 @@ log_recovery_needs_skip_logical_redo (THREAD_ENTRY * thread_p, TRANID tran_id, L
   return false;
 }
 
+/*
+ * log_rv_redo_parallel_start () - create the parallel redo workers
+ *
+ * return        : parallel redo context or NULL if redo is executed by the current thread only
+ * thread_p (in) : thread entry
+ *
+ * NOTE: the number of workers is given by recovery_redo_worker_count. the pool borrows its thread entries from the
+ *       transaction workers budget, which is not used before the server starts accepting connections.
+ */
+static log_rv_redo_context *
+log_rv_redo_parallel_start (THREAD_ENTRY * thread_p)
+{
+#if defined (SERVER_MODE)
+  log_rv_redo_context *context;
+  int worker_count = prm_get_integer_value (PRM_ID_RECOVERY_REDO_WORKER_COUNT);
+
+  if (worker_count <= 1)
+    {
+      return NULL;
+    }
+
+  context = new log_rv_redo_context ();
+  context->m_worker_count = (std::size_t) worker_count;
+  context->m_open_tasks.assign (context->m_worker_count, NULL);
+
+  /* one worker per core; tasks pushed on a core are executed in order by its only worker */
+  context->m_workpool =
+    thread_get_manager ()->create_worker_pool (context->m_worker_count,
+					       context->m_worker_count * LOG_RV_REDO_MAX_PENDING_TASKS_PER_WORKER,
+					       "recovery redo workers", context, context->m_worker_count, false);
+  if (context->m_workpool == NULL)
+    {
+      er_log_debug (ARG_FILE_LINE, "log_rv_redo_parallel_start: could not create %d redo workers. "
+		    "redo is executed serially.\n", worker_count);
+      delete context;
+      return NULL;
+    }
+
+  return context;
+#else /* !SERVER_MODE */
+  return NULL;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * log_rv_redo_parallel_push_task () - push the task being filled for a worker
+ *
+ * return            : void
+ * context (in)      : parallel redo context
+ * worker_index (in) : index of worker
+ */
+static void
+log_rv_redo_parallel_push_task (log_rv_redo_context * context, std::size_t worker_index)
+{
+  log_rv_redo_task *task = context->m_open_tasks[worker_index];
+
+  if (task == NULL)
+    {
+      return;
+    }
+  context->m_open_tasks[worker_index] = NULL;
+
+  /* do not let the dispatcher run too far ahead of the workers */
+  {
+    // *INDENT-OFF*
+    std::unique_lock<std::mutex> ulock (context->m_mutex);
+    context->m_task_executed_cond.wait (ulock, [context] {
+      return context->m_tasks_pushed - context->m_tasks_executed
+             < context->m_worker_count * LOG_RV_REDO_MAX_PENDING_TASKS_PER_WORKER;
+    });
+    // *INDENT-ON*
+  }
+
+  context->m_tasks_pushed++;
+  thread_get_manager ()->push_task_on_core (context->m_workpool, task, worker_index);
+}
+
+/*
+ * log_rv_redo_parallel_wait () - push all pending redo records and wait until workers apply them
+ *
+ * return       : void
+ * context (in) : parallel redo context
+ */
+static void
+log_rv_redo_parallel_wait (log_rv_redo_context * context)
+{
+  std::size_t worker_index;
+
+  for (worker_index = 0; worker_index < context->m_worker_count; worker_index++)
+    {
+      log_rv_redo_parallel_push_task (context, worker_index);
+    }
+
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (context->m_mutex);
+  context->m_task_executed_cond.wait (ulock, [context] {
+    return context->m_tasks_executed == context->m_tasks_pushed;
+  });
+  // *INDENT-ON*
+}
+
+/*
+ * log_rv_redo_parallel_finish () - wait for all redo records and destroy the parallel redo workers
+ *
+ * return       : number of redo records applied by workers
+ * context (in) : parallel redo context
+ */
+static UINT64
+log_rv_redo_parallel_finish (log_rv_redo_context * context)
+{
+  UINT64 records_applied;
+
+  log_rv_redo_parallel_wait (context);
+
+  thread_get_manager ()->destroy_worker_pool (context->m_workpool);
+  records_applied = context->m_records_applied;
+  delete context;
+
+  return records_applied;
+}
+
+/*
+ * log_rv_redo_parallel_prepare () - decide whether a redo record is applied by the parallel redo workers
+ *
+ * return        : true if record must be dispatched to workers, false if it must be applied by current thread
+ * context (in)  : parallel redo context or NULL
+ * rcv_vpid (in) : page of redo record
+ * rcvindex (in) : recovery index of redo record
+ *
+ * NOTE: logical records and disk manager records are applied by the current thread after all previous records have
+ *       been applied by workers.
+ */
+static bool
+log_rv_redo_parallel_prepare (log_rv_redo_context * context, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex)
+{
+  if (context == NULL)
+    {
+      return false;
+    }
+
+  if (!RCV_IS_LOGICAL_LOG (rcv_vpid, rcvindex) && !LOG_RV_REDO_IS_DISK_RCVINDEX (rcvindex))
+    {
+      return true;
+    }
+
+  log_rv_redo_parallel_wait (context);
+  return false;
+}
+
+/*
+ * log_rv_redo_parallel_dispatch () - copy a page redo record and queue it to the worker owning its page
+ *
+ * return             : void
+ * thread_p (in)      : thread entry
+ * context (in)       : parallel redo context
+ * rcv (in)           : recovery structure with offset, length and mvccid of the record
+ * rcv_vpid (in)      : page of redo record
+ * rcvindex (in)      : recovery index
+ * is_compensate (in) : true to apply undo function of a compensate record
+ * rcv_lsa (in)       : LSA of redo record
+ * log_lsa (in/out)   : address of redo data; set to the end of redo data
+ * log_page_p (in/out): log page of redo data
+ * undo_diff_ptr (in) : unzipped undo data for diff records or NULL
+ */
+static void
+log_rv_redo_parallel_dispatch (THREAD_ENTRY * thread_p, log_rv_redo_context * context, const LOG_RCV * rcv,
+			       const VPID * rcv_vpid, LOG_RCVINDEX rcvindex, bool is_compensate,
+			       const LOG_LSA * rcv_lsa, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+			       const LOG_ZIP * undo_diff_ptr)
+{
+  log_rv_redo_job job;
+  std::size_t worker_index;
+  int redo_length;
+  char *data;
+
+  job.rcv_lsa = *rcv_lsa;
+  job.vpid = *rcv_vpid;
+  job.rcvindex = rcvindex;
+  job.is_compensate = is_compensate;
+  job.mvccid = rcv->mvcc_id;
+  job.offset = rcv->offset;
+  job.length = rcv->length;
+  job.undo_length = undo_diff_ptr != NULL ? (int) undo_diff_ptr->data_length : 0;
+
+  redo_length = (int) GET_ZIP_LEN (rcv->length);
+
+  worker_index = ((std::size_t) rcv_vpid->pageid ^ ((std::size_t) rcv_vpid->volid << 16)) % context->m_worker_count;
+  if (context->m_open_tasks[worker_index] == NULL)
+    {
+      context->m_open_tasks[worker_index] = new log_rv_redo_task (*context);
+    }
+
+  data = context->m_open_tasks[worker_index]->add_job (job, job.undo_length + redo_length);
+  if (job.undo_length > 0)
+    {
+      memcpy (data, undo_diff_ptr->log_data, job.undo_length);
+    }
+  logpb_copy_from_log (thread_p, data + job.undo_length, redo_length, log_lsa, log_page_p);
+
+  if (context->m_open_tasks[worker_index]->is_full ())
+    {
+      log_rv_redo_parallel_push_task (context, worker_index);
+    }
+}
+
+/*
+ * log_rv_redo_update_stats () - update redo statistics at the end of recovery redo phase
+ *
+ * return                : void
+ * thread_p (in)         : thread entry
+ * num_redo_records (in) : number of redo records applied
+ * start_time (in)       : start time of redo phase
+ */
+// *INDENT-OFF*
+static void
+log_rv_redo_update_stats (THREAD_ENTRY * thread_p, UINT64 num_redo_records,
+                          std::chrono::steady_clock::time_point start_time)
+{
+  std::chrono::milliseconds elapsed =
+    std::chrono::duration_cast<std::chrono::milliseconds> (std::chrono::steady_clock::now () - start_time);
+  UINT64 records_per_sec = num_redo_records * 1000 / (elapsed.count () > 0 ? elapsed.count () : 1);
+
+  perfmon_add_stat (thread_p, PSTAT_LOG_NUM_REDO_RECORDS, num_redo_records);
+  perfmon_set_stat (thread_p, PSTAT_LOG_REDO_RECORDS_PER_SEC, (int) MIN (records_per_sec, INT_MAX), false);
+
+  er_log_debug (ARG_FILE_LINE, "log_recovery_redo: applied %llu redo records in %lld ms (%llu records/sec).\n",
+		(unsigned long long) num_redo_records, (long long) elapsed.count (),
+		(unsigned long long) records_per_sec);
+}
+// *INDENT-ON*
+
+// *INDENT-OFF*
+log_rv_redo_context::log_rv_redo_context ()
+  : m_workpool (NULL)
+  , m_worker_count (0)
+  , m_open_tasks ()
+  , m_tasks_pushed (0)
+  , m_tasks_executed (0)
+  , m_mutex ()
+  , m_task_executed_cond ()
+  , m_records_applied {0}
+{
+}
+
+void
+log_rv_redo_context::on_create (context_type &context)
+{
+  context.claim_system_worker ();
+}
+
+void
+log_rv_redo_context::on_retire (context_type &context)
+{
+  context.retire_system_worker ();
+}
+
+void
+log_rv_redo_context::on_recycle (context_type &context)
+{
+  context.tran_index = LOG_SYSTEM_TRAN_INDEX;
+}
+
+log_rv_redo_task::log_rv_redo_task (log_rv_redo_context &context)
+  : m_context (context)
+  , m_jobs ()
+  , m_data ()
+{
+  m_jobs.reserve (LOG_RV_REDO_TASK_MAX_JOBS);
+}
+
+char *
+log_rv_redo_task::add_job (const log_rv_redo_job &job, std::size_t data_size)
+{
+  m_jobs.push_back (job);
+  m_jobs.back ().data_offset = m_data.size ();
+  m_data.resize (m_data.size () + data_size);
+
+  return m_data.data () + m_jobs.back ().data_offset;
+}
+
+bool
+log_rv_redo_task::is_full () const
+{
+  return m_jobs.size () >= LOG_RV_REDO_TASK_MAX_JOBS;
+}
+
+void
+log_rv_redo_task::execute (cubthread::entry &thread_ref)
+{
+  THREAD_ENTRY *thread_p = &thread_ref;
+  LOG_ZIP *redo_unzip_ptr = NULL;
+  std::uint64_t records_applied = 0;
+
+  for (log_rv_redo_job &job : m_jobs)
+    {
+      LOG_RCV rcv;
+      bool is_zip = false;
+      char *data = m_data.data () + job.data_offset;
+
+      rcv.pgptr = log_rv_redo_fix_page (thread_p, &job.vpid, job.rcvindex);
+      if (rcv.pgptr == NULL)
+	{
+	  /* deallocated */
+	  continue;
+	}
+      if (LSA_LE (&job.rcv_lsa, pgbuf_get_lsa (rcv.pgptr)))
+	{
+	  /* It is already done */
+	  pgbuf_unfix (thread_p, rcv.pgptr);
+	  continue;
+	}
+
+      rcv.mvcc_id = job.mvccid;
+      rcv.offset = job.offset;
+      rcv.length = job.length;
+      rcv.data = data + job.undo_length;
+      LSA_SET_NULL (&rcv.reference_lsa);
+
+      if (ZIP_CHECK (rcv.length))
+	{
+	  rcv.length = (int) GET_ZIP_LEN (rcv.length);
+	  is_zip = true;
+
+	  if (redo_unzip_ptr == NULL)
+	    {
+	      redo_unzip_ptr = log_zip_alloc (LOGAREA_SIZE, false);
+	      if (redo_unzip_ptr == NULL)
+		{
+		  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rv_redo_task::execute");
+		  pgbuf_unfix (thread_p, rcv.pgptr);
+		  break;
+		}
+	    }
+	}
+
+      log_rv_redo_record_apply (thread_p,
+				job.is_compensate ? RV_fun[job.rcvindex].undofun : RV_fun[job.rcvindex].redofun,
+				&rcv, &job.rcv_lsa, is_zip, job.undo_length, job.undo_length > 0 ? data : NULL,
+				redo_unzip_ptr);
+      pgbuf_unfix (thread_p, rcv.pgptr);
+      records_applied++;
+    }
+
+  if (redo_unzip_ptr != NULL)
+    {
+      log_zip_free (redo_unzip_ptr);
+    }
+
+  m_context.m_records_applied += records_applied;
+
+  std::unique_lock<std::mutex> ulock (m_context.m_mutex);
+  m_context.m_tasks_executed++;
+  m_context.m_task_executed_cond.notify_all ();
+}
+// *INDENT-ON*
+
 /*
  * log_recovery_redo - SCAN FORWARD REDOING DATA
  *
@@ -3072,6 +3549,12 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   LOG_ZIP *redo_unzip_ptr = NULL;
   bool is_diff_rec;
   bool is_mvcc_op = false;
+  bool is_dispatched;
+  log_rv_redo_context *redo_context = NULL;
+  UINT64 num_redo_records = 0;
+  // *INDENT-OFF*
+  std::chrono::steady_clock::time_point redo_start_time = std::chrono::steady_clock::now ();
+  // *INDENT-ON*
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
@@ -3113,6 +3596,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
       return;
     }
 
+  redo_context = log_rv_redo_parallel_start (thread_p);
+
   while (!LSA_ISNULL (&lsa))
     {
       /* Fetch the page where the LSA record to undo is located */
@@ -3285,8 +3770,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = undoredo->data.rcvindex;
+	      is_dispatched = log_rv_redo_parallel_prepare (redo_context, &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3395,6 +3881,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_dispatched)
+		{
+		  log_rv_redo_parallel_dispatch (thread_p, redo_context, &rcv, &rcv_vpid, rcvindex, false, &rcv_lsa,
+						 &log_lsa, log_pgptr, is_diff_rec ? undo_unzip_ptr : NULL);
+		  break;
+		}
+
+	      num_redo_records++;
 	      if (is_diff_rec)
 		{
 		  /* XOR Process */
@@ -3471,8 +3965,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = redo->data.rcvindex;
+	      is_dispatched = log_rv_redo_parallel_prepare (redo_context, &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3528,6 +4023,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_dispatched)
+		{
+		  log_rv_redo_parallel_dispatch (thread_p, redo_context, &rcv, &rcv_vpid, rcvindex, false, &rcv_lsa,
+						 &log_lsa, log_pgptr, NULL);
+		  break;
+		}
+
+	      num_redo_records++;
 	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				  redo_unzip_ptr);
 
@@ -3567,6 +4070,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      if (!log_recovery_needs_skip_logical_redo (thread_p, tran_id, log_rtype, rcvindex, &rcv_lsa))
 		{
+		  (void) log_rv_redo_parallel_prepare (redo_context, &rcv_vpid, rcvindex);
+		  num_redo_records++;
 		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				      NULL);
 		}
@@ -3593,8 +4098,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = run_posp->data.rcvindex;
+	      is_dispatched = log_rv_redo_parallel_prepare (redo_context, &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3651,6 +4157,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_dispatched)
+		{
+		  log_rv_redo_parallel_dispatch (thread_p, redo_context, &rcv, &rcv_vpid, rcvindex, false, &rcv_lsa,
+						 &log_lsa, log_pgptr, NULL);
+		  break;
+		}
+
+	      num_redo_records++;
 	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
 				  NULL);
 
@@ -3680,8 +4194,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = compensate->data.rcvindex;
+	      is_dispatched = log_rv_redo_parallel_prepare (redo_context, &rcv_vpid, rcvindex);
 	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3737,6 +4252,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
+	      if (is_dispatched)
+		{
+		  log_rv_redo_parallel_dispatch (thread_p, redo_context, &rcv, &rcv_vpid, rcvindex, true, &rcv_lsa,
+						 &log_lsa, log_pgptr, NULL);
+		  break;
+		}
+
+	      num_redo_records++;
 	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0, NULL,
 				  NULL);
 	      if (rcv.pgptr != NULL)
@@ -4034,6 +4557,12 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   log_zip_free (undo_unzip_ptr);
   log_zip_free (redo_unzip_ptr);
 
+  if (redo_context != NULL)
+    {
+      num_redo_records += log_rv_redo_parallel_finish (redo_context);
+      redo_context = NULL;
+    }
+
   log_Gl.mvcc_table.reset_start_mvccid ();
 
   /* Abort all atomic system operations that were open when server crashed */
@@ -4049,6 +4578,12 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   (void) pgbuf_flush_all (thread_p, NULL_VOLID);
 
 exit:
+  if (redo_context != NULL)
+    {
+      num_redo_records += log_rv_redo_parallel_finish (redo_context);
+    }
+  log_rv_redo_update_stats (thread_p, num_redo_records, redo_start_time);
+
   LSA_SET_NULL (&log_Gl.unique_stats_table.curr_rcv_rec_lsa);
 
   return;
@@ -647,6 +647,8 @@ mvcc_snapshot::mvcc_snapshot ()
   , m_active_mvccs ()
   , snapshot_fnc (NULL)
   , valid (false)
+  , trans_status_version (0)
+  , has_trans_status_version (false)
 {
 }
 
@@ -657,7 +659,11 @@ mvcc_snapshot::reset ()
   lowest_active_mvccid = MVCCID_NULL;
   highest_completed_mvccid = MVCCID_NULL;
 
-  m_active_mvccs.reset ();
+  if (!has_trans_status_version)
+    {
+      m_active_mvccs.reset ();
+    }
+  /* else keep the copy of transaction status for reuse */
 
   valid = false;
 }
@@ -672,6 +678,8 @@ mvcc_snapshot::copy_to (mvcc_snapshot & dest) const
   dest.highest_completed_mvccid = highest_completed_mvccid;
   dest.snapshot_fnc = snapshot_fnc;
   dest.valid = valid;
+  dest.trans_status_version = trans_status_version;
+  dest.has_trans_status_version = has_trans_status_version;
 }
 
 mvcc_info::mvcc_info ()
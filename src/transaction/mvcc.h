@@ -178,6 +178,12 @@ struct mvcc_snapshot
 
   bool valid;			/* true, if the snapshot is valid */
 
+  /* m_active_mvccs is an unchanged copy of the transaction status with this version; it is kept when the snapshot is
+   * reset, so that the next snapshot can reuse it if no transaction completed meanwhile; same type as
+   * mvcc_trans_status::version_type */
+  UINT64 trans_status_version;
+  bool has_trans_status_version;
+
   // *INDENT-OFF*
   mvcc_snapshot ();
   void reset ();
@@ -30,6 +30,7 @@
 #include "thread_manager.hpp"
 
 #include <cassert>
+#include <type_traits>
 
 // help debugging oldest active by following all changes
 struct oldest_active_event
@@ -112,6 +113,9 @@ oldest_active_get (const mvcctable::lowest_active_mvccid_type &lowest, int tran_
   return mvccid;
 }
 
+static_assert (std::is_same<decltype (mvcc_snapshot::trans_status_version), mvcc_trans_status::version_type>::value,
+	       "snapshot must keep the transaction status version with the type of the table");
+
 mvcc_trans_status::mvcc_trans_status ()
   : m_active_mvccs ()
   , m_last_completed_mvccid (MVCCID_NULL)
@@ -236,6 +240,9 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
   TSCTIMEVAL tv_diff;
   UINT64 snapshot_wait_time;
   UINT64 snapshot_retry_count = 0;
+  bool is_snapshot_reused = false;
+
+  mvcc_snapshot &snapshot = tdes.mvccinfo.snapshot;
 
   assert (tdes.tran_index >= 0 && tdes.tran_index < logtb_get_number_of_total_tran_indices ());
 
@@ -245,7 +252,7 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
     }
 
   // make sure snapshot has allocated data
-  tdes.mvccinfo.snapshot.m_active_mvccs.initialize ();
+  snapshot.m_active_mvccs.initialize ();
 
   tx_lowest_active = oldest_active_get (m_transaction_lowest_visible_mvccids[tdes.tran_index], tdes.tran_index,
 					oldest_active_event::BUILD_MVCC_INFO);
@@ -296,8 +303,22 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       const mvcc_trans_status &trans_status = m_trans_status_history[index];
 
       trans_status_version = trans_status.m_version.load ();
-      trans_status.m_active_mvccs.copy_to (tdes.mvccinfo.snapshot.m_active_mvccs,
-					   mvcc_active_tran::copy_safety::THREAD_UNSAFE);
+      if (snapshot.has_trans_status_version && snapshot.trans_status_version > trans_status_version)
+	{
+	  // the version went back (counter wrapped or table was reinitialized); the cached copy may have been taken
+	  // from a status that reuses the same version and must not be trusted anymore
+	  snapshot.has_trans_status_version = false;
+	  snapshot.m_active_mvccs.reset_active_transactions ();
+	}
+      if (snapshot.has_trans_status_version && snapshot.trans_status_version == trans_status_version)
+	{
+	  // no transaction completed since the active transactions were copied from this status; reuse them
+	  is_snapshot_reused = true;
+	  break;
+	}
+
+      snapshot.has_trans_status_version = false;
+      trans_status.m_active_mvccs.copy_to (snapshot.m_active_mvccs, mvcc_active_tran::copy_safety::THREAD_UNSAFE);
       /* load statistics temporary disabled need to be enabled when activate count optimization */
 #if 0
       /* load global statistics. This must take place here and nowhere else. */
@@ -311,30 +332,32 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       if (trans_status_version == trans_status.m_version.load ())
 	{
 	  // no version change; copying status was successful
+	  snapshot.trans_status_version = trans_status_version;
+	  snapshot.has_trans_status_version = true;
 	  break;
 	}
       else
 	{
 	  // a failed copy may break data validity; to make sure next copy is not affected, it is better to reset
 	  // bit area.
-	  tdes.mvccinfo.snapshot.m_active_mvccs.reset_active_transactions ();
+	  snapshot.m_active_mvccs.reset_active_transactions ();
 	}
     }
 
-  // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
-  tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
+  // snapshot.m_active_mvccs was not checked because it was not safe; now it is
+  snapshot.m_active_mvccs.check_valid ();
 
-  highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
+  highest_completed_mvccid = snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
   MVCCID_FORWARD (highest_completed_mvccid);
 
   /* update lowest active mvccid computed for the most recent snapshot */
   tdes.mvccinfo.recent_snapshot_lowest_active_mvccid = crt_status_lowest_active;
 
   /* update remaining snapshot data */
-  tdes.mvccinfo.snapshot.snapshot_fnc = mvcc_satisfies_snapshot;
-  tdes.mvccinfo.snapshot.lowest_active_mvccid = crt_status_lowest_active;
-  tdes.mvccinfo.snapshot.highest_completed_mvccid = highest_completed_mvccid;
-  tdes.mvccinfo.snapshot.valid = true;
+  snapshot.snapshot_fnc = mvcc_satisfies_snapshot;
+  snapshot.lowest_active_mvccid = crt_status_lowest_active;
+  snapshot.highest_completed_mvccid = highest_completed_mvccid;
+  snapshot.valid = true;
 
   if (is_perf_tracking)
     {
@@ -350,6 +373,10 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
 	  perfmon_add_stat (thread_get_thread_entry_info (), PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS,
 			    snapshot_retry_count - 1);
 	}
+      if (is_snapshot_reused)
+	{
+	  perfmon_inc_stat (thread_get_thread_entry_info (), PSTAT_LOG_SNAPSHOT_REUSE_COUNTERS);
+	}
     }
 }
 
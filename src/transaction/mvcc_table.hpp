@@ -40,7 +40,7 @@ struct mvcc_info;
 
 struct mvcc_trans_status
 {
-  using version_type = unsigned int;
+  using version_type = UINT64;
 
   enum event_type
   {
@@ -0,0 +1,292 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "db_json.hpp"
+#include "dbtype_def.h"
+#include "error_code.h"
+#include "memory_alloc.h"
+#include "object_representation.h"
+#include "thread_manager.hpp"
+
+#include <iostream>
+
+#include <cassert>
+#include <cstring>
+
+static void test_round_trip (void);
+static void test_path_navigation (void);
+static void test_path_navigation_legacy (void);
+
+int
+main (int, char **)
+{
+  THREAD_ENTRY *thread_p = NULL;
+
+  cubthread::initialize (thread_p);
+
+  test_round_trip ();
+  test_path_navigation ();
+  test_path_navigation_legacy ();
+
+  std::cout << "test successful" << std::endl;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// helpers
+//////////////////////////////////////////////////////////////////////////
+
+static const char *json_docs[] =
+{
+  "null",
+  "true",
+  "-5",
+  "4294967295",
+  "9223372036854775807",
+  "3.25",
+  "\"string\"",
+  "[]",
+  "{}",
+  "[1, \"two\", 3.5, false, null]",
+  "{\"a\": 1, \"b\": \"x\", \"c\": null}",
+  "{\"a\": {\"b\": [10, {\"c\": [true, {\"d\": \"deep\"}]}, 30]}, \"e\": [[], {}], \"f\": {\"\": \"empty key\"}}",
+  "[{\"k\": [0, 1, 2]}, [[\"nested\"]], {\"k\": \"v\", \"k2\": {\"k3\": -1}}]",
+};
+
+static JSON_DOC *
+make_doc (const char *json_raw)
+{
+  JSON_DOC *doc = NULL;
+  int error_code = db_json_get_json_from_str (json_raw, doc, std::strlen (json_raw));
+
+  assert (error_code == NO_ERROR);
+  assert (doc != NULL);
+  return doc;
+}
+
+static bool
+is_same_json (const JSON_DOC *doc1, const JSON_DOC *doc2)
+{
+  char *raw1 = db_json_get_raw_json_body_from_document (doc1);
+  char *raw2 = db_json_get_raw_json_body_from_document (doc2);
+  bool is_same = std::strcmp (raw1, raw2) == 0;
+
+  db_private_free (NULL, raw1);
+  db_private_free (NULL, raw2);
+  return is_same && db_json_are_docs_equal (doc1, doc2);
+}
+
+static bool
+is_json_null (const JSON_DOC *doc)
+{
+  return doc == NULL || db_json_get_type (doc) == DB_JSON_NULL;
+}
+
+// serialize doc into buffer; caller frees buffer with delete []
+static char *
+serialize_doc (const JSON_DOC *doc, OR_BUF &buf)
+{
+  std::size_t length = db_json_serialize_length (*doc);
+  char *data = new char[length];
+
+  OR_BUF_INIT2 (buf, data, (int) length);
+  int error_code = db_json_serialize (*doc, buf);
+  assert (error_code == NO_ERROR);
+  assert (buf.ptr == buf.endptr);
+
+  OR_BUF_INIT2 (buf, data, (int) length);
+  return data;
+}
+
+// check value at path of serialized json is the same as the one extracted from the document
+static void
+check_path (const JSON_DOC *doc, OR_BUF &buf, const char *path)
+{
+  JSON_DOC_STORE expected;
+  JSON_DOC *extracted = NULL;
+  char *start = buf.ptr;
+  int error_code;
+
+  error_code = db_json_extract_document_from_path (doc, std::string (path), expected, false);
+  assert (error_code == NO_ERROR);
+
+  error_code = db_json_deserialize_path (&buf, path, extracted);
+  assert (error_code == NO_ERROR);
+  buf.ptr = start;
+
+  if (is_json_null (expected.get_immutable ()))
+    {
+      assert (is_json_null (extracted));
+    }
+  else
+    {
+      assert (extracted != NULL);
+      assert (is_same_json (expected.get_immutable (), extracted));
+    }
+
+  if (extracted != NULL)
+    {
+      db_json_delete_doc (extracted);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// test_round_trip
+//////////////////////////////////////////////////////////////////////////
+
+static void
+test_round_trip (void)
+{
+  for (const char *json_raw : json_docs)
+    {
+      JSON_DOC *doc = make_doc (json_raw);
+      JSON_DOC *read_doc = NULL;
+      OR_BUF buf;
+      char *data = serialize_doc (doc, buf);
+
+      int error_code = db_json_deserialize (&buf, read_doc);
+      assert (error_code == NO_ERROR);
+      assert (buf.ptr == buf.endptr);
+      assert (is_same_json (doc, read_doc));
+
+      db_json_delete_doc (read_doc);
+      db_json_delete_doc (doc);
+      delete [] data;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// test_path_navigation
+//////////////////////////////////////////////////////////////////////////
+
+static void
+test_path_navigation (void)
+{
+  static const char *paths[] =
+  {
+    "$",
+    "$.a",
+    "$.b",
+    "$.c",
+    "$.missing",
+    "$.a.b",
+    "$.a.b[0]",
+    "$.a.b[1].c[1].d",
+    "$.a.b[2]",
+    "$.a.b[3]",
+    "$.a.b[1].c[5]",
+    "$.e[0]",
+    "$.e[1]",
+    "$.f.\"\"",
+    "$[0]",
+    "$[0].k[2]",
+    "$[1][0][0]",
+    "$[2].k2.k3",
+    "$[2].k4",
+    "$[3]",
+    "$[0].a",
+    "$.a[0]",
+  };
+
+  for (const char *json_raw : json_docs)
+    {
+      JSON_DOC *doc = make_doc (json_raw);
+      OR_BUF buf;
+      char *data = serialize_doc (doc, buf);
+
+      for (const char *path : paths)
+	{
+	  check_path (doc, buf, path);
+	}
+
+      db_json_delete_doc (doc);
+      delete [] data;
+    }
+
+  // wildcards are not allowed
+  {
+    JSON_DOC *doc = make_doc ("{\"a\": [1, 2]}");
+    JSON_DOC *extracted = NULL;
+    OR_BUF buf;
+    char *data = serialize_doc (doc, buf);
+
+    int error_code = db_json_deserialize_path (&buf, "$.a[*]", extracted);
+    assert (error_code == ER_JSON_INVALID_PATH);
+    assert (extracted == NULL);
+
+    db_json_delete_doc (doc);
+    delete [] data;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// test_path_navigation_legacy
+//////////////////////////////////////////////////////////////////////////
+
+static void
+test_path_navigation_legacy (void)
+{
+  // {"a": 1, "b": [true, "x"], "c": {"d": 2}} serialized without offset tables
+  char data[512];
+  OR_BUF buf;
+
+  OR_BUF_INIT2 (buf, data, (int) sizeof (data));
+  or_put_int (&buf, DB_JSON_OBJECT);
+  or_put_int (&buf, 3);
+
+  or_put_string_aligned_with_length (&buf, "a");
+  or_put_int (&buf, DB_JSON_INT);
+  or_put_int (&buf, 0);
+  or_put_int (&buf, 1);
+
+  or_put_string_aligned_with_length (&buf, "b");
+  or_put_int (&buf, DB_JSON_ARRAY);
+  or_put_int (&buf, 2);
+  or_put_int (&buf, DB_JSON_BOOL);
+  or_put_int (&buf, 1);
+  or_put_int (&buf, DB_JSON_STRING);
+  or_put_string_aligned_with_length (&buf, "x");
+
+  or_put_string_aligned_with_length (&buf, "c");
+  or_put_int (&buf, DB_JSON_OBJECT);
+  or_put_int (&buf, 1);
+  or_put_string_aligned_with_length (&buf, "d");
+  or_put_int (&buf, DB_JSON_INT);
+  or_put_int (&buf, 0);
+  or_put_int (&buf, 2);
+
+  OR_BUF_INIT2 (buf, data, (int) (buf.ptr - data));
+
+  JSON_DOC *doc = make_doc ("{\"a\": 1, \"b\": [true, \"x\"], \"c\": {\"d\": 2}}");
+  JSON_DOC *read_doc = NULL;
+
+  int error_code = db_json_deserialize (&buf, read_doc);
+  assert (error_code == NO_ERROR);
+  assert (is_same_json (doc, read_doc));
+  db_json_delete_doc (read_doc);
+  buf.ptr = buf.buffer;
+
+  check_path (doc, buf, "$.a");
+  check_path (doc, buf, "$.b[1]");
+  check_path (doc, buf, "$.b[2]");
+  check_path (doc, buf, "$.c");
+  check_path (doc, buf, "$.c.d");
+  check_path (doc, buf, "$.d");
+
+  db_json_delete_doc (doc);
+}
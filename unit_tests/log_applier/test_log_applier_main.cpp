@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+#include "dbtype.h"
+#include "error_code.h"
+#include "log_applier_dispatch.h"
+
+#include <iostream>
+#include <random>
+
+#include <cassert>
+
+static void test_slots (void);
+static void test_same_key_same_worker (void);
+static void test_global_slot (void);
+static void test_checkpoint_order (void);
+static void test_checkpoint_random (void);
+
+int
+main (int, char **)
+{
+  test_slots ();
+  test_same_key_same_worker ();
+  test_global_slot ();
+  test_checkpoint_order ();
+  test_checkpoint_random ();
+
+  std::cout << "test successful" << std::endl;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// helpers
+//////////////////////////////////////////////////////////////////////////
+
+static const int NUM_WORKERS = 4;
+
+static int
+key_slot (const char *class_name, int key)
+{
+  DB_VALUE pk;
+
+  db_make_int (&pk, key);
+  return la_dispatch_get_slot (class_name, LA_DISPATCH_ORDER_BY_KEY, &pk);
+}
+
+// choose a worker for the transaction and send it; returns the worker
+static int
+send_tran (LA_DISPATCH &dispatch, const int *tran_slots, int num_tran_slots, INT64 &seq)
+{
+  int worker = -1;
+  bool chosen = la_dispatch_choose_worker (&dispatch, tran_slots, num_tran_slots, &worker);
+
+  assert (chosen);
+  assert (worker >= 0 && worker < dispatch.num_workers);
+
+  seq = ++dispatch.next_seq;
+  la_dispatch_set_sent (&dispatch, worker, seq, tran_slots, num_tran_slots);
+  return worker;
+}
+
+static void
+add_tran (LA_DISPATCH &dispatch, int worker, INT64 seq, int commit_pageid)
+{
+  LA_DISPATCHED_TRAN tran;
+
+  tran.seq = seq;
+  tran.worker = worker;
+  LSA_SET_NULL (&tran.start_lsa);
+  tran.commit_lsa.pageid = commit_pageid;
+  tran.commit_lsa.offset = 0;
+  LSA_SET_NULL (&tran.rep_lsa);
+  tran.log_record_time = 0;
+
+  la_dispatch_add_tran (&dispatch, &tran);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// slots
+//////////////////////////////////////////////////////////////////////////
+
+static void
+test_slots (void)
+{
+  DB_VALUE pk1, pk2;
+  int slot;
+
+  db_make_int (&pk1, 1);
+  db_make_int (&pk2, 2);
+
+  // the same row always maps to the same slot
+  assert (key_slot ("t", 1) == key_slot ("t", 1));
+  assert (key_slot ("t", 1) >= 0 && key_slot ("t", 1) < LA_WORKER_KEY_SLOTS);
+
+  // all the rows of a class ordered by class share its slot
+  slot = la_dispatch_get_slot ("t", LA_DISPATCH_ORDER_BY_CLASS, &pk1);
+  assert (slot == la_dispatch_get_slot ("t", LA_DISPATCH_ORDER_BY_CLASS, &pk2));
+  assert (slot == la_dispatch_get_slot ("t", LA_DISPATCH_ORDER_BY_CLASS, NULL));
+  assert (slot >= 0 && slot < LA_WORKER_KEY_SLOTS);
+
+  // classes with foreign keys or partitions share one slot
+  assert (la_dispatch_get_slot ("t", LA_DISPATCH_ORDER_GLOBAL, &pk1) == LA_WORKER_GLOBAL_SLOT);
+  assert (la_dispatch_get_slot ("u", LA_DISPATCH_ORDER_GLOBAL, &pk2) == LA_WORKER_GLOBAL_SLOT);
+  assert (la_dispatch_get_slot ("u", LA_DISPATCH_ORDER_GLOBAL, NULL) == LA_WORKER_GLOBAL_SLOT);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// worker choice
+//////////////////////////////////////////////////////////////////////////
+
+static void
+test_same_key_same_worker (void)
+{
+  LA_DISPATCH dispatch;
+  int slot_a, slot_b, both[2];
+  int worker_a, worker_b, worker;
+  INT64 seq_a1, seq_a2, seq_b, seq;
+  int error;
+
+  error = la_dispatch_init (&dispatch, NUM_WORKERS);
+  assert (error == NO_ERROR);
+
+  slot_a = key_slot ("t", 1);
+  slot_b = (slot_a + 1) % LA_WORKER_KEY_SLOTS;
+
+  // a row being applied keeps going to the same worker
+  worker_a = send_tran (dispatch, &slot_a, 1, seq_a1);
+  assert (send_tran (dispatch, &slot_a, 1, seq_a2) == worker_a);
+
+  // another row goes to a less busy worker
+  worker_b = send_tran (dispatch, &slot_b, 1, seq_b);
+  assert (worker_b != worker_a);
+
+  // a transaction changing rows being applied by two workers must wait for them
+  both[0] = slot_a;
+  both[1] = slot_b;
+  assert (!la_dispatch_choose_worker (&dispatch, both, 2, &worker));
+
+  // committing the first request only is not enough
+  la_dispatch_set_committed (&dispatch, worker_a, seq_a1);
+  assert (!la_dispatch_choose_worker (&dispatch, both, 2, &worker));
+
+  // once one worker has committed its rows, it follows the other one
+  la_dispatch_set_committed (&dispatch, worker_a, seq_a2);
+  assert (la_dispatch_choose_worker (&dispatch, both, 2, &worker));
+  assert (worker == worker_b);
+
+  // once both have committed, it goes to an idle worker
+  la_dispatch_set_committed (&dispatch, worker_b, seq_b);
+  worker = send_tran (dispatch, both, 2, seq);
+  assert (dispatch.last_sent_seq[worker] == seq);
+
+  // and the rows follow it
+  assert (send_tran (dispatch, &slot_a, 1, seq) == worker);
+  assert (send_tran (dispatch, &slot_b, 1, seq) == worker);
+
+  // replies are cumulative; an older one does not move back
+  la_dispatch_set_committed (&dispatch, worker, seq);
+  la_dispatch_set_committed (&dispatch, worker, seq - 1);
+  assert (dispatch.committed_seq[worker] == seq);
+
+  la_dispatch_final (&dispatch);
+}
+
+static void
+test_global_slot (void)
+{
+  LA_DISPATCH dispatch;
+  int global_slot = LA_WORKER_GLOBAL_SLOT;
+  int slot_a, slots[2];
+  int worker_g, worker_a, worker;
+  INT64 seq_g, seq_a, seq;
+  int error;
+
+  error = la_dispatch_init (&dispatch, NUM_WORKERS);
+  assert (error == NO_ERROR);
+
+  // transactions on different classes ordered globally go to the same worker
+  worker_g = send_tran (dispatch, &global_slot, 1, seq_g);
+  assert (send_tran (dispatch, &global_slot, 1, seq) == worker_g);
+  assert (send_tran (dispatch, &global_slot, 1, seq) == worker_g);
+
+  // a row of another class is not ordered with them
+  slot_a = key_slot ("t", 1);
+  worker_a = send_tran (dispatch, &slot_a, 1, seq_a);
+  assert (worker_a != worker_g);
+
+  // nor is a transaction changing both, until one of them has committed
+  slots[0] = slot_a;
+  slots[1] = global_slot;
+  assert (!la_dispatch_choose_worker (&dispatch, slots, 2, &worker));
+
+  la_dispatch_set_committed (&dispatch, worker_a, seq_a);
+  assert (send_tran (dispatch, slots, 2, seq) == worker_g);
+
+  la_dispatch_final (&dispatch);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// checkpoint
+//////////////////////////////////////////////////////////////////////////
+
+static void
+test_checkpoint_order (void)
+{
+  LA_DISPATCH dispatch;
+  LA_DISPATCHED_TRAN tran;
+  int error;
+
+  error = la_dispatch_init (&dispatch, NUM_WORKERS);
+  assert (error == NO_ERROR);
+
+  assert (!la_dispatch_next_committed_tran (&dispatch, &tran));
+
+  // in the commit order of the master
+  add_tran (dispatch, 0, 1, 10);
+  add_tran (dispatch, 1, 2, 11);
+  add_tran (dispatch, -1, 0, 12);	// nothing sent to a worker
+  add_tran (dispatch, 0, 3, 13);
+
+  // a later transaction committed by another worker does not pass an uncommitted one
+  la_dispatch_set_committed (&dispatch, 1, 2);
+  assert (!la_dispatch_next_committed_tran (&dispatch, &tran));
+  assert (dispatch.num_pending == 4);
+
+  la_dispatch_set_committed (&dispatch, 0, 1);
+  assert (la_dispatch_next_committed_tran (&dispatch, &tran) && tran.commit_lsa.pageid == 10);
+  assert (la_dispatch_next_committed_tran (&dispatch, &tran) && tran.commit_lsa.pageid == 11);
+  assert (la_dispatch_next_committed_tran (&dispatch, &tran) && tran.commit_lsa.pageid == 12);
+  assert (!la_dispatch_next_committed_tran (&dispatch, &tran));
+  assert (dispatch.num_pending == 1);
+
+  la_dispatch_set_committed (&dispatch, 0, 3);
+  assert (la_dispatch_next_committed_tran (&dispatch, &tran) && tran.commit_lsa.pageid == 13);
+  assert (!la_dispatch_next_committed_tran (&dispatch, &tran));
+  assert (dispatch.num_pending == 0);
+
+  // cleared after a reconnection
+  add_tran (dispatch, 2, 4, 14);
+  la_dispatch_clear (&dispatch);
+  assert (!la_dispatch_next_committed_tran (&dispatch, &tran));
+
+  la_dispatch_final (&dispatch);
+}
+
+static void
+test_checkpoint_random (void)
+{
+  const int NUM_TRANS = 3 * LA_WORKER_MAX_PENDING_TRANS;
+  LA_DISPATCH dispatch;
+  LA_DISPATCHED_TRAN tran;
+  std::mt19937 gen (12345);
+  std::uniform_int_distribution<int> dist (0, 99);
+  INT64 sent_seq[LA_MAX_APPLY_WORKERS] = { 0 };
+  int next_tran = 0, last_passed = -1;
+  int worker, slot;
+  INT64 seq;
+  int error;
+
+  error = la_dispatch_init (&dispatch, NUM_WORKERS);
+  assert (error == NO_ERROR);
+
+  while (last_passed < NUM_TRANS - 1)
+    {
+      if (next_tran < NUM_TRANS && dist (gen) < 60 && dispatch.num_pending < LA_WORKER_MAX_PENDING_TRANS)
+	{
+	  // send a transaction on a random row, or apply it in the applier
+	  if (dist (gen) < 10)
+	    {
+	      add_tran (dispatch, -1, 0, next_tran);
+	    }
+	  else
+	    {
+	      slot = dist (gen);
+	      worker = send_tran (dispatch, &slot, 1, seq);
+	      sent_seq[worker] = seq;
+	      add_tran (dispatch, worker, seq, next_tran);
+	    }
+	  next_tran++;
+	}
+      else
+	{
+	  // a random worker commits part of what it was sent
+	  worker = dist (gen) % NUM_WORKERS;
+	  if (sent_seq[worker] > dispatch.committed_seq[worker])
+	    {
+	      seq = sent_seq[worker] - dispatch.committed_seq[worker];
+	      seq = dispatch.committed_seq[worker] + 1 + dist (gen) % seq;
+	      la_dispatch_set_committed (&dispatch, worker, seq);
+	    }
+	}
+
+      while (la_dispatch_next_committed_tran (&dispatch, &tran))
+	{
+	  // in order, and only what its worker has committed
+	  assert (tran.commit_lsa.pageid == last_passed + 1);
+	  assert (tran.worker < 0 || dispatch.committed_seq[tran.worker] >= tran.seq);
+	  last_passed = (int) tran.commit_lsa.pageid;
+	}
+
+      // the checkpoint stops at the first transaction not committed yet
+      if (dispatch.num_pending > 0)
+	{
+	  tran = dispatch.pending[dispatch.pending_head];
+	  assert (tran.worker >= 0 && dispatch.committed_seq[tran.worker] < tran.seq);
+	}
+
+      if (next_tran == NUM_TRANS)
+	{
+	  // let the workers finish
+	  for (worker = 0; worker < NUM_WORKERS; worker++)
+	    {
+	      if (dist (gen) < 50)
+		{
+		  la_dispatch_set_committed (&dispatch, worker, sent_seq[worker]);
+		}
+	    }
+	}
+    }
+
+  assert (dispatch.num_pending == 0);
+
+  la_dispatch_final (&dispatch);
+}
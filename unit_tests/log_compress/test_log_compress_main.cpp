@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2008 Search Solution Corporation. All rights reserved by Search Solution.
+ *
+ *   This program is free software; you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation; either version 2 of the License, or
+ *   (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ *
+ */
+
+/*
+ * Benchmark of log compression methods.
+ *
+ * usage: test_log_compress [-s record_size] [file ...]
+ *
+ * Given files (e.g. log archive volumes) are cut into chunks of record_size bytes that stand in for log record data.
+ * Each chunk is compressed with every method and, in dictionary mode, using the previous chunk as dictionary (like redo
+ * data compressed against undo data). Every chunk is decompressed and checked. Without files, generated record-like
+ * data is used.
+ */
+
+#include "log_compress.h"
+
+#include <ctime>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+struct bench_result
+{
+  std::size_t org_size;
+  std::size_t zip_size;
+  std::size_t record_count;
+  std::size_t zipped_count;
+  std::clock_t zip_time;
+  std::clock_t unzip_time;
+};
+
+static bool read_file (const char *path, std::vector<char> &data);
+static void generate_records (std::size_t record_size, std::size_t count, std::vector<char> &data);
+static bool bench_method (LOG_ZIP_METHOD method, bool use_dict, const std::vector<char> &data,
+			  std::size_t record_size, bench_result &result);
+static void print_result (const char *name, const bench_result &result);
+
+int
+main (int argc, char **argv)
+{
+  std::size_t record_size = 200;
+  std::vector<char> data;
+  int i;
+
+  for (i = 1; i < argc; i++)
+    {
+      if (std::strcmp (argv[i], "-s") == 0 && i + 1 < argc)
+	{
+	  record_size = (std::size_t) std::atoi (argv[++i]);
+	}
+      else if (!read_file (argv[i], data))
+	{
+	  std::cerr << "cannot read " << argv[i] << std::endl;
+	  return 1;
+	}
+    }
+
+  if (record_size == 0)
+    {
+      std::cerr << "invalid record size" << std::endl;
+      return 1;
+    }
+  if (data.empty ())
+    {
+      generate_records (record_size, 10000, data);
+    }
+
+  if (lzo_init () != LZO_E_OK)
+    {
+      std::cerr << "lzo_init failed" << std::endl;
+      return 1;
+    }
+
+  std::cout << "data size: " << data.size () << ", record size: " << record_size << std::endl;
+  std::cout << std::left << std::setw (20) << "method" << std::right << std::setw (10) << "ratio" << std::setw (10)
+	    << "zipped%" << std::setw (12) << "zip(ms)" << std::setw (12) << "unzip(ms)" << std::endl;
+
+  for (int m = LOG_ZIP_METHOD_LZO1X_1; m <= LOG_ZIP_METHOD_LAST; m++)
+    {
+      LOG_ZIP_METHOD method = (LOG_ZIP_METHOD) m;
+
+      for (int use_dict = 0; use_dict < 2; use_dict++)
+	{
+	  bench_result result;
+	  std::string name = log_zip_method_name (method);
+
+	  if (use_dict)
+	    {
+	      name += "+dict";
+	    }
+	  if (!bench_method (method, use_dict != 0, data, record_size, result))
+	    {
+	      std::cerr << name << ": compression round trip failed" << std::endl;
+	      return 1;
+	    }
+	  print_result (name.c_str (), result);
+	}
+    }
+
+  std::cout << "test successful" << std::endl;
+  return 0;
+}
+
+static bool
+read_file (const char *path, std::vector<char> &data)
+{
+  std::ifstream in (path, std::ios::binary);
+  if (!in)
+    {
+      return false;
+    }
+  data.insert (data.end (), std::istreambuf_iterator<char> (in), std::istreambuf_iterator<char> ());
+  return true;
+}
+
+/*
+ * generate_records () - generate heap record like data: consecutive records share most of their content, like undo and
+ *                       redo images of an update
+ */
+static void
+generate_records (std::size_t record_size, std::size_t count, std::vector<char> &data)
+{
+  std::vector<char> record (record_size);
+  std::size_t i, j;
+
+  std::srand (1);
+  for (j = 0; j < record_size; j++)
+    {
+      record[j] = (j % 8 < 4) ? (char) (std::rand () % 4) : (char) ('a' + std::rand () % 26);
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      /* change a few fields */
+      for (j = 0; j < 4; j++)
+	{
+	  record[std::rand () % record_size] = (char) std::rand ();
+	}
+      data.insert (data.end (), record.begin (), record.end ());
+    }
+}
+
+static bool
+bench_method (LOG_ZIP_METHOD method, bool use_dict, const std::vector<char> &data, std::size_t record_size,
+	      bench_result &result)
+{
+  LOG_ZIP *zip = log_zip_alloc ((LOG_ZIP_SIZE_T) record_size, true);
+  LOG_ZIP *unzip = log_zip_alloc ((LOG_ZIP_SIZE_T) record_size, false);
+  std::vector<char> zipped;
+  const char *dict = NULL;
+  std::size_t offset;
+  std::clock_t start;
+  bool success = false;
+
+  std::memset (&result, 0, sizeof (result));
+
+  if (zip == NULL || unzip == NULL || !log_zip_set_method (zip, method))
+    {
+      goto end;
+    }
+
+  for (offset = 0; offset + record_size <= data.size (); offset += record_size)
+    {
+      const char *record = &data[offset];
+      LOG_ZIP_SIZE_T length = (LOG_ZIP_SIZE_T) record_size;
+      bool is_zipped;
+
+      start = std::clock ();
+      if (use_dict && dict != NULL)
+	{
+	  is_zipped = log_zip_with_dict (zip, length, record, length, dict);
+	}
+      else
+	{
+	  is_zipped = log_zip (zip, length, record);
+	}
+      result.zip_time += std::clock () - start;
+
+      result.org_size += record_size;
+      result.record_count++;
+      if (!is_zipped)
+	{
+	  /* stored uncompressed */
+	  result.zip_size += record_size;
+	  dict = record;
+	  continue;
+	}
+      result.zip_size += zip->data_length;
+      result.zipped_count++;
+
+      zipped.assign ((char *) zip->log_data, (char *) zip->log_data + zip->data_length);
+
+      start = std::clock ();
+      if (!log_unzip_with_dict (unzip, (LOG_ZIP_SIZE_T) zipped.size (), &zipped[0], length, dict))
+	{
+	  goto end;
+	}
+      result.unzip_time += std::clock () - start;
+
+      if (unzip->data_length != length || std::memcmp (unzip->log_data, record, record_size) != 0)
+	{
+	  goto end;
+	}
+      dict = record;
+    }
+  success = true;
+
+end:
+  if (zip != NULL)
+    {
+      log_zip_free (zip);
+    }
+  if (unzip != NULL)
+    {
+      log_zip_free (unzip);
+    }
+  return success;
+}
+
+static void
+print_result (const char *name, const bench_result &result)
+{
+  double ratio = result.zip_size > 0 ? (double) result.org_size / (double) result.zip_size : 0;
+  double zipped_pct = result.record_count > 0 ? (double) result.zipped_count * 100 / (double) result.record_count : 0;
+
+  std::cout << std::left << std::setw (20) << name << std::right << std::fixed << std::setprecision (2)
+	    << std::setw (10) << ratio << std::setw (10) << zipped_pct << std::setw (12)
+	    << (double) result.zip_time * 1000 / CLOCKS_PER_SEC << std::setw (12)
+	    << (double) result.unzip_time * 1000 / CLOCKS_PER_SEC << std::endl;
+}
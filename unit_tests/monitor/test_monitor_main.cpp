@@ -506,10 +506,65 @@ test_counter_timer_max (void)
   assert (statsp[3] == 4);    // average of 4 microseconds
 }
 
+static void
+test_time_histogram_task (cubmonitor::time_histogram_statistic &hist)
+{
+  for (int i = 0; i < 1000; i++)
+    {
+      hist.collect (cubmonitor::time_rep (i));
+    }
+}
+
+void
+test_time_histogram (void)
+{
+  using namespace cubmonitor;
+
+  time_histogram_statistic my_stat;
+  monitor my_monitor;
+
+  // register
+  my_stat.register_to_monitor (my_monitor, "myhist");
+  assert (my_monitor.get_statistics_count () == 6);
+
+  // allocate statistics
+  statistic_value *statsp = my_monitor.allocate_statistics_buffer ();
+
+  for (int i = 0; i < 90; i++)
+    {
+      my_stat.collect (time_rep (1000));
+    }
+  for (int i = 0; i < 9; i++)
+    {
+      my_stat.collect (time_rep (100000));
+    }
+  my_stat.collect (time_rep (5000000));
+
+  // get statistics; percentiles are upper bounds of buckets
+  my_monitor.fetch_global_statistics (statsp);
+  assert (statsp[0] == 100);    // count
+  assert (statsp[1] == 1);      // p50 - 1023 nanoseconds
+  assert (statsp[2] == 1);      // p90 - 1023 nanoseconds
+  assert (statsp[3] == 106);    // p99 - 106495 nanoseconds
+  assert (statsp[4] == 5000);   // p999 - bucket upper bound is over max
+  assert (statsp[5] == 5000);   // max 5 milliseconds
+
+  // every value is counted when collected concurrently
+  time_histogram_statistic mt_stat;
+  const std::size_t THREAD_COUNT = 20;
+
+  execute_multi_thread (THREAD_COUNT, test_time_histogram_task, std::ref (mt_stat));
+  assert (mt_stat.get_count () == THREAD_COUNT * 1000);
+  assert (mt_stat.get_max_time () == time_rep (999));
+
+  delete [] statsp;
+}
+
 void
 test_collect (void)
 {
   test_counter_timer_max ();
+  test_time_histogram ();
 }
 
 //////////////////////////////////////////////////////////////////////////
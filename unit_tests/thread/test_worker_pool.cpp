@@ -31,6 +31,7 @@
 #include <atomic>
 #include <chrono>
 #include <iostream>
+#include <vector>
 
 namespace test_thread
 {
@@ -106,6 +107,25 @@ namespace test_thread
   };
   std::atomic<size_t> inc_work::m_count = { 0 };
 
+  class short_sleep_work : public cubthread::task<test_context>
+  {
+    public:
+      short_sleep_work (std::atomic<size_t> &done_count)
+	: m_done_count (done_count)
+      {
+      }
+
+      void execute (context_type &context)
+      {
+	(void) context;  // suppress unused parameter
+	std::this_thread::sleep_for (std::chrono::microseconds (200));
+	++m_done_count;
+      }
+
+    private:
+      std::atomic<size_t> &m_done_count;
+  };
+
   int
   test_one_thread_pool (void)
   {
@@ -159,12 +179,61 @@ namespace test_thread
     return 0;
   }
 
+  int
+  test_skewed_cores (bool work_stealing)
+  {
+    // all tasks are pushed on the same core; without work stealing, the workers of other cores stay idle
+    const std::size_t CORE_COUNT = 4;
+    const std::size_t WORKERS_PER_CORE = 2;
+    const std::size_t TASK_COUNT = 4000;
+
+    test_context_manager ctx_mgr;
+    std::atomic<size_t> done_count = { 0 };
+    test_worker_pool_type workpool (CORE_COUNT * WORKERS_PER_CORE, TASK_COUNT, ctx_mgr, NULL, CORE_COUNT, false,
+				    false, std::chrono::seconds (5), work_stealing);
+
+    auto start_time = std::chrono::high_resolution_clock::now ();
+    for (std::size_t i = 0; i < TASK_COUNT; i++)
+      {
+	workpool.execute_on_core (new short_sleep_work (done_count), 0);
+      }
+    while (done_count < TASK_COUNT)
+      {
+	std::this_thread::sleep_for (std::chrono::milliseconds (1));
+      }
+    auto end_time = std::chrono::high_resolution_clock::now ();
+
+    std::vector<cubperf::stat_value> stats (cubthread::wp_worker_statset_get_count (), 0);
+    workpool.get_stats (stats.data ());
+
+    // counter and timer values are interleaved; timers are in microseconds
+    cubperf::stat_value steal_count = stats[2 * cubthread::Wpstat_steal_task];
+    cubperf::stat_value queue_wait_count = stats[2 * cubthread::Wpstat_queue_wait];
+    cubperf::stat_value queue_wait_time = stats[2 * cubthread::Wpstat_queue_wait + 1];
+
+    std::cout << "  skewed cores, work stealing " << (work_stealing ? "on" : "off") << " - duration "
+	      << std::chrono::duration<double> (end_time - start_time).count () << ", steals " << steal_count
+	      << ", avg queue wait (us) " << (queue_wait_count > 0 ? queue_wait_time / queue_wait_count : 0)
+	      << std::endl;
+
+    workpool.stop_execution ();
+
+    if (!work_stealing && steal_count != 0)
+      {
+	std::cout << "  unexpected steals without work stealing" << std::endl;
+	return 1;
+      }
+    return 0;
+  }
+
   int
   test_worker_pool (void)
   {
     test_one_thread_pool ();
     test_two_threads_pool ();
     test_stress ();
+    test_skewed_cores (false);
+    test_skewed_cores (true);
     return 0;
   }
 